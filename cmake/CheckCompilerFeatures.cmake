@@ -99,6 +99,17 @@ LOG ( "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++" )
     SET( CF_HAVE_ALLOC_MMAP 1 CACHE BOOL "MemoryAllocator_MMAP can be built")
   ENDIF()
 
+  LOG ( "+++++  Checking for transparent huge pages support" )
+  CHECK_CXX_SOURCE_COMPILES (
+  " #include <sys/mman.h>
+    #include <sys/syscall.h>
+    int main (int argc, char* argv[]) { return madvise (0, 0, MADV_HUGEPAGE) + SYS_mbind; }
+  "
+  CF_HAVE_MADV_HUGEPAGE )
+  IF(CF_HAVE_ALLOC_MMAP AND CF_HAVE_MADV_HUGEPAGE)
+    SET( CF_HAVE_ALLOC_HUGEPAGE 1 CACHE BOOL "MemoryAllocator_HugePage can be built")
+  ENDIF()
+
 #######################################################################################
 
   LOG ( "+++++  Checking for vsnprintf function" ) # check memory mmap functions
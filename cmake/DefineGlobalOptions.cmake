@@ -77,6 +77,8 @@ OPTION ( CF_ENABLE_STDASSERT          "Enable standard assert() functions "  ON
 OPTION ( CF_ENABLE_PARALLEL_VERBOSE   "Enable extra output in the parallel interface" OFF  )
 OPTION ( CF_ENABLE_PARALLEL_DEBUG     "Enable debug code on the parallel interface"  OFF  )
 
+OPTION ( CF_ENABLE_ALLOCATION_TRACKER "Replace the global operator new/delete to track the heap allocations" OFF )
+
 OPTION ( CF_CMAKE_LIST_PLUGINS             "CMake lists the plugins"                 OFF  )
 
 SET    ( CF_TESTCASES_NCPUS "2" CACHE STRING "Number of CPUs to ue in parallel run" )
@@ -0,0 +1,265 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <cmath>
+
+#include "Common/CFLog.hh"
+
+#include "BlockLSS/BlockGMRES.hh"
+#include "BlockLSS/BlockLSSHalo.hh"
+#include "BlockLSS/BlockLSSMatrix.hh"
+#include "BlockLSS/BlockPreconditioner.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockGMRES::BlockGMRES() :
+  m_size(0),
+  m_nbKrylov(0),
+  m_flexible(false),
+  m_nbThreads(1),
+  m_v(),
+  m_z(),
+  m_w(),
+  m_t(),
+  m_ghost(),
+  m_h(),
+  m_coeffs(),
+  m_cs(),
+  m_sn(),
+  m_g()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockGMRES::~BlockGMRES()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockGMRES::setup(const CFuint size, const CFuint nbGhosts,
+                       const CFuint nbKrylov, const bool flexible)
+{
+  cf_assert(nbKrylov > 0);
+
+  m_size = size;
+  m_nbKrylov = nbKrylov;
+  m_flexible = flexible;
+
+  m_v.resize((nbKrylov + 1)*size);
+  m_z.resize(flexible ? nbKrylov*size : 0);
+  m_w.resize(size);
+  m_t.resize(size);
+  m_ghost.resize(nbGhosts);
+  m_h.resize((nbKrylov + 1)*nbKrylov);
+  m_coeffs.resize(nbKrylov + 1);
+  m_cs.resize(nbKrylov);
+  m_sn.resize(nbKrylov);
+  m_g.resize(nbKrylov + 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockGMRES::unsetup()
+{
+  vector<CFreal>().swap(m_v);
+  vector<CFreal>().swap(m_z);
+  vector<CFreal>().swap(m_w);
+  vector<CFreal>().swap(m_t);
+  vector<CFreal>().swap(m_ghost);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockGMRES::mult(const BlockLSSMatrix& mat, BlockLSSHalo& halo,
+                      const CFreal *const x, CFreal *const y)
+{
+  CFreal *const ghost = (m_ghost.size() > 0) ? &m_ghost[0] : CFNULL;
+  halo.exchange(x, ghost);
+  mat.mult(x, ghost, y);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint BlockGMRES::solve(const BlockLSSMatrix& mat, BlockLSSHalo& halo,
+                         BlockPreconditioner& pc, const CFreal *const b,
+                         CFreal *const x, const CFuint maxIter,
+                         const CFreal rTol, const CFreal aTol, CFreal& resNorm)
+{
+  const int size = m_size;
+  m_nbThreads = mat.getNbThreads();
+#ifdef CF_HAVE_OMP
+  const int nbThreads = m_nbThreads;
+#endif
+
+  CFreal *const w = &m_w[0];
+  CFreal *const t = &m_t[0];
+
+  for (int i = 0; i < size; ++i) {
+    x[i] = 0.;
+  }
+
+  // with x = 0 the initial residual is b
+  CFreal *const v0 = getV(0);
+  for (int i = 0; i < size; ++i) {
+    v0[i] = b[i];
+  }
+  CFreal beta = std::sqrt(halo.dot(v0, v0, size));
+  const CFreal target = std::max(rTol*beta, aTol);
+  resNorm = beta;
+
+  CFuint iter = 0;
+  while (resNorm > target && iter < maxIter) {
+    if (beta <= 0.) break;
+
+    for (int i = 0; i < size; ++i) {
+      v0[i] /= beta;
+    }
+    m_g.assign(m_nbKrylov + 1, 0.);
+    m_g[0] = beta;
+
+    CFuint j = 0;
+    for (; j < m_nbKrylov && resNorm > target && iter < maxIter; ++j, ++iter) {
+      // w = A*inv(M)*v_j
+      CFreal *const z = m_flexible ? getZ(j) : t;
+      pc.apply(getV(j), z);
+      mult(mat, halo, z, w);
+
+      // two passes of classical Gram-Schmidt
+      for (CFuint k = 0; k <= j; ++k) {
+        h(k,j) = 0.;
+      }
+      for (CFuint pass = 0; pass < 2; ++pass) {
+        for (CFuint k = 0; k <= j; ++k) {
+          const CFreal *const vk = getV(k);
+          CFreal sum = 0.;
+#ifdef CF_HAVE_OMP
+#pragma omp parallel for schedule(static) num_threads(nbThreads) reduction(+:sum)
+#endif
+          for (int i = 0; i < size; ++i) {
+            sum += vk[i]*w[i];
+          }
+          m_coeffs[k] = sum;
+        }
+        halo.sum(&m_coeffs[0], j+1);
+
+        for (CFuint k = 0; k <= j; ++k) {
+          const CFreal *const vk = getV(k);
+          const CFreal coeff = m_coeffs[k];
+#ifdef CF_HAVE_OMP
+#pragma omp parallel for schedule(static) num_threads(nbThreads)
+#endif
+          for (int i = 0; i < size; ++i) {
+            w[i] -= coeff*vk[i];
+          }
+          h(k,j) += coeff;
+        }
+      }
+
+      const CFreal hNext = std::sqrt(halo.dot(w, w, size));
+      h(j+1,j) = hNext;
+      CFreal *const vNext = getV(j+1);
+      if (hNext > 0.) {
+        for (int i = 0; i < size; ++i) {
+          vNext[i] = w[i]/hNext;
+        }
+      }
+
+      // apply the previous rotations to the new column, then eliminate h(j+1,j)
+      for (CFuint k = 0; k < j; ++k) {
+        const CFreal hk = h(k,j);
+        h(k,j)   =  m_cs[k]*hk + m_sn[k]*h(k+1,j);
+        h(k+1,j) = -m_sn[k]*hk + m_cs[k]*h(k+1,j);
+      }
+      const CFreal denom = std::sqrt(h(j,j)*h(j,j) + hNext*hNext);
+      m_cs[j] = (denom > 0.) ? h(j,j)/denom : 1.;
+      m_sn[j] = (denom > 0.) ? hNext/denom : 0.;
+      h(j,j) = denom;
+      h(j+1,j) = 0.;
+      m_g[j+1] = -m_sn[j]*m_g[j];
+      m_g[j]   =  m_cs[j]*m_g[j];
+      resNorm = std::abs(m_g[j+1]);
+
+      CFLog(DEBUG_MIN, "BlockGMRES::solve() => iter " << iter+1 << ", residual " << resNorm << "\n");
+
+      // happy breakdown
+      if (hNext <= 0.) {
+        ++j;
+        ++iter;
+        break;
+      }
+    }
+
+    // solve the triangular least squares problem
+    for (CFuint k = j; k > 0; --k) {
+      const CFuint row = k - 1;
+      CFreal sum = m_g[row];
+      for (CFuint l = k; l < j; ++l) {
+        sum -= h(row,l)*m_coeffs[l];
+      }
+      m_coeffs[row] = sum/h(row,row);
+    }
+
+    // x += inv(M)*V*y
+    if (m_flexible) {
+      for (CFuint k = 0; k < j; ++k) {
+        const CFreal *const zk = getZ(k);
+        const CFreal yk = m_coeffs[k];
+        for (int i = 0; i < size; ++i) {
+          x[i] += yk*zk[i];
+        }
+      }
+    }
+    else {
+      for (int i = 0; i < size; ++i) {
+        w[i] = 0.;
+      }
+      for (CFuint k = 0; k < j; ++k) {
+        const CFreal *const vk = getV(k);
+        const CFreal yk = m_coeffs[k];
+        for (int i = 0; i < size; ++i) {
+          w[i] += yk*vk[i];
+        }
+      }
+      pc.apply(w, t);
+      for (int i = 0; i < size; ++i) {
+        x[i] += t[i];
+      }
+    }
+
+    // true residual for the restart
+    if (resNorm > target && iter < maxIter) {
+      mult(mat, halo, x, w);
+      for (int i = 0; i < size; ++i) {
+        v0[i] = b[i] - w[i];
+      }
+      beta = std::sqrt(halo.dot(v0, v0, size));
+      resNorm = beta;
+    }
+  }
+
+  return iter;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,129 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockGMRES_hh
+#define COOLFluiD_BlockLSS_BlockGMRES_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Common/NonCopyable.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+    class BlockLSSHalo;
+    class BlockLSSMatrix;
+    class BlockPreconditioner;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a restarted GMRES solver with right preconditioning.
+/// The flexible variant (FGMRES) stores the preconditioned Krylov vectors, so
+/// that the preconditioner may change from one iteration to the next.
+/// The Krylov vectors are orthogonalized with two passes of classical
+/// Gram-Schmidt, whose dot products are reduced over the processes at once.
+class BlockGMRES : public Common::NonCopyable<BlockGMRES> {
+public:
+
+  /// Constructor
+  BlockGMRES();
+
+  /// Destructor
+  ~BlockGMRES();
+
+  /// Allocate the Krylov space
+  /// @param size        number of local entries of the vectors
+  /// @param nbGhosts    number of ghost entries of the vectors
+  /// @param nbKrylov    number of Krylov vectors before restarting
+  /// @param flexible    use the flexible variant
+  void setup(const CFuint size, const CFuint nbGhosts,
+             const CFuint nbKrylov, const bool flexible);
+
+  /// Release the Krylov space
+  void unsetup();
+
+  /// Solve mat*x = b, starting from x = 0 (collective)
+  /// @param maxIter  maximum number of iterations
+  /// @param rTol     tolerance on the residual norm relative to the initial one
+  /// @param aTol     tolerance on the residual norm
+  /// @param resNorm  final residual norm
+  /// @return the number of iterations
+  CFuint solve(const BlockLSSMatrix& mat, BlockLSSHalo& halo,
+               BlockPreconditioner& pc, const CFreal *const b, CFreal *const x,
+               const CFuint maxIter, const CFreal rTol, const CFreal aTol,
+               CFreal& resNorm);
+
+private: // helper functions
+
+  /// y = mat*x, exchanging the ghost entries of x first
+  void mult(const BlockLSSMatrix& mat, BlockLSSHalo& halo,
+            const CFreal *const x, CFreal *const y);
+
+  /// @return the i-th Krylov vector
+  CFreal* getV(const CFuint i) {return &m_v[i*m_size];}
+
+  /// @return the i-th preconditioned Krylov vector
+  CFreal* getZ(const CFuint i) {return &m_z[i*m_size];}
+
+  /// @return the entry (i,j) of the Hessenberg matrix
+  CFreal& h(const CFuint i, const CFuint j) {return m_h[j*(m_nbKrylov+1) + i];}
+
+private: // data
+
+  /// number of local entries
+  CFuint m_size;
+
+  /// number of Krylov vectors before restarting
+  CFuint m_nbKrylov;
+
+  /// flag telling if the preconditioned vectors are stored
+  bool m_flexible;
+
+  /// number of threads
+  CFuint m_nbThreads;
+
+  /// Krylov vectors
+  std::vector<CFreal> m_v;
+
+  /// preconditioned Krylov vectors (flexible variant)
+  std::vector<CFreal> m_z;
+
+  /// work vectors
+  std::vector<CFreal> m_w;
+  std::vector<CFreal> m_t;
+
+  /// ghost entries of the vector multiplied by the matrix
+  std::vector<CFreal> m_ghost;
+
+  /// Hessenberg matrix, stored column by column
+  std::vector<CFreal> m_h;
+
+  /// Gram-Schmidt coefficients
+  std::vector<CFreal> m_coeffs;
+
+  /// Givens rotations
+  std::vector<CFreal> m_cs;
+  std::vector<CFreal> m_sn;
+
+  /// rotated right hand side of the least squares problem
+  std::vector<CFreal> m_g;
+
+}; // end of class BlockGMRES
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_BlockLSS_BlockGMRES_hh
@@ -0,0 +1,255 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <memory>
+
+#include "Framework/MethodStrategyProvider.hh"
+#include "MathTools/MatrixInverter.hh"
+#include "MathTools/RealMatrix.hh"
+#include "MathTools/BlockKernelsT.hh"
+
+#include "BlockLSS/BlockILUPreconditioner.hh"
+#include "BlockLSS/BlockLSSData.hh"
+#include "BlockLSS/BlockLSSMatrix.hh"
+#include "BlockLSS/BlockLSSModule.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::MathTools;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodStrategyProvider<BlockILUPreconditioner,
+                       BlockLSSData,
+                       BlockPreconditioner,
+                       BlockLSSModule>
+blockILUPreconditionerProvider("ILU");
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockILUPreconditioner::BlockILUPreconditioner(const std::string& name) :
+  BlockPreconditioner(name),
+  m_bs(0),
+  m_rowStart(),
+  m_cols(),
+  m_diag(),
+  m_matPos(),
+  m_values(),
+  m_work()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockILUPreconditioner::~BlockILUPreconditioner()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockILUPreconditioner::setPattern(const BlockLSSMatrix& mat)
+{
+  m_bs = mat.getBlockSize();
+  const CFuint nbRows = mat.getNbBlockRows();
+
+  // only the couplings between updatable states are kept
+  m_rowStart.assign(1, 0);
+  m_rowStart.reserve(nbRows + 1);
+  m_cols.clear();
+  m_matPos.clear();
+  m_diag.resize(nbRows);
+  for (CFuint i = 0; i < nbRows; ++i) {
+    for (CFuint k = mat.getRowStart(i); k < mat.getLocalRowEnd(i); ++k) {
+      if (k == mat.getDiagPos(i)) {
+        m_diag[i] = m_cols.size();
+      }
+      m_cols.push_back(mat.getBlockCol(k));
+      m_matPos.push_back(k);
+    }
+    m_rowStart.push_back(m_cols.size());
+  }
+
+  m_values.resize(m_cols.size()*m_bs*m_bs);
+  m_work.resize(2*m_bs*m_bs);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockILUPreconditioner::compute(const BlockLSSMatrix& mat)
+{
+  if (m_rowStart.size() != mat.getNbBlockRows() + 1 || m_bs != mat.getBlockSize()) {
+    setPattern(mat);
+  }
+
+  const CFuint n2 = m_bs*m_bs;
+  for (CFuint kk = 0; kk < m_cols.size(); ++kk) {
+    const CFreal *const a = mat.getBlock(m_matPos[kk]);
+    CFreal *const b = getBlock(kk);
+    for (CFuint m = 0; m < n2; ++m) {
+      b[m] = a[m];
+    }
+  }
+
+  // the block operations are specialized for the common numbers of
+  // equations, as in the FiniteVolume Roe flux
+  switch(m_bs) {
+  case(4):
+    factorize<4>(); break;
+  case(5):
+    factorize<5>(); break;
+  case(6):
+    factorize<6>(); break;
+  case(7):
+    factorize<7>(); break;
+  case(8):
+    factorize<8>(); break;
+  case(9):
+    factorize<9>(); break;
+  case(10):
+    factorize<10>(); break;
+  default:
+    factorize<0>();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+template <unsigned int N>
+void BlockILUPreconditioner::factorize()
+{
+  const CFuint n = m_bs;
+  const CFuint n2 = n*n;
+  const CFuint nbRows = m_rowStart.size() - 1;
+
+  auto_ptr<MatrixInverter> inverter(MatrixInverter::create(n, false));
+  RealMatrix diagBlock(n, n);
+  RealMatrix invDiagBlock(n, n);
+  CFreal *const work = &m_work[0];
+
+  for (CFuint i = 0; i < nbRows; ++i) {
+    const CFuint rowEnd = m_rowStart[i+1];
+
+    for (CFuint kk = m_rowStart[i]; kk < m_diag[i]; ++kk) {
+      const CFuint k = m_cols[kk];
+
+      // L_ik = A_ik*inv(D_k), the diagonal blocks being stored inverted
+      CFreal *const lik = getBlock(kk);
+      BlockKernelsT<N>::multBlocks(lik, getBlock(m_diag[k]), work, n);
+      for (CFuint m = 0; m < n2; ++m) {
+        lik[m] = work[m];
+      }
+
+      // A_ij -= L_ik*U_kj for the blocks j > k present in both rows
+      CFuint jj = kk + 1;
+      CFuint pp = m_diag[k] + 1;
+      const CFuint kEnd = m_rowStart[k+1];
+      while (jj < rowEnd && pp < kEnd) {
+        if (m_cols[jj] < m_cols[pp]) {
+          ++jj;
+        }
+        else if (m_cols[jj] > m_cols[pp]) {
+          ++pp;
+        }
+        else {
+          BlockKernelsT<N>::multSubBlocks(lik, getBlock(pp), getBlock(jj), n);
+          ++jj;
+          ++pp;
+        }
+      }
+    }
+
+    CFreal *const dii = getBlock(m_diag[i]);
+    for (CFuint ib = 0; ib < n; ++ib) {
+      for (CFuint jb = 0; jb < n; ++jb) {
+        diagBlock(ib,jb) = dii[ib*n + jb];
+      }
+    }
+    inverter->invert(diagBlock, invDiagBlock);
+    for (CFuint ib = 0; ib < n; ++ib) {
+      for (CFuint jb = 0; jb < n; ++jb) {
+        dii[ib*n + jb] = invDiagBlock(ib,jb);
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockILUPreconditioner::apply(const CFreal *const x, CFreal *const y)
+{
+  // the block operations are specialized for the common numbers of
+  // equations, as in the FiniteVolume Roe flux
+  switch(m_bs) {
+  case(4):
+    applyT<4>(x, y); break;
+  case(5):
+    applyT<5>(x, y); break;
+  case(6):
+    applyT<6>(x, y); break;
+  case(7):
+    applyT<7>(x, y); break;
+  case(8):
+    applyT<8>(x, y); break;
+  case(9):
+    applyT<9>(x, y); break;
+  case(10):
+    applyT<10>(x, y); break;
+  default:
+    applyT<0>(x, y);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+template <unsigned int N>
+void BlockILUPreconditioner::applyT(const CFreal *const x, CFreal *const y)
+{
+  const CFuint n = m_bs;
+  const CFuint nbRows = m_rowStart.size() - 1;
+  CFreal *const work = &m_work[0];
+
+  // forward substitution with the unit lower factor
+  for (CFuint i = 0; i < nbRows; ++i) {
+    CFreal *const yi = y + i*n;
+    for (CFuint d = 0; d < n; ++d) {
+      yi[d] = x[i*n + d];
+    }
+    for (CFuint kk = m_rowStart[i]; kk < m_diag[i]; ++kk) {
+      BlockKernelsT<N>::multSub(getBlock(kk), y + m_cols[kk]*n, yi, n);
+    }
+  }
+
+  // backward substitution with the upper factor
+  for (CFuint i = nbRows; i > 0; --i) {
+    const CFuint row = i - 1;
+    CFreal *const yi = y + row*n;
+    for (CFuint kk = m_diag[row] + 1; kk < m_rowStart[row+1]; ++kk) {
+      BlockKernelsT<N>::multSub(getBlock(kk), y + m_cols[kk]*n, yi, n);
+    }
+
+    // y_i = inv(D_i)*y_i
+    for (CFuint d = 0; d < n; ++d) {
+      work[d] = yi[d];
+    }
+    BlockKernelsT<N>::mult(getBlock(m_diag[row]), work, yi, n);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
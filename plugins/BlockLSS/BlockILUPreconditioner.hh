@@ -0,0 +1,91 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockILUPreconditioner_hh
+#define COOLFluiD_BlockLSS_BlockILUPreconditioner_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "BlockLSS/BlockPreconditioner.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a block ILU(0) preconditioner of the couplings
+/// between the updatable states. The diagonal blocks of the factors are
+/// stored inverted.
+/// The factorization and the triangular solves are sequential: the threaded
+/// alternative is the multi-colour Gauss-Seidel preconditioner.
+class BlockILUPreconditioner : public BlockPreconditioner {
+public:
+
+  /// Constructor
+  BlockILUPreconditioner(const std::string& name);
+
+  /// Destructor
+  ~BlockILUPreconditioner();
+
+  /// Factorize the given matrix
+  void compute(const BlockLSSMatrix& mat);
+
+  /// Apply the preconditioner: solve L*U*y = x
+  void apply(const CFreal *const x, CFreal *const y);
+
+private: // helper functions
+
+  /// Copy the local pattern of the given matrix
+  void setPattern(const BlockLSSMatrix& mat);
+
+  /// Factorize the copied blocks with the block kernels for blocks of size N
+  template <unsigned int N>
+  void factorize();
+
+  /// Apply the preconditioner with the block kernels for blocks of size N
+  template <unsigned int N>
+  void applyT(const CFreal *const x, CFreal *const y);
+
+  /// @return the storage of the given block
+  CFreal* getBlock(const CFuint k) {return &m_values[k*m_bs*m_bs];}
+
+private: // data
+
+  /// size of the blocks
+  CFuint m_bs;
+
+  /// start of each block row in m_cols
+  std::vector<CFuint> m_rowStart;
+
+  /// block columns
+  std::vector<CFuint> m_cols;
+
+  /// position of the diagonal block of each row
+  std::vector<CFuint> m_diag;
+
+  /// position in the matrix of each block
+  std::vector<CFuint> m_matPos;
+
+  /// blocks of the factors
+  std::vector<CFreal> m_values;
+
+  /// work arrays of the size of a block
+  std::vector<CFreal> m_work;
+
+}; // end of class BlockILUPreconditioner
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_BlockLSS_BlockILUPreconditioner_hh
@@ -0,0 +1,113 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Framework/MethodStrategyProvider.hh"
+#include "MathTools/BlockKernelsT.hh"
+
+#include "BlockLSS/BlockJacobiPreconditioner.hh"
+#include "BlockLSS/BlockLSSData.hh"
+#include "BlockLSS/BlockLSSMatrix.hh"
+#include "BlockLSS/BlockLSSModule.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::MathTools;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodStrategyProvider<BlockJacobiPreconditioner,
+                       BlockLSSData,
+                       BlockPreconditioner,
+                       BlockLSSModule>
+blockJacobiPreconditionerProvider("BJacobi");
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockJacobiPreconditioner::BlockJacobiPreconditioner(const std::string& name) :
+  BlockPreconditioner(name),
+  m_bs(0),
+  m_nbThreads(1),
+  m_invDiag()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockJacobiPreconditioner::~BlockJacobiPreconditioner()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockJacobiPreconditioner::compute(const BlockLSSMatrix& mat)
+{
+  m_bs = mat.getBlockSize();
+  m_nbThreads = mat.getNbThreads();
+  invertDiagonalBlocks(mat, m_invDiag);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockJacobiPreconditioner::apply(const CFreal *const x, CFreal *const y)
+{
+  // the block operations are specialized for the common numbers of
+  // equations, as in the FiniteVolume Roe flux
+  switch(m_bs) {
+  case(4):
+    applyT<4>(x, y); break;
+  case(5):
+    applyT<5>(x, y); break;
+  case(6):
+    applyT<6>(x, y); break;
+  case(7):
+    applyT<7>(x, y); break;
+  case(8):
+    applyT<8>(x, y); break;
+  case(9):
+    applyT<9>(x, y); break;
+  case(10):
+    applyT<10>(x, y); break;
+  default:
+    applyT<0>(x, y);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+template <unsigned int N>
+void BlockJacobiPreconditioner::applyT(const CFreal *const x, CFreal *const y) const
+{
+  const CFuint bs = m_bs;
+  const CFuint bs2 = bs*bs;
+  const int nbRows = m_invDiag.size()/bs2;
+  if (nbRows == 0) return;
+
+  const CFreal *const invDiag = &m_invDiag[0];
+
+#ifdef CF_HAVE_OMP
+  const int nbThreads = m_nbThreads;
+#pragma omp parallel for schedule(static) num_threads(nbThreads)
+#endif
+  for (int i = 0; i < nbRows; ++i) {
+    BlockKernelsT<N>::mult(invDiag + i*bs2, x + i*bs, y + i*bs, bs);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,66 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockJacobiPreconditioner_hh
+#define COOLFluiD_BlockLSS_BlockJacobiPreconditioner_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "BlockLSS/BlockPreconditioner.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a point block Jacobi preconditioner: each block row
+/// is multiplied by the inverse of its diagonal block.
+class BlockJacobiPreconditioner : public BlockPreconditioner {
+public:
+
+  /// Constructor
+  BlockJacobiPreconditioner(const std::string& name);
+
+  /// Destructor
+  ~BlockJacobiPreconditioner();
+
+  /// Invert the diagonal blocks of the given matrix
+  void compute(const BlockLSSMatrix& mat);
+
+  /// Apply the preconditioner: y = inv(D)*x
+  void apply(const CFreal *const x, CFreal *const y);
+
+private: // helper functions
+
+  /// Apply the preconditioner with the block kernels for blocks of size N
+  template <unsigned int N>
+  void applyT(const CFreal *const x, CFreal *const y) const;
+
+private: // data
+
+  /// size of the blocks
+  CFuint m_bs;
+
+  /// number of threads
+  CFuint m_nbThreads;
+
+  /// inverted diagonal blocks
+  std::vector<CFreal> m_invDiag;
+
+}; // end of class BlockJacobiPreconditioner
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_BlockLSS_BlockJacobiPreconditioner_hh
@@ -0,0 +1,136 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/BadValueException.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/MethodStrategyProvider.hh"
+
+#include "BlockLSS/BlockLSSData.hh"
+#include "BlockLSS/BlockLSSModule.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<NullMethodCommand<BlockLSSData>, BlockLSSData, BlockLSSModule>
+nullBlockLSSComProvider("Null");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSData::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< std::string >("KSPType","Krylov solver type (GMRES or FGMRES).");
+  options.addConfigOption< std::string >("Preconditioner","Preconditioner (BJacobi, MCBGS or ILU).");
+  options.addConfigOption< CFuint >("NbKrylovSpaces","Number of Krylov spaces.");
+  options.addConfigOption< CFreal >("RelativeTolerance","Relative tolerance for control of iterative solver convergence.");
+  options.addConfigOption< CFreal >("AbsoluteTolerance","Absolute tolerance for control of iterative solver convergence.");
+  options.addConfigOption< CFuint >("NbThreadsOMP","Number of OpenMP threads of the matrix-vector products and of the preconditioners.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSSData::BlockLSSData(SafePtr<std::valarray<bool> > maskArray,
+                           CFuint& nbSysEquations,
+                           SafePtr<Method> owner) :
+  LSSData(maskArray, nbSysEquations, owner),
+  m_mat(),
+  m_sol(),
+  m_rhs(),
+  m_halo(),
+  m_gmres(),
+  m_preconditioner()
+{
+  addConfigOptionsTo(this);
+
+  m_kspTypeStr = "GMRES";
+  setParameter("KSPType",&m_kspTypeStr);
+
+  m_preconditionerStr = "BJacobi";
+  setParameter("Preconditioner",&m_preconditionerStr);
+
+  m_nbKsp = 30;
+  setParameter("NbKrylovSpaces",&m_nbKsp);
+
+  m_rTol = 1e-4;
+  setParameter("RelativeTolerance",&m_rTol);
+
+  m_aTol = 1e-30;
+  setParameter("AbsoluteTolerance",&m_aTol);
+
+  m_nbThreads = 1;
+  setParameter("NbThreadsOMP",&m_nbThreads);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSSData::~BlockLSSData()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSData::configure(Config::ConfigArgs& args)
+{
+  LSSData::configure(args);
+
+  if (m_kspTypeStr != "GMRES" && m_kspTypeStr != "FGMRES") {
+    throw BadValueException
+      (FromHere(), "BlockLSSData::configure() => unknown KSPType " + m_kspTypeStr);
+  }
+  if (m_nbKsp == 0) {
+    throw BadValueException
+      (FromHere(), "BlockLSSData::configure() => NbKrylovSpaces must be > 0");
+  }
+
+  CFLog(VERBOSE, "BlockLSS KSPType = " << m_kspTypeStr << "\n");
+  CFLog(VERBOSE, "BlockLSS Preconditioner = " << m_preconditionerStr << "\n");
+  CFLog(VERBOSE, "BlockLSS Nb KSP spaces = " << m_nbKsp << "\n");
+  CFLog(VERBOSE, "BlockLSS MaxIter = " << getMaxIterations() << "\n");
+  CFLog(VERBOSE, "BlockLSS Relative Tolerance = " << m_rTol << "\n");
+  CFLog(VERBOSE, "BlockLSS Absolute Tolerance = " << m_aTol << "\n");
+
+  SharedPtr<BlockLSSData> thisPtr(this);
+
+  SafePtr<BaseMethodStrategyProvider<BlockLSSData,BlockPreconditioner> > prov =
+    FACTORY_GET_PROVIDER(getFactoryRegistry(), BlockPreconditioner, m_preconditionerStr);
+
+  cf_assert(prov.isNotNull());
+  m_preconditioner = prov->create(m_preconditionerStr,thisPtr);
+
+  configureNested ( m_preconditioner.getPtr(), args );
+  cf_assert(m_preconditioner.isNotNull());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSData::printToFile(const std::string& prefix, const std::string& suffix)
+{
+  const string matStr = prefix + "mat" + suffix;
+  const string rhsStr = prefix + "rhs" + suffix;
+  const string solStr = prefix + "sol" + suffix;
+
+  m_mat.printToFile(matStr.c_str());
+  m_rhs.printToFile(rhsStr.c_str());
+  m_sol.printToFile(solStr.c_str());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
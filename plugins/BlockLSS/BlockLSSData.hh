@@ -0,0 +1,147 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockLSSData_hh
+#define COOLFluiD_BlockLSS_BlockLSSData_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/LSSData.hh"
+#include "Framework/MethodCommand.hh"
+
+#include "BlockLSS/BlockGMRES.hh"
+#include "BlockLSS/BlockLSSHalo.hh"
+#include "BlockLSS/BlockLSSMatrix.hh"
+#include "BlockLSS/BlockLSSVector.hh"
+#include "BlockLSS/BlockPreconditioner.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This is a data object accessed by the BlockLSSCom's
+class BlockLSSData : public Framework::LSSData {
+public:
+
+  /// Defines the Config Option's of this class
+  /// @param options a OptionList where to add the Option's
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /// Constructor
+  BlockLSSData(Common::SafePtr<std::valarray<bool> > maskArray,
+               CFuint& nbSysEquations,
+               Common::SafePtr<Framework::Method> owner);
+
+  /// Destructor
+  ~BlockLSSData();
+
+  /// Configure the data from the supplied arguments
+  virtual void configure(Config::ConfigArgs& args);
+
+  /// Gets the Class name
+  static std::string getClassName() {return "BlockLSS";}
+
+  /// Get the matrix
+  BlockLSSMatrix& getMatrix() {return m_mat;}
+
+  /// Get the solution vector
+  BlockLSSVector& getSolVector() {return m_sol;}
+
+  /// Get the rhs vector
+  BlockLSSVector& getRhsVector() {return m_rhs;}
+
+  /// Get the exchange of the ghost entries
+  BlockLSSHalo& getHalo() {return m_halo;}
+
+  /// Get the Krylov solver
+  BlockGMRES& getKrylovSolver() {return m_gmres;}
+
+  /// Get the preconditioner
+  Common::SafePtr<BlockPreconditioner> getPreconditioner()
+  {
+    cf_assert(m_preconditioner.isNotNull());
+    return m_preconditioner.getPtr();
+  }
+
+  /// Tell if the flexible GMRES is used
+  bool isFlexible() const {return m_kspTypeStr == "FGMRES";}
+
+  /// Get the number of Krylov vectors before restarting
+  CFuint getNbKrylovSpaces() const {return m_nbKsp;}
+
+  /// Get the relative tolerance
+  CFreal getRelativeTolerance() const {return m_rTol;}
+
+  /// Get the absolute tolerance
+  CFreal getAbsoluteTolerance() const {return m_aTol;}
+
+  /// Get the number of threads
+  CFuint getNbThreads() const {return m_nbThreads;}
+
+  /// Prints the linear system to a file
+  void printToFile(const std::string& prefix, const std::string& suffix);
+
+private: // data
+
+  /// system matrix
+  BlockLSSMatrix m_mat;
+
+  /// solution vector
+  BlockLSSVector m_sol;
+
+  /// rhs vector
+  BlockLSSVector m_rhs;
+
+  /// exchange of the ghost entries
+  BlockLSSHalo m_halo;
+
+  /// Krylov solver
+  BlockGMRES m_gmres;
+
+  /// preconditioner
+  Common::SelfRegistPtr<BlockPreconditioner> m_preconditioner;
+
+  /// Krylov solver type
+  std::string m_kspTypeStr;
+
+  /// preconditioner type
+  std::string m_preconditionerStr;
+
+  /// number of Krylov vectors before restarting
+  CFuint m_nbKsp;
+
+  /// relative tolerance
+  CFreal m_rTol;
+
+  /// absolute tolerance
+  CFreal m_aTol;
+
+  /// number of threads
+  CFuint m_nbThreads;
+
+}; // end of class BlockLSSData
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Definition of a command for BlockLSS
+typedef Framework::MethodCommand<BlockLSSData> BlockLSSCom;
+
+/// Definition of a command provider for BlockLSS
+typedef Framework::MethodCommand<BlockLSSData>::PROVIDER BlockLSSComProvider;
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_BlockLSS_BlockLSSData_hh
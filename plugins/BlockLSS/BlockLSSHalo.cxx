@@ -0,0 +1,205 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/CFLog.hh"
+#ifdef CF_HAVE_MPI
+#  include "Common/MPI/MPIStructDef.hh"
+#  include "Common/MPI/MPIHelper.hh"
+#endif
+
+#include "BlockLSS/BlockLSSHalo.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// MPI tag of the ghost exchange
+static const int BLOCKLSS_HALO_TAG = 4711;
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSSHalo::BlockLSSHalo() :
+  m_comm(),
+  m_isParallel(false),
+  m_bs(0),
+  m_nbGhosts(0),
+  m_sendRanks(),
+  m_sendStart(1, 0),
+  m_sendIDs(),
+  m_recvRanks(),
+  m_recvStart(1, 0),
+  m_recvIDs(),
+  m_sendBuf(),
+  m_recvBuf()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSSHalo::~BlockLSSHalo()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSHalo::setup(MPI_Comm comm,
+                         const vector<vector<CFuint> >& sendList,
+                         const vector<vector<CFuint> >& recvList,
+                         const valarray<CFuint>& localToLSS,
+                         const CFuint nbLocal, const CFuint blockSize)
+{
+  CFAUTOTRACE;
+
+  unsetup();
+
+  m_comm = comm;
+  m_bs = blockSize;
+  m_nbGhosts = localToLSS.size() - nbLocal;
+
+#ifdef CF_HAVE_MPI
+  int nbProcs = 1;
+  MPI_Comm_size(comm, &nbProcs);
+  m_isParallel = (nbProcs > 1);
+#endif
+  if (!m_isParallel) return;
+
+  for (CFuint rank = 0; rank < sendList.size(); ++rank) {
+    if (sendList[rank].empty()) continue;
+    m_sendRanks.push_back(rank);
+    for (CFuint i = 0; i < sendList[rank].size(); ++i) {
+      const CFuint id = localToLSS[sendList[rank][i]];
+      cf_assert(id < nbLocal);
+      m_sendIDs.push_back(id);
+    }
+    m_sendStart.push_back(m_sendIDs.size());
+  }
+
+  for (CFuint rank = 0; rank < recvList.size(); ++rank) {
+    if (recvList[rank].empty()) continue;
+    m_recvRanks.push_back(rank);
+    for (CFuint i = 0; i < recvList[rank].size(); ++i) {
+      const CFuint id = localToLSS[recvList[rank][i]];
+      cf_assert(id >= nbLocal);
+      m_recvIDs.push_back(id - nbLocal);
+    }
+    m_recvStart.push_back(m_recvIDs.size());
+  }
+
+  m_sendBuf.resize(m_sendIDs.size()*m_bs);
+  m_recvBuf.resize(m_recvIDs.size()*m_bs);
+
+  CFLog(VERBOSE, "BlockLSSHalo::setup() => sending [" << m_sendIDs.size() << "] states to ["
+        << m_sendRanks.size() << "] processes, receiving [" << m_recvIDs.size()
+        << "] states from [" << m_recvRanks.size() << "] processes\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSHalo::unsetup()
+{
+  m_isParallel = false;
+  m_nbGhosts = 0;
+  m_sendRanks.clear();
+  m_sendStart.assign(1, 0);
+  m_sendIDs.clear();
+  m_recvRanks.clear();
+  m_recvStart.assign(1, 0);
+  m_recvIDs.clear();
+  vector<CFreal>().swap(m_sendBuf);
+  vector<CFreal>().swap(m_recvBuf);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSHalo::exchange(const CFreal *const x, CFreal *const xGhost)
+{
+#ifdef CF_HAVE_MPI
+  if (!m_isParallel) return;
+
+  const CFuint bs = m_bs;
+  const CFuint nbRecv = m_recvRanks.size();
+  const CFuint nbSend = m_sendRanks.size();
+  m_requests.resize(nbRecv + nbSend);
+
+  for (CFuint r = 0; r < nbRecv; ++r) {
+    const CFuint start = m_recvStart[r]*bs;
+    const int count = (m_recvStart[r+1] - m_recvStart[r])*bs;
+    Common::CheckMPIStatus(MPI_Irecv(&m_recvBuf[start], count,
+                                     Common::MPIStructDef::getMPIType(&m_recvBuf[start]),
+                                     m_recvRanks[r], BLOCKLSS_HALO_TAG, m_comm, &m_requests[r]));
+  }
+
+  for (CFuint s = 0; s < nbSend; ++s) {
+    for (CFuint i = m_sendStart[s]; i < m_sendStart[s+1]; ++i) {
+      const CFreal *const xi = x + m_sendIDs[i]*bs;
+      for (CFuint e = 0; e < bs; ++e) {
+        m_sendBuf[i*bs + e] = xi[e];
+      }
+    }
+    const CFuint start = m_sendStart[s]*bs;
+    const int count = (m_sendStart[s+1] - m_sendStart[s])*bs;
+    Common::CheckMPIStatus(MPI_Isend(&m_sendBuf[start], count,
+                                     Common::MPIStructDef::getMPIType(&m_sendBuf[start]),
+                                     m_sendRanks[s], BLOCKLSS_HALO_TAG, m_comm,
+                                     &m_requests[nbRecv + s]));
+  }
+
+  if (!m_requests.empty()) {
+    Common::CheckMPIStatus(MPI_Waitall(m_requests.size(), &m_requests[0], MPI_STATUSES_IGNORE));
+  }
+
+  const CFuint nbRecvIDs = m_recvIDs.size();
+  for (CFuint i = 0; i < nbRecvIDs; ++i) {
+    CFreal *const xi = xGhost + m_recvIDs[i]*bs;
+    for (CFuint e = 0; e < bs; ++e) {
+      xi[e] = m_recvBuf[i*bs + e];
+    }
+  }
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSHalo::sum(CFreal *const values, const CFuint nbValues) const
+{
+#ifdef CF_HAVE_MPI
+  if (!m_isParallel) return;
+
+  vector<CFreal> localValues(values, values + nbValues);
+  Common::CheckMPIStatus(MPI_Allreduce(&localValues[0], values, nbValues,
+                                       Common::MPIStructDef::getMPIType(values),
+                                       MPI_SUM, m_comm));
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal BlockLSSHalo::dot(const CFreal *const x, const CFreal *const y,
+                         const CFuint size) const
+{
+  CFreal result = 0.;
+  for (CFuint i = 0; i < size; ++i) {
+    result += x[i]*y[i];
+  }
+  sum(&result, 1);
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
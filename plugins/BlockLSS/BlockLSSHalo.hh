@@ -0,0 +1,123 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockLSSHalo_hh
+#define COOLFluiD_BlockLSS_BlockLSSHalo_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <valarray>
+#include <vector>
+
+#include "Framework/LSSVector.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class exchanges the entries of the ghost states of the vectors of the
+/// native block linear system solver and computes their global reductions.
+///
+/// The send and receive lists are the ones of the communication pattern of
+/// the states, so that the ghost entries are exchanged between the same
+/// processes and in the same order as the states themselves.
+class BlockLSSHalo {
+public:
+
+  /// Constructor
+  BlockLSSHalo();
+
+  /// Destructor
+  ~BlockLSSHalo();
+
+  /// Set up the exchange
+  /// @param comm       communicator of the namespace
+  /// @param sendList   local IDs of the states to send to each process
+  /// @param recvList   local IDs of the ghost states to receive from each process
+  /// @param localToLSS internal ID of each local state, the ghost states
+  ///                   following the nbLocal updatable ones
+  /// @param nbLocal    number of updatable states
+  /// @param blockSize  number of entries per state
+  void setup(MPI_Comm comm,
+             const std::vector<std::vector<CFuint> >& sendList,
+             const std::vector<std::vector<CFuint> >& recvList,
+             const std::valarray<CFuint>& localToLSS,
+             const CFuint nbLocal, const CFuint blockSize);
+
+  /// Release the buffers
+  void unsetup();
+
+  /// @return the number of ghost states
+  CFuint getNbGhosts() const {return m_nbGhosts;}
+
+  /// Copy the entries of the updatable states of x needed by the other
+  /// processes into their ghost entries xGhost (collective)
+  void exchange(const CFreal *const x, CFreal *const xGhost);
+
+  /// Sum the given local values over all the processes (collective)
+  void sum(CFreal *const values, const CFuint nbValues) const;
+
+  /// @return the global dot product of the given local vectors (collective)
+  CFreal dot(const CFreal *const x, const CFreal *const y, const CFuint size) const;
+
+private: // data
+
+  /// communicator
+  MPI_Comm m_comm;
+
+  /// flag telling if there is more than one process
+  bool m_isParallel;
+
+  /// number of entries per state
+  CFuint m_bs;
+
+  /// number of ghost states
+  CFuint m_nbGhosts;
+
+  /// ranks of the processes to send to
+  std::vector<int> m_sendRanks;
+
+  /// start of the states to send to each process
+  std::vector<CFuint> m_sendStart;
+
+  /// internal IDs of the states to send
+  std::vector<CFuint> m_sendIDs;
+
+  /// ranks of the processes to receive from
+  std::vector<int> m_recvRanks;
+
+  /// start of the states to receive from each process
+  std::vector<CFuint> m_recvStart;
+
+  /// ghost IDs of the states to receive
+  std::vector<CFuint> m_recvIDs;
+
+  /// send buffer
+  std::vector<CFreal> m_sendBuf;
+
+  /// receive buffer
+  std::vector<CFreal> m_recvBuf;
+
+#ifdef CF_HAVE_MPI
+  /// pending requests
+  std::vector<MPI_Request> m_requests;
+#endif
+
+}; // end of class BlockLSSHalo
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_BlockLSS_BlockLSSHalo_hh
@@ -0,0 +1,507 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <fstream>
+
+#include "Common/CFLog.hh"
+#include "Common/BadValueException.hh"
+#include "Common/StringOps.hh"
+#include "Framework/BlockAccumulator.hh"
+#include "MathTools/BlockKernelsT.hh"
+
+#include "BlockLSS/BlockLSSMatrix.hh"
+#include "BlockLSS/BlockLSSVector.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::MathTools;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSSMatrix::BlockLSSMatrix() :
+  Framework::LSSMatrix(),
+  m_name(),
+  m_bs(0),
+  m_nbRows(0),
+  m_nbCols(0),
+  m_nbThreads(1),
+  m_frozen(false),
+  m_rowStart(),
+  m_rowLength(),
+  m_localRowEnd(),
+  m_diag(),
+  m_cols(),
+  m_values()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSSMatrix::~BlockLSSMatrix()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::createSeqAIJ(const CFint m, const CFint n, const CFint nz,
+                                  const CFint* nnz, const char* name)
+{
+  createSeqBAIJ(1, m, n, nz, nnz, name);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::createSeqBAIJ(const CFuint blockSize,
+                                   const CFint m, const CFint n, const CFint nz,
+                                   const CFint* nnz, const char* name)
+{
+  CFAUTOTRACE;
+
+  cf_assert(blockSize > 0);
+  cf_assert(m % blockSize == 0);
+  cf_assert(n % blockSize == 0);
+
+  m_name = (name != CFNULL) ? std::string(name) : std::string("BlockLSSMatrix");
+  m_bs = blockSize;
+  m_nbRows = m/blockSize;
+  m_nbCols = n/blockSize;
+  m_frozen = false;
+
+  // the rows are filled in during the first assembly
+  m_rowStart.resize(m_nbRows + 1);
+  m_rowStart[0] = 0;
+  for (CFuint i = 0; i < m_nbRows; ++i) {
+    const CFuint nbBlocks = (nz > 0) ? nz : nnz[i];
+    m_rowStart[i+1] = m_rowStart[i] + std::min(nbBlocks, m_nbCols);
+  }
+  m_rowLength.assign(m_nbRows, 0);
+  m_localRowEnd.clear();
+  m_diag.clear();
+
+  m_cols.assign(m_rowStart[m_nbRows], 0);
+  m_values.assign(m_rowStart[m_nbRows]*m_bs*m_bs, 0.);
+
+  CFLog(VERBOSE, "BlockLSSMatrix::createSeqBAIJ() => [" << m_nbRows << "] block rows, ["
+        << m_rowStart[m_nbRows] << "] blocks allocated\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef CF_HAVE_MPI
+void BlockLSSMatrix::createParAIJ(MPI_Comm comm, const CFint m, const CFint n,
+                                  const CFint M, const CFint N,
+                                  const CFint dnz, const CFint* dnnz,
+                                  const CFint onz, const CFint* onnz,
+                                  const char* name)
+{
+  createParBAIJ(comm, 1, m, n, M, N, dnz, dnnz, onz, onnz, name);
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef CF_HAVE_MPI
+void BlockLSSMatrix::createParBAIJ(MPI_Comm comm, const CFuint blockSize,
+                                   const CFint m, const CFint n,
+                                   const CFint M, const CFint N,
+                                   const CFint dnz, const CFint* dnnz,
+                                   const CFint onz, const CFint* onnz,
+                                   const char* name)
+{
+  // only the local rows are stored, the columns of the ghost states
+  // following the ones of the updatable states
+  const CFuint nbRows = m/blockSize;
+  vector<CFint> nnz(nbRows);
+  for (CFuint i = 0; i < nbRows; ++i) {
+    nnz[i] = ((dnz > 0) ? dnz : dnnz[i]) + ((onz > 0) ? onz : onnz[i]);
+  }
+  createSeqBAIJ(blockSize, m, n, 0, (nbRows > 0) ? &nnz[0] : CFNULL, name);
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint BlockLSSMatrix::findBlock(const CFint row, const CFint col, const bool insert)
+{
+  if (row < 0 || col < 0 ||
+      static_cast<CFuint>(row) >= m_nbRows || static_cast<CFuint>(col) >= m_nbCols) {
+    return -1;
+  }
+
+  const CFuint start = m_rowStart[row];
+  const CFuint end = start + m_rowLength[row];
+  const CFuint c = static_cast<CFuint>(col);
+  const CFuint pos = std::lower_bound(&m_cols[0] + start, &m_cols[0] + end, c) - &m_cols[0];
+  if (pos < end && m_cols[pos] == c) {
+    return pos;
+  }
+
+  if (!insert) return -1;
+  if (m_frozen || end == m_rowStart[row+1]) {
+    notFoundIndex(row, col);
+  }
+
+  // insert the new block, keeping the row sorted
+  const CFuint bs2 = m_bs*m_bs;
+  for (CFuint k = end; k > pos; --k) {
+    m_cols[k] = m_cols[k-1];
+    for (CFuint i = 0; i < bs2; ++i) {
+      m_values[k*bs2 + i] = m_values[(k-1)*bs2 + i];
+    }
+  }
+  m_cols[pos] = c;
+  for (CFuint i = 0; i < bs2; ++i) {
+    m_values[pos*bs2 + i] = 0.;
+  }
+  ++m_rowLength[row];
+  return pos;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal* BlockLSSMatrix::getEntry(const CFint im, const CFint in, const bool insert)
+{
+  if (im < 0 || in < 0) return CFNULL;
+
+  const CFint bs = m_bs;
+  const CFint k = findBlock(im/bs, in/bs, insert);
+  return (k >= 0) ? &m_values[(k*bs + im%bs)*bs + in%bs] : CFNULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::setValue(const CFint im, const CFint in, const CFreal value)
+{
+  CFreal *const entry = getEntry(im, in, true);
+  if (entry != CFNULL) *entry = value;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::setValues(const CFuint m, const CFint* im, const CFuint n,
+                               const CFint* in, const CFreal* values)
+{
+  for (CFuint i = 0; i < m; ++i) {
+    for (CFuint j = 0; j < n; ++j) {
+      CFreal *const entry = getEntry(im[i], in[j], true);
+      if (entry != CFNULL) *entry = values[i*n + j];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::addValue(const CFint im, const CFint in, const CFreal value)
+{
+  CFreal *const entry = getEntry(im, in, true);
+  if (entry != CFNULL) *entry += value;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::addValues(const CFuint m, const CFint* im, const CFuint n,
+                               const CFint* in, const CFreal* values)
+{
+  for (CFuint i = 0; i < m; ++i) {
+    for (CFuint j = 0; j < n; ++j) {
+      CFreal *const entry = getEntry(im[i], in[j], true);
+      if (entry != CFNULL) *entry += values[i*n + j];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::getValue(const CFint im, const CFint in, CFreal& value)
+{
+  const CFreal *const entry = getEntry(im, in, false);
+  value = (entry != CFNULL) ? *entry : 0.;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::getValues(const CFuint m, const CFint* im, const CFuint n,
+                               const CFint* in, CFreal* values)
+{
+  for (CFuint i = 0; i < m; ++i) {
+    for (CFuint j = 0; j < n; ++j) {
+      getValue(im[i], in[j], values[i*n + j]);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::setRow(const CFuint row, CFreal diagval, CFreal offdiagval)
+{
+  const CFuint blockRow = row/m_bs;
+  if (blockRow >= m_nbRows) return;
+
+  // the diagonal block has to be there
+  findBlock(blockRow, blockRow, true);
+
+  const CFuint ir = row%m_bs;
+  for (CFuint k = getRowStart(blockRow); k < getRowEnd(blockRow); ++k) {
+    CFreal *const rowValues = &m_values[(k*m_bs + ir)*m_bs];
+    for (CFuint jb = 0; jb < m_bs; ++jb) {
+      rowValues[jb] = (m_cols[k] == blockRow && jb == ir) ? diagval : offdiagval;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::setDiagonal(Framework::LSSVector& diag)
+{
+  const CFreal *const d = static_cast<BlockLSSVector&>(diag).getArray();
+  for (CFuint i = 0; i < m_nbRows; ++i) {
+    CFreal *const block = &m_values[findBlock(i, i, true)*m_bs*m_bs];
+    for (CFuint ib = 0; ib < m_bs; ++ib) {
+      block[ib*m_bs + ib] = d[i*m_bs + ib];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::addToDiagonal(Framework::LSSVector& diag)
+{
+  const CFreal *const d = static_cast<BlockLSSVector&>(diag).getArray();
+  for (CFuint i = 0; i < m_nbRows; ++i) {
+    CFreal *const block = &m_values[findBlock(i, i, true)*m_bs*m_bs];
+    for (CFuint ib = 0; ib < m_bs; ++ib) {
+      block[ib*m_bs + ib] += d[i*m_bs + ib];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::resetToZeroEntries()
+{
+  std::fill(m_values.begin(), m_values.end(), 0.);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::setValues(const Framework::BlockAccumulator& acc)
+{
+  cf_assert(acc.getNB() == m_bs);
+
+  const CFuint nbRows = acc.getM();
+  const CFuint nbCols = acc.getN();
+  for (CFuint i = 0; i < nbRows; ++i) {
+    for (CFuint j = 0; j < nbCols; ++j) {
+      const CFint k = findBlock(acc.getIM()[i], acc.getIN()[j], true);
+      if (k < 0) continue;
+      CFreal *const block = &m_values[k*m_bs*m_bs];
+      for (CFuint ib = 0; ib < m_bs; ++ib) {
+        for (CFuint jb = 0; jb < m_bs; ++jb) {
+          block[ib*m_bs + jb] = acc.getValue(i, j, ib, jb);
+        }
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::addValues(const Framework::BlockAccumulator& acc)
+{
+  cf_assert(acc.getNB() == m_bs);
+
+  const CFuint nbRows = acc.getM();
+  const CFuint nbCols = acc.getN();
+  for (CFuint i = 0; i < nbRows; ++i) {
+    for (CFuint j = 0; j < nbCols; ++j) {
+      const CFint k = findBlock(acc.getIM()[i], acc.getIN()[j], true);
+      if (k < 0) continue;
+      CFreal *const block = &m_values[k*m_bs*m_bs];
+      for (CFuint ib = 0; ib < m_bs; ++ib) {
+        for (CFuint jb = 0; jb < m_bs; ++jb) {
+          block[ib*m_bs + jb] += acc.getValue(i, j, ib, jb);
+        }
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::freezeNonZeroStructure()
+{
+  CFAUTOTRACE;
+
+  if (m_frozen) return;
+
+  // remove the blocks allocated but never filled, adding the diagonal
+  // blocks needed by the preconditioners where they are missing
+  const CFuint bs2 = m_bs*m_bs;
+  vector<CFuint> rowStart(m_nbRows + 1, 0);
+  vector<CFuint> cols;
+  vector<CFreal> values;
+  cols.reserve(m_cols.size());
+  values.reserve(m_values.size());
+  for (CFuint i = 0; i < m_nbRows; ++i) {
+    bool hasDiag = false;
+    for (CFuint k = m_rowStart[i]; k < getRowEnd(i); ++k) {
+      if (!hasDiag && m_cols[k] > i) {
+        cols.push_back(i);
+        values.insert(values.end(), bs2, 0.);
+        hasDiag = true;
+      }
+      hasDiag = hasDiag || (m_cols[k] == i);
+      cols.push_back(m_cols[k]);
+      values.insert(values.end(), m_values.begin() + k*bs2, m_values.begin() + (k+1)*bs2);
+    }
+    if (!hasDiag) {
+      cols.push_back(i);
+      values.insert(values.end(), bs2, 0.);
+    }
+    rowStart[i+1] = cols.size();
+    m_rowLength[i] = rowStart[i+1] - rowStart[i];
+  }
+  m_rowStart.swap(rowStart);
+  m_cols.swap(cols);
+  m_values.swap(values);
+
+  m_diag.resize(m_nbRows);
+  m_localRowEnd.resize(m_nbRows);
+  for (CFuint i = 0; i < m_nbRows; ++i) {
+    const CFuint* rowBegin = &m_cols[0] + m_rowStart[i];
+    const CFuint* rowEnd = &m_cols[0] + getRowEnd(i);
+    m_diag[i] = std::lower_bound(rowBegin, rowEnd, i) - &m_cols[0];
+    m_localRowEnd[i] = std::lower_bound(rowBegin, rowEnd, m_nbRows) - &m_cols[0];
+  }
+
+  m_frozen = true;
+
+  CFLog(VERBOSE, "BlockLSSMatrix::freezeNonZeroStructure() => [" << m_cols.size() << "] blocks\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::mult(const CFreal *const x, const CFreal *const xGhost,
+                          CFreal *const y) const
+{
+  cf_assert(m_frozen);
+
+  // the block operations are specialized for the common numbers of
+  // equations, as in the FiniteVolume Roe flux
+  switch(m_bs) {
+  case(4):
+    multT<4>(x, xGhost, y); break;
+  case(5):
+    multT<5>(x, xGhost, y); break;
+  case(6):
+    multT<6>(x, xGhost, y); break;
+  case(7):
+    multT<7>(x, xGhost, y); break;
+  case(8):
+    multT<8>(x, xGhost, y); break;
+  case(9):
+    multT<9>(x, xGhost, y); break;
+  case(10):
+    multT<10>(x, xGhost, y); break;
+  default:
+    multT<0>(x, xGhost, y);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+template <unsigned int N>
+void BlockLSSMatrix::multT(const CFreal *const x, const CFreal *const xGhost,
+                           CFreal *const y) const
+{
+  const CFuint bs = m_bs;
+  const int nbRows = m_nbRows;
+
+#ifdef CF_HAVE_OMP
+  const int nbThreads = m_nbThreads;
+#pragma omp parallel for schedule(static) num_threads(nbThreads)
+#endif
+  for (int i = 0; i < nbRows; ++i) {
+    CFreal *const yi = y + i*bs;
+    for (CFuint ib = 0; ib < bs; ++ib) {
+      yi[ib] = 0.;
+    }
+
+    // updatable columns, then ghost ones
+    const CFuint localEnd = m_localRowEnd[i];
+    for (CFuint k = m_rowStart[i]; k < localEnd; ++k) {
+      BlockKernelsT<N>::multAdd(getBlock(k), x + m_cols[k]*bs, yi, bs);
+    }
+    const CFuint end = m_rowStart[i+1];
+    for (CFuint k = localEnd; k < end; ++k) {
+      BlockKernelsT<N>::multAdd(getBlock(k), xGhost + (m_cols[k] - nbRows)*bs, yi, bs);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::printToScreen() const
+{
+  CFout << "BlockLSSMatrix \"" << m_name << "\":\n";
+  for (CFuint i = 0; i < m_nbRows; ++i) {
+    for (CFuint k = getRowStart(i); k < getRowEnd(i); ++k) {
+      for (CFuint ib = 0; ib < m_bs; ++ib) {
+        for (CFuint jb = 0; jb < m_bs; ++jb) {
+          CFout << i*m_bs + ib << " " << m_cols[k]*m_bs + jb << " "
+                << getBlock(k)[ib*m_bs + jb] << "\n";
+        }
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::printToFile(const char* fileName) const
+{
+  std::ofstream f(fileName);
+  f.precision(16);
+  for (CFuint i = 0; i < m_nbRows; ++i) {
+    for (CFuint k = getRowStart(i); k < getRowEnd(i); ++k) {
+      for (CFuint ib = 0; ib < m_bs; ++ib) {
+        for (CFuint jb = 0; jb < m_bs; ++jb) {
+          f << i*m_bs + ib << " " << m_cols[k]*m_bs + jb << " "
+            << getBlock(k)[ib*m_bs + jb] << "\n";
+        }
+      }
+    }
+  }
+  f.close();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSMatrix::notFoundIndex(const CFint row, const CFint col) const
+{
+  const std::string msg = "BlockLSSMatrix::notFoundIndex() => block (" +
+    StringOps::to_str(row) + "," + StringOps::to_str(col) + ") not allocated";
+  CFLog(ERROR, msg << "\n");
+  throw BadValueException(FromHere(), msg);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
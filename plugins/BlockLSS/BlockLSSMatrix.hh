@@ -0,0 +1,247 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockLSSMatrix_hh
+#define COOLFluiD_BlockLSS_BlockLSSMatrix_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Framework/LSSMatrix.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+    class BlockAccumulator;
+  }
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a matrix of the native block linear system solver,
+/// stored in block compressed sparse row (BCSR) format with square blocks of
+/// the size of the system, each block being stored row by row.
+///
+/// The block rows are the updatable states, the block columns the updatable
+/// states followed by the ghost ones, so that in each (sorted) row the ghost
+/// columns come last. The entries of the rows are allocated with the number of
+/// non zero blocks given at creation and filled in during the first assembly,
+/// then the storage is compacted by freezeNonZeroStructure(), after which no
+/// new non zero block can be added.
+class BlockLSSMatrix : public Framework::LSSMatrix {
+public:
+
+  /// Default constructor without arguments
+  BlockLSSMatrix();
+
+  /// Destructor
+  ~BlockLSSMatrix();
+
+  /// Create a sequential sparse matrix
+  void createSeqAIJ(const CFint m, const CFint n, const CFint nz,
+                    const CFint* nnz, const char* name = CFNULL);
+
+  /// Create a sequential block sparse matrix
+  /// @param nnz number of non zero blocks of each block row
+  void createSeqBAIJ(const CFuint blockSize, const CFint m, const CFint n,
+                     const CFint nz, const CFint* nnz, const char* name = CFNULL);
+
+#ifdef CF_HAVE_MPI
+  /// Create a parallel sparse matrix
+  void createParAIJ(MPI_Comm comm, const CFint m, const CFint n,
+                    const CFint M, const CFint N,
+                    const CFint dnz, const CFint* dnnz,
+                    const CFint onz, const CFint* onnz,
+                    const char* name = CFNULL);
+
+  /// Create a parallel block sparse matrix
+  void createParBAIJ(MPI_Comm comm, const CFuint blockSize,
+                     const CFint m, const CFint n, const CFint M, const CFint N,
+                     const CFint dnz, const CFint* dnnz,
+                     const CFint onz, const CFint* onnz,
+                     const char* name = CFNULL);
+#endif
+
+  /// Start to assemble the matrix
+  void beginAssembly(LSSMatrixAssemblyType assemblyType) {}
+
+  /// Finish to assemble the matrix
+  void endAssembly(LSSMatrixAssemblyType assemblyType) {}
+
+  /// Print this matrix
+  void printToScreen() const;
+
+  /// Print this matrix to a file
+  void printToFile(const char* fileName) const;
+
+  /// Set one value
+  void setValue(const CFint im, const CFint in, const CFreal value);
+
+  /// Set a list of values
+  void setValues(const CFuint m, const CFint* im, const CFuint n,
+                 const CFint* in, const CFreal* values);
+
+  /// Add one value
+  void addValue(const CFint im, const CFint in, const CFreal value);
+
+  /// Add a list of values
+  void addValues(const CFuint m, const CFint* im, const CFuint n,
+                 const CFint* in, const CFreal* values);
+
+  /// Get one value
+  void getValue(const CFint im, const CFint in, CFreal& value);
+
+  /// Get a list of values
+  void getValues(const CFuint m, const CFint* im, const CFuint n,
+                 const CFint* in, CFreal* values);
+
+  /// Set a row, diagonal and off-diagonals
+  void setRow(const CFuint row, CFreal diagval, CFreal offdiagval);
+
+  /// Set the diagonal
+  void setDiagonal(Framework::LSSVector& diag);
+
+  /// Add to the diagonal
+  void addToDiagonal(Framework::LSSVector& diag);
+
+  /// Reset to 0 all the non-zero elements of the matrix
+  void resetToZeroEntries();
+
+  /// Set a list of values
+  void setValues(const Framework::BlockAccumulator& acc);
+
+  /// Add a list of values
+  void addValues(const Framework::BlockAccumulator& acc);
+
+  /// Compact the storage and freeze the non zero blocks
+  void freezeNonZeroStructure();
+
+  /// Computes y = A*x
+  /// @param x      entries of the updatable states
+  /// @param xGhost entries of the ghost states
+  /// @param y      result, for the updatable states
+  void mult(const CFreal *const x, const CFreal *const xGhost, CFreal *const y) const;
+
+  /// Set the number of threads used by the matrix operations
+  void setNbThreads(const CFuint nbThreads) {m_nbThreads = nbThreads;}
+
+  /// @return the number of threads used by the matrix operations
+  CFuint getNbThreads() const {return m_nbThreads;}
+
+  /// @return true if the non zero structure is frozen
+  bool isFrozen() const {return m_frozen;}
+
+  /// @return the size of the blocks
+  CFuint getBlockSize() const {return m_bs;}
+
+  /// @return the number of block rows
+  CFuint getNbBlockRows() const {return m_nbRows;}
+
+  /// @return the number of block columns
+  CFuint getNbBlockCols() const {return m_nbCols;}
+
+  /// @return the position of the first block of the given row
+  CFuint getRowStart(const CFuint row) const {return m_rowStart[row];}
+
+  /// @return the position after the last block of the given row
+  CFuint getRowEnd(const CFuint row) const {return m_rowStart[row] + m_rowLength[row];}
+
+  /// @return the position after the last block of the given row
+  ///         whose column is an updatable state
+  /// @pre the structure is frozen
+  CFuint getLocalRowEnd(const CFuint row) const {return m_localRowEnd[row];}
+
+  /// @return the position of the diagonal block of the given row
+  /// @pre the structure is frozen
+  CFuint getDiagPos(const CFuint row) const {return m_diag[row];}
+
+  /// @return the block column of the given block
+  CFuint getBlockCol(const CFuint k) const {return m_cols[k];}
+
+  /// @return the row-wise storage of the given block
+  const CFreal* getBlock(const CFuint k) const {return &m_values[k*m_bs*m_bs];}
+
+  /// @return the number of stored blocks
+  CFuint getNbBlocks() const {return m_cols.size();}
+
+private: // helper functions
+
+  /// Finds the block (row,col)
+  /// @param insert insert the block if it is missing and the structure is not frozen
+  /// @return the position of the block or -1 if the row or column is not stored
+  CFint findBlock(const CFint row, const CFint col, const bool insert);
+
+  /// @return the entry (im,in) of the matrix or CFNULL if it is not stored
+  CFreal* getEntry(const CFint im, const CFint in, const bool insert);
+
+  /// Throws when an entry that is not allocated is accessed
+  void notFoundIndex(const CFint row, const CFint col) const;
+
+  /// Computes y = A*x with the block kernels for blocks of size N
+  template <unsigned int N>
+  void multT(const CFreal *const x, const CFreal *const xGhost, CFreal *const y) const;
+
+private:
+
+  /// copy constructor
+  BlockLSSMatrix(const BlockLSSMatrix& other);
+
+  /// assignment operator
+  const BlockLSSMatrix& operator= (const BlockLSSMatrix& other);
+
+private: // data
+
+  /// matrix name
+  std::string m_name;
+
+  /// size of the blocks
+  CFuint m_bs;
+
+  /// number of block rows
+  CFuint m_nbRows;
+
+  /// number of block columns
+  CFuint m_nbCols;
+
+  /// number of threads
+  CFuint m_nbThreads;
+
+  /// flag telling if the non zero structure is frozen
+  bool m_frozen;
+
+  /// start of each block row
+  std::vector<CFuint> m_rowStart;
+
+  /// number of blocks in each block row
+  std::vector<CFuint> m_rowLength;
+
+  /// end of the updatable columns of each block row
+  std::vector<CFuint> m_localRowEnd;
+
+  /// position of the diagonal block of each row
+  std::vector<CFuint> m_diag;
+
+  /// block columns
+  std::vector<CFuint> m_cols;
+
+  /// block values
+  std::vector<CFreal> m_values;
+
+}; // end of class BlockLSSMatrix
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_BlockLSS_BlockLSSMatrix_hh
@@ -0,0 +1,142 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockLSSVector_hh
+#define COOLFluiD_BlockLSS_BlockLSSVector_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Framework/LSSVector.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a vector of the native block linear system solver.
+/// Only the entries of the updatable states are stored, in the internal
+/// (block) ordering of the solver.
+class BlockLSSVector : public Framework::LSSVector {
+public:
+
+  /// Default constructor without arguments
+  BlockLSSVector();
+
+  /// Destructor
+  ~BlockLSSVector();
+
+  /// Create a vector
+  void create(MPI_Comm comm, const CFint m, const CFint M, const char* name);
+
+  /// Initialize a vector
+  void initialize(MPI_Comm comm, const CFreal value) {setValue(value);}
+
+  /// Start to assemble the vector
+  void beginAssembly() {}
+
+  /// Finish to assemble the vector
+  void endAssembly() {}
+
+  /// Print this vector
+  void printToScreen() const;
+
+  /// Print this vector to a file
+  void printToFile(const char* fileName) const;
+
+  /// Deallocate internal memory
+  void destroy();
+
+  /// Set a value at the specified position in the vector
+  void setValue(const CFint idx, const CFreal value) {m_v[idx] = value;}
+
+  /// Set all the entries equal to the given value
+  void setValue(const CFreal value);
+
+  /// Set a list of values
+  void setValues(const CFuint nbValues, const CFint* idx, const CFreal* values)
+  {
+    for (CFuint i = 0; i < nbValues; ++i) {
+      m_v[idx[i]] = values[i];
+    }
+  }
+
+  /// Add a value in the vector at the given location
+  void addValue(const CFint idx, const CFreal value) {m_v[idx] += value;}
+
+  /// Add a list of values at the given locations
+  void addValues(const CFuint nbValues, const CFint* idx, const CFreal* values)
+  {
+    for (CFuint i = 0; i < nbValues; ++i) {
+      m_v[idx[i]] += values[i];
+    }
+  }
+
+  /// Get one value
+  void getValue(const CFint idx, CFreal value) {value = m_v[idx];}
+
+  /// Get a list of values
+  void getValues(const CFuint m, const CFint* im, CFreal* values)
+  {
+    for (CFuint i = 0; i < m; ++i) {
+      values[i] = m_v[im[i]];
+    }
+  }
+
+  /// Gets the local size of the Vector
+  CFuint getLocalSize() const {return m_v.size();}
+
+  /// Gets the global size of the Vector
+  CFuint getGlobalSize() const {return m_globalSize;}
+
+  /// Copy the raw data of this vector to a given array
+  void copy(CFreal *const other, const CFuint size) const
+  {
+    for (CFuint i = 0; i < size; ++i) {
+      other[i] = m_v[i];
+    }
+  }
+
+  /// Copy the raw data of this vector to a given array
+  void copy(CFreal *const other, CFint *const localIDs, const CFuint size) const
+  {
+    for (CFuint i = 0; i < size; ++i) {
+      other[localIDs[i]] = m_v[i];
+    }
+  }
+
+  /// Get the internal array
+  CFreal* getArray() {return &m_v[0];}
+
+  /// Get the internal array
+  const CFreal* getArray() const {return &m_v[0];}
+
+private:
+
+  /// vector entries
+  std::vector<CFreal> m_v;
+
+  /// global size of the vector
+  CFuint m_globalSize;
+
+  /// vector name
+  std::string m_name;
+
+}; // end of class BlockLSSVector
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_BlockLSS_BlockLSSVector_hh
@@ -0,0 +1,78 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <memory>
+
+#include "MathTools/MatrixInverter.hh"
+#include "MathTools/RealMatrix.hh"
+
+#include "BlockLSS/BlockPreconditioner.hh"
+#include "BlockLSS/BlockLSSData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::MathTools;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockPreconditioner::BlockPreconditioner(const std::string& name) :
+  Framework::MethodStrategy<BlockLSSData>(name)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockPreconditioner::~BlockPreconditioner()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockPreconditioner::invertDiagonalBlocks(const BlockLSSMatrix& mat,
+                                               std::vector<CFreal>& invDiag) const
+{
+  const CFuint bs = mat.getBlockSize();
+  const CFuint bs2 = bs*bs;
+  const CFuint nbRows = mat.getNbBlockRows();
+  invDiag.resize(nbRows*bs2);
+
+  auto_ptr<MatrixInverter> inverter(MatrixInverter::create(bs, false));
+  RealMatrix block(bs, bs);
+  RealMatrix invBlock(bs, bs);
+
+  for (CFuint i = 0; i < nbRows; ++i) {
+    const CFreal *const diag = mat.getBlock(mat.getDiagPos(i));
+    for (CFuint ib = 0; ib < bs; ++ib) {
+      for (CFuint jb = 0; jb < bs; ++jb) {
+        block(ib,jb) = diag[ib*bs + jb];
+      }
+    }
+
+    inverter->invert(block, invBlock);
+
+    CFreal *const inv = &invDiag[i*bs2];
+    for (CFuint ib = 0; ib < bs; ++ib) {
+      for (CFuint jb = 0; jb < bs; ++jb) {
+        inv[ib*bs + jb] = invBlock(ib,jb);
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
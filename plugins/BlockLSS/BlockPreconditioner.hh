@@ -0,0 +1,73 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockPreconditioner_hh
+#define COOLFluiD_BlockLSS_BlockPreconditioner_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Environment/ConcreteProvider.hh"
+#include "Framework/MethodStrategy.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+    class BlockLSSData;
+    class BlockLSSMatrix;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a preconditioner of the native block linear system
+/// solver. The preconditioners only act on the rows and columns of the
+/// updatable states, i.e. they are block Jacobi between the processes.
+class BlockPreconditioner : public Framework::MethodStrategy<BlockLSSData> {
+public:
+
+  typedef Framework::BaseMethodStrategyProvider<BlockLSSData,BlockPreconditioner> PROVIDER;
+
+  /// Constructor
+  BlockPreconditioner(const std::string& name);
+
+  /// Destructor
+  virtual ~BlockPreconditioner();
+
+  /// Compute the preconditioner from the given matrix
+  /// @pre the non zero structure of the matrix is frozen
+  virtual void compute(const BlockLSSMatrix& mat) = 0;
+
+  /// Apply the preconditioner: y = inv(M)*x
+  /// @param x entries of the updatable states
+  /// @param y result, for the updatable states
+  virtual void apply(const CFreal *const x, CFreal *const y) = 0;
+
+  /// Gets the Class name
+  static std::string getClassName() {return "BlockPreconditioner";}
+
+  /// Gets the polymorphic type name
+  virtual std::string getPolymorphicTypeName() {return getClassName();}
+
+protected: // helper functions
+
+  /// Invert the diagonal blocks of the given matrix
+  /// @param invDiag inverted blocks, stored row by row
+  void invertDiagonalBlocks(const BlockLSSMatrix& mat, std::vector<CFreal>& invDiag) const;
+
+}; // end of class BlockPreconditioner
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_BlockLSS_BlockPreconditioner_hh
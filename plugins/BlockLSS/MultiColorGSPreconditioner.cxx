@@ -0,0 +1,254 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+
+#include "Common/CFLog.hh"
+#include "Framework/MethodStrategyProvider.hh"
+#include "MathTools/BlockKernelsT.hh"
+
+#include "BlockLSS/MultiColorGSPreconditioner.hh"
+#include "BlockLSS/BlockLSSData.hh"
+#include "BlockLSS/BlockLSSMatrix.hh"
+#include "BlockLSS/BlockLSSModule.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::MathTools;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodStrategyProvider<MultiColorGSPreconditioner,
+                       BlockLSSData,
+                       BlockPreconditioner,
+                       BlockLSSModule>
+multiColorGSPreconditionerProvider("MCBGS");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MultiColorGSPreconditioner::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< CFuint >("NbSweeps","Number of Gauss-Seidel sweeps");
+  options.addConfigOption< bool >("Symmetric","Add a backward sweep to each forward sweep");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MultiColorGSPreconditioner::MultiColorGSPreconditioner(const std::string& name) :
+  BlockPreconditioner(name),
+  m_mat(CFNULL),
+  m_rows(),
+  m_colorStart(),
+  m_invDiag(),
+  m_work()
+{
+  addConfigOptionsTo(this);
+
+  m_nbSweeps = 1;
+  setParameter("NbSweeps",&m_nbSweeps);
+
+  m_symmetric = true;
+  setParameter("Symmetric",&m_symmetric);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MultiColorGSPreconditioner::~MultiColorGSPreconditioner()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MultiColorGSPreconditioner::compute(const BlockLSSMatrix& mat)
+{
+  // the non zero structure is frozen: the colouring is computed once
+  if (m_mat != &mat || m_rows.size() != mat.getNbBlockRows()) {
+    colorRows(mat);
+  }
+  m_mat = &mat;
+  m_work.resize(mat.getNbBlockRows()*mat.getBlockSize());
+  invertDiagonalBlocks(mat, m_invDiag);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MultiColorGSPreconditioner::colorRows(const BlockLSSMatrix& mat)
+{
+  const CFuint nbRows = mat.getNbBlockRows();
+
+  // symmetrized graph of the local couplings
+  vector<CFuint> degree(nbRows, 0);
+  for (CFuint i = 0; i < nbRows; ++i) {
+    for (CFuint k = mat.getRowStart(i); k < mat.getLocalRowEnd(i); ++k) {
+      const CFuint j = mat.getBlockCol(k);
+      if (j != i) {
+        ++degree[i];
+        ++degree[j];
+      }
+    }
+  }
+
+  vector<CFuint> adjStart(nbRows + 1, 0);
+  for (CFuint i = 0; i < nbRows; ++i) {
+    adjStart[i+1] = adjStart[i] + degree[i];
+  }
+  vector<CFuint> adj(adjStart[nbRows]);
+  vector<CFuint> fill(adjStart.begin(), adjStart.end() - 1);
+  for (CFuint i = 0; i < nbRows; ++i) {
+    for (CFuint k = mat.getRowStart(i); k < mat.getLocalRowEnd(i); ++k) {
+      const CFuint j = mat.getBlockCol(k);
+      if (j != i) {
+        adj[fill[i]++] = j;
+        adj[fill[j]++] = i;
+      }
+    }
+  }
+
+  // greedy colouring in the natural order
+  const CFuint noColor = nbRows;
+  vector<CFuint> color(nbRows, noColor);
+  vector<CFuint> usedBy;
+  CFuint nbColors = 0;
+  for (CFuint i = 0; i < nbRows; ++i) {
+    for (CFuint a = adjStart[i]; a < adjStart[i+1]; ++a) {
+      const CFuint c = color[adj[a]];
+      if (c != noColor) {
+        usedBy[c] = i;
+      }
+    }
+
+    CFuint c = 0;
+    while (c < nbColors && usedBy[c] == i) {
+      ++c;
+    }
+    if (c == nbColors) {
+      ++nbColors;
+      usedBy.push_back(noColor);
+    }
+    color[i] = c;
+  }
+
+  // rows grouped by colour
+  m_colorStart.assign(nbColors + 1, 0);
+  for (CFuint i = 0; i < nbRows; ++i) {
+    ++m_colorStart[color[i] + 1];
+  }
+  for (CFuint c = 0; c < nbColors; ++c) {
+    m_colorStart[c+1] += m_colorStart[c];
+  }
+  m_rows.resize(nbRows);
+  fill.assign(m_colorStart.begin(), m_colorStart.end() - 1);
+  for (CFuint i = 0; i < nbRows; ++i) {
+    m_rows[fill[color[i]]++] = i;
+  }
+
+  CFLog(VERBOSE, "MultiColorGSPreconditioner::colorRows() => " << nbColors << " colours\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MultiColorGSPreconditioner::apply(const CFreal *const x, CFreal *const y)
+{
+  cf_assert(m_mat != CFNULL);
+
+  const CFuint size = m_rows.size()*m_mat->getBlockSize();
+  for (CFuint i = 0; i < size; ++i) {
+    y[i] = 0.;
+  }
+
+  const CFuint nbColors = m_colorStart.size() - 1;
+  for (CFuint s = 0; s < m_nbSweeps; ++s) {
+    for (CFuint c = 0; c < nbColors; ++c) {
+      relaxColor(c, x, y);
+    }
+    if (m_symmetric) {
+      for (CFuint c = nbColors; c > 0; --c) {
+        relaxColor(c-1, x, y);
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MultiColorGSPreconditioner::relaxColor(const CFuint color,
+                                            const CFreal *const x,
+                                            CFreal *const y) const
+{
+  // the block operations are specialized for the common numbers of
+  // equations, as in the FiniteVolume Roe flux
+  switch(m_mat->getBlockSize()) {
+  case(4):
+    relaxColorT<4>(color, x, y); break;
+  case(5):
+    relaxColorT<5>(color, x, y); break;
+  case(6):
+    relaxColorT<6>(color, x, y); break;
+  case(7):
+    relaxColorT<7>(color, x, y); break;
+  case(8):
+    relaxColorT<8>(color, x, y); break;
+  case(9):
+    relaxColorT<9>(color, x, y); break;
+  case(10):
+    relaxColorT<10>(color, x, y); break;
+  default:
+    relaxColorT<0>(color, x, y);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+template <unsigned int N>
+void MultiColorGSPreconditioner::relaxColorT(const CFuint color,
+                                             const CFreal *const x,
+                                             CFreal *const y) const
+{
+  const BlockLSSMatrix& mat = *m_mat;
+  const CFuint bs = mat.getBlockSize();
+  const CFuint bs2 = bs*bs;
+  const int start = m_colorStart[color];
+  const int end = m_colorStart[color+1];
+
+#ifdef CF_HAVE_OMP
+  const int nbThreads = mat.getNbThreads();
+#pragma omp parallel for schedule(static) num_threads(nbThreads)
+#endif
+  for (int r = start; r < end; ++r) {
+    const CFuint i = m_rows[r];
+
+    // residual of the row without the diagonal block (the rows of the same
+    // colour are not coupled, so the other entries of y are not modified)
+    CFreal *const res = &m_work[i*bs];
+    for (CFuint ib = 0; ib < bs; ++ib) {
+      res[ib] = x[i*bs + ib];
+    }
+    const CFuint diag = mat.getDiagPos(i);
+    for (CFuint k = mat.getRowStart(i); k < mat.getLocalRowEnd(i); ++k) {
+      if (k != diag) {
+        BlockKernelsT<N>::multSub(mat.getBlock(k), y + mat.getBlockCol(k)*bs, res, bs);
+      }
+    }
+
+    BlockKernelsT<N>::mult(&m_invDiag[i*bs2], res, y + i*bs, bs);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,90 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_MultiColorGSPreconditioner_hh
+#define COOLFluiD_BlockLSS_MultiColorGSPreconditioner_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "BlockLSS/BlockPreconditioner.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a multi-colour block Gauss-Seidel preconditioner.
+/// The block rows are coloured so that no two rows of the same colour are
+/// coupled: the sweeps run colour by colour and the rows of each colour are
+/// relaxed concurrently by the threads.
+class MultiColorGSPreconditioner : public BlockPreconditioner {
+public:
+
+  /// Defines the Config Option's of this class
+  /// @param options a OptionList where to add the Option's
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /// Constructor
+  MultiColorGSPreconditioner(const std::string& name);
+
+  /// Destructor
+  ~MultiColorGSPreconditioner();
+
+  /// Colour the matrix graph (once) and invert the diagonal blocks
+  void compute(const BlockLSSMatrix& mat);
+
+  /// Apply the preconditioner, starting from y = 0
+  void apply(const CFreal *const x, CFreal *const y);
+
+private: // helper functions
+
+  /// Colour the rows of the given matrix
+  void colorRows(const BlockLSSMatrix& mat);
+
+  /// Relax the rows of the given colour
+  void relaxColor(const CFuint color, const CFreal *const x, CFreal *const y) const;
+
+  /// Relax the rows of the given colour with the block kernels for blocks of size N
+  template <unsigned int N>
+  void relaxColorT(const CFuint color, const CFreal *const x, CFreal *const y) const;
+
+private: // data
+
+  /// matrix to precondition
+  const BlockLSSMatrix* m_mat;
+
+  /// rows grouped by colour
+  std::vector<CFuint> m_rows;
+
+  /// start of each colour in m_rows
+  std::vector<CFuint> m_colorStart;
+
+  /// inverted diagonal blocks
+  std::vector<CFreal> m_invDiag;
+
+  /// residuals of the rows being relaxed
+  mutable std::vector<CFreal> m_work;
+
+  /// number of Gauss-Seidel sweeps
+  CFuint m_nbSweeps;
+
+  /// flag telling to add a backward sweep to each forward one
+  bool m_symmetric;
+
+}; // end of class MultiColorGSPreconditioner
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_BlockLSS_MultiColorGSPreconditioner_hh
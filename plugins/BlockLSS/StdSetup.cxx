@@ -0,0 +1,144 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/NotImplementedException.hh"
+#include "Common/PE.hh"
+#include "Framework/GlobalJacobianSparsity.hh"
+#include "Framework/LSSIdxMapping.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/SpaceMethod.hh"
+
+#include "BlockLSS/BlockLSSModule.hh"
+#include "BlockLSS/StdSetup.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<StdSetup, BlockLSSData, BlockLSSModule>
+stdSetupProvider("StdSetup");
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdSetup::StdSetup(const std::string& name) :
+  BlockLSSCom(name),
+  socket_states("states"),
+  socket_nodes("nodes"),
+  socket_bStatesNeighbors("bStatesNeighbors")
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdSetup::~StdSetup()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdSetup::execute()
+{
+  CFAUTOTRACE;
+
+  if (getMethodData().useNodeBased()) {
+    throw NotImplementedException
+      (FromHere(), "StdSetup::execute() => node based systems are not supported by BlockLSS");
+  }
+
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  const CFuint nbStates = states.size();
+  const CFuint nbEqs = getMethodData().getNbSysEquations();
+
+  // the updatable states come first, the ghost ones after them
+  CFuint nbLocal = 0;
+  for (CFuint i = 0; i < nbStates; ++i) {
+    if (states[i]->isParUpdatable()) ++nbLocal;
+  }
+
+  valarray<CFuint> localToLSS(nbStates);
+  valarray<bool> isGhost(nbStates);
+  CFuint countUp = 0;
+  CFuint countGhost = nbLocal;
+  for (CFuint i = 0; i < nbStates; ++i) {
+    isGhost[i] = !states[i]->isParUpdatable();
+    localToLSS[i] = (!isGhost[i]) ? countUp++ : countGhost++;
+  }
+  cf_assert(countUp == nbLocal);
+  cf_assert(countGhost == nbStates);
+
+  getMethodData().getLocalToGlobalMapping().createMapping(localToLSS, isGhost);
+
+  // number of non zero blocks of the rows of the updatable states
+  valarray<CFint> allNonZero(nbStates);
+  allNonZero = 0;
+  valarray<CFint> outDiagNonZero(nbStates);
+  outDiagNonZero = 0;
+
+  SelfRegistPtr<GlobalJacobianSparsity> sparsity =
+    getMethodData().getCollaborator<SpaceMethod>()->createJacobianSparsity();
+  sparsity->setDataSockets(socket_states, socket_nodes, socket_bStatesNeighbors);
+  sparsity->computeNNz(allNonZero, outDiagNonZero);
+
+  vector<CFint> nnz(max(nbLocal, (CFuint)1), 0);
+  for (CFuint i = 0; i < nbStates; ++i) {
+    if (!isGhost[i]) {
+      nnz[localToLSS[i]] = allNonZero[i] + outDiagNonZero[i];
+    }
+  }
+
+  BlockLSSMatrix& mat = getMethodData().getMatrix();
+  mat.createSeqBAIJ(nbEqs, nbLocal*nbEqs, nbStates*nbEqs, 0, &nnz[0], "Jacobian");
+  mat.setNbThreads(getMethodData().getNbThreads());
+
+  const string nsp = getMethodData().getNamespace();
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+  const CFuint globalSize = states.getGlobalSize()*nbEqs;
+  getMethodData().getSolVector().create(comm, nbLocal*nbEqs, globalSize, "sol");
+  getMethodData().getRhsVector().create(comm, nbLocal*nbEqs, globalSize, "rhs");
+
+  BlockLSSHalo& halo = getMethodData().getHalo();
+  halo.setup(comm, states.getGhostSendList(), states.getGhostReceiveList(),
+             localToLSS, nbLocal, nbEqs);
+
+  getMethodData().getKrylovSolver().setup(nbLocal*nbEqs, halo.getNbGhosts()*nbEqs,
+                                          getMethodData().getNbKrylovSpaces(),
+                                          getMethodData().isFlexible());
+
+  CFLog(VERBOSE, "StdSetup::execute() => [" << nbLocal << "] updatable states, ["
+        << nbStates - nbLocal << "] ghost states\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector<Common::SafePtr<BaseDataSocketSink> > StdSetup::needsSockets()
+{
+  std::vector<Common::SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_states);
+  result.push_back(&socket_nodes);
+  result.push_back(&socket_bStatesNeighbors);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,66 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_StdSetup_hh
+#define COOLFluiD_BlockLSS_StdSetup_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/Node.hh"
+#include "Framework/State.hh"
+
+#include "BlockLSS/BlockLSSData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This is a standard command to setup the BlockLSS method: the updatable
+/// states are numbered first and the ghost states after them, the matrix is
+/// preallocated from the Jacobian sparsity of the space method.
+class StdSetup : public BlockLSSCom {
+public:
+
+  /// Constructor
+  explicit StdSetup(const std::string& name);
+
+  /// Destructor
+  ~StdSetup();
+
+  /// Execute processing actions
+  void execute();
+
+  /// Returns the DataSocket's that this command needs as sinks
+  /// @return a vector of SafePtr with the DataSockets
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+protected: // data
+
+  /// socket for states
+  Framework::DataSocketSink<Framework::State*, Framework::GLOBAL> socket_states;
+
+  /// socket for nodes
+  Framework::DataSocketSink<Framework::Node*, Framework::GLOBAL> socket_nodes;
+
+  /// socket for the neighbor states of the boundary states
+  Framework::DataSocketSink<std::valarray<Framework::State*> > socket_bStatesNeighbors;
+
+}; // end of class StdSetup
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_BlockLSS_StdSetup_hh
@@ -0,0 +1,169 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/CFLog.hh"
+#include "Framework/LSSIdxMapping.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/PhysicalModel.hh"
+#include "Framework/SubSystemStatus.hh"
+
+#include "BlockLSS/BlockLSSModule.hh"
+#include "BlockLSS/StdSolveSys.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<StdSolveSys, BlockLSSData, BlockLSSModule>
+stdSolveSysProvider("StdSolveSys");
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdSolveSys::StdSolveSys(const std::string& name) :
+  BlockLSSCom(name),
+  socket_states("states"),
+  socket_rhs("rhs"),
+  m_upLocalIDs(),
+  m_upLSSIDs(),
+  m_hasPreconditioner(false)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdSolveSys::~StdSolveSys()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdSolveSys::setup()
+{
+  CFAUTOTRACE;
+
+  BlockLSSCom::setup();
+
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  const CFuint nbStates = states.size();
+  const CFuint nbEqs = getMethodData().getNbSysEquations();
+  const CFuint totalNbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const std::valarray<bool>& maskArray = *getMethodData().getMaskArray();
+  const LSSIdxMapping& idxMapping = getMethodData().getLocalToGlobalMapping();
+
+  m_upLocalIDs.clear();
+  m_upLSSIDs.clear();
+  for (CFuint i = 0; i < nbStates; ++i) {
+    if (states[i]->isParUpdatable()) {
+      CFuint lssID = idxMapping.getColID(states[i]->getLocalID())*nbEqs;
+      for (CFuint iEq = 0; iEq < totalNbEqs; ++iEq) {
+        if (maskArray[iEq]) {
+          m_upLocalIDs.push_back(i*totalNbEqs + iEq);
+          m_upLSSIDs.push_back(lssID++);
+        }
+      }
+    }
+  }
+
+  m_hasPreconditioner = false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdSolveSys::execute()
+{
+  CFAUTOTRACE;
+
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+  BlockLSSMatrix& mat = getMethodData().getMatrix();
+  BlockLSSVector& rhsVec = getMethodData().getRhsVector();
+  BlockLSSVector& solVec = getMethodData().getSolVector();
+  const CFuint vecSize = m_upLocalIDs.size();
+
+  // the non zero structure is complete after the first assembly
+  if (!mat.isFrozen()) {
+    mat.freezeNonZeroStructure();
+  }
+
+  for (CFuint i = 0; i < vecSize; ++i) {
+    rhsVec.setValue(m_upLSSIDs[i], rhs[m_upLocalIDs[i]]);
+  }
+
+  const CFuint nbIter = SubSystemStatusStack::getActive()->getNbIter();
+  if (getMethodData().getSaveRate() > 0) {
+    if (getMethodData().isSaveSystemToFile() || (nbIter%getMethodData().getSaveRate() == 0)) {
+      const string mFile = "mat-iter" + StringOps::to_str(nbIter) + ".dat";
+      mat.printToFile(mFile.c_str());
+      const string vFile = "rhs-iter" + StringOps::to_str(nbIter) + ".dat";
+      rhsVec.printToFile(vFile.c_str());
+    }
+  }
+
+  // reuse the preconditioner, also if the convergence method asks for it
+  // (e.g. when the jacobian is reused)
+  SafePtr<BlockPreconditioner> pc = getMethodData().getPreconditioner();
+  if (!m_hasPreconditioner || ((nbIter-1)%getMethodData().getPreconditionerRate() == 0 &&
+                               !getMethodData().reusePreconditioner())) {
+    pc->compute(mat);
+    m_hasPreconditioner = true;
+  }
+
+  CFreal resNorm = 0.;
+  const CFuint iter = getMethodData().getKrylovSolver().solve
+    (mat, getMethodData().getHalo(), *pc, rhsVec.getArray(), solVec.getArray(),
+     getMethodData().getMaxIterations(), getMethodData().getRelativeTolerance(),
+     getMethodData().getAbsoluteTolerance(), resNorm);
+  getMethodData().setNbIterations(iter);
+
+  // ask to stop the simulation if convergence is achieved at iteration 0
+  if (iter == 0) {
+    SubSystemStatusStack::getActive()->setStopSimulation(true);
+  }
+
+  if (getMethodData().isOutput()) {
+    CFLog(INFO, "BlockLSS convergence reached at iteration: " << iter
+          << ", residual: " << resNorm << "\n");
+  }
+  else {
+    CFLog(VERBOSE, "StdSolveSys::execute() => iterations [" << iter
+          << "], residual [" << resNorm << "]\n");
+  }
+
+  const CFreal *const sol = solVec.getArray();
+  for (CFuint i = 0; i < vecSize; ++i) {
+    rhs[m_upLocalIDs[i]] = sol[m_upLSSIDs[i]];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector<Common::SafePtr<BaseDataSocketSink> > StdSolveSys::needsSockets()
+{
+  std::vector<Common::SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_states);
+  result.push_back(&socket_rhs);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
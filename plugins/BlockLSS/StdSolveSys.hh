@@ -0,0 +1,72 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_StdSolveSys_hh
+#define COOLFluiD_BlockLSS_StdSolveSys_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/State.hh"
+
+#include "BlockLSS/BlockLSSData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This is a standard command to solve the linear system with BlockLSS
+class StdSolveSys : public BlockLSSCom {
+public:
+
+  /// Constructor
+  explicit StdSolveSys(const std::string& name);
+
+  /// Destructor
+  ~StdSolveSys();
+
+  /// Set up private data and data of the aggregated classes
+  void setup();
+
+  /// Execute processing actions
+  void execute();
+
+  /// Returns the DataSocket's that this command needs as sinks
+  /// @return a vector of SafePtr with the DataSockets
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+protected: // data
+
+  /// socket for states
+  Framework::DataSocketSink<Framework::State*, Framework::GLOBAL> socket_states;
+
+  /// socket for rhs
+  Framework::DataSocketSink<CFreal> socket_rhs;
+
+  /// IDs of the rhs entries of the updatable states
+  std::vector<CFuint> m_upLocalIDs;
+
+  /// IDs of the same entries in the system vectors
+  std::vector<CFuint> m_upLSSIDs;
+
+  /// flag telling if the preconditioner has been computed
+  bool m_hasPreconditioner;
+
+}; // end of class StdSolveSys
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_BlockLSS_StdSolveSys_hh
@@ -0,0 +1,45 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Framework/MethodCommandProvider.hh"
+
+#include "BlockLSS/BlockLSSModule.hh"
+#include "BlockLSS/StdUnSetup.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<StdUnSetup, BlockLSSData, BlockLSSModule>
+stdUnSetupProvider("StdUnSetup");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdUnSetup::execute()
+{
+  CFAUTOTRACE;
+
+  getMethodData().getSolVector().destroy();
+  getMethodData().getRhsVector().destroy();
+  getMethodData().getKrylovSolver().unsetup();
+  getMethodData().getHalo().unsetup();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -4,15 +4,20 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include <fstream>
+#include <sstream>
+
 #include "Common/PE.hh"
 #include "Common/PEFunctions.hh"
 #include "Common/Stopwatch.hh"
 #include "Common/CFLog.hh"
+#include "Common/FilesystemException.hh"
 
 #include "Environment/ObjectProvider.hh"
 #include "Environment/DirPaths.hh"
 
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/PhysicalModel.hh"
 #include "CFmeshFileReader/CFmeshReader.hh"
 #include "CFmeshFileReader/CFmeshFileReader.hh"
 
@@ -47,6 +52,7 @@ void CFmeshReader::defineConfigOptions(Config::OptionList& options)
    options.addConfigOption< std::string > ("convertFrom","Name of format from which to convert to CFmesh.");
    options.addConfigOption< bool > ("convertBack","Also convert back to the original format. Usefull only for debugging.");
    options.addConfigOption< bool > ("onlyConversion","Only convert the mesh without loading it into memory.");
+   options.addConfigOption< bool > ("UseConversionCache","Skip the conversion if the CFmesh file was converted from the same file with the same options.");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -79,6 +85,9 @@ CFmeshReader::CFmeshReader(const std::string& name)  : MeshCreator(name)
 
   m_convertBack = false;
   setParameter("convertBack",&m_convertBack);
+
+  m_useConversionCache = false;
+  setParameter("UseConversionCache",&m_useConversionCache);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -200,12 +209,39 @@ void CFmeshReader::convert(Common::SelfRegistPtr<MeshFormatConverter> converter)
   path fromfile = DirPaths::getInstance().getWorkingDir() / m_data->getConvertFromFileName();
   path tofile   = DirPaths::getInstance().getWorkingDir() / m_data->getFileName();
 
+  // the key of the last conversion is stored next to the CFmesh file
+  path keyfile = tofile;
+  keyfile = boost::filesystem::change_extension(keyfile, ".convkey");
+  std::string key;
+  if (m_useConversionCache)
+  {
+    key = getConversionKey(converter, fromfile);
+    if (exists(tofile) && exists(keyfile))
+    {
+      std::ifstream fin(keyfile.string().c_str());
+      std::string storedKey;
+      std::getline(fin, storedKey);
+      if (storedKey == key)
+      {
+        CFLog(INFO, "CFmeshReader::convert() => " << tofile.string()
+              << " is up to date with " << fromfile.string() << ", conversion skipped\n");
+        return;
+      }
+    }
+  }
+
 #ifndef NDEBUG
   converter->checkFormat(fromfile);
 #endif
 
   converter->convert(fromfile, tofile);
 
+  if (m_useConversionCache)
+  {
+    std::ofstream fout(keyfile.string().c_str());
+    fout << key << "\n";
+  }
+
   if (m_convertBack)
   {
     path backfile(DirPaths::getInstance().getWorkingDir());
@@ -217,6 +253,54 @@ void CFmeshReader::convert(Common::SelfRegistPtr<MeshFormatConverter> converter)
 
 //////////////////////////////////////////////////////////////////////////////
 
+std::string CFmeshReader::getConversionKey
+(Common::SelfRegistPtr<MeshFormatConverter> converter,
+ const boost::filesystem::path& fromfile) const
+{
+  CFAUTOTRACE;
+
+  Stopwatch<WallTime> stp;
+  stp.start();
+
+  // 64-bit FNV-1a hash of the file content
+  const boost::uint64_t fnvPrime = 1099511628211ULL;
+  boost::uint64_t hash = 14695981039346656037ULL;
+
+  std::ifstream fin(fromfile.string().c_str(), std::ios::binary);
+  if (!fin) {
+    throw FilesystemException (FromHere(),"Could not open file: " + fromfile.string());
+  }
+
+  std::vector<char> buffer(1 << 20);
+  while (fin) {
+    fin.read(&buffer[0], buffer.size());
+    const std::streamsize nbRead = fin.gcount();
+    for (std::streamsize i = 0; i < nbRead; ++i) {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= fnvPrime;
+    }
+  }
+
+  // the options of the converter and the number of equations,
+  // which is written in the CFmesh file
+  std::ostringstream key;
+  key << converter->getName() << " " << PhysicalModelStack::getActive()->getNbEq();
+  const std::string convTag = "." + m_converterStr + ".";
+  for (Config::ConfigArgs::const_iterator it = m_stored_args.begin(); it != m_stored_args.end(); ++it) {
+    if (it->first.find(convTag) != std::string::npos) {
+      key << " " << it->first << "=" << it->second;
+    }
+  }
+  key << " " << std::hex << hash;
+
+  stp.stop();
+  CFLog(VERBOSE, "CFmeshReader::getConversionKey() => hashing took " << stp.read() << "s\n");
+
+  return key.str();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void CFmeshReader::modifyFileNameForRestart(const std::string filename)
 {
   m_data->setFileName(filename);
@@ -85,6 +85,11 @@ private:  // helper functions
   
   /// Helper function that actually does the job for converting
   void convert(Common::SelfRegistPtr<Framework::MeshFormatConverter> converter);
+
+  /// @return the key identifying a conversion: the converter, its options
+  ///         and a hash of the content of the file to convert
+  std::string getConversionKey(Common::SelfRegistPtr<Framework::MeshFormatConverter> converter,
+                               const boost::filesystem::path& fromfile) const;
   
 private: // data
 
@@ -118,6 +123,10 @@ private: // data
   
   /// option to choose to only convert the mesh without loading it into memory
   bool m_onlyConversion;
+
+  /// option to skip the conversion if the CFmesh file was already converted
+  /// from the same file with the same options
+  bool m_useConversionCache;
   
   /// stored configuration arguments
   /// @todo this should be avoided and removed.
@@ -38,6 +38,10 @@ barthJesp3DProvider("BarthJesp3D");
 BarthJesp::BarthJesp(const std::string& name) :
   Limiter<CellCenterFVMData>(name),
   socket_stencil("stencil"),
+  socket_stencilOffsets("stencilOffsets", false),
+  socket_stencilIDs("stencilIDs", false),
+  socket_states("states"),
+  socket_gstates("gstates", false),
   socket_uX("uX"),
   socket_uY("uY"),
   socket_uZ("uZ")
@@ -57,6 +61,39 @@ BarthJesp::~BarthJesp()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void BarthJesp::computeStencilExtrema(const State& state, CFuint iVar,
+				      CFreal& min0, CFreal& max0)
+{
+  const CFuint stateID = state.getLocalID();
+  
+  if (!socket_stencilIDs.isConnected()) {
+    DataHandle< vector<State*> > stencil = socket_stencil.getDataHandle();
+    const vector<State*>& s = stencil[stateID];
+    for (CFuint is = 0; is < s.size(); ++is) {
+      State *const currState = s[is];
+      if(&state != currState) {
+	min0 = min(min0,(*currState)[iVar]);
+	max0 = max(max0,(*currState)[iVar]);
+      }
+    }
+    return;
+  }
+  
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  DataHandle<State*> gstates = socket_gstates.getDataHandle();
+  DataHandle<CFuint> stencilOffsets = socket_stencilOffsets.getDataHandle();
+  DataHandle<CompactStencil::IDType> stencilIDs = socket_stencilIDs.getDataHandle();
+  
+  // the compact stencil of a state never includes the state itself
+  for (CFuint in = stencilOffsets[stateID]; in < stencilOffsets[stateID+1]; ++in) {
+    const State *const currState = CompactStencil::getState(stencilIDs[in], states, gstates);
+    min0 = min(min0,(*currState)[iVar]);
+    max0 = max(max0,(*currState)[iVar]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void BarthJesp::limit(const vector<vector<Node*> >& coord,
 		      GeometricEntity* const cell,
 		      CFreal* limiterValue)
@@ -64,8 +101,6 @@ void BarthJesp::limit(const vector<vector<Node*> >& coord,
   DataHandle<CFreal> uX = socket_uX.getDataHandle();
   DataHandle<CFreal> uY = socket_uY.getDataHandle();
   DataHandle<CFreal> uZ = socket_uZ.getDataHandle();
-  DataHandle< vector<State*> > stencil = socket_stencil.getDataHandle();
-  
   const GeomEntList *const faces = cell->getNeighborGeos();
   const CFuint nbFaces = faces->size();
   const State *const state = cell->getState(0);
@@ -80,14 +115,7 @@ void BarthJesp::limit(const vector<vector<Node*> >& coord,
     
     if (this->m_useFullStencil) { 
       if (!this->m_useNodalExtrapolationStencil) {
-	const vector<State*>& s = stencil[stateID];
-	for (CFuint is = 0; is < s.size(); ++is) {
-	  State *const currState = s[is];
-	  if(state != currState) {
-	    min0 = min(min0,(*currState)[iVar]);
-	    max0 = max(max0,(*currState)[iVar]);
-	  }
-	}
+	computeStencilExtrema(*state, iVar, min0, max0);
       }
       else {
 	// old method kept for backward compatibility: it may escludes some ghost states at corners
@@ -153,6 +181,28 @@ void BarthJesp::limit(const vector<vector<Node*> >& coord,
   }
 } 
       
+//////////////////////////////////////////////////////////////////////////////
+
+void BarthJesp::limitIncrements(CFuint nbEqs, CFuint nbPoints,
+				const CFreal* deltaPlusMax, const CFreal* deltaPlusMin,
+				const CFreal* deltaMin, CFreal avgDistance,
+				CFreal* limiterValue) const
+{
+  for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+    limiterValue[iVar] = 1.1;
+  }
+  
+  // as in limit(), a zero increment keeps the previous psi (1 at first)
+  for (CFuint ip = 0; ip < nbPoints; ++ip) {
+    const CFreal *const d = &deltaMin[ip*nbEqs];
+    for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+      const CFreal dPlus = (d[iVar] > 0.0) ? deltaPlusMax[iVar] : deltaPlusMin[iVar];
+      const CFreal psi = (d[iVar] != 0.0) ? min((CFreal)1.0, dPlus/d[iVar]) : 1.0;
+      limiterValue[iVar] = min(psi, limiterValue[iVar]);
+    }
+  }
+}
+  
 //////////////////////////////////////////////////////////////////////////////
   
 std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > BarthJesp::needsSockets()
@@ -160,6 +210,10 @@ std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > BarthJesp::needsSoc
   std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > result = 
     Framework::Limiter<CellCenterFVMData>::needsSockets();
   result.push_back(&socket_stencil);
+  result.push_back(&socket_stencilOffsets);
+  result.push_back(&socket_stencilIDs);
+  result.push_back(&socket_states);
+  result.push_back(&socket_gstates);
   result.push_back(&socket_uX);
   result.push_back(&socket_uY);  
   result.push_back(&socket_uZ);
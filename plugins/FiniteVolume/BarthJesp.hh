@@ -7,6 +7,7 @@
 #include "Framework/Storage.hh"
 #include "Framework/DataSocketSink.hh"
 #include "FiniteVolume/CellCenterFVMData.hh"
+#include "FiniteVolume/CompactStencil.hh"
 
 #ifdef CF_HAVE_CUDA
 #include "FiniteVolume/CellData.hh"
@@ -140,11 +141,44 @@ public:
 	     Framework::GeometricEntity* const cell,
 	     CFreal* limiterValue);
   
+  /**
+   * Compute the limiter of one cell from the extrema in its stencil and
+   * from the increments at its quadrature points
+   */
+  virtual void limitIncrements(CFuint nbEqs, CFuint nbPoints,
+			       const CFreal* deltaPlusMax, const CFreal* deltaPlusMin,
+			       const CFreal* deltaMin, CFreal avgDistance,
+			       CFreal* limiterValue) const;
+  
+  /// @return true since limitIncrements() is implemented
+  virtual bool hasIncrementsKernel() const {return true;}
+  
+private:
+  
+  /**
+   * Updates the extrema of the given variable over the reconstruction
+   * stencil of the given state, using the compact stencil if available
+   */
+  void computeStencilExtrema(const Framework::State& state, CFuint iVar,
+			     CFreal& min0, CFreal& max0);
+  
 private:
   
   /// storage for the stencil via pointers to neighbors
   Framework::DataSocketSink<std::vector<Framework::State*> > socket_stencil;
   
+  /// socket for the offsets of the compact stencil
+  Framework::DataSocketSink<CFuint> socket_stencilOffsets;
+  
+  /// socket for the neighbor IDs of the compact stencil
+  Framework::DataSocketSink<CompactStencil::IDType> socket_stencilIDs;
+  
+  /// socket for states
+  Framework::DataSocketSink<Framework::State*, Framework::GLOBAL> socket_states;
+  
+  /// socket for ghost states
+  Framework::DataSocketSink<Framework::State*> socket_gstates;
+  
   /// socket for uX values
   Framework::DataSocketSink< CFreal> socket_uX;
   
@@ -0,0 +1,61 @@
+#include "Common/CFLog.hh"
+#include "Common/BadValueException.hh"
+
+#include "FiniteVolume/CompactStencil.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CompactStencil::build(DataHandle<vector<State*> > stencil,
+			   DataHandle<CFuint> offsets,
+			   DataHandle<IDType> ids)
+{
+  CFAUTOTRACE;
+
+  const CFuint nbStates = stencil.size();
+  offsets.resize(nbStates + 1);
+  offsets[0] = 0;
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    offsets[iState+1] = offsets[iState] + stencil[iState].size();
+  }
+
+  ids.resize(offsets[nbStates]);
+  CFuint count = 0;
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    const vector<State*>& s = stencil[iState];
+    for (CFuint in = 0; in < s.size(); ++in) {
+      const CFuint localID = s[in]->getLocalID();
+      if (localID >= GHOST_FLAG) {
+	throw BadValueException
+	  (FromHere(), "CompactStencil::build() => local ID too big for 31 bits");
+      }
+      ids[count++] = getID(*s[in]);
+    }
+  }
+
+  CFLog(VERBOSE, "CompactStencil::build() => " << count << " neighbors for "
+	<< nbStates << " states\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,80 @@
+#ifndef COOLFluiD_Numerics_FiniteVolume_CompactStencil_hh
+#define COOLFluiD_Numerics_FiniteVolume_CompactStencil_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/State.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class gives access to the reconstruction stencil stored in compressed
+ * sparse row format, in the sockets "stencilOffsets" and "stencilIDs":
+ * the neighbors of state iState are the IDs between stencilOffsets[iState]
+ * and stencilOffsets[iState+1]. Each ID is the 32-bit local ID of a state,
+ * or, if the highest bit is set, the local ID of a ghost state.
+ */
+class CompactStencil {
+public:
+
+  /// type of the neighbor IDs
+  typedef unsigned int IDType;
+
+  /// flag set in the IDs of the ghost states
+  static const IDType GHOST_FLAG = 0x80000000u;
+
+  /**
+   * Fills the compact stencil from the stencil made of pointers
+   * @param stencil  per state vector of neighbor states
+   * @param offsets  resized to nbStates+1
+   * @param ids      resized to the total number of neighbors
+   */
+  static void build(Framework::DataHandle<std::vector<Framework::State*> > stencil,
+		    Framework::DataHandle<CFuint> offsets,
+		    Framework::DataHandle<IDType> ids);
+
+  /// @return true if the given ID identifies a ghost state
+  static bool isGhost(IDType id) {return (id & GHOST_FLAG) != 0;}
+
+  /// @return the local ID of the (ghost) state with the given ID
+  static CFuint getLocalID(IDType id) {return id & ~GHOST_FLAG;}
+
+  /// @return the ID of the given (ghost) state
+  static IDType getID(const Framework::State& state)
+  {
+    return (!state.isGhost()) ? state.getLocalID() : (state.getLocalID() | GHOST_FLAG);
+  }
+
+  /// @return the state with the given ID
+  static Framework::State* getState
+  (IDType id,
+   Framework::DataHandle<Framework::State*, Framework::GLOBAL>& states,
+   Framework::DataHandle<Framework::State*>& gstates)
+  {
+    return (!isGhost(id)) ? states[id] : gstates[getLocalID(id)];
+  }
+
+}; // end of class CompactStencil
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_FiniteVolume_CompactStencil_hh
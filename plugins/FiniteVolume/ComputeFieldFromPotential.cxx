@@ -50,6 +50,12 @@ void ComputeFieldFromPotential::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< CFreal >
     ("DeltaSelection",
      "Distance within which points in the smaller mesh are selected.");
+  options.addConfigOption< string >
+    ("InterpolationMethod",
+     "Interpolation from the smaller mesh: Nearest or InverseDistance.");
+  options.addConfigOption< CFuint >
+    ("NbNeighbours",
+     "Number of donor states for the InverseDistance interpolation.");
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -64,7 +70,13 @@ ComputeFieldFromPotential::ComputeFieldFromPotential(const std::string& name) :
   socket_otherUY("uY"),
   socket_otherUZ("uZ"),
   socket_otherStates("states"),
-  m_applyProcessing(true)
+  m_applyProcessing(true),
+  m_transfer(),
+  m_internalStateIDs(),
+  m_externalStateIDs(),
+  m_externalDonorIDs(),
+  m_externalDist(),
+  m_transferBuilt(false)
 {
   addConfigOptionsTo(this);
   
@@ -79,6 +91,12 @@ ComputeFieldFromPotential::ComputeFieldFromPotential(const std::string& name) :
 
   m_deltaSelection = 0.;
   setParameter("DeltaSelection", &m_deltaSelection);
+
+  m_interpolationMethod = "Nearest";
+  setParameter("InterpolationMethod", &m_interpolationMethod);
+  
+  m_nbNeighbours = 4;
+  setParameter("NbNeighbours", &m_nbNeighbours);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -185,253 +203,52 @@ void ComputeFieldFromPotential::execute()
       }
     }
     else {
-      DataHandle<State*, GLOBAL> otherStates = socket_otherStates.getDataHandle(); // SMALLER mesh
-      
-      // loop over internal faces
-      //   if face has all its nodes radius < (m_interRadius + eps) and > (m_interRadius - eps)
-      //     store the face states (or stateIDs) whose radius < m_interRadius as interStates
-      //     those states will be those within which looking for the matching "fronteer" otherStates 
-      vector<State*> interStates;
-      interStates.reserve(otherStates.size()/4); // rough estimation
-      
-      SafePtr<TopologicalRegionSet> faces = MeshDataStack::getActive()->getTrs("InnerFaces");
-      SafePtr<GeometricEntityPool<FaceTrsGeoBuilder> > faceBuilder = 
-	this->getMethodData().getFaceTrsGeoBuilder();
-      FaceTrsGeoBuilder::GeoData& geoData = faceBuilder->getDataGE();
-      SafePtr<FaceTrsGeoBuilder> faceBuilderPtr = faceBuilder->getGeoBuilder();
-      faceBuilderPtr->setDataSockets(socket_states, socket_gstates, socket_nodes);
-      geoData.trs = faces;
-      geoData.isBFace = false;
-
-      cf_assert(m_deltaSelection > 0.);
-      const CFreal rMax = m_interRadius + m_deltaSelection;
-      const CFreal rMin = m_interRadius - m_deltaSelection;
-      
-      const CFuint nbFaces = faces->getLocalNbGeoEnts();
-      for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
-	geoData.idx = iFace;
-	const GeometricEntity *const face = faceBuilder->buildGE();
-	const vector<Node*>& nodesInFace = face->getNodes();
-	const CFuint nbNodesInFace = nodesInFace.size();
-	cf_assert(nbNodesInFace > 1);
-	CFuint countInterNodes = 0;
-	CFreal radius = 0.;
-	for (CFuint iNode = 0; iNode < nbNodesInFace; ++iNode) {
-	  radius = nodesInFace[iNode]->norm2();
-	  if (radius < rMax && radius > rMin) {
-	    countInterNodes++;
-	  }
-	}
-	if (countInterNodes == nbNodesInFace) {
-	  // store state on the inner side of the internal surface
-	  const CFreal radius0 = face->getState(0)->getCoordinates().norm2();
-	  const CFreal radius1 = face->getState(1)->getCoordinates().norm2();
-	  (radius0 < radius1) ? interStates.push_back(face->getState(0)) : interStates.push_back(face->getState(1)); 
-	  CFLog(DEBUG_MIN, "ComputeFieldFromPotential::execute() => #" << interStates.size() <<  " face with radius [" << radius << "] detected\n");
-	}
-	faceBuilder->releaseGE();
-      }
-
-      const CFreal maxFloat = std::numeric_limits<double>::max();
-      
-      // find the closest otherStates for each of the selected interStates
-      const CFuint nbOtherStates = otherStates.size();
-      const CFuint nbInterStates = interStates.size();
-      vector<State*> interOtherStates(nbInterStates); // internal states (smaller mesh) attached to m_interRadius boundary
-      vector<CFreal> distMin(nbInterStates, maxFloat);
-      for (CFuint iState = 0; iState < nbInterStates; ++iState) {
-	const Node& coord = interStates[iState]->getCoordinates();
-	for (CFuint jState = 0; jState < nbOtherStates; ++jState) {
-	  const CFreal dist2 = MathFunctions::getSquaredDistance(coord, otherStates[jState]->getCoordinates());
-	  if (dist2 < distMin[iState]) {
-	    distMin[iState] = dist2;
-	    interOtherStates[iState] = otherStates[jState];
-	  }
-	}
-	
-	CFLog(DEBUG_MIN, "ComputeFieldFromPotential::execute() => distMin[" << iState << "] = " << std::sqrt(distMin[iState]) << "\n");
+      if (!m_transferBuilt) {
+	buildTransfer();
       }
       
-      // count the external states and store the corresponding state IDs in a list
-      vector<State*> externalStates;
-      externalStates.reserve(nbStates); // size overestimated to avoid reallocation
-      vector<State*> internalStates;
-      internalStates.reserve(nbStates); // size overestimated to avoid reallocation
-      
-      const CFreal radiusPFSS = m_interRadius + m_deltaSelection;
-      for (CFuint iState = 0; iState < nbStates; ++iState) {
-	if (states[iState]->getCoordinates().norm2() > radiusPFSS) {
-	  cf_assert(iState == states[iState]->getLocalID());
-	  externalStates.push_back(states[iState]);
-	}
-	else {
-	  internalStates.push_back(states[iState]);
-	}
-      }
-      cf_assert(externalStates.size() + internalStates.size() == nbStates);
-      
-      CFLog(INFO, "ComputeFieldFromPotential::execute() => detected [" << externalStates.size() << "] external states\n");
-      
-      // loop over all otherStates
-      //   if state radius > m_interRadius
-      //     loop over all interStates to find the closest state and store the minimal distance
-      //   else increment internal state counter (which will have to match otherStates.size() at the end)
-      const CFuint nbExternalStates = externalStates.size();
-
-      vector<State*> closestStates(nbExternalStates);
-      RealVector closestStateDist(maxFloat, nbExternalStates);
-      
-      for (CFuint iState = 0; iState < nbExternalStates; ++iState) {
-	const Node& coord = externalStates[iState]->getCoordinates();
-	for (CFuint jState = 0; jState < nbInterStates; ++jState) {
-	  State* const intState = interOtherStates[jState];
-	  // use square distance for comparison since it is faster to compute 
-	  const CFreal dist2 =
-	    MathFunctions::getSquaredDistance(coord, intState->getCoordinates());
-	  if (dist2 < closestStateDist[iState]) {
-	    closestStateDist[iState] = dist2;
-	    closestStates[iState] = intState;
-	  }
-	}
-      }            
-      closestStateDist = sqrt(closestStateDist);
-      
-      const CFuint nbInternalStates = internalStates.size();
-      vector<State*> closestInternalStates(nbInternalStates);
-
-      for (CFuint iState = 0; iState < nbInternalStates; ++iState) {
-	const Node& coord = internalStates[iState]->getCoordinates();
-	CFreal distMin = maxFloat;
-	for (CFuint jState = 0; jState < nbOtherStates; ++jState) {
-	  State* const intState = otherStates[jState];
-	  // use square distance for comparison since it is faster to compute 
-	  const CFreal dist2 =
-	    MathFunctions::getSquaredDistance(coord, intState->getCoordinates());
-	  if (dist2 < distMin) {
-	    distMin = dist2;
-	    closestInternalStates[iState] = intState;
-	  }
-	}
-      } 
-      
-      // from here on:
-      // 1) externalStates[k]   gives the State from LARGER mesh with radius > m_interRadius 
-      // 2) closestStates[k]    gives the State from SMALLER mesh to be used for extrapolation
-      // 3) closestStateDist[k] gives the distance between 1) and 2)
-      // 4) closestInternalStates[k]->getLocalID() gives the state ID to be used to fetch the gradient in uX, uY, uZ
-      CFLog(VERBOSE, "size internalStates => " << internalStates[0]->size() << "\n");
-      CFLog(VERBOSE, "size closestInternalStates  => " << closestInternalStates[0]->size() << "\n");
-
-      // array to keep track of the state IDs that correspond to internal and external states
-      vector<bool> flag(nbStates, false);
-      
-      // for (CFuint iState = 0; iState < nbExternalStates; ++iState) {
-      //	const CFuint estateID = externalStates[iState]->getLocalID();
-      //	const CFuint ostateID = closestStates[iState]->getLocalID();
-      /// use ux_i[ostateID] to compute Br, Btheta, Bphi
-      //	flag[estateID] = true;
-      //	(*states[estateID])[xVar] = ux[ostateID];
-      //	(*states[estateID])[yVar] = uy[ostateID];
-      //	if (dim == DIM_3D) {
-      //	  (*states[estateID])[zVar] = uz[ostateID];
-      //	}
-      // }
-
-      // from here on:
-      // 1) internalStates[k]   gives the State from LARGER mesh with radius < m_interRadius 
-      // 2) closestStates[k]    gives the State from SMALLER mesh to be used for extrapolation
-      // 3) closestStateDist[k] gives the distance between 1) and 2)
-      // 4) closestStates[k]->getLocalID() gives the state ID to be used to fetch the gradient in uX, uY, uZ
-            
-      CFLog(VERBOSE, "size internalStates => " << internalStates[0]->size() << "\n");
-      CFLog(VERBOSE, "size closestStates  => " << closestStates[0]->size() << "\n");
-      CFLog(VERBOSE, "size internalStates => " << internalStates[0]->size() << "\n");
-      CFLog(VERBOSE, "size closestInternalStates  => " << closestInternalStates[0]->size() << "\n");
+      DataHandle<State*, GLOBAL> otherStates = socket_otherStates.getDataHandle(); // SMALLER mesh
       
+      // states inside the internal boundary: interpolation of the field of the SMALLER mesh
+      const CFuint nbInternalStates = m_internalStateIDs.size();
       for (CFuint iState = 0; iState < nbInternalStates; ++iState) {
-	const CFuint istateID = internalStates[iState]->getLocalID();
-	const CFuint ostateID = closestInternalStates[iState]->getLocalID();
-	flag[istateID] = true;
-	/// use ux_i[ostateID] to compute Br, Btheta, Bphi
-	(*states[istateID])[xVar] = ux[ostateID];
-	(*states[istateID])[yVar] = uy[ostateID];
+	State& state = *states[m_internalStateIDs[iState]];
+	state[xVar] = m_transfer.interpolate(iState, ux);
+	state[yVar] = m_transfer.interpolate(iState, uy);
 	if (dim == DIM_3D) {
-	  (*states[istateID])[zVar] = uz[ostateID];
+	  state[zVar] = m_transfer.interpolate(iState, uz);
 	}
       }
       
       //<<<<<<<<<<< HERE FOLLOWS THE EXTRAPOLATION ONTO THE OUTER MESH >>>>>>>>>>>>>>>>>
       
-      cout << "Number of external states: " << nbExternalStates << endl;
-      
-      // Loop over the external states that have not yet been assigned field values:
-      for (CFuint iState=0; iState<nbExternalStates; ++iState) {
-	const CFuint estateID = externalStates[iState]->getLocalID();
-	const CFuint ostateID = closestStates[iState]->getLocalID();
-	flag[estateID] = true;
-	
-	const CFreal Bx = ux[ostateID];
-	const CFreal By = uy[ostateID];
-	const CFreal Bz = uz[ostateID];
-	const CFreal normB = std::sqrt(Bx*Bx+By*By+Bz*Bz);
-	
-	// Query x,y,z of the current external state
-	const CFreal xe = (externalStates[iState]->getCoordinates())[0];
-	const CFreal ye = (externalStates[iState]->getCoordinates())[1];
-	const CFreal ze = (externalStates[iState]->getCoordinates())[2];
-	const CFreal re = externalStates[iState]->getCoordinates().norm2();
-	
-	// Query x,y,z from the closest state:
-	const CFreal x = (closestStates[iState]->getCoordinates())[0];
-	const CFreal y = (closestStates[iState]->getCoordinates())[1];
-	const CFreal z = (closestStates[iState]->getCoordinates())[2];
-	const CFreal r = closestStates[iState]->getCoordinates().norm2();
+      const CFuint nbExternalStates = m_externalStateIDs.size();
+      for (CFuint iState = 0; iState < nbExternalStates; ++iState) {
+	const CFuint estateID = m_externalStateIDs[iState];
+	const CFuint ostateID = m_externalDonorIDs[iState];
 	
-	// Compute theta and phi of the current external state from x,y,z
-	// theta = std::atan2(std::sqrt(x*x + y*y),z);
-	// phi = std::atan2(y,x);
+	// x,y,z of the current external state and of the closest state
+	const Node& coordE = states[estateID]->getCoordinates();
+	const Node& coordO = otherStates[ostateID]->getCoordinates();
+	const CFreal re = coordE.norm2();
+	const CFreal r = coordO.norm2();
 	
-	// Compute components Br, Btheta, Bphi at the source surface of ostate:
+	// Br at the source surface of ostate:
 	// Br = sin(theta)*cos(phi)*Bx + sin(theta)*sin(phi)*By + cos(theta)*Bz;
-	// Btheta = cos(theta)*cos(phi)*Bx + cos(theta)*sin(phi)*By - sin(theta)*Bz;
-	// Bphi = -sin(phi)*Bx + cos(phi)*By;
-	const CFreal Br = (x*Bx + y*By + z*Bz)/r;
-	
-	// Check whether Btheta and Bphi are small (ideally exactly zero)
-	// cout << "Btheta: " << Btheta << endl;
-	// cout << "Bphi: " << Bphi << endl;
+	const CFreal Br = (coordO[XX]*ux[ostateID] + coordO[YY]*uy[ostateID] + coordO[ZZ]*uz[ostateID])/r;
 	
 	// Do the extrapolation:
-	const CFreal dist = closestStateDist[iState];
-	// cout << "dist: " << dist << endl;
+	const CFreal dist = m_externalDist[iState];
 	const CFreal Bre = Br/(dist*dist);
-      
-	// From extrapolated Bre compute Bxe, Bye, Bze assuming a purely radial field
-	// Bxe = sin(theta)*cos(phi)*Bre;
-	// Bye = sin(theta)*sin(phi)*Bre;
-	// Bze = cos(theta)*Bre;
-	const CFreal Bxe = (xe/re)*Bre;
-	const CFreal Bye = (ye/re)*Bre;
-	const CFreal Bze = (ze/re)*Bre;
 	
-	// Write the extrapolated cartesian field values to the extended mesh:
-	// Just for checking where the patching error comes from: write 1.0 to states
-	(*states[estateID])[xVar] = Bxe;
-	(*states[estateID])[yVar] = Bye;
+	// From extrapolated Bre compute Bxe, Bye, Bze assuming a purely radial field
+	(*states[estateID])[xVar] = (coordE[XX]/re)*Bre;
+	(*states[estateID])[yVar] = (coordE[YY]/re)*Bre;
 	if (dim == DIM_3D) {
-	  (*states[estateID])[zVar] = Bze;
+	  (*states[estateID])[zVar] = (coordE[ZZ]/re)*Bre;
 	}   
       }
       
-      cf_assert(nbInternalStates + nbExternalStates == states.size());
-      
-      for (CFuint i = 0; i < nbStates; ++i) {
-	if (!flag[i]) {
-	  CFLog(INFO, "ComputeFieldFromPotential::execute() => stateID [" << i<< "] not found during extrapolation\n");
-	  cf_assert(flag[i]);
-	}
-      }
-      
       CFLog(INFO,"ComputeFieldFromPotential::execute() => extrapolation took " << stp.read() << "s\n");
     }
 
@@ -458,6 +275,127 @@ void ComputeFieldFromPotential::execute()
   CFLog(VERBOSE, "ComputeFieldFromPotential::execute() => END\n");
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+void ComputeFieldFromPotential::buildTransfer()
+{
+  CFAUTOTRACE;
+  
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle(); // LARGER mesh
+  DataHandle<State*, GLOBAL> otherStates = socket_otherStates.getDataHandle(); // SMALLER mesh
+  const CFuint nbStates = states.size();
+  
+  // loop over internal faces
+  //   if face has all its nodes radius < (m_interRadius + eps) and > (m_interRadius - eps)
+  //     store the face states (or stateIDs) whose radius < m_interRadius as interStates
+  //     those states will be those within which looking for the matching "fronteer" otherStates 
+  vector<State*> interStates;
+  interStates.reserve(otherStates.size()/4); // rough estimation
+  
+  SafePtr<TopologicalRegionSet> faces = MeshDataStack::getActive()->getTrs("InnerFaces");
+  SafePtr<GeometricEntityPool<FaceTrsGeoBuilder> > faceBuilder = 
+    this->getMethodData().getFaceTrsGeoBuilder();
+  FaceTrsGeoBuilder::GeoData& geoData = faceBuilder->getDataGE();
+  SafePtr<FaceTrsGeoBuilder> faceBuilderPtr = faceBuilder->getGeoBuilder();
+  faceBuilderPtr->setDataSockets(socket_states, socket_gstates, socket_nodes);
+  geoData.trs = faces;
+  geoData.isBFace = false;
+
+  cf_assert(m_deltaSelection > 0.);
+  const CFreal rMax = m_interRadius + m_deltaSelection;
+  const CFreal rMin = m_interRadius - m_deltaSelection;
+  
+  const CFuint nbFaces = faces->getLocalNbGeoEnts();
+  for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+    geoData.idx = iFace;
+    const GeometricEntity *const face = faceBuilder->buildGE();
+    const vector<Node*>& nodesInFace = face->getNodes();
+    const CFuint nbNodesInFace = nodesInFace.size();
+    cf_assert(nbNodesInFace > 1);
+    CFuint countInterNodes = 0;
+    CFreal radius = 0.;
+    for (CFuint iNode = 0; iNode < nbNodesInFace; ++iNode) {
+      radius = nodesInFace[iNode]->norm2();
+      if (radius < rMax && radius > rMin) {
+        countInterNodes++;
+      }
+    }
+    if (countInterNodes == nbNodesInFace) {
+      // store state on the inner side of the internal surface
+      const CFreal radius0 = face->getState(0)->getCoordinates().norm2();
+      const CFreal radius1 = face->getState(1)->getCoordinates().norm2();
+      (radius0 < radius1) ? interStates.push_back(face->getState(0)) : interStates.push_back(face->getState(1)); 
+      CFLog(DEBUG_MIN, "ComputeFieldFromPotential::buildTransfer() => #" << interStates.size() <<  " face with radius [" << radius << "] detected\n");
+    }
+    faceBuilder->releaseGE();
+  }
+
+  // the states of the SMALLER mesh are the donors of the interpolation
+  const CFuint nbOtherStates = otherStates.size();
+  vector<CFreal> otherCoords(nbOtherStates*dim);
+  for (CFuint jState = 0; jState < nbOtherStates; ++jState) {
+    cf_assert(jState == otherStates[jState]->getLocalID());
+    const Node& coord = otherStates[jState]->getCoordinates();
+    for (CFuint d = 0; d < dim; ++d) {
+      otherCoords[jState*dim + d] = coord[d];
+    }
+  }
+  
+  m_transfer.clear();
+  m_transfer.setMethod(InterMeshTransfer::getMethod(m_interpolationMethod), m_nbNeighbours);
+  m_transfer.setDonorPoints(otherCoords, dim);
+  
+  // find the closest otherStates for each of the selected interStates:
+  // those are the internal states (smaller mesh) attached to m_interRadius boundary
+  const CFuint nbInterStates = interStates.size();
+  vector<CFuint> interOtherIDs(nbInterStates);
+  vector<CFreal> interOtherCoords(nbInterStates*dim);
+  CFreal dist2 = 0.;
+  for (CFuint iState = 0; iState < nbInterStates; ++iState) {
+    const CFuint otherID = m_transfer.findNearest(interStates[iState]->getCoordinates(), dist2);
+    interOtherIDs[iState] = otherID;
+    for (CFuint d = 0; d < dim; ++d) {
+      interOtherCoords[iState*dim + d] = otherCoords[otherID*dim + d];
+    }
+    CFLog(DEBUG_MIN, "ComputeFieldFromPotential::buildTransfer() => distMin[" << iState << "] = " << std::sqrt(dist2) << "\n");
+  }
+  
+  InterMeshTransfer interSearch;
+  interSearch.setDonorPoints(interOtherCoords, dim);
+  
+  // the states beyond the internal boundary (external) get the field extrapolated
+  // from the closest interOtherState, the other ones (internal) the field
+  // interpolated from the otherStates
+  m_internalStateIDs.clear();
+  m_externalStateIDs.clear();
+  m_externalDonorIDs.clear();
+  m_externalDist.clear();
+  m_transfer.clearStencils();
+  
+  const CFreal radiusPFSS = m_interRadius + m_deltaSelection;
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    cf_assert(iState == states[iState]->getLocalID());
+    const Node& coord = states[iState]->getCoordinates();
+    if (coord.norm2() > radiusPFSS) {
+      const CFuint interID = interSearch.findNearest(coord, dist2);
+      m_externalStateIDs.push_back(iState);
+      m_externalDonorIDs.push_back(interOtherIDs[interID]);
+      m_externalDist.push_back(std::sqrt(dist2));
+    }
+    else {
+      m_internalStateIDs.push_back(iState);
+      m_transfer.addStencil(coord);
+    }
+  }
+  cf_assert(m_externalStateIDs.size() + m_internalStateIDs.size() == nbStates);
+  cf_assert(m_transfer.getNbStencils() == m_internalStateIDs.size());
+  
+  CFLog(INFO, "ComputeFieldFromPotential::buildTransfer() => detected [" << m_externalStateIDs.size() << "] external states\n");
+  
+  m_transferBuilt = true;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
  /*void ComputeFieldFromPotential::execute()
@@ -821,6 +759,13 @@ void ComputeFieldFromPotential::unsetup()
 {
   CFAUTOTRACE;
   
+  m_transfer.clear();
+  m_internalStateIDs.clear();
+  m_externalStateIDs.clear();
+  m_externalDonorIDs.clear();
+  m_externalDist.clear();
+  m_transferBuilt = false;
+  
   CellCenterFVMCom::unsetup();
 }
 
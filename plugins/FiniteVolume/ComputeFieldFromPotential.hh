@@ -5,6 +5,7 @@
 
 #include "Framework/DataSocketSink.hh"
 #include "FiniteVolume/CellCenterFVMData.hh"
+#include "FiniteVolume/InterMeshTransfer.hh"
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -75,6 +76,14 @@ public:
    */
   virtual std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
 
+private:
+  
+  /**
+   * Builds the interpolation from the smaller mesh for the internal states
+   * and finds the donors of the extrapolation for the external states
+   */
+  void buildTransfer();
+
 private:
   
   /// storage of states
@@ -116,6 +125,30 @@ private:
   /// distance within which points in the smaller mesh are selected
   CFreal m_deltaSelection;
   
+  /// name of the interpolation method from the smaller mesh
+  std::string m_interpolationMethod;
+  
+  /// number of donor states for the inverse distance interpolation
+  CFuint m_nbNeighbours;
+  
+  /// interpolation operator from the smaller mesh for the internal states
+  InterMeshTransfer m_transfer;
+  
+  /// IDs of the states inside the internal boundary
+  std::vector<CFuint> m_internalStateIDs;
+  
+  /// IDs of the states beyond the internal boundary
+  std::vector<CFuint> m_externalStateIDs;
+  
+  /// IDs of the states of the smaller mesh from which the external states are extrapolated
+  std::vector<CFuint> m_externalDonorIDs;
+  
+  /// distance between the external states and their donor
+  std::vector<CFreal> m_externalDist;
+  
+  /// flag telling whether the transfer has been built
+  bool m_transferBuilt;
+  
 }; // end of class ComputeFieldFromPotential
       
 //////////////////////////////////////////////////////////////////////////////
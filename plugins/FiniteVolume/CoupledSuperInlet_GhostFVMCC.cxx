@@ -119,7 +119,9 @@ void CoupledSuperInlet_GhostFVMCC::setGhostState(GeometricEntity *const face)
   //Then get the values at the face nodes from the DataHandle
   const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
   State faceValue;
-  RealVector adimFaceValue(nbEqs);
+  ScratchArena::Frame frame(getScratch());
+  RealVector adimFaceValue;
+  getScratch().getVector(nbEqs, adimFaceValue);
   RealVector faceCoord = coordinates[faceIdx];
 
   if((isAccepted[faceIdx]>=0.) && (interfaceData[faceIdx].size() > 0))
@@ -699,6 +699,7 @@ void FVMCC_ComputeRHS::initializeComputationRHS()
   
   // _polyRec->updateWeights();
   _polyRec->computeGradients();
+  _polyRec->computeLimiters();
   
   // extrapolate the solution from cell centers to all vertices
   _nodalExtrapolator->extrapolateInAllNodes();
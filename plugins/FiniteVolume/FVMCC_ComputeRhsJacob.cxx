@@ -423,6 +423,7 @@ void FVMCC_ComputeRhsJacob::initializeComputationRHS()
   
   // gradients and limiters are computed on all the variables at once
   _polyRec->computeGradients();
+  _polyRec->computeLimiters();
   
   // extrapolate the solution from cell centers to all vertices
   _nodalExtrapolator->extrapolateInAllNodes();
@@ -538,6 +538,7 @@ void FVMCC_ComputeRhsJacobCoupling::initializeComputationRHS()
   
   // gradients and limiters are computed on all the variables at once
   _polyRec->computeGradients();
+  _polyRec->computeLimiters();
   
   // extrapolate the solution from cell centers to all vertices
   _nodalExtrapolator->extrapolateInAllNodes();
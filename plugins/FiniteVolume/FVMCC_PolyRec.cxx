@@ -1,7 +1,10 @@
+#include <algorithm>
+
 #include "FVMCC_PolyRec.hh"
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/MeshData.hh"
 #include "Framework/BaseTerm.hh"
+#include "MathTools/MathFunctions.hh"
 #include "FiniteVolume/CellCenterFVMData.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -9,6 +12,7 @@
 using namespace std;
 using namespace COOLFluiD::Framework;
 using namespace COOLFluiD::Common;
+using namespace COOLFluiD::MathTools;
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -26,6 +30,12 @@ void FVMCC_PolyRec::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< std::vector<std::string> >("Def","Definition of the Functions.");
   options.addConfigOption<CFuint, Config::DynamicOption<> >
     ("StopLimiting","Stop applying the limiter.");
+  options.addConfigOption< bool >
+    ("CellLimiterKernel","Compute the limiters of all cells at once after the gradients (needs a limiter with a cell-wise kernel).");
+  options.addConfigOption< CFuint >
+    ("NbThreadsOMP","Number of OpenMP threads for the cell-wise limiter.");
+  options.addConfigOption< bool >
+    ("IncrementalWeights","Recompute after a mesh update only the reconstruction weights touching moved states.");
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -41,7 +51,21 @@ FVMCC_PolyRec::FVMCC_PolyRec(const std::string& name) :
   _quadPointCoord(),
   _tmpLimiter(), 
   _gradientCoeff(),
-  _vFunction()
+  _vFunction(),
+  m_oldStateCoords(),
+  m_movedStates(),
+  m_movedGhosts(),
+  m_updatedStates(),
+  m_cellLimitersDone(false),
+  m_cellLimiterDataOK(false),
+  m_maxNbPoints(0),
+  m_cellPointOffsets(),
+  m_pointOffsetX(),
+  m_pointOffsetY(),
+  m_pointOffsetZ(),
+  m_cellNeighborOffsets(),
+  m_cellNeighborIDs(),
+  m_avgDistance()
 {
   addConfigOptionsTo(this);
   
@@ -54,6 +78,15 @@ FVMCC_PolyRec::FVMCC_PolyRec(const std::string& name) :
   _stopLimiting = 0;
   setParameter("StopLimiting",&_stopLimiting);
   
+  m_cellLimiterKernel = false;
+  setParameter("CellLimiterKernel",&m_cellLimiterKernel);
+  
+  m_nbThreadsOMP = 1;
+  setParameter("NbThreadsOMP",&m_nbThreadsOMP);
+  
+  m_incrementalWeights = false;
+  setParameter("IncrementalWeights",&m_incrementalWeights);
+  
   // fix high default value   
   _limitIter = 1000000000;
 }
@@ -71,7 +104,10 @@ FVMCC_PolyRec::~FVMCC_PolyRec()
 
 void FVMCC_PolyRec::updateWeights()
 {
-  //nothing to do here
+  // the geometry of the cells may have changed
+  if (SubSystemStatusStack::getActive()->isMovingMesh()) {
+    m_cellLimiterDataOK = false;
+  }
 }
 
 
@@ -89,6 +125,21 @@ void FVMCC_PolyRec::setup()
   if (_isLimiterNull) { 
     socket_limiter.getDataHandle() = 1.0;
   }
+  
+  if (m_cellLimiterKernel && 
+      (_isLimiterNull || !getMethodData().getLimiter()->hasIncrementsKernel())) {
+    CFLog(WARN, "FVMCC_PolyRec::setup() => CellLimiterKernel ignored: limiter "
+	  << getMethodData().getLimiter()->getName() << " has no cell-wise kernel\n");
+    m_cellLimiterKernel = false;
+  }
+  
+#ifndef CF_HAVE_OMP
+  if (m_nbThreadsOMP > 1) {
+    CFLog(WARN, "FVMCC_PolyRec::setup() => NbThreadsOMP = " << m_nbThreadsOMP
+	  << " ignored, COOLFluiD was built without OpenMP\n");
+    m_nbThreadsOMP = 1;
+  }
+#endif
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -100,9 +151,80 @@ void FVMCC_PolyRec::unsetup()
   }
   SwapEmpty(_quadPointCoord);
   
+  SwapEmpty(m_cellPointOffsets);
+  SwapEmpty(m_pointOffsetX);
+  SwapEmpty(m_pointOffsetY);
+  SwapEmpty(m_pointOffsetZ);
+  SwapEmpty(m_cellNeighborOffsets);
+  SwapEmpty(m_cellNeighborIDs);
+  SwapEmpty(m_avgDistance);
+  m_cellLimiterDataOK = false;
+  
+  SwapEmpty(m_oldStateCoords);
+  SwapEmpty(m_movedStates);
+  SwapEmpty(m_movedGhosts);
+  SwapEmpty(m_updatedStates);
+  
   PolyReconstructor<CellCenterFVMData>::unsetup();
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+bool FVMCC_PolyRec::findMovedStates(DataHandle<CFuint> stencilOffsets,
+				    DataHandle<CompactStencil::IDType> stencilIDs)
+{
+  CFAUTOTRACE;
+  
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  DataHandle<State*> gstates = socket_gstates.getDataHandle();
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFuint nbStates = states.size();
+  const CFuint nbGhosts = gstates.size();
+  const bool incremental = m_incrementalWeights && 
+    (m_oldStateCoords.size() == (nbStates + nbGhosts)*dim);
+  
+  if (incremental) {
+    m_movedStates.assign(nbStates, false);
+    m_movedGhosts.assign(nbGhosts, false);
+  }
+  if (m_incrementalWeights) {
+    m_oldStateCoords.resize((nbStates + nbGhosts)*dim);
+    for (CFuint i = 0; i < nbStates + nbGhosts; ++i) {
+      const State& state = (i < nbStates) ? *states[i] : *gstates[i - nbStates];
+      const RealVector& coord = state.getCoordinates();
+      bool moved = false;
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {
+	moved = moved || (coord[iDim] != m_oldStateCoords[i*dim + iDim]);
+	m_oldStateCoords[i*dim + iDim] = coord[iDim];
+      }
+      if (incremental && moved) {
+	if (i < nbStates) {m_movedStates[i] = true;}
+	else {m_movedGhosts[i - nbStates] = true;}
+      }
+    }
+  }
+  if (!incremental) return false;
+  
+  CFuint nbUpdated = 0;
+  m_updatedStates.assign(nbStates, false);
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    for (CFuint in = stencilOffsets[iState]; in < stencilOffsets[iState+1]; ++in) {
+      const CompactStencil::IDType id = stencilIDs[in];
+      if (id > iState && (m_movedStates[iState] || isMovedState(id))) {
+	m_updatedStates[iState] = true;
+	if (!CompactStencil::isGhost(id)) {m_updatedStates[id] = true;}
+      }
+    }
+  }
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    if (m_updatedStates[iState]) {++nbUpdated;}
+  }
+  
+  CFLog(VERBOSE, "FVMCC_PolyRec::findMovedStates() => weights of " << nbUpdated
+	<< "/" << nbStates << " states to update\n");
+  return true;
+}
+
 //////////////////////////////////////////////////////////////////////////////
       
 void FVMCC_PolyRec::prepareReconstruction()
@@ -119,7 +241,8 @@ void FVMCC_PolyRec::prepareReconstruction()
 
 void FVMCC_PolyRec::computeFaceLimiter(GeometricEntity* const face)
 {
-  if (!_isLimiterNull) { 
+  // all the cells have already been limited in computeCellLimiters()
+  if (!_isLimiterNull && !m_cellLimitersDone) { 
     DataHandle<CFreal> newLimiter = socket_limiter.getDataHandle();
     SafePtr<Limiter<CellCenterFVMData> > limiter = getMethodData().getLimiter();
     DataHandle<bool> cellFlag = socket_cellFlag.getDataHandle();
@@ -168,6 +291,216 @@ void FVMCC_PolyRec::computeFaceLimiter(GeometricEntity* const face)
 
 //////////////////////////////////////////////////////////////////////////////
 
+void FVMCC_PolyRec::buildCellLimiterData(DataHandle<CFuint> stencilOffsets,
+					 DataHandle<CompactStencil::IDType> stencilIDs)
+{
+  CFAUTOTRACE;
+  
+  SafePtr<Limiter<CellCenterFVMData> > limiter = getMethodData().getLimiter();
+  const bool useFullStencil = limiter->getUseFullStencil();
+  const bool useNodalStencil = limiter->getUseNodalExtrapolationStencil();
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  
+  SafePtr<TopologicalRegionSet> cells = MeshDataStack::getActive()->getTrs("InnerCells");
+  const CFuint nbCells = cells->getLocalNbGeoEnts();
+  
+  GeometricEntityPool<CellTrsGeoBuilder> cellBuilder;
+  SafePtr<CellTrsGeoBuilder> geoBuilderPtr = cellBuilder.getGeoBuilder();
+  geoBuilderPtr->setDataSockets(socket_states, socket_gstates, socket_nodes);
+  cellBuilder.setup();
+  
+  CellTrsGeoBuilder::GeoData& geoData = cellBuilder.getDataGE();
+  geoData.trs = cells;
+  
+  m_cellPointOffsets.assign(1, 0);
+  m_cellNeighborOffsets.assign(1, 0);
+  m_pointOffsetX.clear();
+  m_pointOffsetY.clear();
+  m_pointOffsetZ.clear();
+  m_cellNeighborIDs.clear();
+  m_avgDistance.resize(nbCells);
+  m_maxNbPoints = 0;
+  
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  DataHandle<State*> gstates = socket_gstates.getDataHandle();
+  
+  Node faceMidCoord(false);
+  vector<CompactStencil::IDType> neighbors;
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    geoData.idx = iCell;
+    GeometricEntity *const currCell = cellBuilder.buildGE();
+    const State *const state = currCell->getState(0);
+    cf_assert(state->getLocalID() == iCell);
+    const RealVector& stateCoord = state->getCoordinates();
+    const GeomEntList *const faces = currCell->getNeighborGeos();
+    const CFuint nbFaces = faces->size();
+    
+    // one quadrature point per face, in its mid point
+    for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+      computeMidPoint(*(*faces)[iFace]->getNodes(), faceMidCoord);
+      m_pointOffsetX.push_back(faceMidCoord[XX] - stateCoord[XX]);
+      m_pointOffsetY.push_back(faceMidCoord[YY] - stateCoord[YY]);
+      m_pointOffsetZ.push_back((dim == DIM_3D) ? faceMidCoord[ZZ] - stateCoord[ZZ] : 0.);
+    }
+    m_cellPointOffsets.push_back(m_pointOffsetX.size());
+    m_maxNbPoints = max(m_maxNbPoints, nbFaces);
+    
+    // same neighbors as in the limiters: the average distance counts the
+    // neighbors shared by several nodes more than once
+    neighbors.clear();
+    CFreal sumDistance = 0.;
+    if (useFullStencil) {
+      if (!useNodalStencil) {
+	for (CFuint in = stencilOffsets[iCell]; in < stencilOffsets[iCell+1]; ++in) {
+	  neighbors.push_back(stencilIDs[in]);
+	}
+      }
+      else {
+	const CFuint nbNodesInCell = currCell->nbNodes();
+	for (CFuint iNode = 0; iNode < nbNodesInCell; ++iNode) {
+	  const CFuint nodeID = currCell->getNode(iNode)->getLocalID();
+	  const vector<State*>& s = getMethodData().
+	    getNodalStatesExtrapolator()->getNodalStateNeighbors(nodeID);
+	  for (CFuint is = 0; is < s.size(); ++is) {
+	    if (s[is] != state) {
+	      neighbors.push_back(CompactStencil::getID(*s[is]));
+	    }
+	  }
+	}
+      }
+    }
+    else {
+      for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+	const GeometricEntity *const neighborFace = (*faces)[iFace];
+	const State *const neighborState = (state == neighborFace->getState(0)) ?
+	  neighborFace->getState(1) : neighborFace->getState(0);
+	neighbors.push_back(CompactStencil::getID(*neighborState));
+      }
+    }
+    
+    for (CFuint in = 0; in < neighbors.size(); ++in) {
+      sumDistance += MathFunctions::getDistance
+	(stateCoord, CompactStencil::getState(neighbors[in], states, gstates)->getCoordinates());
+    }
+    m_avgDistance[iCell] = sumDistance/neighbors.size();
+    
+    // duplicated neighbors do not change the extrema
+    sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    m_cellNeighborIDs.insert(m_cellNeighborIDs.end(), neighbors.begin(), neighbors.end());
+    m_cellNeighborOffsets.push_back(m_cellNeighborIDs.size());
+    
+    cellBuilder.releaseGE();
+  }
+  
+  m_cellLimiterDataOK = true;
+  
+  CFLog(VERBOSE, "FVMCC_PolyRec::buildCellLimiterData() => " << m_pointOffsetX.size()
+	<< " quadrature points and " << m_cellNeighborIDs.size() << " neighbors for "
+	<< nbCells << " cells\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_PolyRec::computeCellLimiters(DataHandle<CFuint> stencilOffsets,
+					DataHandle<CompactStencil::IDType> stencilIDs,
+					const CFreal* uX, const CFreal* uY, const CFreal* uZ)
+{
+  if (_isLimiterNull) return;
+  
+  // from now on the limiters are never computed face by face
+  m_cellLimitersDone = true;
+  
+  const CFreal residual = SubSystemStatusStack::getActive()->getResidual();
+  const CFuint iter = SubSystemStatusStack::getActive()->getNbIter();
+  const bool resetLimiter = (residual > _limitRes && (_limitIter > 0 && iter < _limitIter));
+  if (!resetLimiter && _freezeLimiter) return;
+  
+  if (!m_cellLimiterDataOK) {
+    buildCellLimiterData(stencilOffsets, stencilIDs);
+  }
+  
+  DataHandle<CFreal> newLimiter = socket_limiter.getDataHandle();
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  DataHandle<State*> gstates = socket_gstates.getDataHandle();
+  SafePtr<Limiter<CellCenterFVMData> > limiter = getMethodData().getLimiter();
+  
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const int nbCells = m_avgDistance.size();
+  
+#ifdef CF_HAVE_OMP
+#pragma omp parallel num_threads(m_nbThreadsOMP)
+#endif
+  {
+    // scratch data of the calling thread
+    vector<CFreal> uMin(nbEqs);
+    vector<CFreal> uMax(nbEqs);
+    vector<CFreal> deltaPlusMax(nbEqs);
+    vector<CFreal> deltaPlusMin(nbEqs);
+    vector<CFreal> deltaMin(m_maxNbPoints*nbEqs);
+    vector<CFreal> psi(nbEqs);
+    
+#ifdef CF_HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+    for (int iCell = 0; iCell < nbCells; ++iCell) {
+      const State& state = *states[iCell];
+      for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+	uMin[iVar] = uMax[iVar] = state[iVar];
+      }
+      
+      for (CFuint in = m_cellNeighborOffsets[iCell]; in < m_cellNeighborOffsets[iCell+1]; ++in) {
+	const State& neighbor = *CompactStencil::getState(m_cellNeighborIDs[in], states, gstates);
+	for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+	  uMin[iVar] = min(uMin[iVar], neighbor[iVar]);
+	  uMax[iVar] = max(uMax[iVar], neighbor[iVar]);
+	}
+      }
+      
+      for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+	deltaPlusMax[iVar] = uMax[iVar] - state[iVar];
+	deltaPlusMin[iVar] = uMin[iVar] - state[iVar];
+      }
+      
+      // unlimited increments from the cell center to the quadrature points
+      const CFuint start = iCell*nbEqs;
+      const CFuint firstPoint = m_cellPointOffsets[iCell];
+      const CFuint nbPoints = m_cellPointOffsets[iCell+1] - firstPoint;
+      for (CFuint ip = 0; ip < nbPoints; ++ip) {
+	const CFreal dx = m_pointOffsetX[firstPoint + ip];
+	const CFreal dy = m_pointOffsetY[firstPoint + ip];
+	CFreal *const d = &deltaMin[ip*nbEqs];
+	for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+	  d[iVar] = uX[start + iVar]*dx + uY[start + iVar]*dy;
+	}
+	if (uZ != CFNULL) {
+	  const CFreal dz = m_pointOffsetZ[firstPoint + ip];
+	  for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+	    d[iVar] += uZ[start + iVar]*dz;
+	  }
+	}
+      }
+      
+      limiter->limitIncrements(nbEqs, nbPoints, &deltaPlusMax[0], &deltaPlusMin[0],
+			       &deltaMin[0], m_avgDistance[iCell], &psi[0]);
+      
+      if (resetLimiter) {
+	for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+	  newLimiter[start + iVar] = psi[iVar];
+	}
+      }
+      else {
+	// historical modification of the limiter
+	for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+	  newLimiter[start + iVar] = min(psi[iVar], newLimiter[start + iVar]);
+	}
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void FVMCC_PolyRec::baseExtrapolateImpl(GeometricEntity* const face)
 { 
   //this is only usable if one quadrature point per face is needed
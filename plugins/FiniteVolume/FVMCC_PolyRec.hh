@@ -8,6 +8,7 @@
 #include "Framework/BaseDataSocketSink.hh"
 #include "Framework/CellTrsGeoBuilder.hh"
 #include "Framework/VectorialFunction.hh"
+#include "FiniteVolume/CompactStencil.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -76,6 +77,12 @@ public:
    */
   virtual void computeGradients() = 0;
   
+  /**
+   * Compute the limiters of all the cells after the gradients.
+   * By default, they are computed face by face during the extrapolation.
+   */
+  virtual void computeLimiters() {}
+  
   /// Get the current left state
   Framework::State& getCurrLeftState()
   {
@@ -108,6 +115,42 @@ protected: // helper functions
    */
   void computeFaceLimiter(Framework::GeometricEntity *const face);
   
+  /**
+   * Compute the limiters of all the cells at once, with the cell-wise kernel
+   * of the limiter, after the gradients have been computed.
+   * The geometric data are rebuilt only if the mesh is moving.
+   * Once this has been called, computeFaceLimiter() does nothing.
+   * @param stencilOffsets  offsets of the compact reconstruction stencil
+   * @param stencilIDs      neighbor IDs of the compact reconstruction stencil
+   * @param uX, uY, uZ      gradients (uZ is CFNULL in 2D)
+   */
+  void computeCellLimiters(Framework::DataHandle<CFuint> stencilOffsets,
+			   Framework::DataHandle<CompactStencil::IDType> stencilIDs,
+			   const CFreal* uX, const CFreal* uY, const CFreal* uZ);
+  
+  /**
+   * Build the geometric data needed by computeCellLimiters()
+   */
+  void buildCellLimiterData(Framework::DataHandle<CFuint> stencilOffsets,
+			    Framework::DataHandle<CompactStencil::IDType> stencilIDs);
+  
+  /**
+   * Compare the coordinates of the states and of the ghost states with the
+   * ones of the previous call and flag the states whose least square
+   * weights need to be recomputed (both ends of each stencil edge with a
+   * moved state)
+   * @return true if only the flagged states need to be updated
+   */
+  bool findMovedStates(Framework::DataHandle<CFuint> stencilOffsets,
+		       Framework::DataHandle<CompactStencil::IDType> stencilIDs);
+  
+  /// @return true if the state with the given ID (as in CompactStencil) moved
+  bool isMovedState(CompactStencil::IDType id) const
+  {
+    return (!CompactStencil::isGhost(id)) ? m_movedStates[id] :
+      m_movedGhosts[CompactStencil::getLocalID(id)];
+  }
+  
   /**
    * Compute the mid point
    */
@@ -198,6 +241,57 @@ protected:
   /// flag to stop the limiting
   CFuint _stopLimiting;
   
+  /// flag telling to compute the limiters cell by cell after the gradients
+  bool m_cellLimiterKernel;
+  
+  /// number of OpenMP threads for the cell-wise limiter
+  CFuint m_nbThreadsOMP;
+  
+  /// flag telling to recompute only the weights touching moved states
+  bool m_incrementalWeights;
+  
+  /// coordinates of the states and ghost states at the last weights update
+  std::vector<CFreal> m_oldStateCoords;
+  
+  /// flags telling which states moved since the last weights update
+  std::vector<bool> m_movedStates;
+  
+  /// flags telling which ghost states moved since the last weights update
+  std::vector<bool> m_movedGhosts;
+  
+  /// flags telling which states need their weights to be recomputed
+  std::vector<bool> m_updatedStates;
+  
+  /// flag telling that the cell limiters have been computed for this iteration
+  bool m_cellLimitersDone;
+  
+  /// flag telling that the cell limiter data are up to date
+  bool m_cellLimiterDataOK;
+  
+  /// maximum number of quadrature points in a cell
+  CFuint m_maxNbPoints;
+  
+  /// offsets of the quadrature points of each cell
+  std::vector<CFuint> m_cellPointOffsets;
+  
+  /// x-distance from the cell center to each quadrature point
+  std::vector<CFreal> m_pointOffsetX;
+  
+  /// y-distance from the cell center to each quadrature point
+  std::vector<CFreal> m_pointOffsetY;
+  
+  /// z-distance from the cell center to each quadrature point
+  std::vector<CFreal> m_pointOffsetZ;
+  
+  /// offsets of the neighbors of each cell used for the extrema
+  std::vector<CFuint> m_cellNeighborOffsets;
+  
+  /// IDs (as in CompactStencil) of the neighbors of each cell used for the extrema
+  std::vector<CompactStencil::IDType> m_cellNeighborIDs;
+  
+  /// average distance between each cell and its neighbors
+  std::vector<CFreal> m_avgDistance;
+  
 }; // end of class FVMCC_PolyRec
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,276 @@
+#include <algorithm>
+
+#include "Common/BadValueException.hh"
+
+#include "FiniteVolume/InterMeshTransfer.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// maximum number of points in a leaf of the kd-tree
+static const CFuint LEAF_SIZE = 8;
+
+/// compares the donor points along one axis
+struct CompareAlongAxis {
+  CompareAlongAxis(const vector<CFreal>& coords, const CFuint dim, const CFuint axis) :
+    m_coords(coords), m_dim(dim), m_axis(axis) {}
+
+  bool operator() (const CFuint a, const CFuint b) const
+  {
+    return m_coords[a*m_dim + m_axis] < m_coords[b*m_dim + m_axis];
+  }
+
+  const vector<CFreal>& m_coords;
+  const CFuint m_dim;
+  const CFuint m_axis;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+InterMeshTransfer::InterMeshTransfer() :
+  m_dim(0),
+  m_coords(),
+  m_index(),
+  m_tree(),
+  m_method(NEAREST),
+  m_nbNeighbours(1),
+  m_rowStart(1, 0),
+  m_donors(),
+  m_weights()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+InterMeshTransfer::~InterMeshTransfer()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+InterMeshTransfer::Method InterMeshTransfer::getMethod(const std::string& name)
+{
+  if (name == "Nearest") return NEAREST;
+  if (name == "InverseDistance") return INVERSE_DISTANCE;
+  throw BadValueException
+    (FromHere(), "InterMeshTransfer::getMethod() => unknown method " + name);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InterMeshTransfer::setMethod(const Method method, const CFuint nbNeighbours)
+{
+  cf_assert(nbNeighbours > 0);
+  m_method = method;
+  m_nbNeighbours = (method == NEAREST) ? 1 : nbNeighbours;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InterMeshTransfer::setDonorPoints(const std::vector<CFreal>& coords, const CFuint dim)
+{
+  cf_assert(dim > 0);
+  cf_assert(coords.size() % dim == 0);
+
+  m_dim = dim;
+  m_coords = coords;
+
+  const CFuint nbPoints = coords.size()/dim;
+  m_index.resize(nbPoints);
+  for (CFuint i = 0; i < nbPoints; ++i) {
+    m_index[i] = i;
+  }
+
+  m_tree.clear();
+  m_tree.reserve(2*(nbPoints/LEAF_SIZE + 1));
+  if (nbPoints > 0) {
+    buildTree(0, nbPoints);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint InterMeshTransfer::buildTree(const CFuint begin, const CFuint end)
+{
+  const CFuint nodeID = m_tree.size();
+  m_tree.push_back(TreeNode());
+  m_tree[nodeID].begin = begin;
+  m_tree[nodeID].end   = end;
+  m_tree[nodeID].left  = 0;
+  m_tree[nodeID].right = 0;
+  m_tree[nodeID].axis  = 0;
+  m_tree[nodeID].split = 0.;
+
+  if (end - begin <= LEAF_SIZE) return nodeID;
+
+  // split at the median along the direction of largest extent
+  CFuint axis = 0;
+  CFreal maxExtent = -1.;
+  for (CFuint d = 0; d < m_dim; ++d) {
+    CFreal xMin = coord(m_index[begin], d);
+    CFreal xMax = xMin;
+    for (CFuint i = begin + 1; i < end; ++i) {
+      const CFreal x = coord(m_index[i], d);
+      xMin = std::min(xMin, x);
+      xMax = std::max(xMax, x);
+    }
+    if (xMax - xMin > maxExtent) {
+      maxExtent = xMax - xMin;
+      axis = d;
+    }
+  }
+
+  const CFuint middle = begin + (end - begin)/2;
+  std::nth_element(m_index.begin() + begin, m_index.begin() + middle,
+                   m_index.begin() + end, CompareAlongAxis(m_coords, m_dim, axis));
+
+  const CFreal split = coord(m_index[middle], axis);
+  const CFuint left  = buildTree(begin, middle);
+  const CFuint right = buildTree(middle, end);
+
+  // m_tree may have been reallocated by the recursive calls
+  m_tree[nodeID].left  = left;
+  m_tree[nodeID].right = right;
+  m_tree[nodeID].axis  = axis;
+  m_tree[nodeID].split = split;
+  return nodeID;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InterMeshTransfer::searchTree(const CFuint nodeID, const CFreal *const point,
+                                   const CFuint k,
+                                   vector<pair<CFreal,CFuint> >& best) const
+{
+  const TreeNode& node = m_tree[nodeID];
+
+  if (node.left == 0 && node.right == 0) {
+    for (CFuint i = node.begin; i < node.end; ++i) {
+      const CFuint pointID = m_index[i];
+      CFreal dist2 = 0.;
+      for (CFuint d = 0; d < m_dim; ++d) {
+        const CFreal delta = point[d] - coord(pointID, d);
+        dist2 += delta*delta;
+      }
+
+      // insertion in the sorted list of the k closest points
+      if (best.size() < k || dist2 < best.back().first) {
+        const pair<CFreal,CFuint> entry(dist2, pointID);
+        best.insert(std::upper_bound(best.begin(), best.end(), entry), entry);
+        if (best.size() > k) best.pop_back();
+      }
+    }
+    return;
+  }
+
+  const CFreal delta = point[node.axis] - node.split;
+  const CFuint nearChild = (delta < 0.) ? node.left : node.right;
+  const CFuint farChild  = (delta < 0.) ? node.right : node.left;
+
+  searchTree(nearChild, point, k, best);
+  if (best.size() < k || delta*delta < best.back().first) {
+    searchTree(farChild, point, k, best);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InterMeshTransfer::findNearest(const RealVector& point, const CFuint k,
+                                    vector<CFuint>& ids, vector<CFreal>& dist2) const
+{
+  cf_assert(point.size() >= m_dim);
+  cf_assert(m_tree.size() > 0);
+
+  vector<pair<CFreal,CFuint> > best;
+  best.reserve(k+1);
+  searchTree(0, const_cast<RealVector&>(point).ptr(), k, best);
+
+  ids.resize(best.size());
+  dist2.resize(best.size());
+  for (CFuint i = 0; i < best.size(); ++i) {
+    dist2[i] = best[i].first;
+    ids[i]   = best[i].second;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint InterMeshTransfer::findNearest(const RealVector& point, CFreal& dist2) const
+{
+  vector<CFuint> ids;
+  vector<CFreal> d2;
+  findNearest(point, 1, ids, d2);
+  cf_assert(ids.size() == 1);
+  dist2 = d2[0];
+  return ids[0];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint InterMeshTransfer::addStencil(const RealVector& point)
+{
+  vector<CFuint> ids;
+  vector<CFreal> dist2;
+  findNearest(point, m_nbNeighbours, ids, dist2);
+  cf_assert(ids.size() > 0);
+
+  // a donor point matching the target point is taken alone
+  const CFuint nbDonors = (m_method == NEAREST || dist2[0] <= 0.) ? 1 : ids.size();
+
+  CFreal sumWeights = 0.;
+  for (CFuint i = 0; i < nbDonors; ++i) {
+    const CFreal weight = (nbDonors == 1) ? 1. : 1./dist2[i];
+    m_donors.push_back(ids[i]);
+    m_weights.push_back(weight);
+    sumWeights += weight;
+  }
+  for (CFuint i = m_weights.size() - nbDonors; i < m_weights.size(); ++i) {
+    m_weights[i] /= sumWeights;
+  }
+
+  m_rowStart.push_back(m_donors.size());
+  return m_rowStart.size() - 2;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InterMeshTransfer::clearStencils()
+{
+  m_rowStart.assign(1, 0);
+  m_donors.clear();
+  m_weights.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InterMeshTransfer::clear()
+{
+  clearStencils();
+  vector<CFreal>().swap(m_coords);
+  vector<CFuint>().swap(m_index);
+  vector<TreeNode>().swap(m_tree);
+  vector<CFuint>().swap(m_donors);
+  vector<CFreal>().swap(m_weights);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
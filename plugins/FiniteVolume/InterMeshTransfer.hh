@@ -0,0 +1,196 @@
+#ifndef COOLFluiD_Numerics_FiniteVolume_InterMeshTransfer_hh
+#define COOLFluiD_Numerics_FiniteVolume_InterMeshTransfer_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Common/NonCopyable.hh"
+#include "MathTools/RealVector.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class transfers a field given in a cloud of donor points (e.g. the
+ * states of another mesh) onto a set of target points.
+ *
+ * The donor points are stored in a kd-tree, which is used to build, once
+ * for all, the interpolation stencil and weights of every target point.
+ * The stencils are stored as the rows of a sparse (CSR) operator, so that
+ * every following transfer costs one sparse matrix-vector product.
+ *
+ * The donor and target points are assumed not to move between the
+ * construction of the stencils and their use.
+ */
+class InterMeshTransfer : public Common::NonCopyable<InterMeshTransfer> {
+public:
+
+  /// Interpolation methods
+  enum Method {NEAREST=0, INVERSE_DISTANCE=1};
+
+  /**
+   * Constructor
+   */
+  InterMeshTransfer();
+
+  /**
+   * Destructor
+   */
+  ~InterMeshTransfer();
+
+  /**
+   * Gets the interpolation method from its name ("Nearest" or "InverseDistance")
+   */
+  static Method getMethod(const std::string& name);
+
+  /**
+   * Sets the interpolation method used by addStencil()
+   * @param nbNeighbours number of donors for the inverse distance weighting
+   */
+  void setMethod(const Method method, const CFuint nbNeighbours);
+
+  /**
+   * Builds the search tree of the donor points
+   * @param coords coordinates of the donor points, stored point by point
+   * @param dim    number of coordinates per point
+   */
+  void setDonorPoints(const std::vector<CFreal>& coords, const CFuint dim);
+
+  /**
+   * @return the number of donor points
+   */
+  CFuint getNbDonorPoints() const {return m_index.size();}
+
+  /**
+   * Finds the k donor points closest to the given point, sorted by distance
+   * @param ids   indices of the donor points, in the order given to setDonorPoints()
+   * @param dist2 squared distances to the donor points
+   */
+  void findNearest(const RealVector& point, const CFuint k,
+                   std::vector<CFuint>& ids, std::vector<CFreal>& dist2) const;
+
+  /**
+   * @return the index of the donor point closest to the given point
+   * @param dist2 squared distance to that donor point
+   */
+  CFuint findNearest(const RealVector& point, CFreal& dist2) const;
+
+  /**
+   * Computes the stencil and the weights of the given target point and
+   * appends them to the operator
+   * @return the index of the stencil (row of the operator)
+   */
+  CFuint addStencil(const RealVector& point);
+
+  /**
+   * @return the number of stencils in the operator
+   */
+  CFuint getNbStencils() const {return m_rowStart.size() - 1;}
+
+  /**
+   * @return the index of the closest donor point of the given stencil
+   */
+  CFuint getNearestDonor(const CFuint row) const {return m_donors[m_rowStart[row]];}
+
+  /**
+   * Interpolates the donor values for the given stencil
+   * @param values donor values, indexed like the donor points
+   */
+  template <typename ARRAY>
+  CFreal interpolate(const CFuint row, const ARRAY& values) const
+  {
+    cf_assert(row + 1 < m_rowStart.size());
+    CFreal result = 0.;
+    for (CFuint k = m_rowStart[row]; k < m_rowStart[row+1]; ++k) {
+      result += m_weights[k]*values[m_donors[k]];
+    }
+    return result;
+  }
+
+  /**
+   * Removes all the stencils, keeping the donor points
+   */
+  void clearStencils();
+
+  /**
+   * Releases the memory of the donor points and of the stencils
+   */
+  void clear();
+
+private: // helper functions
+
+  /// Builds the subtree for the points m_index[begin:end[
+  /// @return the index of the root of the subtree
+  CFuint buildTree(const CFuint begin, const CFuint end);
+
+  /// Looks for the k closest points in the subtree of the given node
+  /// @param best sorted list of the closest (squared distance, index) found so far
+  void searchTree(const CFuint nodeID, const CFreal *const point, const CFuint k,
+                  std::vector<std::pair<CFreal,CFuint> >& best) const;
+
+  /// @return the coordinate of the donor point along the given axis
+  CFreal coord(const CFuint pointID, const CFuint axis) const
+  {
+    return m_coords[pointID*m_dim + axis];
+  }
+
+private: // data
+
+  /// node of the kd-tree, a leaf if left == right == 0
+  struct TreeNode {
+    CFuint begin;
+    CFuint end;
+    CFuint left;
+    CFuint right;
+    CFuint axis;
+    CFreal split;
+  };
+
+  /// number of coordinates per point
+  CFuint m_dim;
+
+  /// coordinates of the donor points
+  std::vector<CFreal> m_coords;
+
+  /// donor points sorted along the tree
+  std::vector<CFuint> m_index;
+
+  /// nodes of the kd-tree, the root being the first
+  std::vector<TreeNode> m_tree;
+
+  /// interpolation method
+  Method m_method;
+
+  /// number of donors per stencil for the inverse distance weighting
+  CFuint m_nbNeighbours;
+
+  /// start of each stencil in m_donors and m_weights
+  std::vector<CFuint> m_rowStart;
+
+  /// donor points of the stencils
+  std::vector<CFuint> m_donors;
+
+  /// weights of the donor points of the stencils
+  std::vector<CFreal> m_weights;
+
+}; // end of class InterMeshTransfer
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_FiniteVolume_InterMeshTransfer_hh
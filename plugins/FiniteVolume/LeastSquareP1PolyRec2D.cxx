@@ -33,6 +33,8 @@ leastSquareP1PolyRec2DProvider("LinearLS2D");
 LeastSquareP1PolyRec2D::LeastSquareP1PolyRec2D(const std::string& name) :
   FVMCC_PolyRec(name),
   socket_stencil("stencil"),
+  socket_stencilOffsets("stencilOffsets"),
+  socket_stencilIDs("stencilIDs"),
   socket_weights("weights"),
   socket_uX("uX"),
   socket_uY("uY"),
@@ -68,6 +70,8 @@ LeastSquareP1PolyRec2D::needsSockets()
 
   // Add the needed DataSocketSinks
   result.push_back(&socket_stencil);
+  result.push_back(&socket_stencilOffsets);
+  result.push_back(&socket_stencilIDs);
   result.push_back(&socket_weights);
   result.push_back(&socket_uX);
   result.push_back(&socket_uY);
@@ -84,7 +88,9 @@ void LeastSquareP1PolyRec2D::computeGradients()
   prepareReconstruction();
  
   DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
-  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
+  DataHandle<State*> gstates = socket_gstates.getDataHandle();
+  DataHandle<CFuint> stencilOffsets = socket_stencilOffsets.getDataHandle();
+  DataHandle<CompactStencil::IDType> stencilIDs = socket_stencilIDs.getDataHandle();
   DataHandle<CFreal> weights = socket_weights.getDataHandle();
   DataHandle<CFreal> uX = socket_uX.getDataHandle();
   DataHandle<CFreal> uY = socket_uY.getDataHandle();
@@ -100,16 +106,15 @@ void LeastSquareP1PolyRec2D::computeGradients()
     for(CFuint iState = 0; iState < nbStates; ++iState) {
       assert(iState == states[iState]->getLocalID());
       const State* const first = states[iState];
-      const CFuint stencilSize = stencil[iState].size();
       // loop over the neighbor cells belonging to the chosen stencil
-      for(CFuint in = 0; in < stencilSize; ++in) {
-	const State* const last = stencil[iState][in];
-	const CFuint lastID = (!last->isGhost()) ? last->getLocalID() : 
-	  numeric_limits<CFuint>::max();
+      for(CFuint in = stencilOffsets[iState]; in < stencilOffsets[iState+1]; ++in) {
+	// ghost IDs are bigger than all the others
+	const CFuint lastID = stencilIDs[in];
 	const CFuint firstID = first->getLocalID();
 	cf_assert(firstID != lastID);
 	
 	if (lastID > firstID) {
+	  const State* const last = CompactStencil::getState(lastID, states, gstates);
 	  // consider the next edge
 	  const RealVector& nodeFirst = first->getCoordinates();
 	  const RealVector& nodeLast = last->getCoordinates();
@@ -155,6 +160,18 @@ void LeastSquareP1PolyRec2D::computeGradients()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void LeastSquareP1PolyRec2D::computeLimiters()
+{
+  if (m_cellLimiterKernel) {
+    DataHandle<CFreal> uX = socket_uX.getDataHandle();
+    DataHandle<CFreal> uY = socket_uY.getDataHandle();
+    computeCellLimiters(socket_stencilOffsets.getDataHandle(), socket_stencilIDs.getDataHandle(),
+			&uX[0], &uY[0], CFNULL);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void LeastSquareP1PolyRec2D::extrapolateImpl(GeometricEntity* const face)
 {
   FVMCC_PolyRec::baseExtrapolateImpl(face);
@@ -269,14 +286,29 @@ void LeastSquareP1PolyRec2D::updateWeights()
   FVMCC_PolyRec::updateWeights();
 
   DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
-  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
+  DataHandle<State*> gstates = socket_gstates.getDataHandle();
+  DataHandle<CFuint> stencilOffsets = socket_stencilOffsets.getDataHandle();
+  DataHandle<CompactStencil::IDType> stencilIDs = socket_stencilIDs.getDataHandle();
   DataHandle<CFreal> weights = socket_weights.getDataHandle();
 
   const CFuint nbStates = states.size();
-
-  _l11 = 0.0;
-  _l12 = 0.0;
-  _l22 = 0.0;
+  
+  // if only some states moved, the matrices of the other ones are kept
+  const bool incremental = findMovedStates(stencilOffsets, stencilIDs);
+  if (!incremental) {
+    _l11 = 0.0;
+    _l12 = 0.0;
+    _l22 = 0.0;
+  }
+  else {
+    for (CFuint iState = 0; iState < nbStates; ++iState) {
+      if (m_updatedStates[iState]) {
+	_l11[iState] = 0.0;
+	_l12[iState] = 0.0;
+	_l22[iState] = 0.0;
+      }
+    }
+  }
   _lf1 = 0.0;
   _lf2 = 0.0;
 
@@ -284,41 +316,49 @@ void LeastSquareP1PolyRec2D::updateWeights()
  CFuint iEdge = 0;
  for(CFuint iState = 0; iState < nbStates; ++iState) {
    const State* const first = states[iState];
-   const CFuint stencilSize = stencil[iState].size();
-
    // loop over the neighbor cells belonging to the chosen stencil
-   for(CFuint in = 0; in < stencilSize; ++in) {
-     const State* const last = stencil[iState][in];
-     const CFuint lastID = (!last->isGhost()) ? last->getLocalID() : 
-       numeric_limits<CFuint>::max();
+   for(CFuint in = stencilOffsets[iState]; in < stencilOffsets[iState+1]; ++in) {
+     // ghost IDs are bigger than all the others
+     const CFuint lastID = stencilIDs[in];
      const CFuint firstID = first->getLocalID();
      cf_assert(firstID != lastID);
      
      if (lastID > firstID) {
-       const RealVector& nodeFirst = first->getCoordinates();
-       const RealVector& nodeLast = last->getCoordinates();
-       const CFreal deltaR = MathFunctions::getDistance(nodeFirst,nodeLast);
+       const bool updateFirst = !incremental || m_updatedStates[firstID];
+       const bool updateLast = !CompactStencil::isGhost(lastID) &&
+	 (!incremental || m_updatedStates[lastID]);
        
-       weights[iEdge] = 1.0/deltaR;
-
-       // weights always != 0
-       const CFreal dx = weights[iEdge]*(nodeLast[0]
-            - nodeFirst[0]);
-       const CFreal dy = weights[iEdge]*(nodeLast[1]
-            - nodeFirst[1]);
-
-       CFLogDebugMax( "weights = " << weights[iEdge]
-       << "dx = " << dx
-       << "dy = " << dy << "\n");
-
-       _l11[firstID] += dx*dx;
-       _l12[firstID] += dx*dy;
-       _l22[firstID] += dy*dy;
-       
-       if (!last->isGhost()) {
-	 _l11[lastID] += dx*dx;
-	 _l12[lastID] += dx*dy;
-	 _l22[lastID] += dy*dy;
+       if (updateFirst || updateLast) {
+	 const State* const last = CompactStencil::getState(lastID, states, gstates);
+	 const RealVector& nodeFirst = first->getCoordinates();
+	 const RealVector& nodeLast = last->getCoordinates();
+	 
+	 if (!incremental || m_movedStates[firstID] || isMovedState(lastID)) {
+	   const CFreal deltaR = MathFunctions::getDistance(nodeFirst,nodeLast);
+	   weights[iEdge] = 1.0/deltaR;
+	 }
+	 
+	 // weights always != 0
+	 const CFreal dx = weights[iEdge]*(nodeLast[0]
+					   - nodeFirst[0]);
+	 const CFreal dy = weights[iEdge]*(nodeLast[1]
+					   - nodeFirst[1]);
+	 
+	 CFLogDebugMax( "weights = " << weights[iEdge]
+			<< "dx = " << dx
+			<< "dy = " << dy << "\n");
+	 
+	 if (updateFirst) {
+	   _l11[firstID] += dx*dx;
+	   _l12[firstID] += dx*dy;
+	   _l22[firstID] += dy*dy;
+	 }
+	 
+	 if (updateLast) {
+	   _l11[lastID] += dx*dx;
+	   _l12[lastID] += dx*dy;
+	   _l22[lastID] += dy*dy;
+	 }
        }
        
        ++iEdge;
@@ -335,7 +375,9 @@ void LeastSquareP1PolyRec2D::setup()
   FVMCC_PolyRec::setup();
 
   DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
-  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
+  DataHandle<State*> gstates = socket_gstates.getDataHandle();
+  DataHandle<CFuint> stencilOffsets = socket_stencilOffsets.getDataHandle();
+  DataHandle<CompactStencil::IDType> stencilIDs = socket_stencilIDs.getDataHandle();
   DataHandle<CFreal> weights = socket_weights.getDataHandle();
 
   const CFuint nbStates = states.size();
@@ -356,17 +398,15 @@ void LeastSquareP1PolyRec2D::setup()
   CFuint iEdge = 0;
   for(CFuint iState = 0; iState < nbStates; ++iState) {
    const State* const first = states[iState];
-   const CFuint stencilSize = stencil[iState].size();
-
    // loop over the neighbor cells belonging to the chosen stencil
-   for(CFuint in = 0; in < stencilSize; ++in) {
-     const State* const last = stencil[iState][in];
-     const CFuint lastID = (!last->isGhost()) ? last->getLocalID() : 
-       numeric_limits<CFuint>::max();
+   for(CFuint in = stencilOffsets[iState]; in < stencilOffsets[iState+1]; ++in) {
+     // ghost IDs are bigger than all the others
+     const CFuint lastID = stencilIDs[in];
      const CFuint firstID = first->getLocalID();
      cf_assert(firstID != lastID);
      
      if (lastID > firstID) {
+       const State* const last = CompactStencil::getState(lastID, states, gstates);
        const RealVector& nodeFirst = first->getCoordinates();
        const RealVector& nodeLast = last->getCoordinates();
        const CFreal deltaR = MathFunctions::getDistance(nodeFirst,nodeLast);
@@ -30,6 +30,8 @@ MethodStrategyProvider<LeastSquareP1PolyRec3D, CellCenterFVMData, PolyReconstruc
 LeastSquareP1PolyRec3D::LeastSquareP1PolyRec3D(const std::string& name) :
   FVMCC_PolyRec(name),
   socket_stencil("stencil"),
+  socket_stencilOffsets("stencilOffsets"),
+  socket_stencilIDs("stencilIDs"),
   socket_weights("weights"),
   socket_uX("uX"),
   socket_uY("uY"),
@@ -68,6 +70,8 @@ std::vector<Common::SafePtr<BaseDataSocketSink> > LeastSquareP1PolyRec3D::needsS
 
   // Add the needed DataSocketSinks
   result.push_back(&socket_stencil);
+  result.push_back(&socket_stencilOffsets);
+  result.push_back(&socket_stencilIDs);
   result.push_back(&socket_weights);
   result.push_back(&socket_uX);
   result.push_back(&socket_uY);
@@ -83,7 +87,9 @@ void LeastSquareP1PolyRec3D::computeGradients()
   prepareReconstruction();
 
   DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
-  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
+  DataHandle<State*> gstates = socket_gstates.getDataHandle();
+  DataHandle<CFuint> stencilOffsets = socket_stencilOffsets.getDataHandle();
+  DataHandle<CompactStencil::IDType> stencilIDs = socket_stencilIDs.getDataHandle();
   DataHandle<CFreal> weights = socket_weights.getDataHandle();
   DataHandle<CFreal> uX = socket_uX.getDataHandle();
   DataHandle<CFreal> uY = socket_uY.getDataHandle();
@@ -100,16 +106,15 @@ void LeastSquareP1PolyRec3D::computeGradients()
 
     for(CFuint iState = 0; iState < nbStates; ++iState) {
       const State* const first = states[iState];
-      const CFuint stencilSize = stencil[iState].size();
       // loop over the neighbor cells belonging to the chosen stencil
-      for(CFuint in = 0; in < stencilSize; ++in) {
-        const State* const last = stencil[iState][in];
-	const CFuint lastID = (!last->isGhost()) ? last->getLocalID() : 
-	    numeric_limits<CFuint>::max();
+      for(CFuint in = stencilOffsets[iState]; in < stencilOffsets[iState+1]; ++in) {
+        // ghost IDs are bigger than all the others
+        const CFuint lastID = stencilIDs[in];
         const CFuint firstID = first->getLocalID();
         cf_assert(firstID != lastID);
-
+        
 	if (lastID > firstID) {
+	  const State* const last = CompactStencil::getState(lastID, states, gstates);
 	  const RealVector& nodeFirst = first->getCoordinates();
 	  const RealVector& nodeLast = last->getCoordinates();
 
@@ -213,6 +218,19 @@ void LeastSquareP1PolyRec3D::computeGradients()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void LeastSquareP1PolyRec3D::computeLimiters()
+{
+  if (m_cellLimiterKernel) {
+    DataHandle<CFreal> uX = socket_uX.getDataHandle();
+    DataHandle<CFreal> uY = socket_uY.getDataHandle();
+    DataHandle<CFreal> uZ = socket_uZ.getDataHandle();
+    computeCellLimiters(socket_stencilOffsets.getDataHandle(), socket_stencilIDs.getDataHandle(),
+			&uX[0], &uY[0], &uZ[0]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void LeastSquareP1PolyRec3D::extrapolateImpl(GeometricEntity* const face)
 {
   FVMCC_PolyRec::baseExtrapolateImpl(face);
@@ -330,72 +348,96 @@ void LeastSquareP1PolyRec3D::updateWeights()
   FVMCC_PolyRec::updateWeights();
 
   DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
-  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
+  DataHandle<State*> gstates = socket_gstates.getDataHandle();
+  DataHandle<CFuint> stencilOffsets = socket_stencilOffsets.getDataHandle();
+  DataHandle<CompactStencil::IDType> stencilIDs = socket_stencilIDs.getDataHandle();
   DataHandle<CFreal> weights = socket_weights.getDataHandle();
 
   const CFuint nbStates = states.size();
 
-  _l11 = 0.0;
-  _l12 = 0.0;
-  _l13 = 0.0;
-  _l22 = 0.0;
-  _l23 = 0.0;
-  _l33 = 0.0;
+  // if only some states moved, the matrices of the other ones are kept
+  const bool incremental = findMovedStates(stencilOffsets, stencilIDs);
+  if (!incremental) {
+    _l11 = 0.0;
+    _l12 = 0.0;
+    _l13 = 0.0;
+    _l22 = 0.0;
+    _l23 = 0.0;
+    _l33 = 0.0;
+  }
+  else {
+    for (CFuint iState = 0; iState < nbStates; ++iState) {
+      if (m_updatedStates[iState]) {
+	_l11[iState] = 0.0;
+	_l12[iState] = 0.0;
+	_l13[iState] = 0.0;
+	_l22[iState] = 0.0;
+	_l23[iState] = 0.0;
+	_l33[iState] = 0.0;
+      }
+    }
+  }
 
   _lf1 = 0.0;
   _lf2 = 0.0;
   _lf3 = 0.0;
 
-  // weight coefficients are calculated
   // weight coefficients are calculated
   CFuint iEdge = 0;
   for(CFuint iState = 0; iState < nbStates; ++iState) {
     const State* const first = states[iState];
-    const CFuint stencilSize = stencil[iState].size();
-
     // loop over the neighbor cells belonging to the chosen stencil
-    for(CFuint in = 0; in < stencilSize; ++in) {
-      const State* const last = stencil[iState][in];
-     const CFuint lastID = (!last->isGhost()) ? last->getLocalID() : 
-       numeric_limits<CFuint>::max(); 
+    for(CFuint in = stencilOffsets[iState]; in < stencilOffsets[iState+1]; ++in) {
+      // ghost IDs are bigger than all the others
+      const CFuint lastID = stencilIDs[in];
       const CFuint firstID = first->getLocalID();
       cf_assert(firstID != lastID);
       
       if (lastID > firstID) {
-	const RealVector& nodeFirst = first->getCoordinates();
-	const RealVector& nodeLast = last->getCoordinates();
-	const CFreal deltaR = MathFunctions::getDistance(first->getCoordinates(),last->getCoordinates());
-	
-	weights[iEdge] = 1.0/deltaR;
-
-	
-	// weights always != 0
-	const CFreal dx = weights[iEdge]*(nodeLast[0]
-					  - nodeFirst[0]);
-	const CFreal dy = weights[iEdge]*(nodeLast[1]
-					  - nodeFirst[1]);
-	const CFreal dz = weights[iEdge]*(nodeLast[2]
-					  - nodeFirst[2]);
+	const bool updateFirst = !incremental || m_updatedStates[firstID];
+	const bool updateLast = !CompactStencil::isGhost(lastID) &&
+	  (!incremental || m_updatedStates[lastID]);
 	
-	CFLogDebugMax( "weights = " << weights[iEdge]
-		       << "dx = " << dx
-		       << "dy = " << dy
-		       << "dz = " << dz << "\n");
-	
-	_l11[firstID] += dx*dx;
-	_l12[firstID] += dx*dy;
-	_l13[firstID] += dx*dz;
-	_l22[firstID] += dy*dy;
-	_l23[firstID] += dy*dz;
-	_l33[firstID] += dz*dz;
-	
-	if (!last->isGhost()) {
-	  _l11[lastID] += dx*dx;
-	  _l12[lastID] += dx*dy;
-	  _l13[lastID] += dx*dz;
-	  _l22[lastID] += dy*dy;
-	  _l23[lastID] += dy*dz;
-	  _l33[lastID] += dz*dz;
+	if (updateFirst || updateLast) {
+	  const State* const last = CompactStencil::getState(lastID, states, gstates);
+	  const RealVector& nodeFirst = first->getCoordinates();
+	  const RealVector& nodeLast = last->getCoordinates();
+	  
+	  if (!incremental || m_movedStates[firstID] || isMovedState(lastID)) {
+	    const CFreal deltaR = MathFunctions::getDistance(nodeFirst,nodeLast);
+	    weights[iEdge] = 1.0/deltaR;
+	  }
+	  
+	  // weights always != 0
+	  const CFreal dx = weights[iEdge]*(nodeLast[0]
+					    - nodeFirst[0]);
+	  const CFreal dy = weights[iEdge]*(nodeLast[1]
+					    - nodeFirst[1]);
+	  const CFreal dz = weights[iEdge]*(nodeLast[2]
+					    - nodeFirst[2]);
+	  
+	  CFLogDebugMax( "weights = " << weights[iEdge]
+			 << "dx = " << dx
+			 << "dy = " << dy
+			 << "dz = " << dz << "\n");
+	  
+	  if (updateFirst) {
+	    _l11[firstID] += dx*dx;
+	    _l12[firstID] += dx*dy;
+	    _l13[firstID] += dx*dz;
+	    _l22[firstID] += dy*dy;
+	    _l23[firstID] += dy*dz;
+	    _l33[firstID] += dz*dz;
+	  }
+	  
+	  if (updateLast) {
+	    _l11[lastID] += dx*dx;
+	    _l12[lastID] += dx*dy;
+	    _l13[lastID] += dx*dz;
+	    _l22[lastID] += dy*dy;
+	    _l23[lastID] += dy*dz;
+	    _l33[lastID] += dz*dz;
+	  }
 	}
 	++iEdge;
       }
@@ -410,7 +452,9 @@ void LeastSquareP1PolyRec3D::setup()
   FVMCC_PolyRec::setup();
 
   DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
-  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
+  DataHandle<State*> gstates = socket_gstates.getDataHandle();
+  DataHandle<CFuint> stencilOffsets = socket_stencilOffsets.getDataHandle();
+  DataHandle<CompactStencil::IDType> stencilIDs = socket_stencilIDs.getDataHandle();
   DataHandle<CFreal> weights = socket_weights.getDataHandle();
 
   const CFuint nbStates = states.size();
@@ -442,17 +486,15 @@ void LeastSquareP1PolyRec3D::setup()
   CFuint iEdge = 0;
   for(CFuint iState = 0; iState < nbStates; ++iState) {
     const State* const first = states[iState];
-    const CFuint stencilSize = stencil[iState].size();
-    
     // loop over the neighbor cells belonging to the chosen stencil
-    for(CFuint in = 0; in < stencilSize; ++in) {
-      const State* const last = stencil[iState][in];
-      const CFuint lastID = (!last->isGhost()) ? last->getLocalID() :
-	numeric_limits<CFuint>::max();
+    for(CFuint in = stencilOffsets[iState]; in < stencilOffsets[iState+1]; ++in) {
+      // ghost IDs are bigger than all the others
+      const CFuint lastID = stencilIDs[in];
       const CFuint firstID = first->getLocalID();
       cf_assert(firstID != lastID);
       
       if (lastID > firstID) {
+	const State* const last = CompactStencil::getState(lastID, states, gstates);
 	const RealVector& nodeFirst = first->getCoordinates();
 	const RealVector& nodeLast = last->getCoordinates();
 	const CFreal deltaR = MathFunctions::getDistance(first->getCoordinates(),last->getCoordinates());
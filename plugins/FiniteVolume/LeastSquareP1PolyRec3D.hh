@@ -4,6 +4,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "FiniteVolume/FVMCC_PolyRec.hh"
+#include "FiniteVolume/CompactStencil.hh"
 
 #ifdef CF_HAVE_CUDA
 #include "FiniteVolume/FluxData.hh"
@@ -157,6 +158,12 @@ public:
    * Compute the gradients
    */
   virtual void computeGradients();
+  
+  /**
+   * Compute the limiters of all the cells with the cell-wise kernel
+   * of the limiter, if "CellLimiterKernel" is set
+   */
+  virtual void computeLimiters();
 
   /**
    * Set up the private data
@@ -186,6 +193,12 @@ protected:
   /// socket for stencil
   Framework::DataSocketSink<std::vector<Framework::State*> > socket_stencil;
 
+  /// socket for the offsets of the compact stencil
+  Framework::DataSocketSink<CFuint> socket_stencilOffsets;
+  
+  /// socket for the neighbor IDs of the compact stencil
+  Framework::DataSocketSink<CompactStencil::IDType> socket_stencilIDs;
+
   /// socket for weights
   Framework::DataSocketSink<CFreal> socket_weights;
 
@@ -30,14 +30,30 @@ leastSquareP1SetupProvider("LeastSquareP1Setup");
 
 //////////////////////////////////////////////////////////////////////////////
 
+void LeastSquareP1Setup::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< bool >
+    ("CompactStencilOnly",
+     "Release the stencil made of pointers once the compact stencil is built "
+     "(only valid if no command or strategy uses the \"stencil\" socket).");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 LeastSquareP1Setup::LeastSquareP1Setup(const std::string& name) :
   StdSetup(name),
   socket_stencil("stencil"),
+  socket_stencilOffsets("stencilOffsets"),
+  socket_stencilIDs("stencilIDs"),
   socket_weights("weights"),
   socket_uX("uX"),
   socket_uY("uY"),
   socket_uZ("uZ")
 {
+  addConfigOptionsTo(this);
+  
+  m_compactStencilOnly = false;
+  setParameter("CompactStencilOnly",&m_compactStencilOnly);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -71,6 +87,8 @@ LeastSquareP1Setup::providesSockets()
   std::vector<Common::SafePtr<BaseDataSocketSource> > result = StdSetup::providesSockets();
 
   result.push_back(&socket_stencil);
+  result.push_back(&socket_stencilOffsets);
+  result.push_back(&socket_stencilIDs);
   result.push_back(&socket_weights);
   result.push_back(&socket_uX);
   result.push_back(&socket_uY);
@@ -159,6 +177,18 @@ void LeastSquareP1Setup::computeStencil()
   
   computeStencil->setDataSocketSinks(socket_states, socket_nodes, socket_stencil, socket_gstates);
   (*computeStencil)();
+  
+  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
+  CompactStencil::build(stencil,
+			socket_stencilOffsets.getDataHandle(),
+			socket_stencilIDs.getDataHandle());
+  
+  if (m_compactStencilOnly) {
+    CFLog(VERBOSE, "LeastSquareP1Setup::computeStencil() => releasing the stencil of pointers\n");
+    for (CFuint iState = 0; iState < nbStates; ++iState) {
+      vector<State*>().swap(stencil[iState]);
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -167,31 +197,20 @@ CFuint LeastSquareP1Setup::countEdges()
 {
   CFAUTOTRACE;
 
-  // storage for the stencil (pointers to neighbors)
-  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
+  // compact storage for the stencil (IDs of the neighbors)
+  DataHandle<CFuint> stencilOffsets = socket_stencilOffsets.getDataHandle();
+  DataHandle<CompactStencil::IDType> stencilIDs = socket_stencilIDs.getDataHandle();
   
-  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
-  
-  const CFuint nbStates = states.size();
+  const CFuint nbStates = stencilOffsets.size() - 1;
   CFuint nbEdges = 0;
   
   for(CFuint iState = 0; iState < nbStates; ++iState) {
-    const State* const first = states[iState];
-    const CFuint stencilSize = stencil[iState].size();
     // loop over the neighbor cells belonging to the chosen stencil
-    for(CFuint in = 0; in < stencilSize; ++in) {
-      const State* const last = stencil[iState][in];
-      const CFuint firstID = first->getLocalID();
-      if (!last->isGhost()) {
-	const CFuint lastID = last->getLocalID();
-	cf_assert(firstID != lastID);
-	
-	if (lastID > firstID) {
-	  ++nbEdges;
-	}
-      }
-      else {
-	// you cannot ask the localID to a ghost state
+    for(CFuint in = stencilOffsets[iState]; in < stencilOffsets[iState+1]; ++in) {
+      const CFuint lastID = stencilIDs[in];
+      cf_assert(lastID != iState);
+      // ghost IDs are bigger than all the others
+      if (lastID > iState) {
 	++nbEdges;
       }
     }
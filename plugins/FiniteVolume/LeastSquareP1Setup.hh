@@ -4,6 +4,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "StdSetup.hh"
+#include "FiniteVolume/CompactStencil.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -24,6 +25,12 @@ namespace COOLFluiD {
 class LeastSquareP1Setup : public StdSetup {
 public:
 
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
   /**
    * Constructor.
    */
@@ -67,6 +74,12 @@ private: // data
   /// storage for the stencil via pointers to neighbors
   Framework::DataSocketSource<std::vector<Framework::State*> > socket_stencil;
   
+  /// storage for the offsets of the compact stencil of each state
+  Framework::DataSocketSource<CFuint> socket_stencilOffsets;
+  
+  /// storage for the neighbor IDs of the compact stencil
+  Framework::DataSocketSource<CompactStencil::IDType> socket_stencilIDs;
+  
   /// storage for the weights
   Framework::DataSocketSource<CFreal> socket_weights;
 
@@ -78,6 +91,10 @@ private: // data
 
   /// storage for uZ
   Framework::DataSocketSource<CFreal> socket_uZ; 
+  
+  /// flag telling to release the stencil made of pointers once the
+  /// compact stencil is built
+  bool m_compactStencilOnly;
    
 }; // class Setup
 
@@ -1115,20 +1115,22 @@ void MeshFittingAlgorithm::execute()
   Framework::DataHandle< CFreal> wallDistance = socket_wallDistance.getDataHandle();
  
   typedef CFMultiMap<CFuint, CFuint> MapNodeCell;
-  Common::CFMultiMap<CFuint,CFuint>  m_mapNodeCell(5000000); // AL: what is this??? please compute some estimation of size which is more automatic 
   typedef MapNodeCell::MapIterator mapIt;
+  // nodal wall distance averaged over the cells sharing each node:
+  // the node-cell map is sorted, so only the cells of each node are visited
   for (CFuint iNode = 0; iNode < nodes.size(); ++iNode) { 
- 	nodeDistance[nodes[iNode]->getLocalID()] = 0.;
-  }
-  for (CFuint iNode = 0; iNode < nodes.size(); ++iNode) { 
+	const CFuint nodeID = nodes[iNode]->getLocalID();
+	nodeDistance[nodeID] = 0.;
 	CFuint adjacentCells = 0;
-	for (mapIt it = m_mapNodeCell1.begin(); it!= m_mapNodeCell1.end(); ++it){
-		if (it->first==nodes[iNode]->getLocalID()){
-			nodeDistance[nodes[iNode]->getLocalID()]+= wallDistance[it->second];
-			adjacentCells +=1;
-		}
-         }
-	nodeDistance[nodes[iNode]->getLocalID()] = nodeDistance[nodes[iNode]->getLocalID()]/adjacentCells;
+	bool found = false;
+	std::pair<mapIt,mapIt> cellsOfNode = m_mapNodeCell1.find(nodeID, found);
+	if (found) {
+	  for (mapIt it = cellsOfNode.first; it != cellsOfNode.second; ++it){
+	    nodeDistance[nodeID]+= wallDistance[it->second];
+	    adjacentCells +=1;
+	  }
+	}
+	nodeDistance[nodeID] = nodeDistance[nodeID]/adjacentCells;
    }
 	
 			
@@ -4,12 +4,14 @@
 
 #include "FiniteVolume/FiniteVolume.hh"
 #include "Framework/MethodStrategyProvider.hh"
+#include "MathTools/BlockKernelsT.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
 using namespace COOLFluiD::Framework;
 using namespace COOLFluiD::Common;
+using namespace COOLFluiD::MathTools;
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -48,6 +50,9 @@ RoeFlux::RoeFlux(const std::string& name) :
   _absEvalues(),
   _tState(),
   _absJacob(),
+  _deltaState(),
+  _charDelta(),
+  _absJacobDelta(),
   _jRight(),
   _jLeft(),
   _jacob(),
@@ -56,7 +61,9 @@ RoeFlux::RoeFlux(const std::string& name) :
   _jacobDummy(),
   _tempUnitNormal(),
   _solutionStates(CFNULL),
-  _statesLR(2)
+  _statesLR(2),
+  _absJacobDeltaFun(CFNULL),
+  _sideJacobianFun(CFNULL)
 {
   addConfigOptionsTo(this);
   _currentDiffRedCoeff = 1.0;
@@ -95,6 +102,9 @@ void RoeFlux::setup()
   _tState.resize(Framework::PhysicalModelStack::getActive()->getNbEq());
   _absJacob.resize(Framework::PhysicalModelStack::getActive()->getNbEq(),
 		   Framework::PhysicalModelStack::getActive()->getNbEq());
+  _deltaState.resize(Framework::PhysicalModelStack::getActive()->getNbEq());
+  _charDelta.resize(Framework::PhysicalModelStack::getActive()->getNbEq());
+  _absJacobDelta.resize(Framework::PhysicalModelStack::getActive()->getNbEq());
   _jRight.resize(Framework::PhysicalModelStack::getActive()->getNbEq(),
 		   Framework::PhysicalModelStack::getActive()->getNbEq());
   _jLeft.resize(Framework::PhysicalModelStack::getActive()->getNbEq(),
@@ -110,6 +120,28 @@ void RoeFlux::setup()
 		     Framework::PhysicalModelStack::getActive()->getNbEq());
   _tempUnitNormal.resize(Framework::PhysicalModelStack::getActive()->getDim());
   
+  // the per-face block operations are specialized for the common numbers of
+  // equations: 2D/3D Euler, with one or two turbulence equations, and the
+  // common chemical non-equilibrium mixtures
+  switch(Framework::PhysicalModelStack::getActive()->getNbEq()) {
+  case(4):
+    selectKernels<4>(); break;
+  case(5):
+    selectKernels<5>(); break;
+  case(6):
+    selectKernels<6>(); break;
+  case(7):
+    selectKernels<7>(); break;
+  case(8):
+    selectKernels<8>(); break;
+  case(9):
+    selectKernels<9>(); break;
+  case(10):
+    selectKernels<10>(); break;
+  default:
+    selectKernels<0>();
+  }
+  
   RealVector refValues = 
     PhysicalModelStack::getActive()->getImplementor()->getRefStateValues();
   getMethodData().getNumericalJacobian().setRefValues(refValues);
@@ -159,7 +191,8 @@ void RoeFlux::compute(RealVector& result)
   
   const State& stateL = *(*_solutionStates)[0];
   const State& stateR = *(*_solutionStates)[1];
-  result = 0.5*(_sumFlux - getReductionCoeff()*(_rightEv*(_absEvalues*_leftEv))*(stateR - stateL));
+  (this->*_absJacobDeltaFun)(stateL, stateR);
+  result = 0.5*(_sumFlux - getReductionCoeff()*_absJacobDelta);
   
   // compute update coefficient
   if (!getMethodData().isPerturb()) {    
@@ -241,7 +274,6 @@ void RoeFlux::computeLeftJacobian()
     getConvectiveTerm()->getPhysicalData();
   getMethodData().getUpdateVar()->computePhysicalData(*leftState, pData);
   getMethodData().getSolutionVar()->computeProjectedJacobian(data.getUnitNormal(), _jacob); 
-  _jLeft = 0.5*(_jacob + _absJacob);
   
   // computeTransformMatrix(leftState);
   // _lFluxJacobian = _jLeft*_jacobDummy;
@@ -250,7 +282,7 @@ void RoeFlux::computeLeftJacobian()
     getMethodData().getUpdateToSolutionInUpdateMatTrans();
   vs->setMatrix(*leftState);
   const RealMatrix& dUdP = *vs->getMatrix();  
-  _lFluxJacobian = _jLeft*dUdP;
+  (this->*_sideJacobianFun)(0.5, dUdP, _jLeft, _lFluxJacobian);
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -264,7 +296,6 @@ void RoeFlux::computeRightJacobian()
     getConvectiveTerm()->getPhysicalData();
   getMethodData().getUpdateVar()->computePhysicalData(*rightState, pData);
   getMethodData().getSolutionVar()->computeProjectedJacobian(data.getUnitNormal(), _jacob);
-  _jRight = 0.5*(_jacob - _absJacob);
   
   // computeTransformMatrix(rightState);
   //_rFluxJacobian = _jRight*_jacobDummy;
@@ -273,7 +304,43 @@ void RoeFlux::computeRightJacobian()
     getMethodData().getUpdateToSolutionInUpdateMatTrans();
   vs->setMatrix(*rightState);
   const RealMatrix& dUdP = *vs->getMatrix();
-  _rFluxJacobian = _jRight*dUdP;
+  (this->*_sideJacobianFun)(-0.5, dUdP, _jRight, _rFluxJacobian);
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
+template <unsigned int N>
+void RoeFlux::computeAbsJacobDelta(const RealVector& stateL, const RealVector& stateR)
+{
+  // R*|Lambda|*L*(stateR - stateL), applied right to left on vectors
+  const CFuint nbEqs = _deltaState.size();
+  for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+    _deltaState[iEq] = stateR[iEq] - stateL[iEq];
+  }
+  BlockKernelsT<N>::mult(_leftEv, _deltaState, _charDelta);
+  for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+    _charDelta[iEq] *= _absEvalues[iEq];
+  }
+  BlockKernelsT<N>::mult(_rightEv, _charDelta, _absJacobDelta);
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
+template <unsigned int N>
+void RoeFlux::computeSideJacobian(const CFreal absCoeff, const RealMatrix& dUdP,
+				  RealMatrix& jSide, RealMatrix& fluxJacobian)
+{
+  BlockKernelsT<N>::combine(0.5, _jacob, absCoeff, _absJacob, jSide);
+  BlockKernelsT<N>::mult(jSide, dUdP, fluxJacobian);
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
+template <unsigned int N>
+void RoeFlux::selectKernels()
+{
+  _absJacobDeltaFun = &RoeFlux::computeAbsJacobDelta<N>;
+  _sideJacobianFun = &RoeFlux::computeSideJacobian<N>;
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -90,6 +90,27 @@ protected: // helper functions
     return _currentDiffRedCoeff;
   }
   
+  /**
+   * Compute R*|Lambda|*L*(stateR - stateL) in _absJacobDelta,
+   * with the block kernels for N equations
+   */
+  template <unsigned int N>
+  void computeAbsJacobDelta(const RealVector& stateL, const RealVector& stateR);
+  
+  /**
+   * Compute jSide = 0.5*_jacob + absCoeff*_absJacob and the flux jacobian
+   * jSide*dUdP, with the block kernels for N equations
+   */
+  template <unsigned int N>
+  void computeSideJacobian(const CFreal absCoeff, const RealMatrix& dUdP,
+			   RealMatrix& jSide, RealMatrix& fluxJacobian);
+  
+  /**
+   * Select the block kernels for N equations
+   */
+  template <unsigned int N>
+  void selectKernels();
+  
 private:
   
   /// Coefficient to reduce the diffusive part
@@ -124,6 +145,15 @@ protected:
   /// abs of the jacobian matrix
   RealMatrix   _absJacob;
 
+  /// jump of the states across the face
+  RealVector   _deltaState;
+
+  /// jump of the characteristic variables times the abs of the eigenvalues
+  RealVector   _charDelta;
+
+  /// abs of the jacobian matrix times the jump of the states
+  RealVector   _absJacobDelta;
+
   /// right jacobian matrix
   RealMatrix   _jRight;
   
@@ -151,6 +181,13 @@ protected:
   /// vector storing the left and right states of a face
   std::vector<Framework::State*> _statesLR;
 
+  /// computeAbsJacobDelta() for the number of equations, selected in setup()
+  void (RoeFlux::*_absJacobDeltaFun)(const RealVector& stateL, const RealVector& stateR);
+  
+  /// computeSideJacobian() for the number of equations, selected in setup()
+  void (RoeFlux::*_sideJacobianFun)(const CFreal absCoeff, const RealMatrix& dUdP,
+				    RealMatrix& jSide, RealMatrix& fluxJacobian);
+
 }; // end of class RoeFlux
 
 //////////////////////////////////////////////////////////////////////////////
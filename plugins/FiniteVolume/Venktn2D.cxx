@@ -44,6 +44,10 @@ void Venktn2D::defineConfigOptions(Config::OptionList& options)
 Venktn2D::Venktn2D(const std::string& name) :
   Limiter<CellCenterFVMData>(name),
   socket_stencil("stencil"),
+  socket_stencilOffsets("stencilOffsets", false),
+  socket_stencilIDs("stencilIDs", false),
+  socket_states("states"),
+  socket_gstates("gstates", false),
   socket_uX("uX"),
   socket_uY("uY"),
   _deltaMin(0.)
@@ -103,6 +107,46 @@ void Venktn2D::setup()
       
 //////////////////////////////////////////////////////////////////////////////
 
+CFuint Venktn2D::computeStencilExtrema(const State& state, CFuint iVar,
+				       CFreal& min0, CFreal& max0, CFreal& sumDistance)
+{
+  const CFuint stateID = state.getLocalID();
+  
+  if (!socket_stencilIDs.isConnected()) {
+    DataHandle< vector<State*> > stencil = socket_stencil.getDataHandle();
+    const vector<State*>& s = stencil[stateID];
+    for (CFuint is = 0; is < s.size(); ++is) {
+      State *const currState = s[is];
+      if(&state != currState) {
+	min0 = min(min0,(*currState)[iVar]);
+	max0 = max(max0,(*currState)[iVar]);
+	sumDistance += MathFunctions::getDistance
+	  (state.getCoordinates(), currState->getCoordinates());
+      }
+    }
+    return s.size();
+  }
+  
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  DataHandle<State*> gstates = socket_gstates.getDataHandle();
+  DataHandle<CFuint> stencilOffsets = socket_stencilOffsets.getDataHandle();
+  DataHandle<CompactStencil::IDType> stencilIDs = socket_stencilIDs.getDataHandle();
+  
+  // the compact stencil of a state never includes the state itself
+  const CFuint start = stencilOffsets[stateID];
+  const CFuint end   = stencilOffsets[stateID+1];
+  for (CFuint in = start; in < end; ++in) {
+    const State *const currState = CompactStencil::getState(stencilIDs[in], states, gstates);
+    min0 = min(min0,(*currState)[iVar]);
+    max0 = max(max0,(*currState)[iVar]);
+    sumDistance += MathFunctions::getDistance
+      (state.getCoordinates(), currState->getCoordinates());
+  }
+  return end - start;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void Venktn2D::limit(const vector<vector<Node*> >& coord,
                      GeometricEntity* const cell,
                      CFreal* limiterValue)
@@ -110,9 +154,7 @@ void Venktn2D::limit(const vector<vector<Node*> >& coord,
   const GeomEntList *const faces = cell->getNeighborGeos();
   const CFuint nbFaces = faces->size();
   const State *const state = cell->getState(0);
-  const CFuint stateID = state->getLocalID();
   const CFuint nbEquations = PhysicalModelStack::getActive()->getNbEq();
-  DataHandle< vector<State*> > stencil = socket_stencil.getDataHandle();
   
   for(CFuint iVar = 0; iVar < nbEquations; ++iVar) {
     //std::cout<<"iVar = "<< iVar <<"\n";
@@ -123,17 +165,7 @@ void Venktn2D::limit(const vector<vector<Node*> >& coord,
     if (this->m_useFullStencil) {
       CFuint nbNeighbors = 0;
       if (!this->m_useNodalExtrapolationStencil) {
-	const vector<State*>& s = stencil[stateID];
-	nbNeighbors = s.size();
-	for (CFuint is = 0; is < nbNeighbors; ++is) {
-	  State *const currState = s[is];
-	  if(state != currState) {
-	    min0 = min(min0,(*currState)[iVar]);
-	    max0 = max(max0,(*currState)[iVar]);
-	    avgDistance += MathFunctions::getDistance
-	      (state->getCoordinates(), currState->getCoordinates());
-	  }
-	}
+	nbNeighbors = computeStencilExtrema(*state, iVar, min0, max0, avgDistance);
       }
       else {
 	// old method kept for backward compatibility: it may escludes some ghost states at corners
@@ -247,6 +279,63 @@ void Venktn2D::limit(const vector<vector<Node*> >& coord,
   }
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+void Venktn2D::limitIncrements(CFuint nbEqs, CFuint nbPoints,
+			       const CFreal* deltaPlusMax, const CFreal* deltaPlusMin,
+			       const CFreal* deltaMin, CFreal avgDistance,
+			       CFreal* limiterValue) const
+{
+  // as in limit(), psi is carried from one point to the next for each
+  // variable, so that a zero increment keeps the previous psi (1 at first)
+  if(_isMFMHD){ // IMPLEMENTATION FROM VENKATAKRISHNAN PAPER 
+    const CFreal epsilon2 = pow(_coeffEps*avgDistance/_length, 3.0);
+    for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+      CFreal psi = 1.0;
+      CFreal psimin = 1.1;
+      for (CFuint ip = 0; ip < nbPoints; ++ip) {
+	const CFreal d = deltaMin[ip*nbEqs + iVar];
+	if (d != 0.0) {
+	  const CFreal dMinStar = MathTools::MathFunctions::sign(d)*
+	    (std::abs(d)/_magnitudeValues[iVar] + 1e-24);
+	  const CFreal dPlus = ((d > 0.0) ? deltaPlusMax[iVar] : deltaPlusMin[iVar])/
+	    _magnitudeValues[iVar];
+	  const CFreal dPlus2   = dPlus*dPlus;
+	  const CFreal dPlusMin = dPlus*dMinStar;
+	  const CFreal Num = (dPlus2 + epsilon2)*dMinStar + 2*dMinStar*dMinStar*dPlus;
+	  const CFreal Den = (dPlus2 + 2*dMinStar*dMinStar + dPlusMin + epsilon2);
+	  psi = 1./dMinStar*(Num/Den);
+	}
+	psimin = min(psi, psimin);
+      }
+      limiterValue[iVar] = psimin;
+    }
+  }
+  else{ //OLD IMPLEMENTATION
+    const CFreal distFactor = pow(avgDistance/_length, 3.0);
+    for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+      const CFreal epsilon = _coeffEps*_magnitudeValues[iVar]*_magnitudeValues[iVar]*distFactor;
+      CFreal psi = 1.0;
+      CFreal psimin = 1.1;
+      for (CFuint ip = 0; ip < nbPoints; ++ip) {
+	const CFreal d = deltaMin[ip*nbEqs + iVar];
+	if (d > 0.0) {
+	  const CFreal dPlusMax2   = deltaPlusMax[iVar]*deltaPlusMax[iVar];
+	  const CFreal dPlusMaxMin = deltaPlusMax[iVar]*d;
+	  psi = (dPlusMax2 + 2.0*dPlusMaxMin + epsilon)/
+	    (dPlusMax2 + dPlusMaxMin + 2.0*d*d + epsilon);
+	}
+	if (d < 0.0) {
+	  const CFreal y = deltaPlusMin[iVar]/d;
+	  psi = (y*y + 2*y)/(y*y + y + 2.);
+	}
+	psimin = min(psi, psimin);
+      }
+      limiterValue[iVar] = psimin;
+    }
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
     } // namespace FiniteVolume
@@ -7,6 +7,7 @@
 #include "Framework/Storage.hh"
 #include "Framework/DataSocketSink.hh"
 #include "CellCenterFVMData.hh"
+#include "FiniteVolume/CompactStencil.hh"
 
 #ifdef CF_HAVE_CUDA
 #include "FiniteVolume/CellData.hh"
@@ -165,6 +166,10 @@ public:
       Framework::Limiter<CellCenterFVMData>::needsSockets();
 
     result.push_back(&socket_stencil);
+    result.push_back(&socket_stencilOffsets);
+    result.push_back(&socket_stencilIDs);
+    result.push_back(&socket_states);
+    result.push_back(&socket_gstates);
     result.push_back(&socket_uX);
     result.push_back(&socket_uY);
     return result;
@@ -176,6 +181,18 @@ public:
   virtual void limit(const std::vector<std::vector<Framework::Node*> >& coord,
 		     Framework::GeometricEntity* const cell,
 		     CFreal* limiterValue);
+  
+  /**
+   * Compute the limiter of one cell from the extrema in its stencil and
+   * from the increments at its quadrature points
+   */
+  virtual void limitIncrements(CFuint nbEqs, CFuint nbPoints,
+			       const CFreal* deltaPlusMax, const CFreal* deltaPlusMin,
+			       const CFreal* deltaMin, CFreal avgDistance,
+			       CFreal* limiterValue) const;
+  
+  /// @return true since limitIncrements() is implemented
+  virtual bool hasIncrementsKernel() const {return true;}
 
   /**
    * Set up the private data
@@ -184,6 +201,15 @@ public:
   
 protected:
   
+  /**
+   * Updates the extrema of the given variable and the sum of the distances
+   * to the neighbors over the reconstruction stencil of the given state,
+   * using the compact stencil if it is available
+   * @return the number of neighbors in the stencil
+   */
+  CFuint computeStencilExtrema(const Framework::State& state, CFuint iVar,
+			       CFreal& min0, CFreal& max0, CFreal& sumDistance);
+  
   /**
    * Compute the denominator of the limiter argument
    */
@@ -200,6 +226,18 @@ protected:
   /// storage for the stencil via pointers to neighbors
   Framework::DataSocketSink<std::vector<Framework::State*> > socket_stencil;
   
+  /// socket for the offsets of the compact stencil
+  Framework::DataSocketSink<CFuint> socket_stencilOffsets;
+  
+  /// socket for the neighbor IDs of the compact stencil
+  Framework::DataSocketSink<CompactStencil::IDType> socket_stencilIDs;
+  
+  /// socket for states
+  Framework::DataSocketSink<Framework::State*, Framework::GLOBAL> socket_states;
+  
+  /// socket for ghost states
+  Framework::DataSocketSink<Framework::State*> socket_gstates;
+  
   /// socket for uX values
   Framework::DataSocketSink<CFreal> socket_uX;
   
@@ -48,7 +48,6 @@ void Venktn3D::limit(const vector<vector<Node*> >& coord,
   DataHandle<CFreal> uX = socket_uX.getDataHandle();
   DataHandle<CFreal> uY = socket_uY.getDataHandle();
   DataHandle<CFreal> uZ = socket_uZ.getDataHandle();
-  DataHandle< vector<State*> > stencil = socket_stencil.getDataHandle();
   
   const GeomEntList *const faces = cell->getNeighborGeos();
   const CFuint nbFaces = faces->size();
@@ -65,17 +64,7 @@ void Venktn3D::limit(const vector<vector<Node*> >& coord,
     if (this->m_useFullStencil) {
       CFuint nbNeighbors = 0;
       if (!this->m_useNodalExtrapolationStencil) {
-	const vector<State*>& s = stencil[stateID];
-	nbNeighbors = s.size();
-	for (CFuint is = 0; is < nbNeighbors; ++is) {
-	  State *const currState = s[is];
-	  if(state != currState) {
-	    min0 = min(min0,(*currState)[iVar]);
-	    max0 = max(max0,(*currState)[iVar]);
-	    avgDistance += MathFunctions::getDistance
-	      (state->getCoordinates(), currState->getCoordinates());
-	  }
-	}
+	nbNeighbors = computeStencilExtrema(*state, iVar, min0, max0, avgDistance);
       }
       else {
 	// old method kept for backward compatibility: it may escludes some ghost states at corners
@@ -55,6 +55,12 @@ public:
    */
   virtual ~ICPplasmaFieldComputingBC();
   
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+  
   /**
    * Set up private data and data of the aggregated classes 
    * in this command before processing phase
@@ -88,6 +94,13 @@ private:
   CFreal ellipticIntegralSecondKind(CFreal const& k);
   CFreal ellipticIntegralCombined(CFreal const& k);
   
+  /**
+   * geometric part of the coupling between a ghost cell and a cell,
+   * which multiplies the current in the cell
+   */
+  CFreal computeGeometricCoeff(CFreal rGhostCell, CFreal zGhostCell,
+			       CFreal rCell, CFreal zCell);
+  
 private: //data
 
   /// storage of volumes
@@ -127,6 +140,22 @@ private: //data
   /// number of states in processor
   std::vector<CFuint> m_nbStatesInProc;
   
+  /// number of updatable cells in each processor, once the kernel is built
+  std::vector<CFuint> m_nbUpdatablesInProc;
+  
+  /// geometric coefficients coupling the local ghost cells (rows) and the
+  /// updatable cells of each processor (columns)
+  std::vector<RealVector> m_kernel;
+  
+  /// flag telling if the geometric coefficients are stored
+  bool m_useKernel;
+  
+  /// flag telling if the geometric coefficients have been computed
+  bool m_kernelBuilt;
+  
+  /// maximum size of the stored geometric coefficients in MB
+  CFreal m_maxKernelSizeMB;
+  
 }; // end of class ICPplasmaFieldComputingBC
 
 //////////////////////////////////////////////////////////////////////////////
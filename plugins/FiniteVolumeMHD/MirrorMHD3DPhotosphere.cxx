@@ -5,8 +5,6 @@
 #include "Framework/MeshData.hh"
 #include "Framework/DataHandle.hh"
 
-#include <gsl/gsl_sf_legendre.h>
-
 //////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -49,7 +47,9 @@ MirrorMHD3DPhotosphere::MirrorMHD3DPhotosphere(const std::string& name) :
   _cartesianSphericalTMInnerState(),
   _sphericalCartesianTMInnerState(),
   _cartesianSphericalTMGhostState(),
-  _sphericalCartesianTMGhostState()
+  _sphericalCartesianTMGhostState(),
+  _pfss(),
+  _BrPFSSGhost()
 {
   addConfigOptionsTo(this);
 
@@ -91,81 +91,66 @@ void MirrorMHD3DPhotosphere::setup()
              Framework::PhysicalModelStack::getActive()->getDim());
   _sphericalCartesianTMGhostState.resize(Framework::PhysicalModelStack::getActive()->getDim(),
                 Framework::PhysicalModelStack::getActive()->getDim());
-}
 
-//////////////////////////////////////////////////////////////////////////////
+  // the ghost states do not move, so that the PFSS magnetic field imposed
+  // in them is computed once for all here
+  _BrPFSSGhost.resize(MeshDataStack::getActive()->Statistics().getNbFaces());
 
-void MirrorMHD3DPhotosphere::computePFSSMagneticField(const RealVector& stateCoordsSpherical,
-                                        RealVector& BPFSSSpherical)
-{
-  const CFreal r = stateCoordsSpherical[0];
-  const CFreal theta = stateCoordsSpherical[1];
-  const CFreal phi = stateCoordsSpherical[2];
+  Common::SafePtr<GeometricEntityPool<FaceTrsGeoBuilder> >
+    geoBuilder = getMethodData().getFaceTrsGeoBuilder();
 
-  DataHandle<std::vector<CFreal> > Almreal  = socket_Almreal.getDataHandle();
-  DataHandle<std::vector<CFreal> > Almimg  = socket_Almimg.getDataHandle();
-  DataHandle<std::vector<CFreal> > Blmreal  = socket_Blmreal.getDataHandle();
-  DataHandle<std::vector<CFreal> > Blmimg  = socket_Blmimg.getDataHandle();
+  SafePtr<FaceTrsGeoBuilder> geoBuilderPtr = geoBuilder->getGeoBuilder();
+  geoBuilderPtr->setDataSockets(socket_states, socket_gstates, socket_nodes);
 
-  const CFuint nbLModes = _varSet->getNbLModes();
+  FaceTrsGeoBuilder::GeoData& geoData = geoBuilder->getDataGE();
+  geoData.isBFace = true;
 
-  CFreal Br = 0.0, Btheta = 0.0, Bphi = 0.0;
+  RealVector ghostStateCoordsSpherical(Framework::PhysicalModelStack::getActive()->getDim());
+  RealVector BPFSSGhostState(Framework::PhysicalModelStack::getActive()->getDim());
 
-  for (CFuint l = 0; l <= nbLModes; ++l) {
-      for (CFuint m = 0; m <= l; ++m) {
-          // Assign the real part of B(r,phi)          
-          const CFreal Ylmampl = gsl_sf_legendre_sphPlm(l,m,cos(theta));
-          const CFreal Brreal = -(Almreal[l])[m]*(double)l*pow(r,(double)l-1.0)+(Blmreal[l])[m]*((double)l+1.0)*pow(r,-(double)l-2.0);
-          const CFreal Brimg = -(Almimg[l])[m]*(double)l*pow(r,(double)l-1.0)+(Blmimg[l])[m]*((double)l+1.0)*pow(r,-(double)l-2.0);
-          const CFreal BthetaCoeff = -1.0/(r*sin(theta));
-          const CFreal Bphireal = BthetaCoeff*(double)m*((Almreal[l])[m]*pow(r,(double)l)+(Blmreal[l])[m]*pow(r,-(double)l-1.0));
-          const CFreal Bphiimg = BthetaCoeff*(double)m*((Almimg[l])[m]*pow(r,(double)l)+(Blmimg[l])[m]*pow(r,-(double)l-1.0));
+  const vector<SafePtr<TopologicalRegionSet> >& trsList = getTrsList();
+  for (CFuint iTrs = 0; iTrs < trsList.size(); ++iTrs) {
+    SafePtr<TopologicalRegionSet> trs = trsList[iTrs];
+    const CFuint nbTrsFaces = trs->getLocalNbGeoEnts();
+    geoData.trs = trs;
 
-          const CFreal Brampl = sqrt(Brreal*Brreal+Brimg*Brimg);
-          const CFreal Bphiampl = sqrt(Bphireal*Bphireal+Bphiimg*Bphiimg);
+    CFLog(VERBOSE, "MirrorMHD3DPhotosphere::setup() => PFSS magnetic field computed for "
+          << trs->getName() << " on " << nbTrsFaces << " faces\n");
 
-          // TBD: In order to obtain the correct polarity of the magnetic dipoles on the photosphere -= is used instead of += for Br, Bphi and Btheta. This should be checked.
-          const CFreal Brangle = atan2(Brimg,Brreal);
-          Br -= Brampl*Ylmampl*cos(Brangle+(double)m*phi);
+    for (CFuint iFace = 0; iFace < nbTrsFaces; ++iFace) {
+      geoData.idx = iFace;
+      GeometricEntity *const face = geoBuilder->buildGE();
 
-          const CFreal Bphiangle = atan2(Bphiimg,Bphireal);
-          Bphi -= Bphiampl*Ylmampl*cos(Bphiangle+(double)m*phi+0.5*MathTools::MathConsts::CFrealPi());
-      }
-  }
+      const RealVector ghostStateCoords = face->getState(1)->getCoordinates();
+      _varSet->setTransformationMatrices(ghostStateCoords,ghostStateCoordsSpherical,
+                                         _cartesianSphericalTMGhostState,_sphericalCartesianTMGhostState);
+      computePFSSMagneticField(ghostStateCoordsSpherical,BPFSSGhostState);
+      _BrPFSSGhost[face->getID()] = BPFSSGhostState[0];
 
-  for (CFuint l = 1; l <= (nbLModes-1); ++l) {
-      for (CFuint m = 0; m <= l; ++m) {
-          const CFreal Rlm = sqrt(((double)l*(double)l-(double)m*(double)m)/(4.0*(double)l*(double)l-1.0));
-          const CFreal Rlpl1m = sqrt((((double)l+1.0)*((double)l+1.0)-(double)m*(double)m)/(4.0*((double)l+1.0)*((double)l+1.0)-1.0));
-          // Assign the real part of B(theta)          
-          const CFreal Ylmampl = gsl_sf_legendre_sphPlm(l,m,cos(theta));
-          const CFreal BthetaCoeff = -1.0/(r*sin(theta));
-          const CFreal Bthetareal = BthetaCoeff*(Rlm*((double)l-1.0)*((Almreal[l-1])[m]*pow(r,(double)l-1.0)+(Blmreal[l-1])[m]*pow(r,-(double)l))
-                                            -Rlpl1m*((double)l+2.0)*((Almreal[l+1])[m]*pow(r,(double)l+1.0)+(Blmreal[l+1])[m]*pow(r,-(double)l-2.0)));
-          const CFreal Bthetaimg = BthetaCoeff*(Rlm*((double)l-1.0)*((Almimg[l-1])[m]*pow(r,(double)l-1.0)+(Blmimg[l-1])[m]*pow(r,-(double)l))
-                                            -Rlpl1m*((double)l+2.0)*((Almimg[l+1])[m]*pow(r,(double)l+1.0)+(Blmimg[l+1])[m]*pow(r,-(double)l-2.0)));
-
-          const CFreal Bthetaampl = sqrt(Bthetareal*Bthetareal+Bthetaimg*Bthetaimg);
-
-          const CFreal Bthetaangle = atan2(Bthetaimg,Bthetareal);
-          Btheta -= Bthetaampl*Ylmampl*cos(Bthetaangle+(double)m*phi);
-      }
+      geoBuilder->releaseGE();
+    }
   }
+}
 
-  BPFSSSpherical[0] = Br;
-  BPFSSSpherical[1] = Btheta;
-  BPFSSSpherical[2] = Bphi;
+//////////////////////////////////////////////////////////////////////////////
+
+void MirrorMHD3DPhotosphere::computePFSSMagneticField(const RealVector& stateCoordsSpherical,
+                                        RealVector& BPFSSSpherical)
+{
+  DataHandle<std::vector<CFreal> > Almreal  = socket_Almreal.getDataHandle();
+  DataHandle<std::vector<CFreal> > Almimg  = socket_Almimg.getDataHandle();
+  DataHandle<std::vector<CFreal> > Blmreal  = socket_Blmreal.getDataHandle();
+  DataHandle<std::vector<CFreal> > Blmimg  = socket_Blmimg.getDataHandle();
+
+  _pfss.compute(_varSet->getNbLModes(), stateCoordsSpherical[0],
+                stateCoordsSpherical[1], stateCoordsSpherical[2],
+                Almreal, Almimg, Blmreal, Blmimg, BPFSSSpherical);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 void MirrorMHD3DPhotosphere::setGhostState(GeometricEntity *const face)
 {
-  DataHandle<std::vector<CFreal> > Almreal = socket_Almreal.getDataHandle();
-  DataHandle<std::vector<CFreal> > Almimg = socket_Almimg.getDataHandle();
-  DataHandle<std::vector<CFreal> > Blmreal = socket_Blmreal.getDataHandle();
-  DataHandle<std::vector<CFreal> > Blmimg = socket_Blmimg.getDataHandle();
-
   State *const innerState = face->getState(0);
   State *const ghostState = face->getState(1);
 
@@ -192,7 +177,6 @@ void MirrorMHD3DPhotosphere::setGhostState(GeometricEntity *const face)
   RealVector VSphericalInnerState(Framework::PhysicalModelStack::getActive()->getDim());
   RealVector VCartesianGhostState(Framework::PhysicalModelStack::getActive()->getDim());
   RealVector VSphericalGhostState(Framework::PhysicalModelStack::getActive()->getDim());
-  RealVector BPFSSGhostState(Framework::PhysicalModelStack::getActive()->getDim());
 
   BCartesianInnerState[0] = _dataInnerState[MHDTerm::BX];
   BCartesianInnerState[1] = _dataInnerState[MHDTerm::BY];
@@ -211,9 +195,7 @@ void MirrorMHD3DPhotosphere::setGhostState(GeometricEntity *const face)
 
   VCartesianGhostState = _sphericalCartesianTMGhostState*VSphericalGhostState;
 
-  computePFSSMagneticField(ghostStateCoordsSpherical,BPFSSGhostState);
-
-  BSphericalGhostState[0] = BPFSSGhostState[0]; 
+  BSphericalGhostState[0] = _BrPFSSGhost[face->getID()];
   BSphericalGhostState[1] = BSphericalInnerState[1];
   BSphericalGhostState[2] = BSphericalInnerState[2];
 
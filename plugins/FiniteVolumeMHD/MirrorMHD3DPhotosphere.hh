@@ -5,6 +5,7 @@
 
 #include "FiniteVolume/FVMCC_BC.hh"
 #include "Framework/DataSocketSink.hh"
+#include "MHD/PFSSMagneticField.hh"
 
 //////////////////////////////////////////////////////////////////////
 
@@ -57,7 +58,9 @@ public:
 
   /**
    * Set up private data and data of the aggregated classes
-   * in this command before processing phase
+   * in this command before processing phase.
+   * The PFSS magnetic field is computed here in the ghost state of
+   * every boundary face, since it does not change during the simulation
    */
   void setup();
 
@@ -119,6 +122,12 @@ public:
   /// transformation matrix from spherical to Cartesian coordinate system for ghost state
   RealMatrix _sphericalCartesianTMGhostState;
 
+  /// evaluator of the PFSS magnetic field
+  Physics::MHD::PFSSMagneticField _pfss;
+
+  /// radial PFSS magnetic field in the ghost state of each boundary face, indexed by face ID
+  std::vector<CFreal> _BrPFSSGhost;
+
 }; // end of class MirrorMHD3DPhotosphere
 
 //////////////////////////////////////////////////////////////////////
@@ -56,6 +56,9 @@ public:
 		     Framework::GeometricEntity* const cell,
 		     CFreal* limiterValue);
   
+  /// @return false since limit() differs from the cell-wise kernel of Venktn2D
+  virtual bool hasIncrementsKernel() const {return false;}
+  
   /**
    * Set up the private data
    */
@@ -87,6 +87,13 @@ protected:
   virtual void setVibTemperature(const RealVector& pdata, 
 				 const Framework::State& state,
 				 RealVector& tvib);
+  /**
+   * Scale the jacobian of the mass production terms given by the library
+   * in the variables [rho_i v T Tv]
+   * @param coeff factor multiplying the mass production terms in the source
+   */
+  void scaleMassProductionJacob(const CFreal coeff, RealMatrix& jacobian);
+  
   /**
    * Compute the source term for the axisymmetric Navier-Stokes
    */
@@ -0,0 +1,83 @@
+#include "Common/CFLog.hh"
+
+#include "FluctSplit/CellColouring.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+    namespace FluctSplit {
+
+//////////////////////////////////////////////////////////////////////////////
+
+CellColouring::CellColouring() :
+  m_colourCells(),
+  m_nbCells(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CellColouring::build(SafePtr<TopologicalRegionSet> cells)
+{
+  CFAUTOTRACE;
+
+  m_colourCells.clear();
+  m_nbCells = cells->getLocalNbGeoEnts();
+
+  // find the number of states referenced by the cells
+  CFuint nbStates = 0;
+  for (CFuint iCell = 0; iCell < m_nbCells; ++iCell) {
+    const CFuint nbStatesInCell = cells->getNbStatesInGeo(iCell);
+    for (CFuint iState = 0; iState < nbStatesInCell; ++iState) {
+      nbStates = std::max(nbStates, cells->getStateID(iCell, iState) + 1);
+    }
+  }
+
+  // colours already used by the cells around each state
+  vector<vector<CFuint> > stateColours(nbStates);
+  // forbidden[c] == iCell+1 if colour c is used by a neighbour of iCell
+  vector<CFuint> forbidden;
+
+  for (CFuint iCell = 0; iCell < m_nbCells; ++iCell) {
+    const CFuint nbStatesInCell = cells->getNbStatesInGeo(iCell);
+    for (CFuint iState = 0; iState < nbStatesInCell; ++iState) {
+      const vector<CFuint>& used = stateColours[cells->getStateID(iCell, iState)];
+      for (CFuint i = 0; i < used.size(); ++i) {
+        forbidden[used[i]] = iCell + 1;
+      }
+    }
+
+    // smallest colour not used by any neighbour
+    CFuint colour = 0;
+    while (colour < forbidden.size() && forbidden[colour] == iCell + 1) {
+      ++colour;
+    }
+    if (colour == forbidden.size()) {
+      forbidden.push_back(0);
+      m_colourCells.push_back(vector<CFuint>());
+    }
+
+    m_colourCells[colour].push_back(iCell);
+    for (CFuint iState = 0; iState < nbStatesInCell; ++iState) {
+      stateColours[cells->getStateID(iCell, iState)].push_back(colour);
+    }
+  }
+
+  CFLog(VERBOSE, "CellColouring::build() => " << m_nbCells << " cells of TRS "
+        << cells->getName() << " in " << m_colourCells.size() << " colours\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FluctSplit
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
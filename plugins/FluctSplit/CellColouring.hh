@@ -0,0 +1,66 @@
+#ifndef COOLFluiD_Numerics_FluctSplit_CellColouring_hh
+#define COOLFluiD_Numerics_FluctSplit_CellColouring_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Common/SafePtr.hh"
+#include "Framework/TopologicalRegionSet.hh"
+#include "FluctSplit/FluctSplit.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+    namespace FluctSplit {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class partitions the cells of a TopologicalRegionSet in colours
+/// such that no two cells of the same colour share a state.
+/// All the cells of one colour can then scatter their residual and their
+/// jacobian contributions (or perturb their states) concurrently.
+/// The colouring is greedy, following the local cell numbering, so that
+/// the cells of each colour remain sorted by increasing index.
+class FluctSplit_API CellColouring {
+public:
+
+  /// Constructor
+  CellColouring();
+
+  /// Colours the cells of the given TRS
+  void build(Common::SafePtr<Framework::TopologicalRegionSet> cells);
+
+  /// @return the number of colours
+  CFuint getNbColours() const {return m_colourCells.size();}
+
+  /// @return the local indexes in the TRS of the cells with the given colour
+  const std::vector<CFuint>& getCells(CFuint iColour) const
+  {
+    cf_assert(iColour < m_colourCells.size());
+    return m_colourCells[iColour];
+  }
+
+  /// @return the number of cells which were coloured
+  CFuint getNbCells() const {return m_nbCells;}
+
+private:
+
+  /// cells of each colour
+  std::vector<std::vector<CFuint> > m_colourCells;
+
+  /// number of coloured cells
+  CFuint m_nbCells;
+
+}; // class CellColouring
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FluctSplit
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_FluctSplit_CellColouring_hh
@@ -29,7 +29,8 @@ ComputeDiffusiveTerm::ComputeDiffusiveTerm(const std::string& name) :
   socket_updateCoeff("updateCoeff"),
   socket_normals("normals"),
   socket_volumes("volumes"),
-  socket_Pe_cell("Pe_cell")
+  socket_Pe_cell("Pe_cell"),
+  m_first(CFNULL)
 {
   addConfigOptionsTo(this);
   
@@ -62,7 +63,9 @@ std::vector<Common::SafePtr<BaseDataSocketSource> >
 ComputeDiffusiveTerm::providesSockets()
 {
   std::vector<Common::SafePtr<BaseDataSocketSource> > result;
-  result.push_back(&socket_Pe_cell);
+  if (m_first.isNull()) {
+    result.push_back(&socket_Pe_cell);
+  }
   return result;
 }
 
@@ -71,11 +74,14 @@ ComputeDiffusiveTerm::providesSockets()
 void ComputeDiffusiveTerm::setup()
 {
   Framework::MethodStrategy<FluctuationSplitData>::setup();
-  const CFuint nbcells =
-    MeshDataStack::getActive()->getTrs("InnerCells")->getLocalNbGeoEnts();
   
-  DataHandle<CFreal> Pe_cell = socket_Pe_cell.getDataHandle();
-  Pe_cell.resize( nbcells );
+  if (m_first.isNull()) {
+    const CFuint nbcells =
+      MeshDataStack::getActive()->getTrs("InnerCells")->getLocalNbGeoEnts();
+    
+    DataHandle<CFreal> Pe_cell = socket_Pe_cell.getDataHandle();
+    Pe_cell.resize( nbcells );
+  }
 }
       
 //////////////////////////////////////////////////////////////////////////////
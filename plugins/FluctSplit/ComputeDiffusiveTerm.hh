@@ -79,6 +79,13 @@ public:
   /// Set mesh data
   void setMeshData();
 
+  /// Makes this computer, used by one of the other threads, store the cell
+  /// Peclet number in the socket of the given one instead of providing it
+  void shareSocketsWith(Common::SafePtr<ComputeDiffusiveTerm> first)
+  {
+    m_first = first;
+  }
+
   /// Set the diffusive variable set
   virtual void setDiffusiveVarSet(Common::SafePtr<Framework::DiffusiveVarSet> diffVar) {}
   
@@ -99,6 +106,11 @@ public:
       (FromHere(), "ComputeDiffusiveTerm::computeCellGradientsAndAverageState()");
   }
 
+  /// Tells if one instance of this computer per thread can compute
+  /// concurrently the diffusive terms of cells which do not share any state
+  /// (the data of the other cells must not be modified)
+  virtual bool isThreadSafe() const {return true;}
+
   /// Gets the Class name
   static std::string getClassName()
   {
@@ -117,6 +129,12 @@ protected:
   
   /// Tells if this term can be added to another derived one
   virtual bool addToDerivedTerm() {return false;}
+
+  /// @return the cell Peclet number storage
+  Framework::DataHandle<CFreal> getPeCell()
+  {
+    return (m_first.isNull()) ? socket_Pe_cell.getDataHandle() : m_first->getPeCell();
+  }
   
 protected:
 
@@ -134,6 +152,9 @@ protected:
 
   /// Export the cell Peclet number
   bool _store_Pe_cell;
+
+  /// computer whose sockets are used by this one (CFNULL if it is the first one)
+  Common::SafePtr<ComputeDiffusiveTerm> m_first;
   
 }; // end of class ComputeDiffusiveTerm
 
@@ -61,6 +61,11 @@ public: // typedefs
 				    Framework::BlockAccumulator *const acc,
 				    const std::vector<CFuint>& equationIDs) = 0;
   
+  /// Tells if computeJacobianTerm() can be called concurrently for cells
+  /// which do not share any state, each thread using its own accumulator and
+  /// the FluctuationSplitStrategy returned for it by the method data
+  virtual bool isThreadSafe() const {return false;}
+  
   /// Gets the Class name
   static std::string getClassName()
   {
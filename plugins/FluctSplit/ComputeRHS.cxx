@@ -57,7 +57,11 @@ ComputeRHS::ComputeRHS(const std::string& name) :
   _fsStrategy(CFNULL),
   _adStrategy(CFNULL),
   _hasDiffusiveTerm(false),
-  _hasArtDiffusiveTerm(false)
+  _hasArtDiffusiveTerm(false),
+  _threaded(false),
+  _threadGeoBuilder(),
+  _threadResidual(),
+  _threadDiffResidual()
 {
   addConfigOptionsTo(this);
 
@@ -75,6 +79,11 @@ ComputeRHS::~ComputeRHS()
 
 void ComputeRHS::unsetup()
 {
+  for (CFuint i = 0; i < _threadGeoBuilder.size(); ++i) {
+    _threadGeoBuilder[i]->unsetup();
+    deletePtr(_threadGeoBuilder[i]);
+  }
+  _threadGeoBuilder.clear();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -167,6 +176,34 @@ void ComputeRHS::setup()
 
   // flag telling if a artificial diffusive term has to be computed
   _hasArtDiffusiveTerm = !(_adStrategy->isNull());
+  
+  // each thread has its own split strategy, transformers and diffusive term
+  // computer, but the artificial diffusion strategy is shared
+  const CFuint nbThreads = getMethodData().getNbThreads();
+  _threaded = (nbThreads > 1) && !_hasArtDiffusiveTerm &&
+    (!_hasDiffusiveTerm || _diffTermComputer->isThreadSafe());
+  if (nbThreads > 1 && !_threaded) {
+    CFLog(WARN, "ComputeRHS::setup() => " << getName() << " runs on 1 thread: the artificial "
+	  << "diffusion strategy or the diffusive term computer is not thread-safe\n");
+  }
+  
+  if (_threaded) {
+    _threadGeoBuilder.resize(nbThreads);
+    _threadResidual.resize(nbThreads);
+    _threadDiffResidual.resize(nbThreads);
+    for (CFuint i = 0; i < nbThreads; ++i) {
+      _threadGeoBuilder[i] = new GeometricEntityPool<StdTrsGeoBuilder>();
+      _threadGeoBuilder[i]->setup();
+      _threadResidual[i].resize(maxNbStatesInCell);
+      _threadDiffResidual[i].resize(maxNbStatesInCell);
+      for (CFuint j = 0; j < maxNbStatesInCell; ++j) {
+	_threadResidual[i][j].resize(nbEqs);
+	_threadResidual[i][j] = 0.0;
+	_threadDiffResidual[i][j].resize(nbEqs);
+	_threadDiffResidual[i][j] = 0.0;
+      }
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -184,6 +221,11 @@ void ComputeRHS::executeOnTrs()
   CFAUTOTRACE;
 
   cf_assert(isSetup());
+  
+  if (_threaded) {
+    executeOnTrsColoured();
+    return;
+  }
 
   // reset the RHS to 0.
   cleanRHS();
@@ -290,6 +332,100 @@ void ComputeRHS::executeOnTrs()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void ComputeRHS::executeOnTrsColoured()
+{
+  CFAUTOTRACE;
+
+  // reset the RHS to 0.
+  cleanRHS();
+  // reset the update flag to 0 for all the states
+  DataHandle<bool> isUpdated = socket_isUpdated.getDataHandle();
+  isUpdated = false;
+
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  
+  const CellColouring& colouring = getMethodData().getCellColouring(getCurrentTRS());
+#ifdef CF_HAVE_OMP
+  const int nbThreads = getMethodData().getNbThreads();
+#endif
+  getMethodData().synchronizeDistributionData();
+  
+  for (CFuint iColour = 0; iColour < colouring.getNbColours(); ++iColour) {
+    const vector<CFuint>& colourCells = colouring.getCells(iColour);
+    const int nbCells = colourCells.size();
+    
+#ifdef CF_HAVE_OMP
+#pragma omp parallel for schedule(static) num_threads(nbThreads)
+#endif
+    for (int i = 0; i < nbCells; ++i) {
+      GeometricEntity& cell = *buildThreadCell(colourCells[i]);
+      vector<State*> *const states = cell.getStates();
+      const CFuint nbStatesInCell = states->size();
+      
+      // all these are the ones of the calling thread
+      DistributionData& ddata = getMethodData().getDistributionData();
+      ddata.cell   = &cell;
+      ddata.cellID = cell.getID();
+      ddata.states = states;
+      
+      const CFuint iThread = getMethodData().getThreadID();
+      vector<RealVector>& residual = _threadResidual[iThread];
+      getMethodData().getFluctSplitStrategy()->computeFluctuation(residual);
+      
+      // transform the residual back from the
+      // distribution variables to the solution variables
+      vector<RealVector> *const tBackResidual =
+	getMethodData().getDistribToSolutionMatTrans()->transformFromRef(&residual);
+      
+      if (_hasDiffusiveTerm) {
+	vector<RealVector>& diffResidual = _threadDiffResidual[iThread];
+	getMethodData().getDiffusiveTermComputer()->computeDiffusiveTerm(&cell, diffResidual, true);
+	for (CFuint iState = 0; iState < nbStatesInCell; ++iState) {
+	  (*tBackResidual)[iState] -= diffResidual[iState];
+	}
+      }
+      
+      // no other cell of this colour updates these states
+      for (CFuint iState = 0; iState < nbStatesInCell; ++iState) {
+	const CFuint stateID = (*states)[iState]->getLocalID();
+	for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+	  rhs(stateID, iEq, nbEqs) -= (*tBackResidual)[iState][iEq];
+	}
+      }
+      
+      releaseThreadCell();
+    }
+  }
+  
+  // transform the residual from the solution variables
+  // to the update variables if needed
+  if (getMethodData().isResidualTransformationNeeded()) {
+    transformResidual();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+GeometricEntity* ComputeRHS::buildThreadCell(CFuint cellIdx)
+{
+  GeometricEntityPool<StdTrsGeoBuilder>& geoBuilder =
+    *_threadGeoBuilder[getMethodData().getThreadID()];
+  StdTrsGeoBuilder::GeoData& geoData = geoBuilder.getDataGE();
+  geoData.trs = getCurrentTRS();
+  geoData.idx = cellIdx;
+  return geoBuilder.buildGE();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ComputeRHS::releaseThreadCell()
+{
+  _threadGeoBuilder[getMethodData().getThreadID()]->releaseGE();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void ComputeRHS::transformResidual()
 {
   DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
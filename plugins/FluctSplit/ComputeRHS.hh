@@ -5,6 +5,8 @@
 
 #include "FluctuationSplitData.hh"
 #include "Framework/DataSocketSink.hh"
+#include "Framework/GeometricEntityPool.hh"
+#include "Framework/StdTrsGeoBuilder.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -58,6 +60,16 @@ protected: // methods
   /// Transform the residual
   void transformResidual();
 
+  /// Execute the command on the current TRS with several threads, colour
+  /// by colour, so that no two threads update the same state
+  virtual void executeOnTrsColoured();
+
+  /// Builds the cell with the given index in the pool of the calling thread
+  Framework::GeometricEntity* buildThreadCell(CFuint cellIdx);
+
+  /// Releases the cell built by the calling thread
+  void releaseThreadCell();
+
 protected: // data
 
   /// Transformer from Solution to Distribution Variables
@@ -133,6 +145,18 @@ protected: // data
   /// while doing numerical perturbation of the jacobians
   bool _freezeDiffCoeff;
 
+  /// flag telling if the cells are processed by several threads
+  bool _threaded;
+
+  /// builders of GeometricEntity's, one per thread
+  std::vector<Framework::GeometricEntityPool<Framework::StdTrsGeoBuilder>*> _threadGeoBuilder;
+
+  /// temporary storage of the cell residual, one per thread
+  std::vector<std::vector<RealVector> > _threadResidual;
+
+  /// temporary storage of the cell diffusive residual, one per thread
+  std::vector<std::vector<RealVector> > _threadDiffResidual;
+
 }; // class ComputeRHS
 
 //////////////////////////////////////////////////////////////////////////////
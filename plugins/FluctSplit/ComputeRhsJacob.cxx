@@ -37,6 +37,7 @@ ComputeRhsJacob::ComputeRhsJacob(const std::string& name) :
   ComputeRHS(name),
   _lss(CFNULL),
   _acc(),
+  _threadAcc(),
   _jacobStrategy()
 {
 }
@@ -49,6 +50,12 @@ ComputeRhsJacob::~ComputeRhsJacob()
   for (CFuint i = 0; i < accSize; ++i) {
     deletePtr(_acc[i]);
   }
+  
+  for (CFuint i = 0; i < _threadAcc.size(); ++i) {
+    for (CFuint j = 0; j < _threadAcc[i].size(); ++j) {
+      deletePtr(_threadAcc[i][j]);
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -56,6 +63,11 @@ ComputeRhsJacob::~ComputeRhsJacob()
 void ComputeRhsJacob::executeOnTrs()
 {
   CFAUTOTRACE;
+  
+  if (_threaded) {
+    executeOnTrsColoured();
+    return;
+  }
 
   cleanRHS();
 
@@ -238,7 +250,133 @@ void ComputeRhsJacob::setup()
   cf_assert(_jacobStrategy.isNotNull());
 
   _jacobStrategy->setup();
+  
+  if (_threaded && !_jacobStrategy->isThreadSafe()) {
+    CFLog(WARN, "ComputeRhsJacob::setup() => " << getName() << " runs on 1 thread: "
+	  << getMethodData().getComputeJacobianStrategyName() << " is not thread-safe\n");
+    _threaded = false;
+  }
+  
+  if (_threaded) {
+    _threadAcc.resize(getMethodData().getNbThreads() - 1);
+    for (CFuint i = 0; i < _threadAcc.size(); ++i) {
+      _threadAcc[i].resize(nbElemTypes);
+      for (CFuint iType = 0; iType < nbElemTypes; ++iType) {
+	const CFuint nbStatesInType = (*elementType)[iType].getNbStates();
+	_threadAcc[i][iType] = _lss->createBlockAccumulator(nbStatesInType,
+							   nbStatesInType,
+							   nbEqs);
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ComputeRhsJacob::executeOnTrsColoured()
+{
+  CFAUTOTRACE;
 
+  cleanRHS();
+
+  // reset the update flag to false for all the states
+  DataHandle<bool> isUpdated = socket_isUpdated.getDataHandle();
+  isUpdated = false;
+  
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+  
+  SafePtr<vector<ElementTypeData> > elementType =
+    MeshDataStack::getActive()->getElementTypeData();
+  const CFuint nbElemTypes = elementType->size();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  
+  FluctuationSplitData& fsmdata = getMethodData();
+  const bool computeJacobian = fsmdata.doComputeJacobian();
+  SafePtr<LSSMatrix> jacobMatrix = _lss->getMatrix();
+  if (computeJacobian) {
+    // reset to zero all non zero entries in the jacobian
+    jacobMatrix->resetToZeroEntries();
+  }
+  
+  SafePtr<ConvergenceMethod> cvmth = fsmdata.getCollaborator<ConvergenceMethod>();
+  fsmdata.getDistributionData().subiter =
+    cvmth->getConvergenceMethodData()->getConvergenceStatus().subiter;
+  fsmdata.synchronizeDistributionData();
+  
+  const CellColouring& colouring = fsmdata.getCellColouring(getCurrentTRS());
+#ifdef CF_HAVE_OMP
+  const int nbThreads = fsmdata.getNbThreads();
+#endif
+  
+  for (CFuint iColour = 0; iColour < colouring.getNbColours(); ++iColour) {
+    const vector<CFuint>& colourCells = colouring.getCells(iColour);
+    const int nbCells = colourCells.size();
+    
+#ifdef CF_HAVE_OMP
+#pragma omp parallel for schedule(static) num_threads(nbThreads)
+#endif
+    for (int i = 0; i < nbCells; ++i) {
+      const CFuint iThread = fsmdata.getThreadID();
+      GeometricEntity& cell = *buildThreadCell(colourCells[i]);
+      vector<State*> *const states = cell.getStates();
+      const CFuint nbStatesInCell = states->size();
+      
+      // all these are the ones of the calling thread
+      DistributionData& distdata = fsmdata.getDistributionData();
+      distdata.cell   = &cell;
+      distdata.cellID = cell.getID();
+      distdata.states = states;
+      
+      vector<RealVector>& residual = _threadResidual[iThread];
+      fsmdata.getFluctSplitStrategy()->computeFluctuation(residual);
+      
+      // transform back the residual to solution variables
+      vector<RealVector> *const tBackResidual =
+	fsmdata.getDistribToSolutionMatTrans()->transformFromRef(&residual);
+      
+      SafePtr<DiffusiveVarSet> diffVar = fsmdata.getDiffusiveVar();
+      if (_hasDiffusiveTerm) {
+	diffVar->setFreezeCoeff(false);
+	
+	vector<RealVector>& diffResidual = _threadDiffResidual[iThread];
+	fsmdata.getDiffusiveTermComputer()->computeDiffusiveTerm(&cell, diffResidual, true);
+	for (CFuint iState = 0; iState < nbStatesInCell; ++iState) {
+	  (*tBackResidual)[iState] -= diffResidual[iState];
+	}
+      }
+      
+      // no other cell of this colour updates (or perturbs) these states
+      for (CFuint iState = 0; iState < nbStatesInCell; ++iState) {
+	const CFuint stateID = (*states)[iState]->getLocalID();
+	for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+	  rhs(stateID, iEq, nbEqs) -= (*tBackResidual)[iState][iEq];
+	}
+      }
+      
+      if (computeJacobian) {
+	// cells are numbered by element type
+	CFuint iType = 0;
+	while (iType + 1 < nbElemTypes && colourCells[i] >= (*elementType)[iType+1].getStartIdx()) {
+	  ++iType;
+	}
+	BlockAccumulator *const acc = (iThread == 0) ? _acc[iType] : _threadAcc[iThread-1][iType];
+	
+	distdata.isPerturb = true;
+	diffVar->setFreezeCoeff(_freezeDiffCoeff);
+	_jacobStrategy->computeJacobianTerm(&cell, *tBackResidual, acc, *_lss->getEquationIDs());
+	distdata.isPerturb = false;
+	
+	// the LSS matrix does not support concurrent insertions
+#ifdef CF_HAVE_OMP
+#pragma omp critical (ComputeRhsJacob_addValues)
+#endif
+	jacobMatrix->addValues(*acc);
+	acc->reset();
+      }
+      
+      releaseThreadCell();
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
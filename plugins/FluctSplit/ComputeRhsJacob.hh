@@ -42,6 +42,10 @@ protected: // functions
   /// Execute the command on the current TRS
   virtual void executeOnTrs();
 
+  /// Execute the command on the current TRS with several threads, colour
+  /// by colour, inserting the jacobian blocks one thread at a time
+  virtual void executeOnTrsColoured();
+
 protected:
 
   /// pointer to the linear system solver
@@ -50,6 +54,9 @@ protected:
   /// vector of LSSMatrix accumulators (one for each cell type)
   std::vector<Framework::BlockAccumulator*> _acc;
   
+  /// LSSMatrix accumulators of the threads other than the first one
+  std::vector<std::vector<Framework::BlockAccumulator*> > _threadAcc;
+  
   /// strategy object to compute the jacobian contributions
   Common::SafePtr<ComputeJacobStrategy> _jacobStrategy;
   
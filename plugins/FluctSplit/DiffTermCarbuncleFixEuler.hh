@@ -68,8 +68,14 @@ public:
   /**
    * Set the update variable set
    */
-  virtual void setUpdateVarSet(Common::SafePtr<Framework::ConvectiveVarSet>); 
-  
+  virtual void setUpdateVarSet(Common::SafePtr<Framework::ConvectiveVarSet>);
+
+  /**
+   * The cell Peclet numbers of all the cells are reset at the first
+   * access of each iteration
+   */
+  virtual bool isThreadSafe() const {return false;}
+
   /**
    * Returns the DataSocket's that this numerical strategy needs as sinks
    * @return a vector of SafePtr with the DataSockets
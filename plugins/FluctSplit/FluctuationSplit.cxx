@@ -404,7 +404,13 @@ void FluctuationSplit::prepareComputationImpl()
 {
   CFAUTOTRACE;
 
-  getData()->getFluctSplitStrategy()->prepare();
+  std::vector<Common::SafePtr<FluctuationSplitStrategy> > fsStrategies =
+    getData()->getFluctSplitStrategies();
+  for (CFuint i = 0; i < fsStrategies.size(); ++i) {
+    getData()->setActiveThread(i);
+    fsStrategies[i]->prepare();
+  }
+  getData()->setActiveThread(0);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -432,6 +438,18 @@ void FluctuationSplit::setMethodImpl()
     _setups[i]->execute();
   }
 
+  // the strategies of the other threads are set up first, each one
+  // getting the splitters, var sets, etc. of its thread
+  for (CFuint iThread = 1; iThread < _data->getNbThreads(); ++iThread) {
+    _data->setActiveThread(iThread);
+    std::vector<Common::SafePtr<Framework::NumericalStrategy> > strategies =
+      _data->getThreadStrategies(iThread);
+    for (CFuint i = 0; i < strategies.size(); ++i) {
+      if (!strategies[i]->isSetup()) strategies[i]->setup();
+    }
+  }
+  _data->setActiveThread(0);
+
   setupCommandsAndStrategies();
 }
 
@@ -506,6 +524,13 @@ std::vector<Common::SafePtr<Framework::NumericalStrategy> > FluctuationSplit::ge
 
   result.push_back(_data->getJacobianFixComputer().d_castTo<NumericalStrategy>());
 
+  // the strategies of the threads other than the first one
+  for (CFuint iThread = 1; iThread < _data->getNbThreads(); ++iThread) {
+    std::vector<Common::SafePtr<NumericalStrategy> > threadStrategies =
+      _data->getThreadStrategies(iThread);
+    result.insert(result.end(), threadStrategies.begin(), threadStrategies.end());
+  }
+
   return result;
 }
 
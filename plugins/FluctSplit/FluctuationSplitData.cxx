@@ -1,5 +1,6 @@
 #include "Common/CFPrintContainer.hh"
 
+#include "Framework/BaseTerm.hh"
 #include "Framework/ContourIntegrator.hh"
 #include "Framework/MethodCommandProvider.hh"
 #include "Framework/NamespaceSwitcher.hh"
@@ -58,6 +59,8 @@ void FluctuationSplitData::defineConfigOptions(Config::OptionList& options)
    options.addConfigOption< bool > ("hasArtificialDiff","Tells if an artificial diffusion term should be added.");
    options.addConfigOption< bool>
      ("ScalarFirst","Flag telling if the scalar part has to be treated before the system part.");
+   options.addConfigOption< CFuint >
+     ("NbThreadsOMP","Number of OpenMP threads for the coloured cell loops (needs a thread-safe FluctSplitStrategy and a physical model without mutable state of its own, e.g. no thermodynamic library).");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -89,6 +92,11 @@ FluctuationSplitData::FluctuationSplitData(Common::SafePtr<Framework::Method> ow
     m_convergenceMtd(),
     m_linearVar(), // AL: possible memory leak: problems if you put this after m_distribVar
     m_distData(),
+    m_threadData(),
+    m_activeThread(0),
+    m_pastResiduals(),
+    m_pastResidualsOrder1(),
+    m_cellColouring(),
     m_resFactor(1.0),
     m_isInitializationPhase(false)
 {
@@ -169,12 +177,21 @@ FluctuationSplitData::FluctuationSplitData(Common::SafePtr<Framework::Method> ow
   
   m_scalarFirst = false;
   setParameter("ScalarFirst",&m_scalarFirst);
+  
+  m_nbThreadsOMP = 1;
+  setParameter("NbThreadsOMP",&m_nbThreadsOMP);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 FluctuationSplitData::~FluctuationSplitData()
 {
+  deleteThreadComponents();
+  
+  for (std::map<std::string, CellColouring*>::iterator it = m_cellColouring.begin();
+       it != m_cellColouring.end(); ++it) {
+    deletePtr(it->second);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -219,6 +236,9 @@ void FluctuationSplitData::configure ( Config::ConfigArgs& args )
   CFLog(VERBOSE,"Configuring Transformers\n");
   configureTransformers(args);
 
+  CFLog(VERBOSE,"Configuring Thread Components\n");
+  configureThreadComponents(args);
+
   CFLog(VERBOSE,"Configuring Integrators\n");
   configureIntegrators(args);
 
@@ -550,6 +570,20 @@ void FluctuationSplitData::configureFluctSplitStrategy( Config::ConfigArgs& args
   m_fsStrategy = prov->create(getFluctSplitStrategyName(),SharedPtr<FluctuationSplitData>(this));
   cf_assert(m_fsStrategy.isNotNull());
   configureNested ( m_fsStrategy.getPtr(), args );
+  
+#ifndef CF_HAVE_OMP
+  if (m_nbThreadsOMP > 1) {
+    CFLog(WARN, "FluctuationSplitData: NbThreadsOMP = " << m_nbThreadsOMP
+	  << " ignored, COOLFluiD was built without OpenMP\n");
+    m_nbThreadsOMP = 1;
+  }
+#endif
+  
+  if (m_nbThreadsOMP > 1 && !m_fsStrategy->isThreadSafe()) {
+    CFLog(WARN, "FluctuationSplitData: " << getFluctSplitStrategyName()
+	  << " is not thread-safe, NbThreadsOMP = " << m_nbThreadsOMP << " ignored\n");
+    m_nbThreadsOMP = 1;
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -666,6 +700,8 @@ void FluctuationSplitData::configureIntegrators( Config::ConfigArgs& args )
   order = CFPolyOrder::Convert::to_enum( m_cIntegratorOrderStr );
   if ( order == CFPolyOrder::MAXORDER ) { order = orderGen; }
 
+  const CFPolyOrder::Type cOrder = order;
+
   try {
      m_ContourIntegrator.setIntegrationForAllGeo(quadType,order);
   }
@@ -693,6 +729,13 @@ void FluctuationSplitData::configureIntegrators( Config::ConfigArgs& args )
     CFLog(ERROR, "Integrator Order : " << m_integratorOrderStr << "\n");
     throw; // rethrow exception
   }
+
+  // the integrators keep the values of the shape functions of the last
+  // integrated entity: each thread has its own ones, with the same rules
+  for (CFuint i = 0; i < m_threadData.size(); ++i) {
+    m_threadData[i]->contourIntegrator.setIntegrationForAllGeo(quadType,cOrder);
+    m_threadData[i]->volumeIntegrator.setIntegrationForAllGeo(quadType,order);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -722,6 +765,181 @@ void FluctuationSplitData::configureDiffusiveTermComputer( Config::ConfigArgs& a
 
 //////////////////////////////////////////////////////////////////////////////
 
+void FluctuationSplitData::configureThreadComponents( Config::ConfigArgs& args )
+{
+  CFAUTOTRACE;
+
+  if (m_nbThreadsOMP < 2) return;
+
+  std::string name = getNamespace();
+  Common::SafePtr<Namespace> nsp = NamespaceSwitcher::getInstance
+    (SubSystemStatusStack::getCurrentName()).getNamespace(name);
+  Common::SafePtr<PhysicalModel> physModel = PhysicalModelStack::getInstance().getEntryByNamespace(nsp);
+  SharedPtr<FluctuationSplitData> thisPtr(this);
+
+  const std::string updateVarName = (_updateVarStr != "Null") ?
+    physModel->getConvectiveName() + _updateVarStr : "Null";
+  const std::string solutionVarName = (_solutionVarStr != "Null") ?
+    physModel->getConvectiveName() + _solutionVarStr : "Null";
+  const std::string diffusiveVarName = (physModel->getDiffusiveName() != "Null") ?
+    physModel->getDiffusiveName() + _diffusiveVarStr : "Null";
+  const std::string linearVarName = (m_linearVarStr != "Null") ?
+    physModel->getConvectiveName() + m_linearVarStr : "Null";
+
+  // each additional thread gets its own copy of all the components which
+  // keep data of the cell being processed
+  m_threadData.resize(m_nbThreadsOMP - 1);
+  for (CFuint i = 0; i < m_threadData.size(); ++i) {
+    ThreadData *const td = new ThreadData();
+    m_threadData[i] = td;
+
+    td->fsStrategy = Environment::Factory<FluctuationSplitStrategy>::getInstance().
+      getProvider(getFluctSplitStrategyName())->create(getFluctSplitStrategyName(), thisPtr);
+    configureNested ( td->fsStrategy.getPtr(), args );
+
+    // variable sets
+    td->updateVar.reset(Environment::Factory<ConvectiveVarSet>::getInstance().
+      getProvider(updateVarName)->create(physModel->getImplementor()->getConvectiveTerm()));
+    td->solutionVar.reset(Environment::Factory<ConvectiveVarSet>::getInstance().
+      getProvider(solutionVarName)->create(physModel->getImplementor()->getConvectiveTerm()));
+    td->diffusiveVar.reset(Environment::Factory<DiffusiveVarSet>::getInstance().
+      getProvider(diffusiveVarName)->create(diffusiveVarName, physModel->getImplementor()));
+    configureNested ( td->diffusiveVar.getPtr(), args );
+    td->distribVar.reset(Environment::Factory<ConvectiveVarSet>::getInstance().
+      getProvider(physModel->getConvectiveName() + m_distribVarStr)->
+      create(physModel->getImplementor()->getConvectiveTerm()));
+    td->linearVar.reset(Environment::Factory<ConvectiveVarSet>::getInstance().
+      getProvider(linearVarName)->create(physModel->getImplementor()->getConvectiveTerm()));
+
+    // splitters
+    const std::string sysSplitterName = m_rhsSysSplitter->getName();
+    td->rhsSysSplitter = Environment::Factory<Splitter>::getInstance().
+      getProvider(sysSplitterName)->create(sysSplitterName, thisPtr);
+    configureNested ( td->rhsSysSplitter.getPtr(), args );
+    td->rhsSclSplitter = Environment::Factory<Splitter>::getInstance().
+      getProvider(m_scalarSplitterStr)->create(m_scalarSplitterStr, thisPtr);
+    configureNested ( td->rhsSclSplitter.getPtr(), args );
+
+    if (m_jacobSysSplitterStr == "Null") {
+      td->jacobSysSplitter = td->rhsSysSplitter;
+    }
+    else {
+      td->jacobSysSplitter = Environment::Factory<Splitter>::getInstance().
+        getProvider(m_jacobSysSplitterStr)->create(m_jacobSysSplitterStr, thisPtr);
+      configureNested ( td->jacobSysSplitter.getPtr(), args );
+    }
+
+    if (m_jacobSclSplitterStr == "Null") {
+      td->jacobSclSplitter = td->rhsSclSplitter;
+    }
+    else {
+      td->jacobSclSplitter = Environment::Factory<Splitter>::getInstance().
+        getProvider(m_jacobSclSplitterStr)->create(m_jacobSclSplitterStr, thisPtr);
+      configureNested ( td->jacobSclSplitter.getPtr(), args );
+    }
+
+    td->sysSplitter = td->rhsSysSplitter.getPtr();
+    td->sclSplitter = td->rhsSclSplitter.getPtr();
+
+    td->jacobFixComputer = Environment::Factory<ComputeJacobianFix>::getInstance().
+      getProvider(m_jacobFixComputerStr)->create(m_jacobFixComputerStr, thisPtr);
+
+    // source terms
+    td->sourceTermSplitter.resize(m_sourceTermSplitterStr.size());
+    for (CFuint is = 0; is < m_sourceTermSplitterStr.size(); ++is) {
+      td->sourceTermSplitter[is] = Environment::Factory<SourceTermSplitter>::getInstance().
+        getProvider(m_sourceTermSplitterStr[is])->create(m_sourceTermSplitterStr[is], thisPtr);
+      configureNested ( td->sourceTermSplitter[is].getPtr(), args );
+    }
+
+    td->stComputer.resize(m_stComputerStr.size());
+    for (CFuint is = 0; is < m_stComputerStr.size(); ++is) {
+      td->stComputer[is] = Environment::Factory<ComputeSourceTermFSM>::getInstance().
+        getProvider(m_stComputerStr[is])->create(m_stComputerStr[is], thisPtr);
+      configureNested ( td->stComputer[is].getPtr(), args );
+    }
+
+    // diffusive term, the cell Peclet numbers being stored by the first computer
+    td->diffTermComputer = Environment::Factory<ComputeDiffusiveTerm>::getInstance().
+      getProvider(m_diffTermComputerStr)->create(m_diffTermComputerStr, thisPtr);
+    configureNested ( td->diffTermComputer.getPtr(), args );
+    td->diffTermComputer->shareSocketsWith(m_diffTermComputer.getPtr());
+
+    td->linearizer = Environment::Factory<JacobianLinearizer>::getInstance().
+      getProvider(m_linearizerStr)->create(physModel);
+
+    // transformers
+    td->solutionToDistMatTrans = Environment::Factory<MatrixTransformer>::getInstance().
+      getProvider(m_solutionToDistMatTransStr)->create(physModel->getImplementor());
+    td->distToSolutionMatTrans = Environment::Factory<MatrixTransformer>::getInstance().
+      getProvider(m_distToSolutionMatTransStr)->create(physModel->getImplementor());
+    td->linearToDistMatTrans = Environment::Factory<MatrixTransformer>::getInstance().
+      getProvider(m_linearToDistMatTransStr)->create(physModel->getImplementor());
+    td->solutionToLinearInUpdateMatTrans = Environment::Factory<MatrixTransformer>::getInstance().
+      getProvider(m_solutionToLinearInUpdateMatTransStr)->create(physModel->getImplementor());
+    td->solutionToLinearMatTrans = Environment::Factory<MatrixTransformer>::getInstance().
+      getProvider(m_solutionToLinearMatTransStr)->create(physModel->getImplementor());
+    td->solToUpdateInUpdateMatTrans = Environment::Factory<MatrixTransformer>::getInstance().
+      getProvider(m_solToUpdateInUpdateMatTransStr)->create(physModel->getImplementor());
+    td->updateToSolutionInUpdateMatTrans = Environment::Factory<MatrixTransformer>::getInstance().
+      getProvider(m_updateToSolutionInUpdateMatTransStr)->create(physModel->getImplementor());
+    td->updateToLinearVecTrans = Environment::Factory<VectorTransformer>::getInstance().
+      getProvider(m_updateToLinearVecTransStr)->create(physModel->getImplementor());
+    td->updateToSolutionVecTrans = Environment::Factory<VectorTransformer>::getInstance().
+      getProvider(m_updateToSolutionVecTransStr)->create(physModel->getImplementor());
+  }
+
+  // the copies must not provide sockets, which would be registered twice
+  for (CFuint i = 0; i < m_threadData.size(); ++i) {
+    std::vector<SafePtr<NumericalStrategy> > strategies = getThreadStrategies(i+1);
+    for (CFuint s = 0; s < strategies.size(); ++s) {
+      if (!strategies[s]->providesSockets().empty()) {
+        CFLog(WARN, "FluctuationSplitData: " << strategies[s]->getName()
+              << " provides sockets and cannot be used by several threads, NbThreadsOMP = "
+              << m_nbThreadsOMP << " ignored\n");
+        deleteThreadComponents();
+        m_nbThreadsOMP = 1;
+        return;
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FluctuationSplitData::deleteThreadComponents()
+{
+  for (CFuint i = 0; i < m_threadData.size(); ++i) {
+    deletePtr(m_threadData[i]);
+  }
+  m_threadData.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector<Common::SafePtr<NumericalStrategy> >
+FluctuationSplitData::getThreadStrategies(CFuint iThread) const
+{
+  cf_assert(iThread > 0 && iThread <= m_threadData.size());
+  const ThreadData& td = *m_threadData[iThread-1];
+
+  std::vector<Common::SafePtr<NumericalStrategy> > result;
+  result.push_back(td.fsStrategy.getPtr());
+  result.push_back(td.diffTermComputer.getPtr());
+  for (CFuint i = 0; i < td.stComputer.size(); ++i) {
+    result.push_back(td.stComputer[i].getPtr());
+  }
+  result.push_back(td.rhsSysSplitter.getPtr());
+  result.push_back(td.rhsSclSplitter.getPtr());
+  for (CFuint i = 0; i < td.sourceTermSplitter.size(); ++i) {
+    result.push_back(td.sourceTermSplitter[i].getPtr());
+  }
+  result.push_back(td.jacobFixComputer.getPtr());
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 CFuint FluctuationSplitData::getBlockSeparator() const
 {
 
@@ -784,6 +1002,54 @@ void FluctuationSplitData::setup()
   // set up the distribution data
   getDistributionData().setup();
 
+  // set up the components of the other threads, as the ones above
+  for (CFuint i = 0; i < m_threadData.size(); ++i) {
+    ThreadData& td = *m_threadData[i];
+    setActiveThread(i+1);
+
+    td.contourIntegrator.setup();
+    td.volumeIntegrator.setup();
+    td.jacobSclSplitter->setup();
+    td.jacobSysSplitter->setup();
+
+    td.distribVar->setup();
+    td.updateVar->setup();
+    td.linearVar->setup();
+    td.diffusiveVar->setup();
+    td.solutionVar->setup();
+
+    td.solutionToDistMatTrans->setup(maxNbStatesInCell);
+    td.distToSolutionMatTrans->setup(maxNbStatesInCell);
+    td.linearToDistMatTrans->setup(maxNbStatesInCell);
+    td.solutionToLinearInUpdateMatTrans->setup(maxNbStatesInCell);
+    td.solutionToLinearMatTrans->setup(maxNbStatesInCell);
+    td.updateToLinearVecTrans->setup(maxNbStatesInCell);
+    td.solToUpdateInUpdateMatTrans->setup(maxNbStatesInCell);
+    td.updateToSolutionInUpdateMatTrans->setup(maxNbStatesInCell);
+    td.updateToSolutionVecTrans->setup(maxNbStatesInCell);
+    td.diffTermComputer->setMeshData();
+    td.diffTermComputer->setDiffusiveVarSet(td.diffusiveVar.getPtr());
+    td.diffTermComputer->setUpdateVarSet(td.updateVar.getPtr());
+
+    td.linearizer->setMaxNbStates(maxNbStatesInCell);
+    td.distData.setup();
+  }
+  setActiveThread(0);
+
+  // the physical data computed by the var sets and by the linearizers
+  // are stored in the terms of the physical model: one per thread
+  if (m_nbThreadsOMP > 1) {
+    SafePtr<PhysicalModelImpl> physModel = PhysicalModelStack::getActive()->getImplementor();
+    if (physModel->getConvectiveTerm().isNotNull()) {
+      physModel->getConvectiveTerm()->setNbThreads(m_nbThreadsOMP);
+    }
+    if (physModel->getDiffusiveTerm().isNotNull()) {
+      physModel->getDiffusiveTerm()->setNbThreads(m_nbThreadsOMP);
+    }
+    if (physModel->getSourceTerm().isNotNull()) {
+      physModel->getSourceTerm()->setNbThreads(m_nbThreadsOMP);
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -794,6 +1060,13 @@ void FluctuationSplitData::unsetup()
   
   // unsetup TRS Geo builder
   m_stdTrsGeoBuilder.unsetup();
+  
+  // the mesh may change before the next setup
+  for (std::map<std::string, CellColouring*>::iterator it = m_cellColouring.begin();
+       it != m_cellColouring.end(); ++it) {
+    deletePtr(it->second);
+  }
+  m_cellColouring.clear();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -801,7 +1074,50 @@ void FluctuationSplitData::unsetup()
 Common::SafePtr<FluctuationSplitStrategy> FluctuationSplitData::getFluctSplitStrategy() const
 {
   cf_assert(m_fsStrategy.isNotNull());
-  return m_fsStrategy.getPtr();
+  ThreadData *const td = getThreadData();
+  return (td == CFNULL) ? m_fsStrategy.getPtr() : td->fsStrategy.getPtr();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector<Common::SafePtr<FluctuationSplitStrategy> >
+FluctuationSplitData::getFluctSplitStrategies() const
+{
+  std::vector<Common::SafePtr<FluctuationSplitStrategy> > result;
+  result.push_back(m_fsStrategy.getPtr());
+  for (CFuint i = 0; i < m_threadData.size(); ++i) {
+    result.push_back(m_threadData[i]->fsStrategy.getPtr());
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+const CellColouring& FluctuationSplitData::getCellColouring(SafePtr<TopologicalRegionSet> trs)
+{
+  CellColouring*& colouring = m_cellColouring[trs->getName()];
+  if (colouring == CFNULL) {
+    colouring = new CellColouring();
+    colouring->build(trs);
+  }
+  return *colouring;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FluctuationSplitData::synchronizeDistributionData()
+{
+  for (CFuint i = 0; i < m_threadData.size(); ++i) {
+    DistributionData& tdata = m_threadData[i]->distData;
+    tdata.computeBetas = m_distData.computeBetas;
+    tdata.sourceComputeGradients = m_distData.sourceComputeGradients;
+    tdata.needDiss = m_distData.needDiss;
+    tdata.time = m_distData.time;
+    tdata.isHO = m_distData.isHO;
+    tdata.subiter = m_distData.subiter;
+    tdata.isdbInit = m_distData.isdbInit;
+    tdata.isfirstP1 = m_distData.isfirstP1;
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -823,14 +1139,16 @@ Common::SafePtr<ComputeJacobStrategy> FluctuationSplitData::getJacobStrategy() c
 
 Common::SafePtr<VolumeIntegrator> FluctuationSplitData::getVolumeIntegrator()
 {
-  return &m_VolumeIntegrator;
+  ThreadData *const td = getThreadData();
+  return (td == CFNULL) ? &m_VolumeIntegrator : &td->volumeIntegrator;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 Common::SafePtr<ContourIntegrator> FluctuationSplitData::getContourIntegrator()
 {
-  return &m_ContourIntegrator;
+  ThreadData *const td = getThreadData();
+  return (td == CFNULL) ? &m_ContourIntegrator : &td->contourIntegrator;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -839,7 +1157,8 @@ SafePtr<vector<SelfRegistPtr<ComputeSourceTermFSM> > > FluctuationSplitData::
 getSourceTermComputer()
 {
   cf_assert(m_stComputer.size() > 0);
-  return &m_stComputer;
+  ThreadData *const td = getThreadData();
+  return (td == CFNULL) ? &m_stComputer : &td->stComputer;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -847,7 +1166,8 @@ getSourceTermComputer()
 SafePtr<ComputeSourceTermFSM> FluctuationSplitData::getSourceTermComputer(CFuint is)
 {
   cf_assert(is < m_stComputer.size());
-  return m_stComputer[is].getPtr();
+  ThreadData *const td = getThreadData();
+  return (td == CFNULL) ? m_stComputer[is].getPtr() : td->stComputer[is].getPtr();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -3,6 +3,12 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <map>
+
+#ifdef CF_HAVE_OMP
+#  include <omp.h>
+#endif
+
 #include "Common/OwnedObject.hh"
 #include "Common/SafePtr.hh"
 #include "Config/ConfigObject.hh"
@@ -23,6 +29,7 @@
 
 #include "FluctSplit/SourceTermSplitter.hh"
 #include "FluctSplit/DistributionData.hh"
+#include "FluctSplit/CellColouring.hh"
 #include "FluctSplit/ComputeJacobianFix.hh"
 #include "FluctSplit/FluctSplit.hh"
 
@@ -112,18 +119,27 @@ public:
 
   /// Get System Splitter
   /// @return the pointer to the system splitter
-  Common::SafePtr<Splitter> getSysSplitter() const {  return m_SysSplitter;  }
+  Common::SafePtr<Splitter> getSysSplitter() const
+  {
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_SysSplitter : td->sysSplitter;
+  }
 
   /// Get Scalar Splitter
   /// @return the pointer to the system splitter
-  Common::SafePtr<Splitter> getScalarSplitter() const  {  return m_SclSplitter;  }
+  Common::SafePtr<Splitter> getScalarSplitter() const
+  {
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_SclSplitter : td->sclSplitter;
+  }
 
   /// Get the system source term Splitter
   /// @return the pointer to the system source term splitter
   Common::SafePtr<std::vector<Common::SelfRegistPtr<SourceTermSplitter> > > getSourceTermSplitter()
   {
     cf_assert(m_sourceTermSplitter.size() > 0);
-    return &m_sourceTermSplitter;
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? &m_sourceTermSplitter : &td->sourceTermSplitter;
   }
 
   /// Get the system source term Splitter
@@ -131,7 +147,8 @@ public:
   Common::SafePtr<SourceTermSplitter> getSourceTermSplitter(CFuint is)
   {
     cf_assert(is < m_sourceTermSplitter.size());
-    return m_sourceTermSplitter[is].getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_sourceTermSplitter[is].getPtr() : td->sourceTermSplitter[is].getPtr();
   }
 
   /// Get Splitter
@@ -140,11 +157,12 @@ public:
   {
     cf_assert(!isMultipleSplitter());
 
-    if (m_SclSplitter->isNull()) {
+    Common::SafePtr<Splitter> sclSplitter = getScalarSplitter();
+    if (sclSplitter->isNull()) {
       // cf_assert(!m_SysSplitter->isNull());
-      return m_SysSplitter;
+      return getSysSplitter();
     }
-    return m_SclSplitter;
+    return sclSplitter;
   }
 
   /// Switch the splitters to computation of implicit jacobian
@@ -152,6 +170,10 @@ public:
   {
     m_SysSplitter = m_jacobSysSplitter.getPtr();
     m_SclSplitter = m_jacobSclSplitter.getPtr();
+    for (CFuint i = 0; i < m_threadData.size(); ++i) {
+      m_threadData[i]->sysSplitter = m_threadData[i]->jacobSysSplitter.getPtr();
+      m_threadData[i]->sclSplitter = m_threadData[i]->jacobSclSplitter.getPtr();
+    }
   }
 
   /// Switch the splitters to explicit computation or RHS computation
@@ -159,27 +181,55 @@ public:
   {
     m_SysSplitter = m_rhsSysSplitter.getPtr();
     m_SclSplitter = m_rhsSclSplitter.getPtr();
+    for (CFuint i = 0; i < m_threadData.size(); ++i) {
+      m_threadData[i]->sysSplitter = m_threadData[i]->rhsSysSplitter.getPtr();
+      m_threadData[i]->sclSplitter = m_threadData[i]->rhsSclSplitter.getPtr();
+    }
   }
 
   /// Get the diffusive term computer
   Common::SafePtr<ComputeDiffusiveTerm> getDiffusiveTermComputer() const
   {
     cf_assert(m_diffTermComputer.isNotNull());
-    return m_diffTermComputer.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_diffTermComputer.getPtr() : td->diffTermComputer.getPtr();
+  }
+
+  /// Get the update variables set
+  Common::SafePtr<Framework::ConvectiveVarSet> getUpdateVar() const
+  {
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? SpaceMethodData::getUpdateVar() : td->updateVar.getPtr();
+  }
+
+  /// Get the solution variables set
+  Common::SafePtr<Framework::ConvectiveVarSet> getSolutionVar() const
+  {
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? SpaceMethodData::getSolutionVar() : td->solutionVar.getPtr();
+  }
+
+  /// Get the diffusive variables set
+  Common::SafePtr<Framework::DiffusiveVarSet> getDiffusiveVar() const
+  {
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? SpaceMethodData::getDiffusiveVar() : td->diffusiveVar.getPtr();
   }
 
   /// Get the distribution variables set
   Common::SafePtr<Framework::ConvectiveVarSet> getDistribVar() const
   {
     cf_assert(m_distribVar.isNotNull());
-    return m_distribVar.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_distribVar.getPtr() : td->distribVar.getPtr();
   }
 
   /// Get the linearizion variables set
   Common::SafePtr<Framework::ConvectiveVarSet> getLinearVar() const
   {
     cf_assert(m_linearVar.isNotNull());
-    return m_linearVar.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_linearVar.getPtr() : td->linearVar.getPtr();
   }
 
   /// Get Linearizer
@@ -187,7 +237,8 @@ public:
   Common::SafePtr<Framework::JacobianLinearizer> getLinearizer() const
   {
     cf_assert(m_linearizer.isNotNull());
-    return m_linearizer.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_linearizer.getPtr() : td->linearizer.getPtr();
   }
 
   /// Get the source term computer
@@ -202,7 +253,8 @@ public:
   Common::SafePtr<FluctSplit::ComputeJacobianFix> getJacobianFixComputer() const
   {
     cf_assert(m_jacobFixComputer.isNotNull());
-    return m_jacobFixComputer.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_jacobFixComputer.getPtr() : td->jacobFixComputer.getPtr();
   }
 
   /// Sets the ConvergenceMethod for this SpaceMethod to use
@@ -232,7 +284,8 @@ public:
   Common::SafePtr<MatrixTransformer> getSolutionToDistribMatTrans() const
   {
     cf_assert(m_solutionToDistMatTrans.isNotNull());
-    return m_solutionToDistMatTrans.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_solutionToDistMatTrans.getPtr() : td->solutionToDistMatTrans.getPtr();
   }
 
   /// Get the matrix transformation from Distribution to Solution variables
@@ -240,7 +293,8 @@ public:
   Common::SafePtr<MatrixTransformer> getDistribToSolutionMatTrans() const
   {
     cf_assert(m_distToSolutionMatTrans.isNotNull());
-    return m_distToSolutionMatTrans.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_distToSolutionMatTrans.getPtr() : td->distToSolutionMatTrans.getPtr();
   }
 
   /// Get the matrix transformation from Linear to Distribution variables
@@ -248,7 +302,8 @@ public:
   Common::SafePtr<MatrixTransformer> getLinearToDistribMatTrans() const
   {
     cf_assert(m_linearToDistMatTrans.isNotNull());
-    return m_linearToDistMatTrans.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_linearToDistMatTrans.getPtr() : td->linearToDistMatTrans.getPtr();
   }
 
   /// Get the matrix transformation from Solution to Linear in Update
@@ -256,7 +311,8 @@ public:
   Common::SafePtr<MatrixTransformer> getSolutionToLinearInUpdateMatTrans() const
   {
     cf_assert(m_solutionToLinearInUpdateMatTrans.isNotNull());
-    return m_solutionToLinearInUpdateMatTrans.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_solutionToLinearInUpdateMatTrans.getPtr() : td->solutionToLinearInUpdateMatTrans.getPtr();
   }
 
   /// Get the matrix transformation from Solution to Linear variables
@@ -264,7 +320,8 @@ public:
   Common::SafePtr<MatrixTransformer> getSolutionToLinearMatTrans() const
   {
     cf_assert(m_solutionToLinearMatTrans.isNotNull());
-    return m_solutionToLinearMatTrans.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_solutionToLinearMatTrans.getPtr() : td->solutionToLinearMatTrans.getPtr();
   }
 
   /// Get the vector transformation from Update to Linear variables
@@ -272,7 +329,8 @@ public:
   Common::SafePtr<VectorTransformer> getUpdateToLinearVecTrans() const
   {
     cf_assert(m_updateToLinearVecTrans.isNotNull());
-    return m_updateToLinearVecTrans.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_updateToLinearVecTrans.getPtr() : td->updateToLinearVecTrans.getPtr();
   }
 
   /// Get the vector transformation from Update to Solution variables
@@ -280,7 +338,8 @@ public:
   Common::SafePtr<VectorTransformer> getUpdateToSolutionVecTrans() const
   {
     cf_assert(m_updateToSolutionVecTrans.isNotNull());
-    return m_updateToSolutionVecTrans.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_updateToSolutionVecTrans.getPtr() : td->updateToSolutionVecTrans.getPtr();
   }
 
   /// Get the matrix transformer from solution to update variables
@@ -289,7 +348,8 @@ public:
   getSolToUpdateInUpdateMatTrans() const
   {
     cf_assert(m_solToUpdateInUpdateMatTrans.isNotNull());
-    return m_solToUpdateInUpdateMatTrans.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_solToUpdateInUpdateMatTrans.getPtr() : td->solToUpdateInUpdateMatTrans.getPtr();
   }
 
   /// Get the matrix transformer from update to solution variables
@@ -298,7 +358,8 @@ public:
   getUpdateToSolutionInUpdateMatTrans() const
   {
     cf_assert(m_updateToSolutionInUpdateMatTrans.isNotNull());
-    return m_updateToSolutionInUpdateMatTrans.getPtr();
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_updateToSolutionInUpdateMatTrans.getPtr() : td->updateToSolutionInUpdateMatTrans.getPtr();
   }
 
   /// Tell if a varaible has to be applied for the residual
@@ -323,9 +384,50 @@ public:
     return m_adStrategyName;
   }
 
-  /// Get the Fluctuation splitting strategy
+  /// Get the Fluctuation splitting strategy of the calling thread
   Common::SafePtr<FluctuationSplitStrategy> getFluctSplitStrategy() const;
 
+  /// Get the Fluctuation splitting strategies of all the threads
+  /// (the first one is the one used outside the threaded loops)
+  std::vector<Common::SafePtr<FluctuationSplitStrategy> > getFluctSplitStrategies() const;
+
+  /// @return the number of threads requested for the coloured cell loops
+  CFuint getNbThreads() const {return m_nbThreadsOMP;}
+
+  /// @return the index of the thread whose components are given by this
+  /// object: the calling thread in a threaded cell loop, outside the one
+  /// set by setActiveThread() (0 except while the other ones are set up)
+  CFuint getThreadID() const
+  {
+#ifdef CF_HAVE_OMP
+    if (omp_in_parallel()) {return omp_get_thread_num();}
+#endif
+    return m_activeThread;
+  }
+
+  /// Makes this object give, outside the threaded cell loops, the
+  /// components of the given thread
+  void setActiveThread(CFuint iThread)
+  {
+    cf_assert(iThread < m_nbThreadsOMP);
+    m_activeThread = iThread;
+  }
+
+  /// Get the strategies (split strategy, splitters and computers) of one of
+  /// the threads other than the first one, in the order of set up
+  std::vector<Common::SafePtr<Framework::NumericalStrategy> > getThreadStrategies(CFuint iThread) const;
+
+  /// Get the residuals of the past time layer of each cell, shared by the
+  /// space-time strategies of all the threads
+  Common::SafePtr<std::vector<RealVector> > getPastResiduals() {return &m_pastResiduals;}
+
+  /// Get the residuals of the past time layer of each cell computed with
+  /// the first order scheme, shared by the space-time strategies of all the threads
+  Common::SafePtr<std::vector<RealVector> > getPastResidualsOrder1() {return &m_pastResidualsOrder1;}
+
+  /// @return the colouring of the cells of the given TRS, built on first use
+  const CellColouring& getCellColouring(Common::SafePtr<Framework::TopologicalRegionSet> trs);
+
   /// Get the Fluctuation splitting strategy
   Common::SafePtr<ArtificialDiffusionStrategy> getArtificialDiffusionStrategy() const;
 
@@ -338,8 +440,16 @@ public:
   /// Get the VolumeIntegrator
   Common::SafePtr<Framework::VolumeIntegrator> getVolumeIntegrator();
 
-  /// Get the data for the fluctuation distribution
-  DistributionData& getDistributionData() {  return m_distData;  }
+  /// Get the data for the fluctuation distribution of the calling thread
+  DistributionData& getDistributionData()
+  {
+    ThreadData *const td = getThreadData();
+    return (td == CFNULL) ? m_distData : td->distData;
+  }
+
+  /// Copies the flags which are set outside the cell loops from the
+  /// distribution data of the main thread to the ones of the other threads
+  void synchronizeDistributionData();
 
   /// Get block separator index
   /// @return integer with block separator index
@@ -384,6 +494,72 @@ public:
 
 private:
 
+  /// Numerical components of one of the threads other than the first one,
+  /// created as the ones of the first thread and used in place of them
+  /// by the split strategy of the thread
+  struct ThreadData {
+    /// split strategy
+    Common::SelfRegistPtr<FluctuationSplitStrategy> fsStrategy;
+    /// distribution data
+    DistributionData distData;
+    /// current system splitter
+    Common::SafePtr<Splitter> sysSplitter;
+    /// current scalar splitter
+    Common::SafePtr<Splitter> sclSplitter;
+    /// system splitter for RHS and explicit computations
+    Common::SelfRegistPtr<Splitter> rhsSysSplitter;
+    /// scalar splitter for RHS and explicit computations
+    Common::SelfRegistPtr<Splitter> rhsSclSplitter;
+    /// system splitter for the jacobian
+    Common::SelfRegistPtr<Splitter> jacobSysSplitter;
+    /// scalar splitter for the jacobian
+    Common::SelfRegistPtr<Splitter> jacobSclSplitter;
+    /// source term splitters
+    std::vector<Common::SelfRegistPtr<SourceTermSplitter> > sourceTermSplitter;
+    /// source term computers
+    std::vector<Common::SelfRegistPtr<ComputeSourceTermFSM> > stComputer;
+    /// diffusive term computer
+    Common::SelfRegistPtr<ComputeDiffusiveTerm> diffTermComputer;
+    /// jacobian fix computer
+    Common::SelfRegistPtr<ComputeJacobianFix> jacobFixComputer;
+    /// update variable set
+    Common::SelfRegistPtr<Framework::ConvectiveVarSet> updateVar;
+    /// solution variable set
+    Common::SelfRegistPtr<Framework::ConvectiveVarSet> solutionVar;
+    /// diffusive variable set
+    Common::SelfRegistPtr<Framework::DiffusiveVarSet> diffusiveVar;
+    /// distribution variable set
+    Common::SelfRegistPtr<Framework::ConvectiveVarSet> distribVar;
+    /// linearization variable set
+    Common::SelfRegistPtr<Framework::ConvectiveVarSet> linearVar;
+    /// linearizer
+    Common::SelfRegistPtr<Framework::JacobianLinearizer> linearizer;
+    /// transformers (see the ones of FluctuationSplitData)
+    Common::SelfRegistPtr<MatrixTransformer> solutionToDistMatTrans;
+    Common::SelfRegistPtr<MatrixTransformer> distToSolutionMatTrans;
+    Common::SelfRegistPtr<MatrixTransformer> linearToDistMatTrans;
+    Common::SelfRegistPtr<MatrixTransformer> solutionToLinearInUpdateMatTrans;
+    Common::SelfRegistPtr<MatrixTransformer> solutionToLinearMatTrans;
+    Common::SelfRegistPtr<VectorTransformer> updateToLinearVecTrans;
+    Common::SelfRegistPtr<VectorTransformer> updateToSolutionVecTrans;
+    Common::SelfRegistPtr<MatrixTransformer> solToUpdateInUpdateMatTrans;
+    Common::SelfRegistPtr<MatrixTransformer> updateToSolutionInUpdateMatTrans;
+    /// contour integrator
+    Framework::ContourIntegrator contourIntegrator;
+    /// volume integrator
+    Framework::VolumeIntegrator volumeIntegrator;
+  };
+
+  /// @return the components of the thread given by getThreadID(),
+  ///         CFNULL for the first thread which uses the ones of this object
+  ThreadData* getThreadData() const
+  {
+    if (m_threadData.empty()) {return CFNULL;}
+    const CFuint iThread = getThreadID();
+    cf_assert(iThread <= m_threadData.size());
+    return (iThread == 0) ? CFNULL : m_threadData[iThread-1];
+  }
+
   /// Configures the VarSet's
   void configureVarSets ( Config::ConfigArgs& args );
 
@@ -422,6 +598,13 @@ private:
   /// Configures both Integrators
   void configureIntegrators ( Config::ConfigArgs& args );
 
+  /// Configures the components of the threads other than the first one
+  /// @pre assumes you already called configureTransformers()
+  void configureThreadComponents ( Config::ConfigArgs& args );
+
+  /// Deletes the components of the threads other than the first one
+  void deleteThreadComponents();
+
 private:
 
   /// Multiple Splitter
@@ -506,6 +689,24 @@ private:
 
   /// distribution data
   DistributionData m_distData;
+
+  /// components of the threads other than the first one
+  std::vector<ThreadData*> m_threadData;
+
+  /// number of threads used by the coloured cell loops
+  CFuint m_nbThreadsOMP;
+
+  /// thread whose components are given outside the threaded cell loops
+  CFuint m_activeThread;
+
+  /// residuals of the past time layer of each cell
+  std::vector<RealVector> m_pastResiduals;
+
+  /// residuals of the past time layer of each cell with the first order scheme
+  std::vector<RealVector> m_pastResidualsOrder1;
+
+  /// colouring of the cells of each TRS
+  std::map<std::string, CellColouring*> m_cellColouring;
   
   /// residual factor
   CFreal m_resFactor;
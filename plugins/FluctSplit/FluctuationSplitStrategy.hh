@@ -59,6 +59,16 @@ public: // methods
 
   /// Computes the fluctuation
   virtual void computeFluctuation(std::vector<RealVector>& residual) = 0;
+  
+  /// Tells if one instance of this strategy per thread can compute
+  /// concurrently the fluctuations of cells which do not share any state.
+  /// All the scratch data must then belong to the instance or be accessed
+  /// through FluctuationSplitData::getDistributionData(), and the splitters,
+  /// var sets, transformers, integrators and computers must be taken from
+  /// FluctuationSplitData at setup, which gives the ones of the thread.
+  /// The physical model is shared: the ones keeping mutable state of their
+  /// own (e.g. a thermodynamic library) need NbThreadsOMP = 1.
+  virtual bool isThreadSafe() const {return false;}
 
   /// Gets the Class name
   static std::string getClassName() { return "FluctuationSplitStrategy"; }
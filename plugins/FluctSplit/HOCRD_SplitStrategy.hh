@@ -51,6 +51,10 @@ public: // methods
   /// @param residual the residual for each variable to distribute in each state
   virtual void computeFluctuation(std::vector<RealVector>& residual);
 
+  /// The scratch data belong to this object, the splitters, var sets and
+  /// transformers being the ones of its thread
+  virtual bool isThreadSafe() const {return true;}
+
 protected: // methods
 
   /// Compute the integral of the fluxes
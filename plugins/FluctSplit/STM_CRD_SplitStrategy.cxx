@@ -54,8 +54,8 @@ STM_CRD_SplitStrategy::STM_CRD_SplitStrategy(const std::string& name) :
   m_unitFaceNormals(),
   m_statesBkp(0),
   m_phi(),
-  _pastResiduals(0),
-  _pastResiduals_order1(0),
+  _pastResiduals(CFNULL),
+  _pastResiduals_order1(CFNULL),
   temp_residual(0)
 {
 }
@@ -112,11 +112,11 @@ void STM_CRD_SplitStrategy::computeFluctuation(vector<RealVector>& residual)
 
 
     //We point the past_residual from the DistributeData to the past residual of cellID
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
 
     //We point the past_residual of order1 from the DistributeData to the past residual of order 1 of cellID
     // If we are not unsing blending scheme these are vector of dimension 0
-    ddata.past_residuals_order1 = &_pastResiduals_order1[ddata.cellID];
+    ddata.past_residuals_order1 = &(*_pastResiduals_order1)[ddata.cellID];
 
     m_splitter->setConsStates(_pastStates);
 
@@ -134,7 +134,7 @@ void STM_CRD_SplitStrategy::computeFluctuation(vector<RealVector>& residual)
 
 
 //We point the past_residual from the DistributeData to the past residual of cellID
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
 
     const CFreal dt = SubSystemStatusStack::getActive()->getDT();
     ddata.time = SubSystemStatusStack::getActive()->getCurrentTime()-dt;
@@ -197,8 +197,8 @@ void STM_CRD_SplitStrategy::computeFluctuation(vector<RealVector>& residual)
 }
  if (!SubSystemStatusStack::getActive()->isFirstStep())
   {
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
-    ddata.past_residuals_order1 = &_pastResiduals_order1[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
+    ddata.past_residuals_order1 = &(*_pastResiduals_order1)[ddata.cellID];
   }
 
   computeSTFluxIntegral();
@@ -401,11 +401,15 @@ void STM_CRD_SplitStrategy::setup()
   // back up cell state pointers
   m_statesBkp.resize(MeshDataStack::getActive()->Statistics().getMaxNbStatesInCell());
 
+  // the past residuals of each cell are shared by the strategies of all the threads
+  _pastResiduals = getMethodData().getPastResiduals();
+  _pastResiduals_order1 = getMethodData().getPastResidualsOrder1();
+
   // Resizing the storage for the full past Residuals
-  _pastResiduals_order1.resize(nbGeoEnts);
+  _pastResiduals_order1->resize(nbGeoEnts);
 
   // Resizing the storage for the full past Residuals
-  _pastResiduals.resize(nbGeoEnts);
+  _pastResiduals->resize(nbGeoEnts);
   _stdTrsGeoBuilder.getDataGE().trs = innerCells;
 
   // loop over all the cells and set the number of quadrature
@@ -420,8 +424,8 @@ void STM_CRD_SplitStrategy::setup()
     m_contourIntegrator->setNbSolQuadraturePoints(&cell, m_nbQPointsInCell[iGeoEnt]);
 
     nbStatesInCell = cell.nbStates();
-    _pastResiduals_order1[iGeoEnt].resize(nbStatesInCell*nbEqs);
-   _pastResiduals[iGeoEnt].resize(nbStatesInCell*nbEqs);
+    (*_pastResiduals_order1)[iGeoEnt].resize(nbStatesInCell*nbEqs);
+   (*_pastResiduals)[iGeoEnt].resize(nbStatesInCell*nbEqs);
     // release the GeometricEntity
     _stdTrsGeoBuilder.releaseGE();
   }
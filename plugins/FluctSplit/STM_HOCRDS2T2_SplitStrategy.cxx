@@ -64,8 +64,8 @@ STM_HOCRDS2T2_SplitStrategy::STM_HOCRDS2T2_SplitStrategy(const std::string& name
   m_unitFaceNormals(),
   m_statesBkp(0),
   m_phi(),
-  _pastResiduals(0),
-  _pastResiduals_order1(0),
+  _pastResiduals(CFNULL),
+  _pastResiduals_order1(CFNULL),
   temp_residual(0),
   m_phisubT(0),
   subelemfacedir(0,0),
@@ -186,7 +186,7 @@ void STM_HOCRDS2T2_SplitStrategy::docomputeFirstFluctuation(std::vector<RealVect
     //We point the past_residual from the DistributeData to the past residual of cellID
     // The residual from the past and the one from the intermediate level are both not changing
     // So, we can store the sum of both in one vector
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
 
     //The time is the present time (this is used for the source term)
     ddata.time = SubSystemStatusStack::getActive()->getCurrentTime();
@@ -650,8 +650,8 @@ void STM_HOCRDS2T2_SplitStrategy::docomputeFirstFluctuation(std::vector<RealVect
   if (!SubSystemStatusStack::getActive()->isFirstStep())
    {
     // If this is not the first pseudo-time iteration we point to the past_residual of the cell
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
-    //    ddata.past_residuals_order1 = &_pastResiduals_order1[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
+    //    ddata.past_residuals_order1 = &(*_pastResiduals_order1)[ddata.cellID];
    }
 
 
@@ -1158,7 +1158,7 @@ void STM_HOCRDS2T2_SplitStrategy::docomputeFirstFluctuation(std::vector<RealVect
     //We point the past_residual from the DistributeData to the past residual of cellID
     // The residual from the past and the one from the intermediate level are both not changing
     // So, we can store the sum of both in one vector
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
 
    //The time is the present time (this is used for the source term)
    ddata.time = SubSystemStatusStack::getActive()->getCurrentTime();
@@ -2174,8 +2174,8 @@ void STM_HOCRDS2T2_SplitStrategy::docomputeFirstFluctuation(std::vector<RealVect
   if (!SubSystemStatusStack::getActive()->isFirstStep())
    {
     // If this is not the first pseudo-time iteration we point to the past_residual of the cell
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
-    //    ddata.past_residuals_order1 = &_pastResiduals_order1[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
+    //    ddata.past_residuals_order1 = &(*_pastResiduals_order1)[ddata.cellID];
    }
 
 
@@ -2801,11 +2801,15 @@ void STM_HOCRDS2T2_SplitStrategy::setup()
   // back up cell state pointers
   m_statesBkp.resize(MeshDataStack::getActive()->Statistics().getMaxNbStatesInCell());
 
+  // the past residuals of each cell are shared by the strategies of all the threads
+  _pastResiduals = getMethodData().getPastResiduals();
+  _pastResiduals_order1 = getMethodData().getPastResidualsOrder1();
+
   // Resizing the storage for the full past Residuals
-  _pastResiduals_order1.resize(nbGeoEnts);
+  _pastResiduals_order1->resize(nbGeoEnts);
 
   // Resizing the storage for the full past Residuals
-  _pastResiduals.resize(nbGeoEnts);
+  _pastResiduals->resize(nbGeoEnts);
   _stdTrsGeoBuilder.getDataGE().trs = innerCells;
 
   // loop over all the cells and set the number of quadrature
@@ -2820,8 +2824,8 @@ void STM_HOCRDS2T2_SplitStrategy::setup()
     m_contourIntegrator->setNbSolQuadraturePoints(&cell, m_nbQPointsInCell[iGeoEnt]);
 
     nbStatesInCell = cell.nbStates();
-    _pastResiduals_order1[iGeoEnt].resize(nbStatesInCell*nbEqs);
-   _pastResiduals[iGeoEnt].resize(nbStatesInCell*nbEqs);
+    (*_pastResiduals_order1)[iGeoEnt].resize(nbStatesInCell*nbEqs);
+   (*_pastResiduals)[iGeoEnt].resize(nbStatesInCell*nbEqs);
     // release the GeometricEntity
     _stdTrsGeoBuilder.releaseGE();
   }
@@ -67,6 +67,13 @@ public: // methods
    */
   virtual void computeFluctuation(std::vector<RealVector>& residual);
 
+  /**
+   * The scratch data belong to this object, the splitters, var sets and
+   * transformers being the ones of its thread, and the past residuals of
+   * each cell are shared by all the threads
+   */
+  virtual bool isThreadSafe() const {return true;}
+
   static void defineConfigOptions(Config::OptionList& options);
 
   protected: // methods
@@ -174,11 +181,11 @@ private: // data
   ///Temporary vector of the contour integration
   RealVector m_phi;
 
-  /// Storage for the residual (past states contribution)
-  std::vector<RealVector> _pastResiduals;
+  /// Storage for the residual (past states contribution, shared by the threads)
+  Common::SafePtr<std::vector<RealVector> > _pastResiduals;
 
-  /// Storage for the residual (past states contribution of the N scheme used in B scheme)
-  std::vector<RealVector> _pastResiduals_order1;
+  /// Storage for the residual (past states contribution of the N scheme used in B scheme, shared by the threads)
+  Common::SafePtr<std::vector<RealVector> > _pastResiduals_order1;
 
   /// temporary vector with past source term residual
   std::vector<RealVector> temp_residual;
@@ -53,8 +53,8 @@ STM_HOCRD_SplitStrategy::STM_HOCRD_SplitStrategy(const std::string& name) :
   m_unitFaceNormals(),
   m_statesBkp(0),
   m_phi(),
-  _pastResiduals(0),
-  _pastResiduals_order1(0),
+  _pastResiduals(CFNULL),
+  _pastResiduals_order1(CFNULL),
   temp_residual(0),
   m_phisubT(0),
   subelemfacedir(0,0),
@@ -151,11 +151,11 @@ void STM_HOCRD_SplitStrategy::computeFluctuation(vector<RealVector>& residual)
 
 
     //We point the past_residual from the DistributeData to the past residual of cellID
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
 
     //We point the past_residual of order1 from the DistributeData to the past residual of order 1 of cellID
     // If we are not unsing blending scheme these are vector of dimension 0
-    ddata.past_residuals_order1 = &_pastResiduals_order1[ddata.cellID];
+    ddata.past_residuals_order1 = &(*_pastResiduals_order1)[ddata.cellID];
 
    //The time is the present time (this is used for the source term)
    ddata.time = SubSystemStatusStack::getActive()->getCurrentTime();
@@ -163,7 +163,7 @@ void STM_HOCRD_SplitStrategy::computeFluctuation(vector<RealVector>& residual)
  computeHOFluctuation_past();
 
     //We point the past_residual from the DistributeData to the past residual of cellID
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
 
     /*****         Triangle 0-3-5          *****/
 
@@ -620,8 +620,8 @@ void STM_HOCRD_SplitStrategy::computeFluctuation(vector<RealVector>& residual)
   if (!SubSystemStatusStack::getActive()->isFirstStep())
    {
     // If this is not the first pseudo-time iteration we point to the past_residual of the cell
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
-    //    ddata.past_residuals_order1 = &_pastResiduals_order1[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
+    //    ddata.past_residuals_order1 = &(*_pastResiduals_order1)[ddata.cellID];
    }
 
 
@@ -1343,11 +1343,15 @@ void STM_HOCRD_SplitStrategy::setup()
   // back up cell state pointers
   m_statesBkp.resize(MeshDataStack::getActive()->Statistics().getMaxNbStatesInCell());
 
+  // the past residuals of each cell are shared by the strategies of all the threads
+  _pastResiduals = getMethodData().getPastResiduals();
+  _pastResiduals_order1 = getMethodData().getPastResidualsOrder1();
+
   // Resizing the storage for the full past Residuals
-  _pastResiduals_order1.resize(nbGeoEnts);
+  _pastResiduals_order1->resize(nbGeoEnts);
 
   // Resizing the storage for the full past Residuals
-  _pastResiduals.resize(nbGeoEnts);
+  _pastResiduals->resize(nbGeoEnts);
   _stdTrsGeoBuilder.getDataGE().trs = innerCells;
 
   // loop over all the cells and set the number of quadrature
@@ -1362,8 +1366,8 @@ void STM_HOCRD_SplitStrategy::setup()
     m_contourIntegrator->setNbSolQuadraturePoints(&cell, m_nbQPointsInCell[iGeoEnt]);
 
     nbStatesInCell = cell.nbStates();
-    _pastResiduals_order1[iGeoEnt].resize(nbStatesInCell*nbEqs);
-   _pastResiduals[iGeoEnt].resize(nbStatesInCell*nbEqs);
+    (*_pastResiduals_order1)[iGeoEnt].resize(nbStatesInCell*nbEqs);
+   (*_pastResiduals)[iGeoEnt].resize(nbStatesInCell*nbEqs);
     // release the GeometricEntity
     _stdTrsGeoBuilder.releaseGE();
   }
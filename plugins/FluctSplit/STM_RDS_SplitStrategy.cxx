@@ -40,7 +40,7 @@ STM_RDS_SplitStrategy::STM_RDS_SplitStrategy(const std::string& name) :
   m_splitter(CFNULL),
   _pastStates(0),
   m_tmpvec(),
-  _pastResiduals(0),
+  _pastResiduals(CFNULL),
 temp_residual(0)
 {
 }
@@ -126,11 +126,11 @@ void STM_RDS_SplitStrategy::computeFluctuation(vector<RealVector>& residual)
     // restore the backed up flag
     ddata.isPerturb = backUpPerturb;
     //We point the past_residual from the DistributeData to the past residual of cellID
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
 //CF_DEBUG_OBJ((ddata.past_residuals_order1).size());
     //We point the past_residual of order1 from the DistributeData to the past residual of order 1 of cellID
     // If we are not unsing blending scheme these are vector of dimension 0
-    ddata.past_residuals_order1 = &_pastResiduals_order1[ddata.cellID];
+    ddata.past_residuals_order1 = &(*_pastResiduals_order1)[ddata.cellID];
     // set the conservative past states
     m_splitter->setConsStates(_pastStates);
     ddata.time = SubSystemStatusStack::getActive()->getCurrentTime();
@@ -187,8 +187,8 @@ void STM_RDS_SplitStrategy::computeFluctuation(vector<RealVector>& residual)
  // }
   if (!SubSystemStatusStack::getActive()->isFirstStep())
   {
-    ddata.past_residuals = &_pastResiduals[ddata.cellID];
-    ddata.past_residuals_order1 = &_pastResiduals_order1[ddata.cellID];
+    ddata.past_residuals = &(*_pastResiduals)[ddata.cellID];
+    ddata.past_residuals_order1 = &(*_pastResiduals_order1)[ddata.cellID];
   }
   ddata.tStates = computeConsistentStates(ddata.states);
   // set the conservative states
@@ -271,10 +271,14 @@ void STM_RDS_SplitStrategy::setup()
   const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
   CFuint nbStatesInCell;
 
+  // the past residuals of each cell are shared by the strategies of all the threads
+  _pastResiduals = getMethodData().getPastResiduals();
+  _pastResiduals_order1 = getMethodData().getPastResidualsOrder1();
+
  // Resizing the storage for the full past Residuals of scheme of order 1 (if we use ST blending)
   std::string name = m_splitter->getName();
   // Resizing the storage for the full past Residuals
-  _pastResiduals_order1.resize(nbCells);
+  _pastResiduals_order1->resize(nbCells);
   // Resize the RealVector
   _stdTrsGeoBuilder.getDataGE().trs = innerCells;
 
@@ -287,14 +291,14 @@ void STM_RDS_SplitStrategy::setup()
     GeometricEntity& cell = *_stdTrsGeoBuilder.buildGE();
 
     nbStatesInCell = cell.nbStates();
-    _pastResiduals_order1[iGeoEnt].resize(nbStatesInCell*nbEqs);
+    (*_pastResiduals_order1)[iGeoEnt].resize(nbStatesInCell*nbEqs);
 
     //release the GeometricEntity
     _stdTrsGeoBuilder.releaseGE();
    }
  
   // Resizing the storage for the full past Residuals
-  _pastResiduals.resize(nbCells);
+  _pastResiduals->resize(nbCells);
   // Resize the RealVector
   _stdTrsGeoBuilder.getDataGE().trs = innerCells;
 
@@ -307,7 +311,7 @@ void STM_RDS_SplitStrategy::setup()
     GeometricEntity& cell = *_stdTrsGeoBuilder.buildGE();
 
     nbStatesInCell = cell.nbStates();
-    _pastResiduals[iGeoEnt].resize(nbStatesInCell*nbEqs);
+    (*_pastResiduals)[iGeoEnt].resize(nbStatesInCell*nbEqs);
 
     //release the GeometricEntity
     _stdTrsGeoBuilder.releaseGE();
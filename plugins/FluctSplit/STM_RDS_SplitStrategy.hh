@@ -66,6 +66,13 @@ public: // methods
    * @param residual the residual for each variable to distribute in each state
    */
   virtual void computeFluctuation(std::vector<RealVector>& residual);
+
+  /**
+   * The scratch data belong to this object, the splitters, var sets and
+   * transformers being the ones of its thread, and the past residuals of
+   * each cell are shared by all the threads
+   */
+  virtual bool isThreadSafe() const {return true;}
  /**
    * Sets the current cell and calls the computation of the
    * consistent state transformation.
@@ -98,11 +105,11 @@ private: // data
   ///Temporary vector
   RealVector m_tmpvec;
 
-  /// Storage for the residual (past states contribution)
-  std::vector<RealVector> _pastResiduals;
+  /// Storage for the residual (past states contribution, shared by the threads)
+  Common::SafePtr<std::vector<RealVector> > _pastResiduals;
 
-  /// Storage for the residual (past states contribution of the N scheme used in B scheme)
-  std::vector<RealVector> _pastResiduals_order1;
+  /// Storage for the residual (past states contribution of the N scheme used in B scheme, shared by the threads)
+  Common::SafePtr<std::vector<RealVector> > _pastResiduals_order1;
 
   /// temporary vector with past source term residual
   std::vector<RealVector> temp_residual;
@@ -0,0 +1,119 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+
+#include "FluxReconstructionMethod/BlockModalFilter.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockModalFilter::BlockModalFilter() :
+  m_filter(),
+  m_nbrOut(0),
+  m_nbrIn(0),
+  m_nbrEqs(0),
+  m_blockSize(0),
+  m_ld(0),
+  m_input(),
+  m_output()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockModalFilter::~BlockModalFilter()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockModalFilter::setup(const RealMatrix& filter, const CFuint nbrEqs, const CFuint blockSize)
+{
+  cf_assert(nbrEqs > 0);
+
+  m_nbrOut = filter.nbRows();
+  m_nbrIn = filter.nbCols();
+  m_nbrEqs = nbrEqs;
+  m_blockSize = std::max(blockSize, static_cast<CFuint>(1));
+  m_ld = m_blockSize*m_nbrEqs;
+
+  m_filter.resize(m_nbrOut*m_nbrIn);
+  for (CFuint iOut = 0; iOut < m_nbrOut; ++iOut)
+  {
+    for (CFuint iIn = 0; iIn < m_nbrIn; ++iIn)
+    {
+      m_filter[iOut*m_nbrIn + iIn] = filter(iOut,iIn);
+    }
+  }
+
+  m_input.assign(m_nbrIn*m_ld, 0.0);
+  m_output.assign(m_nbrOut*m_ld, 0.0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockModalFilter::apply(const CFuint nbrElems)
+{
+  cf_assert(nbrElems <= m_blockSize);
+
+  // output = filter*input, the inner loop running over the contiguous
+  // values of all the elements and equations of the block
+  const CFuint nbrCols = nbrElems*m_nbrEqs;
+  for (CFuint iOut = 0; iOut < m_nbrOut; ++iOut)
+  {
+    CFreal *const out = &m_output[iOut*m_ld];
+    for (CFuint iCol = 0; iCol < nbrCols; ++iCol)
+    {
+      out[iCol] = 0.0;
+    }
+
+    const CFreal *const filterRow = &m_filter[iOut*m_nbrIn];
+    for (CFuint iIn = 0; iIn < m_nbrIn; ++iIn)
+    {
+      const CFreal coef = filterRow[iIn];
+      if (coef == 0.0) continue;
+
+      const CFreal *const in = &m_input[iIn*m_ld];
+      for (CFuint iCol = 0; iCol < nbrCols; ++iCol)
+      {
+        out[iCol] += coef*in[iCol];
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockModalFilter::getFilteredStates(const CFuint iElem, vector< RealVector >& filtered) const
+{
+  cf_assert(iElem < m_blockSize);
+  cf_assert(filtered.size() == m_nbrOut);
+
+  for (CFuint iOut = 0; iOut < m_nbrOut; ++iOut)
+  {
+    const CFreal *const out = &m_output[iOut*m_ld + iElem*m_nbrEqs];
+    for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+    {
+      filtered[iOut][iEq] = out[iEq];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  }  // namespace FluxReconstructionMethod
+}  // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,119 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_FluxReconstructionMethod_BlockModalFilter_hh
+#define COOLFluiD_FluxReconstructionMethod_BlockModalFilter_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Common/NonCopyable.hh"
+#include "MathTools/RealMatrix.hh"
+#include "MathTools/RealVector.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class applies a fixed matrix (e.g. the projection on order P-1 used by
+ * the shock sensors) to the solution point states of a block of elements of
+ * the same type and order.
+ *
+ * The states of the block are stored solution point by solution point, the
+ * values of all the elements and equations of a solution point being
+ * contiguous, so that the filter is applied to the whole block as a single
+ * small matrix-matrix product instead of one matrix-vector product per
+ * element and per equation.
+ */
+class BlockModalFilter : public Common::NonCopyable<BlockModalFilter> {
+public:
+
+  /// Constructor
+  BlockModalFilter();
+
+  /// Destructor
+  ~BlockModalFilter();
+
+  /**
+   * Sets the filter and allocates the storage of the blocks
+   * @param filter     matrix applied to the solution point values (nbrOut x nbrSolPnts)
+   * @param nbrEqs     number of equations per solution point
+   * @param blockSize  maximum number of elements per block
+   */
+  void setup(const RealMatrix& filter, const CFuint nbrEqs, const CFuint blockSize);
+
+  /// @return the maximum number of elements per block
+  CFuint getBlockSize() const {return m_blockSize;}
+
+  /**
+   * Sets the state in a solution point of an element of the block
+   * @param iElem  index of the element in the block
+   */
+  void setState(const CFuint iElem, const CFuint iSol, const RealVector& state)
+  {
+    cf_assert(iElem < m_blockSize);
+    cf_assert(iSol < m_nbrIn);
+    CFreal *const in = &m_input[iSol*m_ld + iElem*m_nbrEqs];
+    for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+    {
+      in[iEq] = state[iEq];
+    }
+  }
+
+  /**
+   * Applies the filter to the first elements of the block
+   * @param nbrElems  number of elements set in the block
+   */
+  void apply(const CFuint nbrElems);
+
+  /**
+   * Gets the filtered states of an element of the block
+   * @param iElem     index of the element in the block
+   * @param filtered  filtered states (nbrOut vectors of size nbrEqs)
+   */
+  void getFilteredStates(const CFuint iElem, std::vector< RealVector >& filtered) const;
+
+private: // data
+
+  /// filter, stored row by row
+  std::vector< CFreal > m_filter;
+
+  /// number of rows of the filter
+  CFuint m_nbrOut;
+
+  /// number of columns of the filter (solution points)
+  CFuint m_nbrIn;
+
+  /// number of equations
+  CFuint m_nbrEqs;
+
+  /// maximum number of elements per block
+  CFuint m_blockSize;
+
+  /// distance between two solution points in the storage of the block
+  CFuint m_ld;
+
+  /// states of the block
+  std::vector< CFreal > m_input;
+
+  /// filtered states of the block
+  std::vector< CFreal > m_output;
+
+}; // class BlockModalFilter
+
+//////////////////////////////////////////////////////////////////////////////
+
+  }  // namespace FluxReconstructionMethod
+}  // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_FluxReconstructionMethod_BlockModalFilter_hh
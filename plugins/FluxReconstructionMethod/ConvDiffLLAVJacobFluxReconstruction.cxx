@@ -40,6 +40,10 @@ ConvDiffLLAVJacobFluxReconstruction::ConvDiffLLAVJacobFluxReconstruction(const s
   m_updateVarSet(CFNULL),
   m_order(),
   m_transformationMatrix(),
+  m_blockProjection(),
+  m_sensorBlockSize(),
+  m_smoothSkipIter(),
+  m_nbSmoothIter(),
   m_statesPMinOne(),
   m_epsilon(),
   m_solEpsilons(),
@@ -146,6 +150,12 @@ ConvDiffLLAVJacobFluxReconstruction::ConvDiffLLAVJacobFluxReconstruction(const s
     m_monitoredPhysVar = MathTools::MathConsts::CFuintMax();
     setParameter( "MonitoredPhysVar", &m_monitoredPhysVar);
     
+    m_sensorBlockSize = 64;
+    setParameter( "SensorBlockSize", &m_sensorBlockSize);
+    
+    m_smoothSkipIter = 0;
+    setParameter( "SmoothSkipIter", &m_smoothSkipIter);
+    
     m_printLLAV = true;
     setParameter( "printLLAV", &m_printLLAV);
     
@@ -200,6 +210,10 @@ void ConvDiffLLAVJacobFluxReconstruction::defineConfigOptions(Config::OptionList
   
   options.addConfigOption< CFuint,Config::DynamicOption<> >("MonitoredPhysVar","Index of the monitored physical var for positivity preservation, if not specified MonitoredVar is used instead.");
   
+  options.addConfigOption< CFuint >("SensorBlockSize","Number of elements whose states are projected on order P-1 together for the smoothness indicator.");
+  
+  options.addConfigOption< CFuint >("SmoothSkipIter","Number of consecutive iterations below the smoothness threshold after which the smoothness of an element is only recomputed every SmoothSkipIter iterations, the smoothness output keeping the value of the last evaluation in between (0 recomputes it at every iteration).");
+  
   options.addConfigOption< CFreal,Config::DynamicOption<> >("WallCutOffDistance","Distance from wall at which to cut off LLAV.");
   
   options.addConfigOption< bool >("UseWallCutOff","Boolean telling whether to use wall distance cut off of LLAV.");
@@ -343,6 +357,11 @@ void ConvDiffLLAVJacobFluxReconstruction::execute()
   //// Loop over the elements to compute the artificial viscosities and cell
   //// part of gradients
   
+  // get the states
+  DataHandle< State*, GLOBAL > states = MeshDataStack::getActive()->getStateDataSocketSink().getDataHandle();
+  
+  const CFuint blockSize = m_blockProjection.getBlockSize();
+  
   // loop over element types, for the moment there should only be one
   const CFuint nbrElemTypes = elemType->size();
   cf_assert(nbrElemTypes == 1);
@@ -352,38 +371,68 @@ void ConvDiffLLAVJacobFluxReconstruction::execute()
     const CFuint startIdx = (*elemType)[m_iElemType].getStartIdx();
     const CFuint endIdx   = (*elemType)[m_iElemType].getEndIdx();
 
-    // loop over cells
-    for (CFuint elemIdx = startIdx; elemIdx < endIdx; ++elemIdx)
+    // loop over blocks of cells
+    for (CFuint blockStartIdx = startIdx; blockStartIdx < endIdx; blockStartIdx += blockSize)
     {
-      // build the GeometricEntity
-      geoDataCell.idx = elemIdx;
-      m_elemIdx = elemIdx;
-      m_cell = m_cellBuilder->buildGE();
+      const CFuint blockEndIdx = min(blockStartIdx + blockSize, endIdx);
+      
+      // project the states of the cells whose smoothness is computed on order P-1
+      CFuint nbrBlockElems = 0;
+      for (CFuint elemIdx = blockStartIdx; elemIdx < blockEndIdx; ++elemIdx)
+      {
+        if (isSensorFrozen(elemIdx)) continue;
+        
+        for (CFuint iSol = 0; iSol < m_nbrSolPnts; ++iSol)
+        {
+          m_blockProjection.setState(nbrBlockElems, iSol, *states[cells->getStateID(elemIdx,iSol)]);
+        }
+        ++nbrBlockElems;
+      }
+      m_blockProjection.apply(nbrBlockElems);
+      
+      // loop over cells
+      CFuint iBlockElem = 0;
+      for (CFuint elemIdx = blockStartIdx; elemIdx < blockEndIdx; ++elemIdx)
+      {
+        // build the GeometricEntity
+        geoDataCell.idx = elemIdx;
+        m_elemIdx = elemIdx;
+        m_cell = m_cellBuilder->buildGE();
 
-      // get the states in this cell
-      m_cellStates = m_cell->getStates();
+        // get the states in this cell
+        m_cellStates = m_cell->getStates();
       
-      // get the nodes in this cell
-      m_cellNodes[0]  = m_cell->getNodes();
+        // get the nodes in this cell
+        m_cellNodes[0]  = m_cell->getNodes();
       
-//       // if the states in the cell are parallel updatable, compute the resUpdates (-divFC)
-//       if ((*m_cellStates)[0]->isParUpdatable())
-//       {
-	// compute the states projected on order P-1
-	computeProjStates(m_statesPMinOne);
-	
-	// compute the artificial viscosity
-	computeEpsilon();
-	
-	// store epsilon
-	storeEpsilon();
-//       } 
+        if (isSensorFrozen(elemIdx))
+        {
+          // the cell is still considered smooth, no artificial viscosity is needed;
+          // its smoothness output keeps the value of its last evaluation
+          m_epsilon = 0.0;
+          ++m_nbSmoothIter[elemIdx];
+        }
+        else
+        {
+          // get the states projected on order P-1
+          m_blockProjection.getFilteredStates(iBlockElem, m_statesPMinOne);
+          ++iBlockElem;
+          
+          // compute the artificial viscosity
+          computeEpsilon();
+          
+          m_nbSmoothIter[elemIdx] = (m_s < m_s0 - m_kappa) ? m_nbSmoothIter[elemIdx] + 1 : 0;
+        }
+        
+        // store epsilon
+        storeEpsilon();
       
-      // add the cell part to the gradients
-      computeGradients();
+        // add the cell part to the gradients
+        computeGradients();
       
-      //release the GeometricEntity
-      m_cellBuilder->releaseGE();
+        //release the GeometricEntity
+        m_cellBuilder->releaseGE();
+      }
     }
   }
   
@@ -3792,6 +3841,20 @@ void ConvDiffLLAVJacobFluxReconstruction::setup()
   
   m_transformationMatrix = (*vdm)*temp*(*vdmInv);
   
+  // the projection on order 0 is the average of the solution point states
+  if (m_order != 1)
+  {
+    m_blockProjection.setup(m_transformationMatrix, m_nbrEqs, m_sensorBlockSize);
+  }
+  else
+  {
+    RealMatrix average(m_nbrSolPnts,m_nbrSolPnts);
+    average = 1.0/m_nbrSolPnts;
+    m_blockProjection.setup(average, m_nbrEqs, m_sensorBlockSize);
+  }
+  
+  m_nbSmoothIter.assign(nbrCells, 0);
+  
   //m_s0 = -m_s0*log10(static_cast<CFreal>(m_order));
   
   m_Smax = m_s0 + m_kappa;
@@ -0,0 +1,255 @@
+#include "Environment/ObjectProvider.hh"
+#include "Framework/SpaceMethod.hh"
+#include "Framework/CFL.hh"
+#include "Framework/SubSystemStatus.hh"
+
+#include "FluxReconstructionMethod/FluxReconstruction.hh"
+#include "FluxReconstructionMethod/FRPMultigrid.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+Environment::ObjectProvider<FRPMultigrid,
+               ConvergenceMethod,
+               FluxReconstructionModule,
+               1>
+frPMultigridConvergenceMethodProvider("FRPMultigrid");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigrid::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< std::string >("SetupCom","SetupCommand to run. This command seldomly needs overriding.");
+  options.addConfigOption< std::string >("UnSetupCom","UnSetupCommand to run. This command seldomly needs overriding.");
+  options.addConfigOption< std::string >("SmoothCom","Smoothing step command to run.");
+  options.addConfigOption< std::string >("RestrictCom","Command restricting a level to the next coarser one.");
+  options.addConfigOption< std::string >("ProlongCom","Command correcting a level with the next coarser one.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigrid::FRPMultigrid(const std::string& name) :
+  ConvergenceMethod(name)
+{
+  addConfigOptionsTo(this);
+
+  m_data.reset(new FRPMultigridData(this));
+
+  m_setupStr = "StdSetup";
+  setParameter("SetupCom",&m_setupStr);
+
+  m_unSetupStr = "StdUnSetup";
+  setParameter("UnSetupCom",&m_unSetupStr);
+
+  m_smoothStr = "StdSmooth";
+  setParameter("SmoothCom",&m_smoothStr);
+
+  m_restrictStr = "StdRestrict";
+  setParameter("RestrictCom",&m_restrictStr);
+
+  m_prolongStr = "StdProlong";
+  setParameter("ProlongCom",&m_prolongStr);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigrid::~FRPMultigrid()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+Common::SafePtr<MethodData> FRPMultigrid::getMethodData() const
+{
+  return m_data.getPtr();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+Common::SafePtr<ConvergenceMethodData> FRPMultigrid::getConvergenceMethodData()
+{
+  return m_data.getPtr();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigrid::configure ( Config::ConfigArgs& args )
+{
+  ConvergenceMethod::configure(args);
+  configureNested ( m_data.getPtr(), args );
+
+  configureCommand<FRPMultigridData,FRPMultigridComProvider>( args, m_setup,m_setupStr,m_data);
+
+  configureCommand<FRPMultigridData,FRPMultigridComProvider>( args, m_unSetup,m_unSetupStr,m_data);
+
+  configureCommand<FRPMultigridData,FRPMultigridComProvider>( args, m_smooth,m_smoothStr,m_data);
+
+  configureCommand<FRPMultigridData,FRPMultigridComProvider>( args, m_restrict,m_restrictStr,m_data);
+
+  configureCommand<FRPMultigridData,FRPMultigridComProvider>( args, m_prolong,m_prolongStr,m_data);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigrid::setMethodImpl()
+{
+  ConvergenceMethod::setMethodImpl();
+
+  setupCommandsAndStrategies();
+  m_setup->execute();
+
+  setCycle(m_data->getNbLevels(),
+           m_data->getNbCoarseVisits(),
+           m_data->getNbPreSmoothing(),
+           m_data->getNbPostSmoothing(),
+           m_data->getNbCoarsestSmoothing(),
+           m_data->getNbFMGCycles());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigrid::unsetMethodImpl()
+{
+  m_unSetup->execute();
+  unsetupCommandsAndStrategies();
+
+  ConvergenceMethod::unsetMethodImpl();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigrid::takeStepImpl()
+{
+  CFAUTOTRACE;
+
+  // update number of iterations, time step and CFL
+  SubSystemStatusStack::getActive()->updateNbIter();
+  SubSystemStatusStack::getActive()->updateTimeStep();
+  getConvergenceMethodData()->getCFL()->update();
+
+  // the transfer operators need the FR data, which is only set up after the convergence method
+  if (m_data->getNbLevels() > 1 && !m_data->getTransfer().isSetup())
+  {
+    m_data->setupLevels();
+  }
+
+  const CFuint topLevel = getTopLevel(SubSystemStatusStack::getActive()->getNbIter());
+  if (topLevel == 0)
+  {
+    runCycle(0, true);
+    return;
+  }
+
+  // full multigrid start: the residual of the iteration is the one of the
+  // mesh states at its beginning, then the problem of the top level is
+  // solved on its own and its solution is interpolated on the mesh states
+  computeSpaceResidual();
+  ConvergenceMethod::syncGlobalDataComputeResidual(true);
+
+  m_data->setFMGTransfer(true);
+  for (CFuint level = 0; level < topLevel; ++level)
+  {
+    restrictToCoarse(level);
+  }
+  m_data->setFMGTransfer(false);
+
+  runCycle(topLevel, false);
+
+  m_data->setFMGTransfer(true);
+  for (CFuint level = topLevel; level > 0; --level)
+  {
+    prolongToFine(level - 1);
+  }
+  m_data->setFMGTransfer(false);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigrid::smooth(CFuint level, CFuint nbSteps, bool isLast)
+{
+  m_data->setCurrentLevel(level);
+
+  const CFuint nbStages = m_data->getNbStages();
+  for (CFuint iStep = 0; iStep < nbSteps; ++iStep)
+  {
+    for (CFuint iStage = 0; iStage < nbStages; ++iStage)
+    {
+      m_data->setCurrentStage(iStage);
+
+      // Compute the RHS of the mesh states, which hold the solution of the level
+      computeSpaceResidual();
+
+      // update the solution of this stage
+      m_smooth->execute();
+
+      // Synchronize the states, compute the residual only at the end of the iteration,
+      // which is on the finest level
+      const bool computeResidual = level == 0 && isLast && iStep == nbSteps - 1 && iStage == nbStages - 1;
+      ConvergenceMethod::syncGlobalDataComputeResidual(computeResidual);
+
+      // postprocess the solution of the finest level
+      if (level == 0)
+      {
+        m_data->getCollaborator<SpaceMethod>()->postProcessSolution();
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigrid::restrictToCoarse(CFuint level)
+{
+  // the forcing term of the coarser level needs the residual of the current
+  // solution of this level, which the smoothing steps have changed
+  if (!m_data->isFMGTransfer())
+  {
+    computeSpaceResidual();
+  }
+
+  m_data->setCurrentLevel(level);
+  m_restrict->execute();
+
+  ConvergenceMethod::syncGlobalDataComputeResidual(false);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigrid::prolongToFine(CFuint level)
+{
+  m_data->setCurrentLevel(level);
+  m_prolong->execute();
+
+  ConvergenceMethod::syncGlobalDataComputeResidual(false);
+  if (level == 0)
+  {
+    m_data->getCollaborator<SpaceMethod>()->postProcessSolution();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigrid::computeSpaceResidual()
+{
+  m_data->getCollaborator<SpaceMethod>()->prepareComputation();
+  m_data->getCollaborator<SpaceMethod>()->computeSpaceResidual(1.0);
+  m_data->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,160 @@
+#ifndef COOLFluiD_FluxReconstructionMethod_FRPMultigrid_hh
+#define COOLFluiD_FluxReconstructionMethod_FRPMultigrid_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/ConvergenceMethod.hh"
+#include "Framework/MultigridCycle.hh"
+#include "FluxReconstructionMethod/FRPMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class defines a ConvergenceMethod that implements a polynomial
+ * multigrid for steady Flux Reconstruction computations.
+ * The coarse levels solve the full approximation scheme problem of the
+ * lower polynomial orders, with the Galerkin coarse operator described in
+ * FRPMultigridData: the solution is restricted to and prolonged from each
+ * order with the element data of the FR elements of that order.
+ * Each level is smoothed by an explicit multistage Runge-Kutta scheme with
+ * local time stepping, at a CFL that grows as the order decreases.
+ * V and W cycles are available, optionally preceded by a full multigrid
+ * start on the coarse levels.
+ */
+class FRPMultigrid : public Framework::ConvergenceMethod,
+                     public Framework::MultigridCycle {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Constructor.
+   *
+   * @param name missing documentation
+   */
+  explicit FRPMultigrid(const std::string& name);
+
+  /**
+   * Default destructor
+   */
+  ~FRPMultigrid();
+
+  /**
+   * Configures the method, by allocating the it's dynamic members.
+   *
+   * @param args missing documentation
+   */
+  virtual void configure ( Config::ConfigArgs& args );
+
+protected: // helper functions
+
+  /**
+   * Gets the Data aggregator of this method
+   * @return SafePtr to the MethodData
+   */
+  virtual Common::SafePtr< Framework::MethodData > getMethodData () const;
+
+  /**
+   * Gets the Data aggregator of this method
+   * @return SafePtr to the ConvergenceMethodData
+   */
+  virtual Common::SafePtr<Framework::ConvergenceMethodData> getConvergenceMethodData();
+
+  /**
+   * Smooths the given level
+   * @see MultigridCycle::smooth()
+   */
+  virtual void smooth(CFuint level, CFuint nbSteps, bool isLast);
+
+  /**
+   * Transfers the solution and the residual of the given level to the next
+   * coarser one
+   * @see MultigridCycle::restrictToCoarse()
+   */
+  virtual void restrictToCoarse(CFuint level);
+
+  /**
+   * Corrects the given level with the next coarser one
+   * @see MultigridCycle::prolongToFine()
+   */
+  virtual void prolongToFine(CFuint level);
+
+  /// Computes the residual of the mesh states with the space method
+  void computeSpaceResidual();
+
+protected: // abstract interface implementations
+
+  /**
+   * Take one timestep
+   * @see ConvergenceMethod::takeStep()
+   */
+  virtual void takeStepImpl();
+
+  /**
+   * UnSets the data of the method.
+   * @see Method::unsetMethod()
+   */
+  virtual void unsetMethodImpl();
+
+  /**
+   * Sets up the data for the method commands to be applied.
+   * @see Method::setMethod()
+   */
+  virtual void setMethodImpl();
+
+protected: // member data
+
+  ///The Setup command to use
+  Common::SelfRegistPtr<FRPMultigridCom> m_setup;
+
+  ///The UnSetup command to use
+  Common::SelfRegistPtr<FRPMultigridCom> m_unSetup;
+
+  ///The smoothing step command to use
+  Common::SelfRegistPtr<FRPMultigridCom> m_smooth;
+
+  ///The restriction command to use
+  Common::SelfRegistPtr<FRPMultigridCom> m_restrict;
+
+  ///The prolongation command to use
+  Common::SelfRegistPtr<FRPMultigridCom> m_prolong;
+
+  ///The Setup string for configuration
+  std::string m_setupStr;
+
+  ///The UnSetup string for configuration
+  std::string m_unSetupStr;
+
+  ///The smoothing step string for configuration
+  std::string m_smoothStr;
+
+  ///The restriction string for configuration
+  std::string m_restrictStr;
+
+  ///The prolongation string for configuration
+  std::string m_prolongStr;
+
+  ///The data to share between FRPMultigrid commands
+  Common::SharedPtr<FRPMultigridData> m_data;
+
+}; // class FRPMultigrid
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_FluxReconstructionMethod_FRPMultigrid_hh
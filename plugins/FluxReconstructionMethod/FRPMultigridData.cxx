@@ -0,0 +1,262 @@
+#include "Common/BadValueException.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/PhysicalModel.hh"
+#include "Framework/SpaceMethod.hh"
+
+#include "FluxReconstructionMethod/FluxReconstruction.hh"
+#include "FluxReconstructionMethod/FluxReconstructionSolver.hh"
+#include "FluxReconstructionMethod/FRPMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<NullMethodCommand<FRPMultigridData>, FRPMultigridData, FluxReconstructionModule>
+  nullFRPMultigridComProvider("Null");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridData::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< CFuint >("CoarsestOrder","Polynomial order of the coarsest level.");
+  options.addConfigOption< std::string >("CycleType","Type of multigrid cycle (V or W).");
+  options.addConfigOption< CFuint >("PreSmoothing","Number of smoothing steps before visiting the coarser level.");
+  options.addConfigOption< CFuint >("PostSmoothing","Number of smoothing steps after visiting the coarser level.");
+  options.addConfigOption< CFuint >("CoarsestSmoothing","Number of smoothing steps on the coarsest level.");
+  options.addConfigOption< CFuint >("FMGCycles","Number of cycles starting from each coarse level at the beginning of the computation (full multigrid), 0 to disable.");
+  options.addConfigOption< std::vector<CFreal> >("Alpha","Coefficients of the stages of the Runge-Kutta smoother.");
+  options.addConfigOption< CFreal >("CoarseCFLExponent","The CFL on the level of order p is multiplied by ((P+1)/(p+1))^CoarseCFLExponent.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridData::FRPMultigridData(Common::SafePtr<Framework::Method> owner)
+  : ConvergenceMethodData(owner),
+    m_levelOrders(),
+    m_transfer(),
+    m_solutions(),
+    m_stageSolutions(),
+    m_restrictedSolutions(),
+    m_restrictedResiduals(),
+    m_forcings(),
+    m_levelResiduals(),
+    m_needsForcing(),
+    m_fineSolution(),
+    m_fineWork(),
+    m_isFMGTransfer(false),
+    m_level(0),
+    m_stage(0),
+    m_alpha()
+{
+  addConfigOptionsTo(this);
+
+  m_coarsestOrder = 0;
+  setParameter("CoarsestOrder",&m_coarsestOrder);
+
+  m_cycleType = "V";
+  setParameter("CycleType",&m_cycleType);
+
+  m_nbPreSmoothing = 1;
+  setParameter("PreSmoothing",&m_nbPreSmoothing);
+
+  m_nbPostSmoothing = 1;
+  setParameter("PostSmoothing",&m_nbPostSmoothing);
+
+  m_nbCoarsestSmoothing = 2;
+  setParameter("CoarsestSmoothing",&m_nbCoarsestSmoothing);
+
+  m_nbFMGCycles = 0;
+  setParameter("FMGCycles",&m_nbFMGCycles);
+
+  setParameter("Alpha",&m_alpha);
+
+  m_cflExponent = 1.0;
+  setParameter("CoarseCFLExponent",&m_cflExponent);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridData::~FRPMultigridData()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridData::configure ( Config::ConfigArgs& args )
+{
+  ConvergenceMethodData::configure(args);
+
+  if (m_cycleType != "V" && m_cycleType != "W")
+  {
+    throw BadValueException (FromHere(),"FRPMultigridData::configure() => CycleType must be V or W, not " + m_cycleType);
+  }
+
+  if (m_alpha.size() == 0)
+  {
+    // 4-stage Jameson scheme
+    m_alpha.resize(4);
+    m_alpha[0] = 1.0/4.0;
+    m_alpha[1] = 1.0/3.0;
+    m_alpha[2] = 1.0/2.0;
+    m_alpha[3] = 1.0;
+  }
+
+  if (m_nbCoarsestSmoothing == 0)
+  {
+    CFLog(WARN, "FRPMultigridData::configure() => CoarsestSmoothing = 0, set to 1\n");
+    m_nbCoarsestSmoothing = 1;
+  }
+
+  // the residual of the iteration is the one of the last smoothing step of the finest level
+  if (m_nbPostSmoothing == 0)
+  {
+    CFLog(WARN, "FRPMultigridData::configure() => PostSmoothing = 0, set to 1\n");
+    m_nbPostSmoothing = 1;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridData::setLevelOrders(CFuint solOrder)
+{
+  CFuint coarsestOrder = m_coarsestOrder;
+  if (coarsestOrder > solOrder)
+  {
+    CFLog(WARN, "FRPMultigridData::setLevelOrders() => CoarsestOrder " << coarsestOrder
+          << " higher than the solution order " << solOrder << ": single level\n");
+    coarsestOrder = solOrder;
+  }
+
+  m_levelOrders.clear();
+  for (CFuint order = solOrder + 1; order > coarsestOrder; --order)
+  {
+    m_levelOrders.push_back(order - 1);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridData::setupLevels()
+{
+  CFAUTOTRACE;
+
+  // the FR data is only set up after the convergence method
+  SafePtr<FluxReconstructionSolver> frSolver =
+    getCollaborator<SpaceMethod>().d_castTo<FluxReconstructionSolver>();
+  cf_assert(frSolver.isNotNull());
+
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  m_transfer.setup(frSolver->getData(), m_levelOrders, nbEqs);
+
+  const CFuint nbLevels = m_levelOrders.size();
+  m_solutions          .resize(nbLevels);
+  m_stageSolutions     .resize(nbLevels);
+  m_restrictedSolutions.resize(nbLevels);
+  m_restrictedResiduals.resize(nbLevels);
+  m_forcings           .resize(nbLevels);
+  m_levelResiduals     .resize(nbLevels);
+  m_needsForcing.assign(nbLevels, false);
+  for (CFuint iLevel = 1; iLevel < nbLevels; ++iLevel)
+  {
+    const CFuint nbValues = m_transfer.getNbLevelValues(iLevel);
+    m_solutions          [iLevel].assign(nbValues, 0.);
+    m_stageSolutions     [iLevel].assign(nbValues, 0.);
+    m_restrictedSolutions[iLevel].assign(nbValues, 0.);
+    m_restrictedResiduals[iLevel].assign(nbValues, 0.);
+    m_forcings           [iLevel].assign(nbValues, 0.);
+    m_levelResiduals     [iLevel].assign(nbValues, 0.);
+  }
+
+  const CFuint nbFineValues = m_transfer.getNbLevelValues(0);
+  m_levelResiduals[0].assign(nbFineValues, 0.);
+  m_fineSolution.assign(nbFineValues, 0.);
+  m_fineWork.assign(nbFineValues, 0.);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridData::unsetupLevels()
+{
+  m_transfer.unsetup();
+
+  m_solutions.clear();
+  m_stageSolutions.clear();
+  m_restrictedSolutions.clear();
+  m_restrictedResiduals.clear();
+  m_forcings.clear();
+  m_levelResiduals.clear();
+  m_needsForcing.clear();
+  m_fineSolution.clear();
+  m_fineWork.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridData::computeLevelResidual(CFuint level, const DataHandle<CFreal>& rhs)
+{
+  cf_assert(level < m_levelResiduals.size());
+
+  if (level == 0)
+  {
+    m_transfer.gather(rhs, m_levelResiduals[0]);
+    return;
+  }
+
+  m_transfer.gather(rhs, m_fineWork);
+  vector<CFreal>& residual = m_levelResiduals[level];
+  m_transfer.projectOnLevel(level, m_fineWork, residual);
+
+  // FAS forcing term: R(res_{l-1} + P_{l-1}) - res_l(R u_{l-1})
+  vector<CFreal>& forcing = m_forcings[level];
+  const CFuint nbValues = residual.size();
+  if (m_needsForcing[level])
+  {
+    const vector<CFreal>& restrictedResidual = m_restrictedResiduals[level];
+    for (CFuint i = 0; i < nbValues; ++i)
+    {
+      forcing[i] = restrictedResidual[i] - residual[i];
+    }
+    m_needsForcing[level] = false;
+  }
+
+  for (CFuint i = 0; i < nbValues; ++i)
+  {
+    residual[i] += forcing[i];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridData::resetForcing(CFuint level)
+{
+  cf_assert(level > 0 && level < m_forcings.size());
+  m_forcings[level].assign(m_forcings[level].size(), 0.);
+  m_needsForcing[level] = false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal FRPMultigridData::getCFLFactor(CFuint level) const
+{
+  cf_assert(level < m_levelOrders.size());
+  const CFreal ratio = (m_levelOrders[0] + 1.0)/(m_levelOrders[level] + 1.0);
+  return std::pow(ratio, m_cflExponent);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,323 @@
+#ifndef COOLFluiD_FluxReconstructionMethod_FRPMultigridData_hh
+#define COOLFluiD_FluxReconstructionMethod_FRPMultigridData_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/MethodCommand.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/ConvergenceMethodData.hh"
+#include "Framework/DataHandle.hh"
+#include "FluxReconstructionMethod/FRPMultigridTransfer.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class represents the data shared by the commands of the
+ * polynomial multigrid method for Flux Reconstruction.
+ * Level 0 is the order P of the solution, level i has order P-i, down to
+ * the coarsest order.
+ * The coarse levels follow the full approximation scheme. The solution u_q
+ * of the level of order q is stored by its values at the solution points of
+ * order q, and its residual is the Galerkin one
+ *   R_q(u_q) = Pi_q R_P(I_q u_q)
+ * where I_q interpolates u_q on the solution points of order P, R_P is the
+ * FR residual computed by the space method on the mesh states and Pi_q is
+ * the least squares projection back on order q (see FRPMultigridTransfer).
+ * The forcing term of each coarse level makes its residual equal, for the
+ * restricted solution, to the restriction of the residual of the finer level.
+ */
+class FRPMultigridData : public Framework::ConvergenceMethodData {
+
+public: // functions
+
+  /// Defines the Config Option's of this class
+  /// @param options a OptionList where to add the Option's
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /// Constructor
+  FRPMultigridData(Common::SafePtr<Framework::Method> owner);
+
+  /// Destructor
+  ~FRPMultigridData();
+
+  /// Configure the data from the supplied arguments.
+  virtual void configure ( Config::ConfigArgs& args );
+
+  /// Gets the Class name
+  static std::string getClassName()
+  {
+    return "FRPMultigrid";
+  }
+
+  /// Sets the orders of the levels, from the order of the solution
+  /// down to the coarsest order
+  void setLevelOrders(CFuint solOrder);
+
+  /// @return the number of levels
+  CFuint getNbLevels() const
+  {
+    return m_levelOrders.size();
+  }
+
+  /// @return the polynomial order of the given level
+  CFuint getLevelOrder(CFuint level) const
+  {
+    cf_assert(level < m_levelOrders.size());
+    return m_levelOrders[level];
+  }
+
+  /// Builds the transfer operators and allocates the values of the levels
+  void setupLevels();
+
+  /// Releases the transfer operators and the values of the levels
+  void unsetupLevels();
+
+  /// @return the transfer operators between the levels
+  FRPMultigridTransfer& getTransfer()
+  {
+    return m_transfer;
+  }
+
+  /// @return the solution of the given coarse level
+  std::vector<CFreal>& getSolution(CFuint level)
+  {
+    cf_assert(level > 0 && level < m_solutions.size());
+    return m_solutions[level];
+  }
+
+  /// @return the solution of the given coarse level at the beginning of the smoothing step
+  std::vector<CFreal>& getStageSolution(CFuint level)
+  {
+    cf_assert(level > 0 && level < m_stageSolutions.size());
+    return m_stageSolutions[level];
+  }
+
+  /// @return the solution of the given coarse level right after its restriction
+  std::vector<CFreal>& getRestrictedSolution(CFuint level)
+  {
+    cf_assert(level > 0 && level < m_restrictedSolutions.size());
+    return m_restrictedSolutions[level];
+  }
+
+  /// @return the residual of the finer level restricted to the given coarse level
+  std::vector<CFreal>& getRestrictedResidual(CFuint level)
+  {
+    cf_assert(level > 0 && level < m_restrictedResiduals.size());
+    return m_restrictedResiduals[level];
+  }
+
+  /// @return the solution of the finest level before the restriction,
+  /// in the layout of FRPMultigridTransfer
+  std::vector<CFreal>& getFineSolution()
+  {
+    return m_fineSolution;
+  }
+
+  /// @return the residual of the given level, including its forcing term,
+  /// as computed by the last call to computeLevelResidual()
+  std::vector<CFreal>& getLevelResidual(CFuint level)
+  {
+    cf_assert(level < m_levelResiduals.size());
+    return m_levelResiduals[level];
+  }
+
+  /// Computes the residual of the given level from the residual of the mesh
+  /// states, which must have been computed for the current solution of the level.
+  /// The first call after a restriction to this level sets its forcing term.
+  void computeLevelResidual(CFuint level, const Framework::DataHandle<CFreal>& rhs);
+
+  /// Sets the forcing term of the given coarse level from its restricted
+  /// residual at the next computation of its residual
+  void setForcingFromRestriction(CFuint level)
+  {
+    cf_assert(level > 0 && level < m_needsForcing.size());
+    m_needsForcing[level] = true;
+  }
+
+  /// Sets to zero the forcing term of the given coarse level
+  void resetForcing(CFuint level);
+
+  /// @return true if the transfers are the ones of a full multigrid start,
+  /// i.e. the coarse levels solve their own problem without forcing term
+  /// and the solution is interpolated instead of corrected
+  bool isFMGTransfer() const
+  {
+    return m_isFMGTransfer;
+  }
+
+  /// Sets if the transfers are the ones of a full multigrid start
+  void setFMGTransfer(bool isFMGTransfer)
+  {
+    m_isFMGTransfer = isFMGTransfer;
+  }
+
+  /// @return work storage of the size of the finest level
+  std::vector<CFreal>& getFineWork()
+  {
+    return m_fineWork;
+  }
+
+  /// @return the current level
+  CFuint getCurrentLevel() const
+  {
+    return m_level;
+  }
+
+  /// Sets the current level
+  void setCurrentLevel(CFuint level)
+  {
+    m_level = level;
+  }
+
+  /// @return the current stage of the smoother
+  CFuint getCurrentStage() const
+  {
+    return m_stage;
+  }
+
+  /// Sets the current stage of the smoother
+  void setCurrentStage(CFuint stage)
+  {
+    m_stage = stage;
+  }
+
+  /// @return the number of stages of the smoother
+  CFuint getNbStages() const
+  {
+    return m_alpha.size();
+  }
+
+  /// @return the coefficient of the given stage of the smoother
+  CFreal getAlpha(CFuint stage) const
+  {
+    cf_assert(stage < m_alpha.size());
+    return m_alpha[stage];
+  }
+
+  /// @return the number of coarser levels visited from each level (1 for V, 2 for W cycles)
+  CFuint getNbCoarseVisits() const
+  {
+    return (m_cycleType == "W") ? 2 : 1;
+  }
+
+  /// @return the number of smoothing steps before visiting the coarser level
+  CFuint getNbPreSmoothing() const
+  {
+    return m_nbPreSmoothing;
+  }
+
+  /// @return the number of smoothing steps after visiting the coarser level
+  CFuint getNbPostSmoothing() const
+  {
+    return m_nbPostSmoothing;
+  }
+
+  /// @return the number of smoothing steps on the coarsest level
+  CFuint getNbCoarsestSmoothing() const
+  {
+    return m_nbCoarsestSmoothing;
+  }
+
+  /// @return the number of cycles starting from each coarse level
+  /// at the beginning of the computation (full multigrid)
+  CFuint getNbFMGCycles() const
+  {
+    return m_nbFMGCycles;
+  }
+
+  /// @return the factor multiplying the CFL on the given level
+  CFreal getCFLFactor(CFuint level) const;
+
+private: // data
+
+  /// orders of the levels
+  std::vector<CFuint> m_levelOrders;
+
+  /// transfer operators between the levels
+  FRPMultigridTransfer m_transfer;
+
+  /// solutions of the coarse levels
+  std::vector< std::vector<CFreal> > m_solutions;
+
+  /// solutions of the coarse levels at the beginning of the smoothing step
+  std::vector< std::vector<CFreal> > m_stageSolutions;
+
+  /// solutions of the coarse levels right after their restriction
+  std::vector< std::vector<CFreal> > m_restrictedSolutions;
+
+  /// residuals of the finer levels restricted to the coarse levels
+  std::vector< std::vector<CFreal> > m_restrictedResiduals;
+
+  /// forcing terms of the coarse levels
+  std::vector< std::vector<CFreal> > m_forcings;
+
+  /// residuals of the levels, including the forcing terms
+  std::vector< std::vector<CFreal> > m_levelResiduals;
+
+  /// flags telling if the forcing term of a coarse level must be set
+  std::vector<bool> m_needsForcing;
+
+  /// solution of the finest level before the restriction
+  std::vector<CFreal> m_fineSolution;
+
+  /// work storage of the size of the finest level
+  std::vector<CFreal> m_fineWork;
+
+  /// true during the transfers of a full multigrid start
+  bool m_isFMGTransfer;
+
+  /// current level
+  CFuint m_level;
+
+  /// current stage of the smoother
+  CFuint m_stage;
+
+  /// coarsest polynomial order
+  CFuint m_coarsestOrder;
+
+  /// type of cycle (V or W)
+  std::string m_cycleType;
+
+  /// number of smoothing steps before visiting the coarser level
+  CFuint m_nbPreSmoothing;
+
+  /// number of smoothing steps after visiting the coarser level
+  CFuint m_nbPostSmoothing;
+
+  /// number of smoothing steps on the coarsest level
+  CFuint m_nbCoarsestSmoothing;
+
+  /// number of cycles starting from each coarse level at the beginning
+  CFuint m_nbFMGCycles;
+
+  /// coefficients of the stages of the smoother
+  std::vector<CFreal> m_alpha;
+
+  /// exponent of the ratio (P+1)/(p+1) multiplying the CFL on level of order p
+  CFreal m_cflExponent;
+
+}; // end of class FRPMultigridData
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Definition of a command for the polynomial multigrid
+typedef Framework::MethodCommand<FRPMultigridData> FRPMultigridCom;
+
+/// Definition of a command provider for the polynomial multigrid
+typedef Framework::MethodCommand<FRPMultigridData>::PROVIDER FRPMultigridComProvider;
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_FluxReconstructionMethod_FRPMultigridData_hh
@@ -0,0 +1,110 @@
+#include "Framework/MethodCommandProvider.hh"
+
+#include "FluxReconstructionMethod/FluxReconstruction.hh"
+#include "FluxReconstructionMethod/FRPMultigridProlong.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<FRPMultigridProlong, FRPMultigridData, FluxReconstructionModule>
+  frPMultigridProlongProvider("StdProlong");
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridProlong::FRPMultigridProlong(const std::string& name) :
+  FRPMultigridCom(name),
+  socket_states("states"),
+  m_correction(),
+  m_fineCorrection()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridProlong::~FRPMultigridProlong()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > FRPMultigridProlong::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_states);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridProlong::execute()
+{
+  CFAUTOTRACE;
+
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+
+  const CFuint level = getMethodData().getCurrentLevel();
+  const CFuint coarseLevel = level + 1;
+  cf_assert(coarseLevel < getMethodData().getNbLevels());
+
+  FRPMultigridTransfer& transfer = getMethodData().getTransfer();
+  vector<CFreal>& solution = (level == 0) ?
+    getMethodData().getFineSolution() : getMethodData().getSolution(level);
+  const vector<CFreal>& coarseSolution = getMethodData().getSolution(coarseLevel);
+
+  if (getMethodData().isFMGTransfer())
+  {
+    transfer.prolongFromLevel(coarseLevel, coarseSolution, solution);
+  }
+  else
+  {
+    // FAS correction: u_l += I(u_{l+1} - R u_l)
+    const vector<CFreal>& restrictedSolution = getMethodData().getRestrictedSolution(coarseLevel);
+    const CFuint nbCoarseValues = coarseSolution.size();
+    m_correction.resize(nbCoarseValues);
+    for (CFuint i = 0; i < nbCoarseValues; ++i)
+    {
+      m_correction[i] = coarseSolution[i] - restrictedSolution[i];
+    }
+
+    transfer.prolongFromLevel(coarseLevel, m_correction, m_fineCorrection);
+
+    const CFuint nbValues = solution.size();
+    for (CFuint i = 0; i < nbValues; ++i)
+    {
+      solution[i] += m_fineCorrection[i];
+    }
+  }
+
+  // the mesh states hold the interpolation of the corrected solution
+  if (level == 0)
+  {
+    transfer.scatterStates(solution, states);
+  }
+  else
+  {
+    vector<CFreal>& fineWork = getMethodData().getFineWork();
+    transfer.interpolateOnFinest(level, solution, fineWork);
+    transfer.scatterStates(fineWork, states);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,66 @@
+#ifndef COOLFluiD_FluxReconstructionMethod_FRPMultigridProlong_hh
+#define COOLFluiD_FluxReconstructionMethod_FRPMultigridProlong_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/State.hh"
+#include "Framework/Storage.hh"
+#include "FluxReconstructionMethod/FRPMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class corrects the solution of the current level of the polynomial
+ * multigrid with the next coarser one: the change of the coarse solution
+ * since its restriction is interpolated on the higher order and added to
+ * the solution of the current level. During the full multigrid start, the
+ * coarse solution itself is interpolated. The mesh states are then set to
+ * the interpolation of the corrected solution.
+ */
+class FRPMultigridProlong : public FRPMultigridCom {
+public:
+
+  /// Constructor.
+  explicit FRPMultigridProlong(const std::string& name);
+
+  /// Destructor.
+  ~FRPMultigridProlong();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+  /// Execute Processing actions
+  void execute();
+
+protected:
+
+  /// handle to states
+  Framework::DataSocketSink < Framework::State* , Framework::GLOBAL > socket_states;
+
+  /// change of the solution of the coarser level since its restriction
+  std::vector<CFreal> m_correction;
+
+  /// correction of the solution of the current level
+  std::vector<CFreal> m_fineCorrection;
+
+}; // class FRPMultigridProlong
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_FluxReconstructionMethod_FRPMultigridProlong_hh
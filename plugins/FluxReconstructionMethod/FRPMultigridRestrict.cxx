@@ -0,0 +1,114 @@
+#include "Framework/MethodCommandProvider.hh"
+
+#include "FluxReconstructionMethod/FluxReconstruction.hh"
+#include "FluxReconstructionMethod/FRPMultigridRestrict.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<FRPMultigridRestrict, FRPMultigridData, FluxReconstructionModule>
+  frPMultigridRestrictProvider("StdRestrict");
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridRestrict::FRPMultigridRestrict(const std::string& name) :
+  FRPMultigridCom(name),
+  socket_rhs("rhs"),
+  socket_updateCoeff("updateCoeff"),
+  socket_states("states")
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridRestrict::~FRPMultigridRestrict()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > FRPMultigridRestrict::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_rhs);
+  result.push_back(&socket_updateCoeff);
+  result.push_back(&socket_states);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridRestrict::execute()
+{
+  CFAUTOTRACE;
+
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle<CFreal> rhs         = socket_rhs        .getDataHandle();
+  DataHandle<CFreal> updateCoeff = socket_updateCoeff.getDataHandle();
+
+  const CFuint level = getMethodData().getCurrentLevel();
+  const CFuint coarseLevel = level + 1;
+  cf_assert(coarseLevel < getMethodData().getNbLevels());
+
+  FRPMultigridTransfer& transfer = getMethodData().getTransfer();
+
+  // the solution of the finest level is the one of the mesh states,
+  // which the coarse levels overwrite until the prolongation
+  vector<CFreal>* fineSolution = CFNULL;
+  if (level == 0)
+  {
+    transfer.gatherStates(states, getMethodData().getFineSolution());
+    fineSolution = &getMethodData().getFineSolution();
+  }
+  else
+  {
+    fineSolution = &getMethodData().getSolution(level);
+  }
+
+  vector<CFreal>& coarseSolution = getMethodData().getSolution(coarseLevel);
+  transfer.restrictToLevel(coarseLevel, *fineSolution, coarseSolution);
+  getMethodData().getRestrictedSolution(coarseLevel) = coarseSolution;
+
+  if (getMethodData().isFMGTransfer())
+  {
+    getMethodData().resetForcing(coarseLevel);
+  }
+  else
+  {
+    // the residual of this level, with its own forcing term, is restricted
+    // and gives the forcing term of the coarser level at its first residual
+    getMethodData().computeLevelResidual(level, rhs);
+    transfer.restrictToLevel(coarseLevel, getMethodData().getLevelResidual(level),
+                             getMethodData().getRestrictedResidual(coarseLevel));
+    getMethodData().setForcingFromRestriction(coarseLevel);
+  }
+
+  // the mesh states hold the interpolation of the solution of the coarser level
+  vector<CFreal>& fineWork = getMethodData().getFineWork();
+  transfer.interpolateOnFinest(coarseLevel, coarseSolution, fineWork);
+  transfer.scatterStates(fineWork, states);
+
+  // reset to 0 the update coefficient
+  updateCoeff = 0.0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,66 @@
+#ifndef COOLFluiD_FluxReconstructionMethod_FRPMultigridRestrict_hh
+#define COOLFluiD_FluxReconstructionMethod_FRPMultigridRestrict_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/State.hh"
+#include "Framework/Storage.hh"
+#include "FluxReconstructionMethod/FRPMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class transfers the problem of the current level of the polynomial
+ * multigrid to the next coarser one: the solution is projected on the lower
+ * order and the forcing term of the coarser level is computed from the
+ * residual of the current one, which must be in rhs for the current mesh
+ * states. During the full multigrid start, only the solution is transferred.
+ * The mesh states are then set to the interpolation of the coarse solution.
+ */
+class FRPMultigridRestrict : public FRPMultigridCom {
+public:
+
+  /// Constructor.
+  explicit FRPMultigridRestrict(const std::string& name);
+
+  /// Destructor.
+  ~FRPMultigridRestrict();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+  /// Execute Processing actions
+  void execute();
+
+protected:
+
+  /// socket for rhs
+  Framework::DataSocketSink<CFreal> socket_rhs;
+
+  /// socket for updateCoeff
+  Framework::DataSocketSink<CFreal> socket_updateCoeff;
+
+  /// handle to states
+  Framework::DataSocketSink < Framework::State* , Framework::GLOBAL > socket_states;
+
+}; // class FRPMultigridRestrict
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_FluxReconstructionMethod_FRPMultigridRestrict_hh
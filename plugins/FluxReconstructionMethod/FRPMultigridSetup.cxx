@@ -0,0 +1,115 @@
+#include "Common/BadValueException.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/PhysicalModel.hh"
+
+#include "FluxReconstructionMethod/FluxReconstruction.hh"
+#include "FluxReconstructionMethod/FRPMultigridSetup.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<FRPMultigridSetup, FRPMultigridData, FluxReconstructionModule>
+  frPMultigridSetupProvider("StdSetup");
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridSetup::FRPMultigridSetup(const std::string& name) :
+  FRPMultigridCom(name),
+  socket_rhs("rhs"),
+  socket_u0("u0"),
+  socket_updateCoeff("updateCoeff"),
+  socket_states("states")
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridSetup::~FRPMultigridSetup()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector<Common::SafePtr<BaseDataSocketSource> >
+FRPMultigridSetup::providesSockets()
+{
+  std::vector<Common::SafePtr<BaseDataSocketSource> > result;
+
+  result.push_back(&socket_rhs);
+  result.push_back(&socket_u0);
+  result.push_back(&socket_updateCoeff);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > FRPMultigridSetup::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_states);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridSetup::execute()
+{
+  CFAUTOTRACE;
+
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+
+  const CFuint nbStates = states.size();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+  rhs.resize(nbStates*nbEqs);
+  rhs = 0.0;
+
+  DataHandle<CFreal> u0 = socket_u0.getDataHandle();
+  u0.resize(nbStates*nbEqs);
+
+  DataHandle<CFreal> updateCoeff = socket_updateCoeff.getDataHandle();
+  updateCoeff.resize(nbStates);
+  updateCoeff = 0.0;
+
+  // the levels go from the order of the solution down to the coarsest order
+  SafePtr< vector<ElementTypeData> > elemType = MeshDataStack::getActive()->getElementTypeData();
+  cf_assert(elemType->size() > 0);
+  const CFuint solOrder = (*elemType)[0].getSolOrder();
+  for (CFuint iElemType = 1; iElemType < elemType->size(); ++iElemType)
+  {
+    if ((*elemType)[iElemType].getSolOrder() != solOrder)
+    {
+      throw BadValueException (FromHere(),"FRPMultigridSetup::execute() => all element types must have the same solution order");
+    }
+  }
+
+  getMethodData().setLevelOrders(solOrder);
+
+  CFLog(INFO, "FRPMultigridSetup::execute() => " << getMethodData().getNbLevels()
+        << " levels, from order " << getMethodData().getLevelOrder(0) << " to "
+        << getMethodData().getLevelOrder(getMethodData().getNbLevels()-1) << "\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
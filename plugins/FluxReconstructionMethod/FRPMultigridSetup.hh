@@ -0,0 +1,73 @@
+#ifndef COOLFluiD_FluxReconstructionMethod_FRPMultigridSetup_hh
+#define COOLFluiD_FluxReconstructionMethod_FRPMultigridSetup_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/DataSocketSource.hh"
+#include "Framework/State.hh"
+#include "Framework/Storage.hh"
+#include "FluxReconstructionMethod/FRPMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class sets up the polynomial multigrid method: it allocates the
+ * sockets and sets the orders of the levels.
+ */
+class FRPMultigridSetup : public FRPMultigridCom {
+public:
+
+  /// Constructor.
+  explicit FRPMultigridSetup(const std::string& name);
+
+  /// Destructor.
+  ~FRPMultigridSetup();
+
+  /**
+   * Returns the DataSocket's that this command provides as sources
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSource> > providesSockets();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  virtual std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+  /// Execute Processing actions
+  void execute();
+
+protected:
+
+  /// socket for rhs
+  Framework::DataSocketSource<CFreal> socket_rhs;
+
+  /// socket for the solution at the beginning of the smoothing step
+  Framework::DataSocketSource<CFreal> socket_u0;
+
+  /// socket for updateCoeff
+  /// denominators of the coefficients for the update
+  Framework::DataSocketSource<CFreal> socket_updateCoeff;
+
+  /// handle to states
+  Framework::DataSocketSink < Framework::State* , Framework::GLOBAL > socket_states;
+
+}; // class FRPMultigridSetup
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_FluxReconstructionMethod_FRPMultigridSetup_hh
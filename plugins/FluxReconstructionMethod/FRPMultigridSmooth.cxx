@@ -0,0 +1,181 @@
+#include "Common/CFLog.hh"
+#include "MathTools/MathChecks.hh"
+#include "Framework/CFL.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/PhysicalModel.hh"
+
+#include "FluxReconstructionMethod/FluxReconstruction.hh"
+#include "FluxReconstructionMethod/FRPMultigridSmooth.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::MathTools;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<FRPMultigridSmooth, FRPMultigridData, FluxReconstructionModule>
+  frPMultigridSmoothProvider("StdSmooth");
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridSmooth::FRPMultigridSmooth(const std::string& name) :
+  FRPMultigridCom(name),
+  socket_rhs("rhs"),
+  socket_u0("u0"),
+  socket_updateCoeff("updateCoeff"),
+  socket_states("states"),
+  m_cellDt()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridSmooth::~FRPMultigridSmooth()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > FRPMultigridSmooth::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_rhs);
+  result.push_back(&socket_u0);
+  result.push_back(&socket_updateCoeff);
+  result.push_back(&socket_states);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridSmooth::execute()
+{
+  CFAUTOTRACE;
+
+  if (getMethodData().getCurrentLevel() == 0)
+  {
+    smoothFinest();
+  }
+  else
+  {
+    smoothCoarse();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridSmooth::smoothFinest()
+{
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle<CFreal> u0          = socket_u0         .getDataHandle();
+  DataHandle<CFreal> rhs         = socket_rhs        .getDataHandle();
+  DataHandle<CFreal> updateCoeff = socket_updateCoeff.getDataHandle();
+
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFuint nbStates = states.size();
+
+  const CFuint stage = getMethodData().getCurrentStage();
+  const CFreal alpha = getMethodData().getAlpha(stage);
+  const CFreal cfl   = getMethodData().getCFL()->getCFLValue();
+
+  // store the solution at the beginning of the smoothing step
+  if (stage == 0)
+  {
+    for (CFuint i = 0; i < nbStates; ++i)
+    {
+      for (CFuint j = 0; j < nbEqs; ++j)
+      {
+        u0(i,j,nbEqs) = (*states[i])[j];
+      }
+    }
+  }
+
+  // local time stepping, rhs is left untouched for the residual norm
+  for (CFuint i = 0; i < nbStates; ++i)
+  {
+    if (states[i]->isParUpdatable())
+    {
+      const CFreal dt = MathChecks::isNotZero(updateCoeff[i]) ? cfl/updateCoeff[i] : 0.;
+      for (CFuint j = 0; j < nbEqs; ++j)
+      {
+        (*states[i])[j] = u0(i,j,nbEqs) + alpha*dt*rhs(i,j,nbEqs);
+      }
+
+      cf_assert(states[i]->isValid());
+    }
+
+    // reset to 0 the update coefficient
+    updateCoeff[i] = 0.0;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridSmooth::smoothCoarse()
+{
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle<CFreal> rhs         = socket_rhs        .getDataHandle();
+  DataHandle<CFreal> updateCoeff = socket_updateCoeff.getDataHandle();
+
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+
+  const CFuint level = getMethodData().getCurrentLevel();
+  const CFuint stage = getMethodData().getCurrentStage();
+  const CFreal alpha = getMethodData().getAlpha(stage);
+  const CFreal cfl   = getMethodData().getCFL()->getCFLValue()*getMethodData().getCFLFactor(level);
+
+  FRPMultigridTransfer& transfer = getMethodData().getTransfer();
+  vector<CFreal>& solution = getMethodData().getSolution(level);
+  vector<CFreal>& stageSolution = getMethodData().getStageSolution(level);
+
+  // store the solution at the beginning of the smoothing step
+  if (stage == 0)
+  {
+    stageSolution = solution;
+  }
+
+  // residual of the level, rhs is left untouched for the residual norm
+  getMethodData().computeLevelResidual(level, rhs);
+  const vector<CFreal>& residual = getMethodData().getLevelResidual(level);
+
+  transfer.computeCellTimeSteps(updateCoeff, cfl, m_cellDt);
+
+  const CFuint nbCells = transfer.getNbCells();
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell)
+  {
+    const CFreal coeff = alpha*m_cellDt[iCell];
+    const CFuint start = transfer.getCellPntOffset(level, iCell)*nbEqs;
+    const CFuint end   = start + transfer.getNbCellPnts(level, iCell)*nbEqs;
+    for (CFuint i = start; i < end; ++i)
+    {
+      solution[i] = stageSolution[i] + coeff*residual[i];
+    }
+  }
+
+  // the mesh states hold the interpolation of the solution of the level
+  vector<CFreal>& fineWork = getMethodData().getFineWork();
+  transfer.interpolateOnFinest(level, solution, fineWork);
+  transfer.scatterStates(fineWork, states);
+
+  // reset to 0 the update coefficient
+  updateCoeff = 0.0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
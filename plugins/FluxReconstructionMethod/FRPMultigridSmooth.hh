@@ -0,0 +1,84 @@
+#ifndef COOLFluiD_FluxReconstructionMethod_FRPMultigridSmooth_hh
+#define COOLFluiD_FluxReconstructionMethod_FRPMultigridSmooth_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/State.hh"
+#include "Framework/Storage.hh"
+#include "FluxReconstructionMethod/FRPMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class performs one stage of the Runge-Kutta smoother on the current
+ * level of the polynomial multigrid. On the finest level:
+ *   u = u0 + alpha*cfl/updateCoeff*rhs
+ * On the coarse level of order q, the residual of the mesh states, which
+ * hold the interpolation of the solution of the level, is projected on
+ * order q and the forcing term of the level is added:
+ *   u_q = u0_q + alpha*dt*(Pi_q(rhs) + P_q)
+ * with dt the smallest time step of the states of the cell, scaled by the
+ * CFL factor of the level. The mesh states are then set to the interpolation
+ * of the new solution of the level.
+ */
+class FRPMultigridSmooth : public FRPMultigridCom {
+public:
+
+  /// Constructor.
+  explicit FRPMultigridSmooth(const std::string& name);
+
+  /// Destructor.
+  ~FRPMultigridSmooth();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+  /// Execute Processing actions
+  void execute();
+
+protected:
+
+  /// Smooths the finest level
+  void smoothFinest();
+
+  /// Smooths the current coarse level
+  void smoothCoarse();
+
+protected:
+
+  /// socket for rhs
+  Framework::DataSocketSink<CFreal> socket_rhs;
+
+  /// socket for the solution at the beginning of the smoothing step
+  Framework::DataSocketSink<CFreal> socket_u0;
+
+  /// socket for updateCoeff
+  Framework::DataSocketSink<CFreal> socket_updateCoeff;
+
+  /// handle to states
+  Framework::DataSocketSink < Framework::State* , Framework::GLOBAL > socket_states;
+
+  /// local time step of each cell
+  std::vector<CFreal> m_cellDt;
+
+}; // class FRPMultigridSmooth
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_FluxReconstructionMethod_FRPMultigridSmooth_hh
@@ -0,0 +1,371 @@
+#include <memory>
+
+#include "Common/CFLog.hh"
+#include "Common/NotImplementedException.hh"
+#include "Common/StringOps.hh"
+#include "MathTools/MathChecks.hh"
+#include "MathTools/MatrixInverter.hh"
+#include "Framework/MeshData.hh"
+
+#include "FluxReconstructionMethod/FRPMultigridTransfer.hh"
+#include "FluxReconstructionMethod/FluxReconstructionElementData.hh"
+#include "FluxReconstructionMethod/QuadFluxReconstructionElementData.hh"
+#include "FluxReconstructionMethod/HexaFluxReconstructionElementData.hh"
+#include "FluxReconstructionMethod/TriagFluxReconstructionElementData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::MathTools;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridTransfer::FRPMultigridTransfer() :
+  m_nbLevels(0),
+  m_nbEqs(0),
+  m_cellTypes(),
+  m_cellPntOffsets(),
+  m_stateIDs(),
+  m_restrictions(),
+  m_prolongations(),
+  m_fromFinest(),
+  m_toFinest()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridTransfer::~FRPMultigridTransfer()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridTransfer::setup(SafePtr<FluxReconstructionSolverData> frData,
+                                 const vector<CFuint>& levelOrders,
+                                 const CFuint nbEqs)
+{
+  CFAUTOTRACE;
+
+  vector< FluxReconstructionElementData* >& frLocalData = frData->getFRLocalData();
+  SafePtr<TopologicalRegionSet> cells = MeshDataStack::getActive()->getTrs("InnerCells");
+  SafePtr< vector<ElementTypeData> > elemType = MeshDataStack::getActive()->getElementTypeData();
+
+  const CFuint nbLevels = levelOrders.size();
+  const CFuint nbElemTypes = elemType->size();
+  cf_assert(nbLevels > 0);
+  cf_assert(frLocalData.size() == nbElemTypes);
+
+  m_nbEqs = nbEqs;
+
+  // element data of the order of each level, the finest being the one of the solver
+  vector< vector< FluxReconstructionElementData* > > levelData(nbLevels);
+  levelData[0] = frLocalData;
+  for (CFuint iLevel = 1; iLevel < nbLevels; ++iLevel)
+  {
+    const CFPolyOrder::Type order = static_cast<CFPolyOrder::Type>(levelOrders[iLevel]);
+    levelData[iLevel].resize(nbElemTypes);
+    for (CFuint iElemType = 0; iElemType < nbElemTypes; ++iElemType)
+    {
+      switch(frLocalData[iElemType]->getShape())
+      {
+        case CFGeoShape::TRIAG:
+        {
+          levelData[iLevel][iElemType] = new TriagFluxReconstructionElementData(order,frData->getSolPntDistribution(),frData->getFluxPntDistribution());
+        } break;
+        case CFGeoShape::QUAD:
+        {
+          levelData[iLevel][iElemType] = new QuadFluxReconstructionElementData(order,frData->getSolPntDistribution(),frData->getFluxPntDistribution());
+        } break;
+        case CFGeoShape::HEXA:
+        {
+          levelData[iLevel][iElemType] = new HexaFluxReconstructionElementData(order,frData->getSolPntDistribution(),frData->getFluxPntDistribution());
+        } break;
+        default:
+        {
+          throw Common::NotImplementedException (FromHere(),"FRPMultigrid not implemented for elements of type "
+                                                 + StringOps::to_str(frLocalData[iElemType]->getShape()) + ".");
+        }
+      }
+    }
+  }
+
+  // transfer operators, per level and element type
+  m_restrictions .resize(nbLevels);
+  m_prolongations.resize(nbLevels);
+  m_fromFinest   .resize(nbLevels);
+  m_toFinest     .resize(nbLevels);
+  for (CFuint iLevel = 1; iLevel < nbLevels; ++iLevel)
+  {
+    m_restrictions [iLevel].resize(nbElemTypes);
+    m_prolongations[iLevel].resize(nbElemTypes);
+    m_fromFinest   [iLevel].resize(nbElemTypes);
+    m_toFinest     [iLevel].resize(nbElemTypes);
+    for (CFuint iElemType = 0; iElemType < nbElemTypes; ++iElemType)
+    {
+      computeInterpolation(levelData[iLevel][iElemType], levelData[iLevel-1][iElemType],
+                           m_prolongations[iLevel][iElemType]);
+      computeLeastSquares(m_prolongations[iLevel][iElemType], m_restrictions[iLevel][iElemType]);
+
+      computeInterpolation(levelData[iLevel][iElemType], levelData[0][iElemType],
+                           m_toFinest[iLevel][iElemType]);
+      computeLeastSquares(m_toFinest[iLevel][iElemType], m_fromFinest[iLevel][iElemType]);
+    }
+
+    CFLog(VERBOSE, "FRPMultigridTransfer::setup() => level " << iLevel
+          << " of order " << levelOrders[iLevel] << "\n");
+  }
+
+  // layout of the values of the levels
+  const CFuint nbCells = cells->getLocalNbGeoEnts();
+  m_cellTypes.resize(nbCells);
+  m_cellPntOffsets.assign(nbLevels, vector<CFuint>(nbCells+1, 0));
+  m_stateIDs.clear();
+  for (CFuint iElemType = 0; iElemType < nbElemTypes; ++iElemType)
+  {
+    const CFuint startIdx = (*elemType)[iElemType].getStartIdx();
+    const CFuint endIdx   = (*elemType)[iElemType].getEndIdx();
+    for (CFuint iCell = startIdx; iCell < endIdx; ++iCell)
+    {
+      m_cellTypes[iCell] = iElemType;
+
+      const CFuint nbSolPnts = cells->getNbStatesInGeo(iCell);
+      cf_assert(nbSolPnts == levelData[0][iElemType]->getNbrOfSolPnts());
+      for (CFuint iSol = 0; iSol < nbSolPnts; ++iSol)
+      {
+        m_stateIDs.push_back(cells->getStateID(iCell,iSol));
+      }
+    }
+  }
+
+  for (CFuint iLevel = 0; iLevel < nbLevels; ++iLevel)
+  {
+    vector<CFuint>& offsets = m_cellPntOffsets[iLevel];
+    for (CFuint iCell = 0; iCell < nbCells; ++iCell)
+    {
+      offsets[iCell+1] = offsets[iCell] + levelData[iLevel][m_cellTypes[iCell]]->getNbrOfSolPnts();
+    }
+  }
+  cf_assert(m_cellPntOffsets[0][nbCells] == m_stateIDs.size());
+
+  for (CFuint iLevel = 1; iLevel < nbLevels; ++iLevel)
+  {
+    for (CFuint iElemType = 0; iElemType < nbElemTypes; ++iElemType)
+    {
+      delete levelData[iLevel][iElemType];
+    }
+  }
+
+  m_nbLevels = nbLevels;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridTransfer::unsetup()
+{
+  m_nbLevels = 0;
+  m_cellTypes.clear();
+  m_cellPntOffsets.clear();
+  m_stateIDs.clear();
+  m_restrictions.clear();
+  m_prolongations.clear();
+  m_fromFinest.clear();
+  m_toFinest.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridTransfer::computeInterpolation(FluxReconstructionElementData* coarseData,
+                                                FluxReconstructionElementData* fineData,
+                                                RealMatrix& interp)
+{
+  const vector< vector< CFreal > > polyVals =
+    coarseData->getSolPolyValsAtNode(*fineData->getSolPntsLocalCoords());
+  const CFuint nbFineSolPnts = fineData->getNbrOfSolPnts();
+  const CFuint nbCoarseSolPnts = coarseData->getNbrOfSolPnts();
+  cf_assert(polyVals.size() == nbFineSolPnts);
+
+  interp.resize(nbFineSolPnts,nbCoarseSolPnts);
+  for (CFuint iSol = 0; iSol < nbFineSolPnts; ++iSol)
+  {
+    for (CFuint iPoly = 0; iPoly < nbCoarseSolPnts; ++iPoly)
+    {
+      interp(iSol,iPoly) = polyVals[iSol][iPoly];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridTransfer::computeLeastSquares(const RealMatrix& v, RealMatrix& proj)
+{
+  const CFuint nbFine = v.nbRows();
+  const CFuint nbCoarse = v.nbCols();
+
+  // V^T V
+  RealMatrix vtv(nbCoarse,nbCoarse,0.);
+  for (CFuint i = 0; i < nbCoarse; ++i)
+  {
+    for (CFuint j = 0; j < nbCoarse; ++j)
+    {
+      for (CFuint k = 0; k < nbFine; ++k)
+      {
+        vtv(i,j) += v(k,i)*v(k,j);
+      }
+    }
+  }
+
+  RealMatrix invVtv(nbCoarse,nbCoarse);
+  std::auto_ptr<MatrixInverter> inverter(MatrixInverter::create(nbCoarse,false));
+  inverter->invert(vtv,invVtv);
+
+  // (V^T V)^-1 V^T
+  proj.resize(nbCoarse,nbFine);
+  proj = 0.;
+  for (CFuint i = 0; i < nbCoarse; ++i)
+  {
+    for (CFuint k = 0; k < nbFine; ++k)
+    {
+      for (CFuint j = 0; j < nbCoarse; ++j)
+      {
+        proj(i,k) += invVtv(i,j)*v(k,j);
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridTransfer::apply(const vector<RealMatrix>& matrices,
+                                 const CFuint inLevel, const CFuint outLevel,
+                                 const vector<CFreal>& in, vector<CFreal>& out) const
+{
+  cf_assert(in.size() == getNbLevelValues(inLevel));
+  out.resize(getNbLevelValues(outLevel));
+
+  const vector<CFuint>& inOffsets  = m_cellPntOffsets[inLevel];
+  const vector<CFuint>& outOffsets = m_cellPntOffsets[outLevel];
+  const CFuint nbCells = m_cellTypes.size();
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell)
+  {
+    const RealMatrix& mat = matrices[m_cellTypes[iCell]];
+    const CFuint nbIn  = inOffsets [iCell+1] - inOffsets [iCell];
+    const CFuint nbOut = outOffsets[iCell+1] - outOffsets[iCell];
+    cf_assert(mat.nbRows() == nbOut);
+    cf_assert(mat.nbCols() == nbIn);
+
+    const CFreal* cellIn = &in [inOffsets [iCell]*m_nbEqs];
+    CFreal* cellOut      = &out[outOffsets[iCell]*m_nbEqs];
+    for (CFuint iOut = 0; iOut < nbOut; ++iOut)
+    {
+      CFreal* pntOut = &cellOut[iOut*m_nbEqs];
+      for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq)
+      {
+        pntOut[iEq] = 0.;
+      }
+
+      for (CFuint iIn = 0; iIn < nbIn; ++iIn)
+      {
+        const CFreal coeff = mat(iOut,iIn);
+        const CFreal* pntIn = &cellIn[iIn*m_nbEqs];
+        for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq)
+        {
+          pntOut[iEq] += coeff*pntIn[iEq];
+        }
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridTransfer::gather(const DataHandle<CFreal>& values,
+                                  vector<CFreal>& finest) const
+{
+  const CFuint nbPnts = m_stateIDs.size();
+  finest.resize(nbPnts*m_nbEqs);
+  for (CFuint iPnt = 0; iPnt < nbPnts; ++iPnt)
+  {
+    const CFuint stateID = m_stateIDs[iPnt];
+    for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq)
+    {
+      finest[iPnt*m_nbEqs+iEq] = values(stateID,iEq,m_nbEqs);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridTransfer::gatherStates(const DataHandle<State*,GLOBAL>& states,
+                                        vector<CFreal>& finest) const
+{
+  const CFuint nbPnts = m_stateIDs.size();
+  finest.resize(nbPnts*m_nbEqs);
+  for (CFuint iPnt = 0; iPnt < nbPnts; ++iPnt)
+  {
+    const State& state = *states[m_stateIDs[iPnt]];
+    for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq)
+    {
+      finest[iPnt*m_nbEqs+iEq] = state[iEq];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridTransfer::scatterStates(const vector<CFreal>& finest,
+                                         DataHandle<State*,GLOBAL>& states) const
+{
+  const CFuint nbPnts = m_stateIDs.size();
+  cf_assert(finest.size() == nbPnts*m_nbEqs);
+  for (CFuint iPnt = 0; iPnt < nbPnts; ++iPnt)
+  {
+    State& state = *states[m_stateIDs[iPnt]];
+    if (state.isParUpdatable())
+    {
+      for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq)
+      {
+        state[iEq] = finest[iPnt*m_nbEqs+iEq];
+      }
+
+      cf_assert(state.isValid());
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridTransfer::computeCellTimeSteps(const DataHandle<CFreal>& updateCoeff,
+                                                const CFreal cfl,
+                                                vector<CFreal>& cellDt) const
+{
+  const vector<CFuint>& offsets = m_cellPntOffsets[0];
+  const CFuint nbCells = m_cellTypes.size();
+  cellDt.resize(nbCells);
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell)
+  {
+    CFreal maxCoeff = 0.;
+    for (CFuint iPnt = offsets[iCell]; iPnt < offsets[iCell+1]; ++iPnt)
+    {
+      maxCoeff = std::max(maxCoeff, updateCoeff[m_stateIDs[iPnt]]);
+    }
+
+    cellDt[iCell] = MathChecks::isNotZero(maxCoeff) ? cfl/maxCoeff : 0.;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,190 @@
+#ifndef COOLFluiD_FluxReconstructionMethod_FRPMultigridTransfer_hh
+#define COOLFluiD_FluxReconstructionMethod_FRPMultigridTransfer_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataHandle.hh"
+#include "Framework/State.hh"
+#include "Framework/Storage.hh"
+#include "MathTools/RealMatrix.hh"
+#include "FluxReconstructionMethod/FluxReconstructionSolverData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class holds the transfer operators between the levels of the
+ * polynomial multigrid for Flux Reconstruction.
+ * The solution of the level of order q is stored, cell by cell, by its
+ * values at the solution points of the FR element of order q, with the
+ * same point distribution as the solution. The operators are built, for
+ * each element type, from the element data of the orders of the levels:
+ *  - the prolongation from level l to level l-1 evaluates the solution
+ *    polynomials of level l at the solution points of level l-1, which is
+ *    exact since the polynomials of order q_l are also of order q_{l-1};
+ *  - the restriction from level l-1 to level l is the least squares
+ *    projection (V^T V)^-1 V^T, with V the prolongation;
+ *  - the same pair of operators maps level l directly to and from the
+ *    finest level, on which the residual is computed.
+ * The values of a level are stored in a flat vector, cell after cell in
+ * the order of the cells of InnerCells, point after point and equation
+ * after equation. The finest level uses the same layout, the gather and
+ * scatter functions map it to the state ordering.
+ */
+class FRPMultigridTransfer {
+public:
+
+  /// Constructor
+  FRPMultigridTransfer();
+
+  /// Destructor
+  ~FRPMultigridTransfer();
+
+  /// Builds the operators of the given levels
+  /// @param frData       data of the Flux Reconstruction solver
+  /// @param levelOrders  polynomial orders of the levels, finest first
+  /// @param nbEqs        number of equations
+  void setup(Common::SafePtr<FluxReconstructionSolverData> frData,
+             const std::vector<CFuint>& levelOrders,
+             const CFuint nbEqs);
+
+  /// Releases the operators
+  void unsetup();
+
+  /// @return true if the operators have been built
+  bool isSetup() const
+  {
+    return m_nbLevels > 0;
+  }
+
+  /// @return the number of values of the given level
+  CFuint getNbLevelValues(CFuint level) const
+  {
+    cf_assert(level < m_cellPntOffsets.size());
+    return m_cellPntOffsets[level].back()*m_nbEqs;
+  }
+
+  /// @return the number of cells
+  CFuint getNbCells() const
+  {
+    return m_cellTypes.size();
+  }
+
+  /// @return the index of the first point of the given cell on the given level
+  CFuint getCellPntOffset(CFuint level, CFuint iCell) const
+  {
+    return m_cellPntOffsets[level][iCell];
+  }
+
+  /// @return the number of points of the given cell on the given level
+  CFuint getNbCellPnts(CFuint level, CFuint iCell) const
+  {
+    return m_cellPntOffsets[level][iCell+1] - m_cellPntOffsets[level][iCell];
+  }
+
+  /// Gathers a storage of nbEqs values per state in the layout of the finest level
+  void gather(const Framework::DataHandle<CFreal>& values,
+              std::vector<CFreal>& finest) const;
+
+  /// Gathers the states in the layout of the finest level
+  void gatherStates(const Framework::DataHandle<Framework::State*,Framework::GLOBAL>& states,
+                    std::vector<CFreal>& finest) const;
+
+  /// Copies values in the layout of the finest level to the updatable states
+  void scatterStates(const std::vector<CFreal>& finest,
+                     Framework::DataHandle<Framework::State*,Framework::GLOBAL>& states) const;
+
+  /// Restricts values of level-1 to the given level
+  void restrictToLevel(CFuint level, const std::vector<CFreal>& fine, std::vector<CFreal>& coarse) const
+  {
+    apply(m_restrictions[level], level-1, level, fine, coarse);
+  }
+
+  /// Prolongs values of the given level to level-1
+  void prolongFromLevel(CFuint level, const std::vector<CFreal>& coarse, std::vector<CFreal>& fine) const
+  {
+    apply(m_prolongations[level], level, level-1, coarse, fine);
+  }
+
+  /// Projects values of the finest level on the given level
+  void projectOnLevel(CFuint level, const std::vector<CFreal>& finest, std::vector<CFreal>& coarse) const
+  {
+    apply(m_fromFinest[level], 0, level, finest, coarse);
+  }
+
+  /// Interpolates values of the given level on the finest level
+  void interpolateOnFinest(CFuint level, const std::vector<CFreal>& coarse, std::vector<CFreal>& finest) const
+  {
+    apply(m_toFinest[level], level, 0, coarse, finest);
+  }
+
+  /// Computes the local time step of each cell, from the smallest one of its states
+  /// @param updateCoeff  denominators of the time steps of the states
+  /// @param cfl          CFL number
+  /// @param cellDt       time step of each cell, 0 if the cell has no update coefficient
+  void computeCellTimeSteps(const Framework::DataHandle<CFreal>& updateCoeff,
+                            const CFreal cfl,
+                            std::vector<CFreal>& cellDt) const;
+
+private: // helper functions
+
+  /// Applies, cell by cell and equation by equation, the matrix of the
+  /// element type of each cell
+  void apply(const std::vector<RealMatrix>& matrices,
+             const CFuint inLevel, const CFuint outLevel,
+             const std::vector<CFreal>& in, std::vector<CFreal>& out) const;
+
+  /// Computes the least squares projection (V^T V)^-1 V^T
+  static void computeLeastSquares(const RealMatrix& v, RealMatrix& proj);
+
+  /// Computes the values of the solution polynomials of coarseData at the
+  /// solution points of fineData
+  static void computeInterpolation(FluxReconstructionElementData* coarseData,
+                                   FluxReconstructionElementData* fineData,
+                                   RealMatrix& interp);
+
+private: // data
+
+  /// number of levels
+  CFuint m_nbLevels;
+
+  /// number of equations
+  CFuint m_nbEqs;
+
+  /// element type of each cell
+  std::vector<CFuint> m_cellTypes;
+
+  /// index of the first point of each cell per level (one more entry for the end)
+  std::vector< std::vector<CFuint> > m_cellPntOffsets;
+
+  /// ID of the state of each point of the finest level
+  std::vector<CFuint> m_stateIDs;
+
+  /// restrictions from level l-1 to level l, per level and element type
+  std::vector< std::vector<RealMatrix> > m_restrictions;
+
+  /// prolongations from level l to level l-1, per level and element type
+  std::vector< std::vector<RealMatrix> > m_prolongations;
+
+  /// projections from the finest level to level l, per level and element type
+  std::vector< std::vector<RealMatrix> > m_fromFinest;
+
+  /// interpolations from level l to the finest level, per level and element type
+  std::vector< std::vector<RealMatrix> > m_toFinest;
+
+}; // class FRPMultigridTransfer
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_FluxReconstructionMethod_FRPMultigridTransfer_hh
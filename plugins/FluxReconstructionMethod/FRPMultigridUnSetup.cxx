@@ -0,0 +1,70 @@
+#include "Framework/MethodCommandProvider.hh"
+
+#include "FluxReconstructionMethod/FluxReconstruction.hh"
+#include "FluxReconstructionMethod/FRPMultigridUnSetup.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<FRPMultigridUnSetup, FRPMultigridData, FluxReconstructionModule>
+  frPMultigridUnSetupProvider("StdUnSetup");
+
+//////////////////////////////////////////////////////////////////////////////
+
+FRPMultigridUnSetup::FRPMultigridUnSetup(const std::string& name) :
+  FRPMultigridCom(name),
+  socket_rhs("rhs"),
+  socket_u0("u0"),
+  socket_updateCoeff("updateCoeff")
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > FRPMultigridUnSetup::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_rhs);
+  result.push_back(&socket_u0);
+  result.push_back(&socket_updateCoeff);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FRPMultigridUnSetup::execute()
+{
+  CFAUTOTRACE;
+
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+  rhs.resize(0);
+
+  DataHandle<CFreal> u0 = socket_u0.getDataHandle();
+  u0.resize(0);
+
+  DataHandle<CFreal> updateCoeff = socket_updateCoeff.getDataHandle();
+  updateCoeff.resize(0);
+
+  getMethodData().unsetupLevels();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,61 @@
+#ifndef COOLFluiD_FluxReconstructionMethod_FRPMultigridUnSetup_hh
+#define COOLFluiD_FluxReconstructionMethod_FRPMultigridUnSetup_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "FluxReconstructionMethod/FRPMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace FluxReconstructionMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class deallocates the sockets of the polynomial multigrid method.
+ */
+class FRPMultigridUnSetup : public FRPMultigridCom {
+public:
+
+  /// Constructor.
+  explicit FRPMultigridUnSetup(const std::string& name);
+
+  /// Destructor.
+  ~FRPMultigridUnSetup()
+  {
+  }
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+  /// Execute Processing actions
+  void execute();
+
+protected:
+
+  /// socket for rhs
+  Framework::DataSocketSink<CFreal> socket_rhs;
+
+  /// socket for the solution at the beginning of the smoothing step
+  Framework::DataSocketSink<CFreal> socket_u0;
+
+  /// socket for updateCoeff
+  Framework::DataSocketSink<CFreal> socket_updateCoeff;
+
+}; // class FRPMultigridUnSetup
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace FluxReconstructionMethod
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_FluxReconstructionMethod_FRPMultigridUnSetup_hh
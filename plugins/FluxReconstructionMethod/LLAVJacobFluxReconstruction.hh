@@ -15,6 +15,8 @@
 
 #include "FluxReconstructionMethod/DiffRHSJacobFluxReconstruction.hh"
 
+#include "FluxReconstructionMethod/BlockModalFilter.hh"
+
 //////////////////////////////////////////////////////////////////////////////
 
 namespace COOLFluiD {
@@ -108,6 +110,19 @@ protected: //functions
    */
   virtual void computeEpsilon();
   
+  /**
+   * Check whether the smoothness of an element is not recomputed in this
+   * iteration, the element having been smooth for SmoothSkipIter iterations.
+   * The socket smoothness of a frozen element is not written, so it keeps
+   * the value of the last evaluation, below S0 - Kappa, for at most
+   * SmoothSkipIter - 1 iterations.
+   */
+  bool isSensorFrozen(const CFuint elemIdx) const
+  {
+    return m_smoothSkipIter > 0 && m_nbSmoothIter[elemIdx] >= m_smoothSkipIter &&
+           m_nbSmoothIter[elemIdx]%m_smoothSkipIter != 0;
+  }
+  
   /**
    * Compute the reference artificial viscosity
    */
@@ -160,6 +175,18 @@ protected: //data
   /// transformation matrices to order P-1
   RealMatrix m_transformationMatrix;
   
+  /// projection on order P-1 of the states of a block of elements
+  BlockModalFilter m_blockProjection;
+  
+  /// number of elements per block for the projection on order P-1
+  CFuint m_sensorBlockSize;
+  
+  /// number of smooth iterations after which the smoothness of an element is only recomputed every so many iterations
+  CFuint m_smoothSkipIter;
+  
+  /// number of consecutive iterations during which each element has been smooth
+  std::vector< CFuint > m_nbSmoothIter;
+  
   /// states projected on P-1
   std::vector< RealVector > m_statesPMinOne;
   
@@ -17,6 +17,8 @@
 #include "Environment/FileHandlerInput.hh"
 #include "Environment/FileHandlerOutput.hh"
 #include "Common/CFMap.hh"
+#include "Environment/CFEnv.hh"
+#include "Framework/CFGeoEnt.hh"
 #include "Gmsh2CFmesh/Gmsh2CFmeshConverter.hh"
 #include "Gmsh2CFmesh/Gmsh2CFmesh.hh"
 
@@ -44,6 +46,13 @@ gmsh2CFmeshConverterProvider("Gmsh2CFmesh");
 
 //////////////////////////////////////////////////////////////////////////////
 
+void Gmsh2CFmeshConverter::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< bool >("BinaryOutput","Write the CFmesh file in the binary format read by ParReadCFmeshBinary.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 Gmsh2CFmeshConverter::Gmsh2CFmeshConverter (const std::string& name)
 : MeshFormatConverter(name),
   _fileFormatVersion(0),
@@ -65,8 +74,16 @@ Gmsh2CFmeshConverter::Gmsh2CFmeshConverter (const std::string& name)
   _nodesPerElemTypeTable(31),
   _orderPerElemTypeTable(31),
   _dimPerElemTypeTable(31),
-  _mapNodeIdxPerElemTypeTable(31)
+  _mapNodeIdxPerElemTypeTable(31),
+  m_faceCells(),
+  m_faceNodes(),
+  m_cellNodes()
 {
+  addConfigOptionsTo(this);
+
+  m_binaryOutput = false;
+  setParameter("BinaryOutput",&m_binaryOutput);
+
   // Build the nbNodes per ElemTypeTable
   _nodesPerElemTypeTable[0]  = 2;  // line
   _nodesPerElemTypeTable[1]  = 3;  // triangle
@@ -1515,12 +1532,6 @@ void Gmsh2CFmeshConverter::writeDiscontinuousTrsData(ofstream& fout)
       fout << "!GEOM_TYPE Face" << "\n";
       fout << "!LIST_GEOM_ENT" << "\n";
 
-      // Vector holding element numbers for cell lookup
-      vector<CFuint> elemens;
-      /// Vector holding the nodes we care about
-      vector<CFuint> trNodes;
-      vector<CFuint> eleNodes;
-
       for (CFuint iTR = 0; iTR < nbTRsInTRS; ++iTR)
       {
 
@@ -1530,148 +1541,492 @@ void Gmsh2CFmeshConverter::writeDiscontinuousTrsData(ofstream& fout)
 
          for (CFuint iFace = 0; iFace < nbFacesInPatch; ++iFace)
          {
-            const CFuint nbNodesPerFace = _patch[curPatch].getFaceData()[iFace].getNbNodesInFace();
+            const valarray<CFuint>& faceNodes = _patch[curPatch].getFaceData()[iFace].getFaceNodes();
+            const CFuint nbNodesPerFace = faceNodes.size();
             const CFuint nbStatesPerFace = 1;
             fout << nbNodesPerFace << " " << nbStatesPerFace << " ";
 
-            elemens.clear();
-            /// Find the corresponding cell ID
-            typedef CFMultiMap<CFuint,CFuint>::MapIterator Iter;
-            pair<Iter,Iter> res;
-
-            trNodes.clear();
-
             for (CFuint iNode = 0; iNode < nbNodesPerFace; ++iNode)
             {
-               const CFuint nodeid = _patch[curPatch].getFaceData()[iFace].getFaceNodes()[iNode];
                /// @note the mapping between node local indexes in COOLFluiD and Gmsh is not used here,
                /// the face type is not immediately available. Should be okay, since the numbering of the nodes
                /// is the same for 1D and 2D elements in COOLFluiD and Gmsh
-               fout << nodeid << " " ;
+               fout << faceNodes[iNode] << " " ;
+            }
 
-               trNodes.push_back(nodeid);
+            fout << findFaceCellID(iTRS, iTR, iFace, faceNodes) << "\n";
 
-               // Store all the elements that contain this node in elemns
-               bool fo = false;
-	       res = m_nodeElement.find(nodeid, fo);
-	       if (!fo) cout << "Gambit2CFmesh::writeDiscontinuousTrsData() => node " << nodeid  << " not found!\n";
-	       for (Iter i = res.first; i != res.second; ++i) {
-		 elemens.push_back(i->second);
-               }
-	       
-            }
-	    
-            // Sort elemns
-            sort(elemens.begin(), elemens.end());
+            fout.flush ();
+         }
+      }
+   }
+}
 
-            // sort nodes
-            sort(trNodes.begin(), trNodes.end());
+//////////////////////////////////////////////////////////////////////////////
 
-            // Find an element that contains all our nodes
-            CFuint count = 0;
-            CFuint last = elemens.front();
-            for (CFuint i = 0; i < elemens.size() && count != nbNodesPerFace; ++i)
-            {
-               if (elemens[i] == last)
-               {
-                ++count;
-                continue;
-               }
-               // New type
-               count=1;
-               last = elemens[i];
-            }
+CFuint Gmsh2CFmeshConverter::findFaceCellID(const CFuint iTRS,
+                                            const CFuint iTR,
+                                            const CFuint iFace,
+                                            const valarray<CFuint>& faceNodes)
+{
+   const CFuint nbNodesPerFace = faceNodes.size();
+
+   // Vector holding element numbers for cell lookup
+   vector<CFuint>& elemens = m_faceCells;
+   /// Vector holding the nodes we care about
+   vector<CFuint>& trNodes = m_faceNodes;
+   vector<CFuint>& eleNodes = m_cellNodes;
+
+   elemens.clear();
+   /// Find the corresponding cell ID
+   typedef CFMultiMap<CFuint,CFuint>::MapIterator Iter;
+   pair<Iter,Iter> res;
+
+   trNodes.clear();
+
+   for (CFuint iNode = 0; iNode < nbNodesPerFace; ++iNode)
+   {
+      const CFuint nodeid = faceNodes[iNode];
+
+      trNodes.push_back(nodeid);
+
+      // Store all the elements that contain this node in elemns
+      bool fo = false;
+      res = m_nodeElement.find(nodeid, fo);
+      if (!fo) cout << "Gambit2CFmesh::writeDiscontinuousTrsData() => node " << nodeid  << " not found!\n";
+      for (Iter i = res.first; i != res.second; ++i) {
+        elemens.push_back(i->second);
+      }
+
+   }
+
+   // Sort elemns
+   sort(elemens.begin(), elemens.end());
 
-            cf_assert (count <= nbNodesPerFace);
+   // sort nodes
+   sort(trNodes.begin(), trNodes.end());
+
+   // Find an element that contains all our nodes
+   CFuint count = 0;
+   CFuint last = elemens.front();
+   for (CFuint i = 0; i < elemens.size() && count != nbNodesPerFace; ++i)
+   {
+      if (elemens[i] == last)
+      {
+       ++count;
+       continue;
+      }
+      // New type
+      count=1;
+      last = elemens[i];
+   }
+
+   cf_assert (count <= nbNodesPerFace);
 
 #ifdef NDEBUG
-            // Double check the algorithm above
-            vector<CFuint> uniq_ele (elemens);
-            uniq_ele.erase(std::unique(uniq_ele.begin(), uniq_ele.end()),
-                  uniq_ele.end());
-            for (CFuint i=0; i<uniq_ele.size(); ++i)
-            {
-              CFuint mycount = std::count (elemens.begin(), elemens.end(), uniq_ele[i]);
-
-               if (mycount >= nbNodesPerFace)
-               {
-                  if (count != nbNodesPerFace)
-                  {
-                     cerr << "For " << iTRS << "," << iTR << "," << iFace <<
-                        ": count=" << count << ", mycount=" << mycount <<
-                        ", nbNodesPerFace=" << nbNodesPerFace << endl;
-                  }
-               }
-            }
+   // Double check the algorithm above
+   vector<CFuint> uniq_ele (elemens);
+   uniq_ele.erase(std::unique(uniq_ele.begin(), uniq_ele.end()),
+         uniq_ele.end());
+   for (CFuint i=0; i<uniq_ele.size(); ++i)
+   {
+     CFuint mycount = std::count (elemens.begin(), elemens.end(), uniq_ele[i]);
+
+      if (mycount >= nbNodesPerFace)
+      {
+         if (count != nbNodesPerFace)
+         {
+            cerr << "For " << iTRS << "," << iTR << "," << iFace <<
+               ": count=" << count << ", mycount=" << mycount <<
+               ", nbNodesPerFace=" << nbNodesPerFace << endl;
+         }
+      }
+   }
 
 #endif
-            if (count != nbNodesPerFace)
-               cerr << "No match found for " << iTRS << "," << iTR << ","
-                  << iFace << " (count=" << count << ", nbNodesPerFace="
-                  << nbNodesPerFace << ")" << endl;
+   if (count != nbNodesPerFace)
+      cerr << "No match found for " << iTRS << "," << iTR << ","
+         << iFace << " (count=" << count << ", nbNodesPerFace="
+         << nbNodesPerFace << ")" << endl;
+
+   // Verify that the element contains the state & nodes
+
+   // Find element type
+   CFuint eletype = getNbElementTypes();
+   CFuint inCell = static_cast<CFuint>(-1);
+   for (CFint e = getNbElementTypes()-1; e >= 0; --e)
+   {
+      if (last >= _elementType[e].getCellStartIDX ())
+      {
+         eletype = e;
+         inCell = last - _elementType[e].getCellStartIDX();
+         break;
+      }
+   }
 
-            fout << last << "\n";
+   cf_assert (eletype < getNbElementTypes());
+   cf_assert (inCell < _elementType[eletype].getNbCellsPerType());
 
-            // Verify that the element contains the state & nodes
+   const CFuint nbNodes =
+      _elementType[eletype].getNbNodesPerCell();
 
-            // Find element type
-            CFuint eletype = getNbElementTypes();
-            CFuint inCell = static_cast<CFuint>(-1);
-            for (CFint e = getNbElementTypes()-1; e >= 0; --e)
-            {
-               if (last >= _elementType[e].getCellStartIDX ())
-               {
-                  eletype = e;
-                  inCell = last - _elementType[e].getCellStartIDX();
-                  break;
-               }
-            }
+   eleNodes.clear();
+   for (CFuint i = 0; i < nbNodes; ++i)
+      eleNodes.push_back
+         (_elementType[eletype].getTableConnectivity()(inCell,i));
 
-            cf_assert (eletype < getNbElementTypes());
-            cf_assert (inCell < _elementType[eletype].getNbCellsPerType());
+   sort(eleNodes.begin(), eleNodes.end());
 
-            const CFuint nbNodes =
-               _elementType[eletype].getNbNodesPerCell();
+   const bool error = (!includes(eleNodes.begin(), eleNodes.end(),
+                           trNodes.begin(), trNodes.end()));
 
-            eleNodes.clear();
-            for (CFuint i = 0; i < nbNodes; ++i)
-               eleNodes.push_back
-                  (_elementType[eletype].getTableConnectivity()(inCell,i));
+   if (error)
+   {
+      cerr << "Error in TR state matching:\n"
+         << "Selected TRS,TR,GEO: " << iTRS << "," << iTR << ","
+         << iFace << "\n";
+      cerr << "Matched element: (and state)" << last <<
+         ", type=" << eletype << "\n";
+      cerr << "Geo nodes: ";
+      for (CFuint i = 0; i < trNodes.size(); ++i)
+         cerr << trNodes[i] << " ";
+      cerr << endl;
+      cerr << "Element nodes: ";
+      for (CFuint i = 0; i<eleNodes.size(); ++i)
+         cerr << eleNodes[i] << " ";
+      cerr << endl;
+      cerr << "Possible elements: ";
+      for (CFuint i=0; i<elemens.size(); ++i)
+         cerr << elemens[i] << " ";
+
+      cerr << endl;
+      cerr << endl;
 
-            sort(eleNodes.begin(), eleNodes.end());
 
-            const bool error = (!includes(eleNodes.begin(), eleNodes.end(),
-                                    trNodes.begin(), trNodes.end()));
+   }
 
-            if (error)
-            {
-               cerr << "Error in TR state matching:\n"
-                  << "Selected TRS,TR,GEO: " << iTRS << "," << iTR << ","
-                  << iFace << "\n";
-               cerr << "Matched element: (and state)" << last <<
-                  ", type=" << eletype << "\n";
-               cerr << "Geo nodes: ";
-               for (CFuint i = 0; i < trNodes.size(); ++i)
-                  cerr << trNodes[i] << " ";
-               cerr << endl;
-               cerr << "Element nodes: ";
-               for (CFuint i = 0; i<eleNodes.size(); ++i)
-                  cerr << eleNodes[i] << " ";
-               cerr << endl;
-               cerr << "Possible elements: ";
-               for (CFuint i=0; i<elemens.size(); ++i)
-                  cerr << elemens[i] << " ";
-
-               cerr << endl;
-               cerr << endl;
+   return last;
+}
 
+//////////////////////////////////////////////////////////////////////////////
 
-            }
+void Gmsh2CFmeshConverter::convert(const boost::filesystem::path& fromFilepath,
+                                   const boost::filesystem::path& filepath)
+{
+  CFAUTOTRACE;
 
-            fout.flush ();
-         }
+  if (!m_binaryOutput) {
+    MeshFormatConverter::convert(fromFilepath, filepath);
+    return;
+  }
+
+  Stopwatch<WallTime> stp;
+  stp.start();
+
+  // only reads if not yet been read
+  readFiles(fromFilepath);
+
+  stp.stop();
+  CFLog(INFO, "Reading " << getName() << " took: " << stp.read() << "s\n");
+
+  stp.start();
+  adjustToCFmeshNodeNumbering();
+
+  writeBinaryFile(filepath);
+
+  stp.stop();
+  CFLog(INFO, "Conversion " << getName() << " to binary CFmesh took: " << stp.read() << "s\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Gmsh2CFmeshConverter::writeBinaryFile(const boost::filesystem::path& filepath)
+{
+  CFAUTOTRACE;
+
+  SelfRegistPtr<Environment::FileHandlerOutput>* fhandle =
+    Environment::SingleBehaviorFactory<Environment::FileHandlerOutput>::getInstance().createPtr();
+  ofstream& fout = (*fhandle)->open(filepath, ios_base::out | ios_base::binary);
+
+  // same layout as the one written by ParCFmeshBinaryFileWriter:
+  // keys padded to 30 characters followed by raw values
+  writeBinaryKey(fout, "!COOLFLUID_VERSION ");
+  writeBinaryKey(fout, Environment::CFEnv::getInstance().getCFVersion());
+  writeBinaryKey(fout, "\n!CFMESH_FORMAT_VERSION ");
+  writeBinaryKey(fout, "1.3");
+
+  writeBinaryKey(fout, "\n!NB_DIM ");
+  writeBinaryValue(fout, getDimension());
+
+  CFuint nbVariables = getNbVariables();
+  if (nbVariables == 0) {
+    nbVariables = PhysicalModelStack::getActive()->getNbEq();
+  }
+  writeBinaryKey(fout, "\n!NB_EQ ");
+  writeBinaryValue(fout, nbVariables);
+
+  writeBinaryElements(fout);
+  writeBinaryTrsData(fout);
+  writeBinaryNodes(fout);
+  writeBinaryStates(fout);
+
+  writeBinaryKey(fout, "\n!END");
+
+  (*fhandle)->close();
+  delete fhandle;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Gmsh2CFmeshConverter::writeBinaryElements(ofstream& fout)
+{
+  CFAUTOTRACE;
+
+  const bool isFVMCC = isDiscontinuous();
+
+  /// @todo fix this for parallel mesh reading
+  const CFuint nbNotUpdatableNodes  = 0;
+  const CFuint nbNotUpdatableStates = 0;
+
+  writeBinaryKey(fout, "\n!NB_NODES ");
+  writeBinaryValue(fout, _nbUpdatableNodes);
+  writeBinaryValue(fout, nbNotUpdatableNodes);
+
+  writeBinaryKey(fout, "\n!NB_STATES ");
+  writeBinaryValue(fout, (isFVMCC) ? _nbCells : _nbUpdatableStates);
+  writeBinaryValue(fout, nbNotUpdatableStates);
+
+  writeBinaryKey(fout, "\n!NB_ELEM ");
+  writeBinaryValue(fout, _nbCells);
+
+  const CFuint nbElementTypes = getNbElementTypes();
+  writeBinaryKey(fout, "\n!NB_ELEM_TYPES ");
+  writeBinaryValue(fout, nbElementTypes);
+
+  // CFPolyOrder::ORDER0 can only be set if here we know that we are dealing
+  // with CellCenterFEM
+  const CFuint solOrder = (isFVMCC) ? static_cast<CFuint>(CFPolyOrder::ORDER0) : _order;
+  writeBinaryKey(fout, "\n!GEOM_POLYORDER ");
+  writeBinaryValue(fout, _order);
+  writeBinaryKey(fout, "\n!SOL_POLYORDER ");
+  writeBinaryValue(fout, solOrder);
+
+  writeBinaryKey(fout, "\n!ELEM_TYPES ");
+  for (CFuint k = 0; k < nbElementTypes; ++k) {
+    writeBinaryKey(fout, MapGeoEnt::identifyGeoEnt(_elementType[k].getNbNodesPerCell(),
+                                                   _elementType[k].getOrderPerCell(),
+                                                   _dimension) + " ");
+  }
+
+  writeBinaryKey(fout, "\n!NB_ELEM_PER_TYPE ");
+  for (CFuint k = 0; k < nbElementTypes; ++k) {
+    writeBinaryValue(fout, _elementType[k].getNbCellsPerType());
+  }
+
+  writeBinaryKey(fout, "\n!NB_NODES_PER_TYPE ");
+  for (CFuint k = 0; k < nbElementTypes; ++k) {
+    writeBinaryValue(fout, _elementType[k].getNbNodesPerCell());
+  }
+
+  writeBinaryKey(fout, "\n!NB_STATES_PER_TYPE ");
+  for (CFuint k = 0; k < nbElementTypes; ++k) {
+    writeBinaryValue(fout, (isFVMCC) ? 1 : _elementType[k].getNbNodesPerCell());
+  }
+
+  writeBinaryKey(fout, "\n!LIST_ELEM");
+  writeBinaryKey(fout, "\n");
+
+  vector<CFuint> elemData;
+  CFuint countElem = 0;
+  for (CFuint k = 0; k < nbElementTypes; ++k) {
+    const CFuint nbCellsPerType  = _elementType[k].getNbCellsPerType();
+    const CFuint nbNodesPerCell  = _elementType[k].getNbNodesPerCell();
+    const CFuint nbStatesPerCell = (isFVMCC) ? 1 : nbNodesPerCell;
+    const CFuint typeID          = _elementType[k].getTypeID();
+    elemData.resize(nbNodesPerCell + nbStatesPerCell);
+
+    // For use in the TRS
+    _elementType[k].setCellStartIDX (countElem);
+
+    for (CFuint i = 0; i < nbCellsPerType; ++i, ++countElem) {
+      for (CFuint j = 0; j < nbNodesPerCell; ++j) {
+        const CFuint elemIdx = _mapNodeIdxPerElemTypeTable[typeID][j];
+        const CFuint nodeid = _elementType[k].getTableConnectivity()(i,elemIdx);
+        elemData[j] = nodeid;
+        if (isFVMCC) {
+          m_nodeElement.insert(nodeid, countElem);
+        }
+        else {
+          elemData[nbNodesPerCell + j] = nodeid;
+        }
       }
-   }
+      if (isFVMCC) {
+        elemData[nbNodesPerCell] = countElem; // cellID == stateID
+      }
+      writeBinaryValues(fout, &elemData[0], elemData.size());
+    }
+  }
+
+  if (isFVMCC) {
+    // sort map
+    m_nodeElement.sortKeys();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Gmsh2CFmeshConverter::writeBinaryTrsData(ofstream& fout)
+{
+  CFAUTOTRACE;
+
+  const bool isFVMCC = isDiscontinuous();
+
+  typedef map< CFuint, CFuint, less<CFuint> > MapCodeNbPatch;
+  MapCodeNbPatch mapCP;
+
+  for (CFuint iPatch = 0; iPatch < _nbPatches; ++iPatch) {
+    const CFuint codeP = _patch[iPatch].getPatchCode();
+    mapCP[codeP] = iPatch;
+  }
+
+  writeBinaryKey(fout, "\n!NB_TRSs ");
+  writeBinaryValue(fout, getNbSuperPatches());
+
+  //only boundary TRS are listed !!!
+  vector<CFuint> nbNodesStatesInTRGeo;
+  vector<CFint> geoData;
+  for (CFuint iTRS = 0; iTRS < getNbSuperPatches(); ++iTRS) {
+    const CFuint nbTRsInTRS = _superPatch[iTRS].getNbPatchesInSuperPatch();
+
+    writeBinaryKey(fout, "\n!TRS_NAME ");
+    writeBinaryKey(fout, _superPatch[iTRS].getSuperPatchName());
+
+    writeBinaryKey(fout, "\n!NB_TRs ");
+    writeBinaryValue(fout, nbTRsInTRS);
+
+    writeBinaryKey(fout, "\n!NB_GEOM_ENTS ");
+    for (CFuint iTR = 0; iTR < nbTRsInTRS; ++iTR) {
+      const CFuint patchID = _superPatch[iTRS].getPatchIDs()[iTR];
+      const CFuint curPatch = mapCP.find(patchID)->second;
+      writeBinaryValue(fout, _patch[curPatch].getNbFacesInPatch());
+    }
+
+    writeBinaryKey(fout, "\n!GEOM_TYPE ");
+    writeBinaryKey(fout, CFGeoEnt::Convert::to_str(CFGeoEnt::FACE));
+
+    // the binary format needs the maximum number of nodes and states
+    // in the faces of each TR, the lists being padded with -1
+    nbNodesStatesInTRGeo.assign(2*nbTRsInTRS, 0);
+    for (CFuint iTR = 0; iTR < nbTRsInTRS; ++iTR) {
+      const CFuint patchID = _superPatch[iTRS].getPatchIDs()[iTR];
+      const CFuint curPatch = mapCP.find(patchID)->second;
+      const CFuint nbFacesInPatch = _patch[curPatch].getNbFacesInPatch();
+
+      CFuint maxNbNodesInTRGeo = 0;
+      for (CFuint iFace = 0; iFace < nbFacesInPatch; ++iFace) {
+        maxNbNodesInTRGeo = max(maxNbNodesInTRGeo,
+                                _patch[curPatch].getFaceData()[iFace].getNbNodesInFace());
+      }
+      nbNodesStatesInTRGeo[2*iTR]   = maxNbNodesInTRGeo;
+      nbNodesStatesInTRGeo[2*iTR+1] = (isFVMCC) ? 1 : maxNbNodesInTRGeo;
+    }
+
+    writeBinaryKey(fout, "\n!LIST_GEOM_ENT ");
+    writeBinaryValues(fout, &nbNodesStatesInTRGeo[0], nbNodesStatesInTRGeo.size());
+    writeBinaryKey(fout, "\n");
+
+    for (CFuint iTR = 0; iTR < nbTRsInTRS; ++iTR) {
+      const CFuint patchID = _superPatch[iTRS].getPatchIDs()[iTR];
+      const CFuint curPatch = mapCP.find(patchID)->second;
+      const CFuint nbFacesInPatch = _patch[curPatch].getNbFacesInPatch();
+      const CFuint maxNbNodesInTRGeo = nbNodesStatesInTRGeo[2*iTR];
+      const CFuint maxNbStatesInTRGeo = nbNodesStatesInTRGeo[2*iTR+1];
+
+      for (CFuint iFace = 0; iFace < nbFacesInPatch; ++iFace) {
+        const valarray<CFuint>& faceNodes = _patch[curPatch].getFaceData()[iFace].getFaceNodes();
+        const CFuint nbNodesPerFace = faceNodes.size();
+        const CFuint nbStatesPerFace = (isFVMCC) ? 1 : nbNodesPerFace;
+
+        geoData.assign(2 + maxNbNodesInTRGeo + maxNbStatesInTRGeo, -1);
+        geoData[0] = nbNodesPerFace;
+        geoData[1] = nbStatesPerFace;
+        for (CFuint iNode = 0; iNode < nbNodesPerFace; ++iNode) {
+          geoData[2 + iNode] = faceNodes[iNode];
+        }
+
+        if (isFVMCC) {
+          geoData[2 + maxNbNodesInTRGeo] = findFaceCellID(iTRS, iTR, iFace, faceNodes);
+        }
+        else {
+          for (CFuint iState = 0; iState < nbStatesPerFace; ++iState) {
+            geoData[2 + maxNbNodesInTRGeo + iState] = faceNodes[iState];
+          }
+        }
+        writeBinaryValues(fout, &geoData[0], geoData.size());
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Gmsh2CFmeshConverter::writeBinaryNodes(ofstream& fout)
+{
+  CFAUTOTRACE;
+
+  writeBinaryKey(fout, "\n!LIST_NODE");
+  writeBinaryKey(fout, "\n");
+
+  vector<CFreal> node(_dimension);
+  for (CFuint k = 0; k < _nbUpdatableNodes; ++k) {
+    for (CFuint j = 0; j < _dimension; ++j) {
+      node[j] = (*_coordinate)(k,j);
+    }
+    writeBinaryValues(fout, &node[0], node.size());
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Gmsh2CFmeshConverter::writeBinaryStates(ofstream& fout)
+{
+  CFAUTOTRACE;
+
+  writeBinaryKey(fout, "\n!LIST_STATE ");
+  writeBinaryValue(fout, static_cast<CFuint>(_isWithSolution));
+  writeBinaryKey(fout, "\n");
+
+  if (!_isWithSolution) return;
+
+  if (!isDiscontinuous()) {
+    for (CFuint k = 0; k < _variables->nbRows(); ++k) {
+      const vector<CFreal>& nodalState = _variables->getRow(k);
+      writeBinaryValues(fout, &nodalState[0], nodalState.size());
+    }
+    return;
+  }
+
+  const CFuint nbVariables = PhysicalModelStack::getActive()->getNbEq();
+  vector<CFreal> averageState(nbVariables);
+  for (CFuint k = 0; k < getNbElementTypes(); ++k) {
+    const CFuint nbCellsPerType = _elementType[k].getNbCellsPerType();
+    const CFuint nbNodesPerCell = _elementType[k].getNbNodesPerCell();
+
+    for (CFuint i = 0; i < nbCellsPerType; ++i) {
+      averageState.assign(nbVariables, 0.);
+      for (CFuint j = 0; j < nbNodesPerCell; ++j) {
+        const CFuint nodeID = _elementType[k].getTableConnectivity()(i,j);
+        const vector<CFreal>& nodalState = _variables->getRow(nodeID);
+        for (CFuint v = 0; v < nbVariables; ++v) {
+          averageState[v] += nodalState[v];
+        }
+      }
+      for (CFuint v = 0; v < nbVariables; ++v) {
+        averageState[v] /= nbNodesPerCell; // compute the average state
+      }
+      writeBinaryValues(fout, &averageState[0], nbVariables);
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
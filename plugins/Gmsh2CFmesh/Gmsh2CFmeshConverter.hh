@@ -222,6 +222,12 @@ public:
 
 public:
 
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
   /**
    * Constructor
    */
@@ -244,6 +250,15 @@ public:
    */
   void convertBack(const boost::filesystem::path& filepath);
 
+  /**
+   * Converts the Gmsh file to a CFmesh file, in the binary format read by
+   * ParReadCFmeshBinary if the option BinaryOutput is set
+   * @param fromFilepath name of the file to convert from
+   * @param filepath name of the file to write to
+   */
+  void convert(const boost::filesystem::path& fromFilepath,
+               const boost::filesystem::path& filepath);
+
 protected:
 
   /**
@@ -380,6 +395,79 @@ private:
    */
   void writeNodes(std::ofstream& fout);
 
+  /**
+   * Write the binary CFmesh file (see ParCFmeshBinaryFileWriter)
+   */
+  void writeBinaryFile(const boost::filesystem::path& filepath);
+
+  /**
+   * Write in the binary COOLFluiD format the global counts and the
+   * element list, for FEM or for cell center FVM
+   */
+  void writeBinaryElements(std::ofstream& fout);
+
+  /**
+   * Write in the binary COOLFluiD format the Topological Region Set data,
+   * for FEM or for cell center FVM
+   */
+  void writeBinaryTrsData(std::ofstream& fout);
+
+  /**
+   * Write in the binary COOLFluiD format the node list
+   */
+  void writeBinaryNodes(std::ofstream& fout);
+
+  /**
+   * Write in the binary COOLFluiD format the state list, for FEM or
+   * for cell center FVM
+   */
+  void writeBinaryStates(std::ofstream& fout);
+
+  /**
+   * Write a key of the binary CFmesh format, padded with blanks to
+   * 30 characters as done by MPIIOFunctions::writeKeyValue()
+   */
+  static void writeBinaryKey(std::ofstream& fout, const std::string& key)
+  {
+    if (key != "\n") {
+      cf_always_assert(key.size() < 30);
+      std::string buf(30, ' ');
+      buf.replace(0, key.size(), key);
+      fout.write(&buf[0], buf.size());
+    }
+    else {
+      fout.write(&key[0], key.size());
+    }
+  }
+
+  /**
+   * Write raw values in the binary CFmesh format
+   */
+  template <typename T>
+  static void writeBinaryValues(std::ofstream& fout, const T* values, const CFuint size)
+  {
+    if (size > 0) {
+      fout.write(reinterpret_cast<const char*>(values), size*sizeof(T));
+    }
+  }
+
+  /**
+   * Write a raw value in the binary CFmesh format
+   */
+  template <typename T>
+  static void writeBinaryValue(std::ofstream& fout, const T value)
+  {
+    writeBinaryValues(fout, &value, 1);
+  }
+
+  /**
+   * Find the cell containing all the nodes of a boundary face, for cell
+   * center FVM. The map from the nodes to the cells must have been filled
+   * while writing the elements.
+   */
+  CFuint findFaceCellID(const CFuint iTRS, const CFuint iTR, const CFuint iFace,
+                        const std::valarray<CFuint>& faceNodes);
+
   CFuint getNbSuperPatches() const
   {
     return _superPatch.size();
@@ -455,6 +543,18 @@ private:
 
   // node element map
   Common::CFMultiMap<CFuint,CFuint> m_nodeElement;
+
+  /// cells containing the nodes of the current boundary face
+  std::vector<CFuint> m_faceCells;
+
+  /// sorted nodes of the current boundary face
+  std::vector<CFuint> m_faceNodes;
+
+  /// sorted nodes of the cell matched to the current boundary face
+  std::vector<CFuint> m_cellNodes;
+
+  /// flag telling to write the CFmesh file in binary format
+  bool m_binaryOutput;
 }; // end class Gmsh2CFmeshConverter
 
 //////////////////////////////////////////////////////////////////////////////
@@ -4,6 +4,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "Common/MPI/MPIStructDef.hh"
+#include "Common/Stopwatch.hh"
 #include "LagrangianSolverModule.hh"
 #include "ParticleTracking/ParticleTracking.hh"
 #include "Framework/SocketBundleSetter.hh"
@@ -56,6 +57,7 @@ public:
       m_sendBuffer.reset(new SendBuffer<Particle<UserData> >());
       m_sendBufferSize = sendBufferSize;
       m_sendBuffer->reserve(m_sendBufferSize);
+      m_batch.reserve(m_sendBufferSize);
     } 
     catch (std::bad_alloc& ba) {
       std::cerr << "bad_alloc caught: " << ba.what() << '\n';
@@ -128,6 +130,54 @@ public:
 
    void bufferCommitParticle(CFuint faceID);
 
+  /// Removes all the particles of the batch
+  inline void clearBatch()
+  {
+    m_batch.clear();
+    m_batchUserData.clear();
+  }
+
+  /// Adds a particle to the batch
+  /// @return the index of the particle in the batch
+  inline CFuint addToBatch(const Particle<UserData>& particle)
+  {
+    m_batchUserData.push_back(particle.userData);
+    return m_batch.add(particle.commonData);
+  }
+
+  /// Removes a particle from the batch, replacing it by the last one
+  inline void removeFromBatch(CFuint i)
+  {
+    m_batch.remove(i);
+    m_batchUserData[i] = m_batchUserData.back();
+    m_batchUserData.pop_back();
+  }
+
+  /// @return the particles of the batch
+  inline ParticleBatch& getBatch(){ return m_batch; }
+
+  /// @return the user data of a particle of the batch
+  inline UserData& getBatchUserData(CFuint i){ return m_batchUserData[i]; }
+
+  /// Advances all the particles of the batch to the exit of their current cell
+  inline void batchTrackingStep(){ m_particleTracking.batchTrackingStep(m_batch); }
+
+  /// Puts a particle of the batch, which has crossed a partition face, in the
+  /// buffer of the particles to send at the next synchronization
+  void bufferCommitBatchParticle(CFuint i, CFuint faceID);
+
+  /**
+   * Measures the throughput of the tracking: particles are sent from the
+   * centroid of the cells until they reach a boundary, first one after the
+   * other by trackingStep(), then all together by batchTrackingStep()
+   * @param nbParticles  number of particles
+   * @param maxSteps     maximum number of cells crossed by a particle
+   * @param dirDim       number of components of the directions (3 in axisymmetric)
+   * @return the number of particles traced per second by the batched tracking
+   */
+  CFreal benchmarkTracking(const CFuint nbParticles, const CFuint maxSteps,
+			   const CFuint dirDim);
+
 private:
 
   void (ParticleTracking::*getNormalsPtr) (CFuint, RealVector, RealVector);
@@ -142,6 +192,12 @@ private:
   
   std::auto_ptr<SendBuffer<Particle<UserData> > > m_sendBuffer;
   
+  /// particles advanced together by batchTrackingStep()
+  ParticleBatch m_batch;
+  
+  /// user data of the particles of the batch
+  std::vector<UserData> m_batchUserData;
+  
   CFuint m_sendBufferSize;
 
 };
@@ -190,6 +246,104 @@ void LagrangianSolver<UserData, PARTICLE_TRACKING>::bufferCommitParticle(CFuint
 
 //////////////////////////////////////////////////////////////////////////////
 
+template<typename UserData, class PARTICLE_TRACKING>
+void LagrangianSolver<UserData, PARTICLE_TRACKING>::bufferCommitBatchParticle(CFuint i, CFuint faceID)
+{
+  cf_assert(m_wallTypes(faceID,0) == ParticleTracking::COMP_DOMAIN_FACE );
+  
+  static Particle<UserData> sendParticle;
+  m_batch.getCommonData(i, sendParticle.commonData);
+  sendParticle.userData = m_batchUserData[i];
+  sendParticle.commonData.cellID = m_wallTypes(faceID,3);
+  m_sendBuffer->push_back(sendParticle, m_wallTypes(faceID,2) );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+template<typename UserData, class PARTICLE_TRACKING>
+CFreal LagrangianSolver<UserData, PARTICLE_TRACKING>::benchmarkTracking
+(const CFuint nbParticles, const CFuint maxSteps, const CFuint dirDim)
+{
+  const CellFacePlanes& cellFaces = m_particleTracking.getCellFacePlanes();
+  const CFuint nbCells = cellFaces.getNbCells();
+  if (nbCells == 0 || nbParticles == 0 || maxSteps == 0) return 0.;
+  
+  ParticleBatch batch;
+  batch.reserve(nbParticles);
+  std::vector<CommonData> particles(nbParticles);
+  for (CFuint i = 0; i < nbParticles; ++i) {
+    const CFuint cellID = i % nbCells;
+    const CFreal *const center = cellFaces.getCellCenter(cellID);
+    CellFacePlanes::getBenchmarkDirection(i, nbParticles, dirDim, particles[i].direction);
+    for (CFuint d = 0; d < 3; ++d) {
+      particles[i].currentPoint[d] = center[d];
+    }
+    particles[i].cellID = cellID;
+  }
+  
+  // one particle after the other
+  Common::Stopwatch<Common::WallTime> stp;
+  stp.start();
+  
+  CFuint nbCrossings = 0;
+  for (CFuint i = 0; i < nbParticles; ++i) {
+    m_particleTracking.newParticle(particles[i]);
+    
+    CFuint currentCellID = particles[i].cellID;
+    for (CFuint step = 0; step < maxSteps; ++step) {
+      m_particleTracking.trackingStep();
+      const CFint exitFaceID = m_particleTracking.getExitFaceID();
+      const CFuint exitCellID = m_particleTracking.getExitCellID();
+      if (exitFaceID < 0 || exitCellID == currentCellID) break;
+      currentCellID = exitCellID;
+      ++nbCrossings;
+    }
+  }
+  
+  const CFreal time = stp.read();
+  CFLog(INFO, "LagrangianSolver::benchmarkTracking() => single: " << nbParticles
+	<< " particles, " << nbCrossings << " crossings in " << time << " s: "
+	<< ((time > 0.) ? nbParticles/time : 0.) << " particles/s, "
+	<< ((time > 0.) ? nbCrossings/time : 0.) << " crossings/s\n");
+  
+  // the same particles advanced together
+  stp.restart();
+  
+  CFuint nbBatchCrossings = 0;
+  for (CFuint i = 0; i < nbParticles; ++i) {
+    batch.add(particles[i]);
+  }
+  while (batch.size() > 0) {
+    m_particleTracking.batchTrackingStep(batch);
+    CFuint i = 0;
+    while (i < batch.size()) {
+      if (batch.getExitFaceID(i) < 0 || batch.getExitCellID(i) == batch.getCellID(i)) {
+	batch.remove(i);
+	continue;
+      }
+      
+      ++nbBatchCrossings;
+      batch.enterExitCell(i);
+      if (batch.getNbSteps(i) == maxSteps) {
+	batch.remove(i);
+	continue;
+      }
+      ++i;
+    }
+  }
+  
+  const CFreal batchTime = stp.read();
+  const CFreal rate = (batchTime > 0.) ? nbParticles/batchTime : 0.;
+  CFLog(INFO, "LagrangianSolver::benchmarkTracking() => batched: " << nbParticles
+	<< " particles, " << nbBatchCrossings << " crossings in " << batchTime << " s: "
+	<< rate << " particles/s, " << ((batchTime > 0.) ? nbBatchCrossings/batchTime : 0.)
+	<< " crossings/s\n");
+  
+  return rate;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 template<typename UserData, class PARTICLE_TRACKING>
 bool LagrangianSolver<UserData,PARTICLE_TRACKING>::sincronizeParticles(std::vector< Particle<UserData> >&particleBuffer,
 								       bool isLastPhoton)
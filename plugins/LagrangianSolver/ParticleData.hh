@@ -1,3 +1,6 @@
+#ifndef COOLFluiD_LagrangianSolver_ParticleData_hh
+#define COOLFluiD_LagrangianSolver_ParticleData_hh
+
 #include "Common/COOLFluiD.hh"
 #include "MathTools/CFVec.hh"
 
@@ -39,3 +42,7 @@ struct Particle
 }
 
 }
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_LagrangianSolver_ParticleData_hh
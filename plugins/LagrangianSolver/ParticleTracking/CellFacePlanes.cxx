@@ -0,0 +1,377 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Common/CFLog.hh"
+#include "MathTools/MathConsts.hh"
+#include "Framework/GeometricEntity.hh"
+#include "Framework/TopologicalRegionSet.hh"
+
+#include "LagrangianSolver/ParticleTracking/CellFacePlanes.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::MathTools;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+namespace LagrangianSolver {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// distance of the nodes of a face to its plane, relative to the square root
+/// of its area, above which the face is considered as warped
+static const CFreal WARP_TOLERANCE = 1e-6;
+
+/// tolerance of the intersections between a ray and a triangle
+static const CFreal TRIANGLE_EPSILON = 1e-12;
+
+//////////////////////////////////////////////////////////////////////////////
+
+CellFacePlanes::CellFacePlanes() :
+  m_dim(0),
+  m_cellStart(1, 0),
+  m_faceID(),
+  m_exitCellID(),
+  m_nx(),
+  m_ny(),
+  m_nz(),
+  m_d(),
+  m_segments(),
+  m_nodeStart(1, 0),
+  m_faceNodes(),
+  m_cellCenters()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CellFacePlanes::~CellFacePlanes()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CellFacePlanes::build(GeometricEntityPool<CellTrsGeoBuilder>& cellBuilder,
+			   const CFuint dim)
+{
+  cf_assert(dim == DIM_2D || dim == DIM_3D);
+
+  clear();
+  m_dim = dim;
+
+  CellTrsGeoBuilder::GeoData& cellData = cellBuilder.getDataGE();
+  const CFuint nbCells = cellData.trs->getLocalNbGeoEnts();
+  m_cellStart.reserve(nbCells + 1);
+  m_cellCenters.assign(nbCells*3, 0.);
+
+  CFreal faceCenter[3];
+  CFreal normal[3];
+  vector<CFreal> cellNodeCoords;
+  vector<CFuint> cellNodeCounts;
+  CFuint nbWarpedCells = 0;
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    cellData.idx = iCell;
+    GeometricEntity *const cell = cellBuilder.buildGE();
+
+    // the faces are oriented with respect to the centroid of the cell
+    const vector<Node*>& cellNodes = *cell->getNodes();
+    CFreal *const cellCenter = &m_cellCenters[iCell*3];
+    for (CFuint i = 0; i < cellNodes.size(); ++i) {
+      for (CFuint d = 0; d < dim; ++d) {
+	cellCenter[d] += (*cellNodes[i])[d];
+      }
+    }
+    for (CFuint d = 0; d < dim; ++d) {
+      cellCenter[d] /= static_cast<CFreal>(cellNodes.size());
+    }
+
+    const CFuint nbFaces = cell->nbNeighborGeos();
+    cellNodeCoords.clear();
+    cellNodeCounts.clear();
+    bool isWarped = false;
+    for (CFuint f = 0; f < nbFaces; ++f) {
+      GeometricEntity *const face = cell->getNeighborGeo(f);
+      const vector<Node*>& nodes = *face->getNodes();
+      const CFuint nbNodes = nodes.size();
+
+      faceCenter[0] = faceCenter[1] = faceCenter[2] = 0.;
+      normal[0] = normal[1] = normal[2] = 0.;
+      if (dim == DIM_2D) {
+	const CFreal x1 = (*nodes[0])[XX];
+	const CFreal y1 = (*nodes[0])[YY];
+	const CFreal x2 = (*nodes[1])[XX];
+	const CFreal y2 = (*nodes[1])[YY];
+	m_segments.push_back(x1);
+	m_segments.push_back(y1);
+	m_segments.push_back(x2);
+	m_segments.push_back(y2);
+
+	faceCenter[0] = 0.5*(x1 + x2);
+	faceCenter[1] = 0.5*(y1 + y2);
+	normal[0] = y2 - y1;
+	normal[1] = x1 - x2;
+      }
+      else {
+	// Newell's method gives the best fitting plane of non planar faces
+	for (CFuint i = 0; i < nbNodes; ++i) {
+	  const Node& ni = *nodes[i];
+	  const Node& nj = *nodes[(i+1) % nbNodes];
+	  normal[0] += (ni[YY] - nj[YY])*(ni[ZZ] + nj[ZZ]);
+	  normal[1] += (ni[ZZ] - nj[ZZ])*(ni[XX] + nj[XX]);
+	  normal[2] += (ni[XX] - nj[XX])*(ni[YY] + nj[YY]);
+	  for (CFuint d = 0; d < 3; ++d) {
+	    faceCenter[d] += ni[d];
+	  }
+	}
+	for (CFuint d = 0; d < 3; ++d) {
+	  faceCenter[d] /= static_cast<CFreal>(nbNodes);
+	}
+      }
+
+      CFreal norm = 0.;
+      CFreal orientation = 0.;
+      for (CFuint d = 0; d < 3; ++d) {
+	norm += normal[d]*normal[d];
+	orientation += normal[d]*(faceCenter[d] - cellCenter[d]);
+      }
+      cf_assert(norm > 0.);
+      const CFreal invNorm = ((orientation < 0.) ? -1. : 1.)/std::sqrt(norm);
+      for (CFuint d = 0; d < 3; ++d) {
+	normal[d] *= invNorm;
+      }
+
+      const CFreal d = normal[0]*faceCenter[0] + normal[1]*faceCenter[1] + normal[2]*faceCenter[2];
+      m_nx.push_back(normal[0]);
+      m_ny.push_back(normal[1]);
+      m_nz.push_back(normal[2]);
+      m_d.push_back(d);
+      m_faceID.push_back(face->getID());
+
+      if (dim == DIM_3D) {
+	// the Newell normal is twice the area of the face
+	const CFreal tolerance = WARP_TOLERANCE*std::sqrt(0.5*std::sqrt(norm));
+	for (CFuint i = 0; i < nbNodes; ++i) {
+	  const Node& ni = *nodes[i];
+	  if (std::abs(normal[0]*ni[XX] + normal[1]*ni[YY] + normal[2]*ni[ZZ] - d) > tolerance) {
+	    isWarped = true;
+	  }
+	  for (CFuint dd = 0; dd < 3; ++dd) {
+	    cellNodeCoords.push_back(ni[dd]);
+	  }
+	}
+	cellNodeCounts.push_back(nbNodes);
+      }
+
+      // same neighbour as the one given by the geometric entities
+      const CFuint cellID = cell->getState(0)->getLocalID();
+      CFuint exitCellID = face->getState(0)->getLocalID();
+      if (exitCellID == cellID && !face->getState(1)->isGhost()) {
+	exitCellID = face->getState(1)->getLocalID();
+      }
+      m_exitCellID.push_back(exitCellID);
+    }
+
+    // the nodes are only kept for the cells needing the triangulated exit test
+    if (isWarped) {
+      ++nbWarpedCells;
+      m_faceNodes.insert(m_faceNodes.end(), cellNodeCoords.begin(), cellNodeCoords.end());
+      for (CFuint f = 0; f < nbFaces; ++f) {
+	m_nodeStart.push_back(m_nodeStart.back() + cellNodeCounts[f]);
+      }
+    }
+    else {
+      m_nodeStart.insert(m_nodeStart.end(), nbFaces, m_nodeStart.back());
+    }
+
+    m_cellStart.push_back(m_faceID.size());
+    cellBuilder.releaseGE();
+  }
+
+  CFLog(VERBOSE, "CellFacePlanes::build() => " << nbCells << " cells, "
+	<< m_faceID.size() << " face entries, " << nbWarpedCells
+	<< " cells with warped faces\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint CellFacePlanes::findExit(const CFuint cellID, const CFreal *const origin,
+			       const CFreal *const dir, CFreal& t) const
+{
+  cf_assert(cellID + 1 < m_cellStart.size());
+
+  if (isWarped(cellID)) {
+    const CFint exitFace = findExitTriangulated(cellID, origin, dir, t);
+    if (exitFace >= 0) return exitFace;
+  }
+
+  const CFuint start = m_cellStart[cellID];
+  const CFuint end   = m_cellStart[cellID+1];
+
+  CFint exitFace = -1;
+  CFreal tExit = 0.;
+  for (CFuint k = start; k < end; ++k) {
+    const CFreal nDir = m_nx[k]*dir[0] + m_ny[k]*dir[1] + m_nz[k]*dir[2];
+    // only the faces the ray is going through can be exit faces
+    if (nDir > 0.) {
+      const CFreal nOrigin = m_nx[k]*origin[0] + m_ny[k]*origin[1] + m_nz[k]*origin[2];
+      const CFreal tk = (m_d[k] - nOrigin)/nDir;
+      if (exitFace < 0 || tk < tExit) {
+	tExit = tk;
+	exitFace = k;
+      }
+    }
+  }
+
+  if (exitFace >= 0) {
+    // a ray starting on an edge can leave the cell immediately
+    t = std::max(tExit, t);
+  }
+  return exitFace;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint CellFacePlanes::findExitTriangulated(const CFuint cellID,
+					   const CFreal *const origin,
+					   const CFreal *const dir, CFreal& t) const
+{
+  const CFuint start = m_cellStart[cellID];
+  const CFuint end   = m_cellStart[cellID+1];
+
+  CFint exitFace = -1;
+  CFreal tExit = 0.;
+  CFreal centroid[3];
+  CFreal e1[3], e2[3], p[3], q[3], s[3];
+  for (CFuint k = start; k < end; ++k) {
+    const CFreal *const nodes = &m_faceNodes[m_nodeStart[k]*3];
+    const CFuint nbNodes = m_nodeStart[k+1] - m_nodeStart[k];
+
+    centroid[0] = centroid[1] = centroid[2] = 0.;
+    for (CFuint i = 0; i < nbNodes; ++i) {
+      for (CFuint d = 0; d < 3; ++d) {
+	centroid[d] += nodes[i*3 + d];
+      }
+    }
+    for (CFuint d = 0; d < 3; ++d) {
+      centroid[d] /= static_cast<CFreal>(nbNodes);
+    }
+
+    // Moller-Trumbore test on the triangles (node i, node i+1, centroid),
+    // without culling so that the orientation of the face does not matter
+    for (CFuint i = 0; i < nbNodes; ++i) {
+      const CFreal *const v1 = nodes + i*3;
+      const CFreal *const v2 = nodes + ((i+1) % nbNodes)*3;
+      for (CFuint d = 0; d < 3; ++d) {
+	e1[d] = v2[d] - v1[d];
+	e2[d] = centroid[d] - v1[d];
+	s[d]  = origin[d] - v1[d];
+      }
+
+      p[0] = dir[1]*e2[2] - dir[2]*e2[1];
+      p[1] = dir[2]*e2[0] - dir[0]*e2[2];
+      p[2] = dir[0]*e2[1] - dir[1]*e2[0];
+      const CFreal det = e1[0]*p[0] + e1[1]*p[1] + e1[2]*p[2];
+      // the ray is parallel to the triangle
+      if (std::abs(det) < TRIANGLE_EPSILON) continue;
+      const CFreal invDet = 1./det;
+
+      const CFreal u = (s[0]*p[0] + s[1]*p[1] + s[2]*p[2])*invDet;
+      if (u < 0. || u > 1.) continue;
+
+      q[0] = s[1]*e1[2] - s[2]*e1[1];
+      q[1] = s[2]*e1[0] - s[0]*e1[2];
+      q[2] = s[0]*e1[1] - s[1]*e1[0];
+      const CFreal v = (dir[0]*q[0] + dir[1]*q[1] + dir[2]*q[2])*invDet;
+      if (v < 0. || u + v > 1.) continue;
+
+      // the entry face is crossed at the current position and is skipped
+      const CFreal tk = (e2[0]*q[0] + e2[1]*q[1] + e2[2]*q[2])*invDet;
+      if (tk > t + TRIANGLE_EPSILON && (exitFace < 0 || tk < tExit)) {
+	tExit = tk;
+	exitFace = k;
+      }
+    }
+  }
+
+  if (exitFace >= 0) {
+    t = tExit;
+  }
+  return exitFace;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CellFacePlanes::advance(const CFuint nbRays, const CFuint stride,
+			     CFuint *const cellIDs,
+			     const CFreal *const origins, const CFreal *const dirs,
+			     CFreal *const t, CFint *const faces) const
+{
+  cf_assert(nbRays <= stride);
+
+  CFreal origin[3];
+  CFreal dir[3];
+  for (CFuint r = 0; r < nbRays; ++r) {
+    for (CFuint d = 0; d < 3; ++d) {
+      origin[d] = origins[d*stride + r];
+      dir[d]    = dirs[d*stride + r];
+    }
+
+    faces[r] = findExit(cellIDs[r], origin, dir, t[r]);
+    if (faces[r] >= 0) {
+      cellIDs[r] = m_exitCellID[faces[r]];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CellFacePlanes::getBenchmarkDirection(const CFuint i, const CFuint n,
+					   const CFuint dim, CFreal *const dir)
+{
+  const CFreal pi = MathConsts::CFrealPi();
+  if (dim == DIM_2D) {
+    const CFreal angle = 2.*pi*(i + 0.5)/n;
+    dir[0] = std::cos(angle);
+    dir[1] = std::sin(angle);
+    dir[2] = 0.;
+  }
+  else {
+    // Fibonacci lattice on the unit sphere
+    const CFreal z = 1. - 2.*(i + 0.5)/n;
+    const CFreal r = std::sqrt(std::max(0., 1. - z*z));
+    const CFreal phi = pi*(3. - std::sqrt(5.))*i;
+    dir[0] = r*std::cos(phi);
+    dir[1] = r*std::sin(phi);
+    dir[2] = z;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CellFacePlanes::clear()
+{
+  m_cellStart.assign(1, 0);
+  vector<CFuint>().swap(m_faceID);
+  vector<CFuint>().swap(m_exitCellID);
+  vector<CFreal>().swap(m_nx);
+  vector<CFreal>().swap(m_ny);
+  vector<CFreal>().swap(m_nz);
+  vector<CFreal>().swap(m_d);
+  vector<CFreal>().swap(m_segments);
+  m_nodeStart.assign(1, 0);
+  vector<CFreal>().swap(m_faceNodes);
+  vector<CFreal>().swap(m_cellCenters);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace LagrangianSolver
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,188 @@
+#ifndef COOLFluiD_LagrangianSolver_CellFacePlanes_hh
+#define COOLFluiD_LagrangianSolver_CellFacePlanes_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Common/NonCopyable.hh"
+#include "Framework/GeometricEntityPool.hh"
+#include "Framework/CellTrsGeoBuilder.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+namespace LagrangianSolver {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class stores, for every cell, the planes of its faces, so that the
+ * particles can walk from cell to cell without building any GeometricEntity.
+ *
+ * The faces of all the cells are stored one after the other (cell by cell)
+ * in separate arrays (structure of arrays): the outward unit normal n and the
+ * offset d = n.x of the plane, the face ID and the cell reached through the
+ * face. The exit face of a ray of origin O and direction D is the face
+ * with n.D > 0 and the smallest t = (d - n.O)/(n.D), which is exact for
+ * convex cells with planar faces. In 3D, the plane of a face with more than
+ * three nodes is the best fitting one (Newell's method): the faces whose
+ * nodes are off that plane by more than a small fraction of their size are
+ * flagged as warped at build time, their nodes are stored and the exit of
+ * the cells with a warped face is found by intersecting the ray with the
+ * triangles joining the edges of the faces to their centroid, as done by
+ * the tracking before the planes were cached. In 2D, the end points of the
+ * faces are also stored for the axisymmetric tracking.
+ */
+class CellFacePlanes : public Common::NonCopyable<CellFacePlanes> {
+public:
+
+  /**
+   * Constructor
+   */
+  CellFacePlanes();
+
+  /**
+   * Destructor
+   */
+  ~CellFacePlanes();
+
+  /**
+   * Builds the planes of the faces of all the cells of the given builder
+   * @param cellBuilder  builder of the cells (on "InnerCells")
+   * @param dim          space dimension
+   */
+  void build(Framework::GeometricEntityPool<Framework::CellTrsGeoBuilder>& cellBuilder,
+	     const CFuint dim);
+
+  /// @return true if the planes have been built
+  bool isBuilt() const {return m_cellStart.size() > 1;}
+
+  /// @return the number of cells
+  CFuint getNbCells() const {return m_cellStart.size() - 1;}
+
+  /// @return the first face entry of the given cell
+  CFuint getCellStart(const CFuint cellID) const {return m_cellStart[cellID];}
+
+  /// @return the number of faces of the given cell
+  CFuint getNbFaces(const CFuint cellID) const
+  {
+    return m_cellStart[cellID+1] - m_cellStart[cellID];
+  }
+
+  /// @return the ID of the face of the given entry
+  CFuint getFaceID(const CFuint k) const {return m_faceID[k];}
+
+  /// @return the cell reached through the face of the given entry
+  CFuint getExitCellID(const CFuint k) const {return m_exitCellID[k];}
+
+  /// @return the end points (x1, y1, x2, y2) of the face of the given entry (2D only)
+  const CFreal* getSegment(const CFuint k) const {return &m_segments[k*4];}
+
+  /// @return the centroid of the given cell
+  const CFreal* getCellCenter(const CFuint cellID) const {return &m_cellCenters[cellID*3];}
+
+  /// @return true if the given cell has a warped face
+  bool isWarped(const CFuint cellID) const
+  {
+    return m_nodeStart[m_cellStart[cellID+1]] > m_nodeStart[m_cellStart[cellID]];
+  }
+
+  /**
+   * Finds the face through which a ray leaves the given cell
+   * @param cellID  current cell
+   * @param origin  origin of the ray (3 components, the last one being 0 in 2D)
+   * @param dir     direction of the ray (3 components, the last one being 0 in 2D)
+   * @param t       in: parameter of the current position along the ray
+   *                out: parameter of the exit point
+   * @return the face entry or -1 if no exit is found
+   */
+  CFint findExit(const CFuint cellID, const CFreal *const origin,
+		 const CFreal *const dir, CFreal& t) const;
+
+  /**
+   * Advances a batch of rays to the exit of their current cell
+   * @param nbRays   number of rays
+   * @param stride   distance between two components of a ray in origins and dirs
+   * @param cellIDs  in: current cells, out: cells reached
+   * @param origins  origins of the rays, stored component by component (3*stride)
+   * @param dirs     directions of the rays, stored component by component (3*stride)
+   * @param t        in: current parameters, out: parameters of the exit points
+   * @param faces    out: face entries crossed (-1 if no exit is found)
+   */
+  void advance(const CFuint nbRays, const CFuint stride, CFuint *const cellIDs,
+	       const CFreal *const origins, const CFreal *const dirs,
+	       CFreal *const t, CFint *const faces) const;
+
+  /**
+   * Computes the direction of the i-th out of n rays evenly spread on the
+   * unit circle (2D) or sphere (3D), used by the tracking benchmark
+   */
+  static void getBenchmarkDirection(const CFuint i, const CFuint n,
+				    const CFuint dim, CFreal *const dir);
+
+  /**
+   * Releases the memory
+   */
+  void clear();
+
+private: // helper functions
+
+  /**
+   * Finds the face through which a ray leaves a cell with warped faces, by
+   * intersecting it with the triangles (edge, face centroid) of the faces
+   * @see findExit()
+   */
+  CFint findExitTriangulated(const CFuint cellID, const CFreal *const origin,
+			     const CFreal *const dir, CFreal& t) const;
+
+private: // data
+
+  /// space dimension
+  CFuint m_dim;
+
+  /// start of the face entries of each cell
+  std::vector<CFuint> m_cellStart;
+
+  /// face ID of each entry
+  std::vector<CFuint> m_faceID;
+
+  /// cell reached through the face of each entry
+  std::vector<CFuint> m_exitCellID;
+
+  /// x component of the outward unit normals
+  std::vector<CFreal> m_nx;
+
+  /// y component of the outward unit normals
+  std::vector<CFreal> m_ny;
+
+  /// z component of the outward unit normals
+  std::vector<CFreal> m_nz;
+
+  /// offsets of the planes
+  std::vector<CFreal> m_d;
+
+  /// end points of the faces (2D only)
+  std::vector<CFreal> m_segments;
+
+  /// start of the nodes of each entry in m_faceNodes (empty range if the cell has no warped face)
+  std::vector<CFuint> m_nodeStart;
+
+  /// coordinates of the nodes of the faces of the cells with a warped face (3D only)
+  std::vector<CFreal> m_faceNodes;
+
+  /// centroids of the cells (3 components)
+  std::vector<CFreal> m_cellCenters;
+
+}; // end of class CellFacePlanes
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace LagrangianSolver
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_LagrangianSolver_CellFacePlanes_hh
@@ -0,0 +1,155 @@
+#include <algorithm>
+
+#include "LagrangianSolver/ParticleTracking/ParticleBatch.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+namespace LagrangianSolver {
+
+//////////////////////////////////////////////////////////////////////////////
+
+ParticleBatch::ParticleBatch() :
+  m_cellIDs(),
+  m_points(),
+  m_directions(),
+  m_stepDistances(),
+  m_exitFaceIDs(),
+  m_exitCellIDs(),
+  m_nbSteps(),
+  m_size(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ParticleBatch::~ParticleBatch()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParticleBatch::reserve(const CFuint capacity)
+{
+  m_cellIDs.assign(capacity, 0);
+  m_points.assign(3*capacity, 0.);
+  m_directions.assign(3*capacity, 0.);
+  m_stepDistances.assign(capacity, 0.);
+  m_exitFaceIDs.assign(capacity, -1);
+  m_exitCellIDs.assign(capacity, 0);
+  m_nbSteps.assign(capacity, 0);
+  m_size = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint ParticleBatch::add(const CommonData& particle)
+{
+  const CFuint oldCapacity = capacity();
+  if (m_size == oldCapacity) {
+    // the components are stored with a stride equal to the capacity
+    const CFuint newCapacity = std::max<CFuint>(2*oldCapacity, 64);
+    vector<CFreal> points(3*newCapacity, 0.);
+    vector<CFreal> directions(3*newCapacity, 0.);
+    for (CFuint d = 0; d < 3 && m_size > 0; ++d) {
+      std::copy(m_points.begin() + d*oldCapacity, m_points.begin() + d*oldCapacity + m_size,
+		points.begin() + d*newCapacity);
+      std::copy(m_directions.begin() + d*oldCapacity, m_directions.begin() + d*oldCapacity + m_size,
+		directions.begin() + d*newCapacity);
+    }
+    m_points.swap(points);
+    m_directions.swap(directions);
+    m_cellIDs.resize(newCapacity, 0);
+    m_stepDistances.resize(newCapacity, 0.);
+    m_exitFaceIDs.resize(newCapacity, -1);
+    m_exitCellIDs.resize(newCapacity, 0);
+    m_nbSteps.resize(newCapacity, 0);
+  }
+
+  const CFuint i = m_size++;
+  const CFuint stride = capacity();
+  for (CFuint d = 0; d < 3; ++d) {
+    m_points[d*stride + i]     = particle.currentPoint[d];
+    m_directions[d*stride + i] = particle.direction[d];
+  }
+  m_cellIDs[i] = particle.cellID;
+  m_stepDistances[i] = 0.;
+  m_exitFaceIDs[i] = -1;
+  m_exitCellIDs[i] = particle.cellID;
+  m_nbSteps[i] = 0;
+  return i;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParticleBatch::remove(const CFuint i)
+{
+  cf_assert(i < m_size);
+
+  const CFuint last = --m_size;
+  if (i < last) {
+    const CFuint stride = capacity();
+    for (CFuint d = 0; d < 3; ++d) {
+      m_points[d*stride + i]     = m_points[d*stride + last];
+      m_directions[d*stride + i] = m_directions[d*stride + last];
+    }
+    m_cellIDs[i] = m_cellIDs[last];
+    m_stepDistances[i] = m_stepDistances[last];
+    m_exitFaceIDs[i] = m_exitFaceIDs[last];
+    m_exitCellIDs[i] = m_exitCellIDs[last];
+    m_nbSteps[i] = m_nbSteps[last];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParticleBatch::setDirection(const CFuint i, const RealVector& direction)
+{
+  cf_assert(i < m_size);
+  cf_assert(direction.size() <= 3);
+
+  const CFuint stride = capacity();
+  for (CFuint d = 0; d < 3; ++d) {
+    m_directions[d*stride + i] = (d < direction.size()) ? direction[d] : 0.;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParticleBatch::getCommonData(const CFuint i, CommonData& particle) const
+{
+  cf_assert(i < m_size);
+
+  const CFuint stride = capacity();
+  for (CFuint d = 0; d < 3; ++d) {
+    particle.currentPoint[d] = m_points[d*stride + i];
+    particle.direction[d]    = m_directions[d*stride + i];
+  }
+  particle.cellID = m_cellIDs[i];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParticleBatch::getPoint(const CFuint i, RealVector& point) const
+{
+  cf_assert(i < m_size);
+  cf_assert(point.size() <= 3);
+
+  const CFuint stride = capacity();
+  for (CFuint d = 0; d < point.size(); ++d) {
+    point[d] = m_points[d*stride + i];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace LagrangianSolver
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
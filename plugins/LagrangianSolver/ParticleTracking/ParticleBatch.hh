@@ -0,0 +1,132 @@
+#ifndef COOLFluiD_LagrangianSolver_ParticleBatch_hh
+#define COOLFluiD_LagrangianSolver_ParticleBatch_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "MathTools/RealVector.hh"
+#include "LagrangianSolver/ParticleData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+namespace LagrangianSolver {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class stores the geometric data of a batch of particles which are
+ * advanced together, one cell per tracking step (see
+ * ParticleTracking::trackingStep(ParticleBatch&)).
+ *
+ * The data are stored in separate arrays (structure of arrays), the
+ * components of the points and of the directions being stored component by
+ * component with a stride equal to the capacity of the batch. A tracking
+ * step moves the points to the exit of the current cells and gives the
+ * step distances, the exit faces and the exit cells: the current cells are
+ * only changed by enterExitCell(), once the caller has processed the step.
+ */
+class ParticleBatch {
+public:
+
+  /**
+   * Constructor
+   */
+  ParticleBatch();
+
+  /**
+   * Destructor
+   */
+  ~ParticleBatch();
+
+  /// Sets the maximum number of particles, the current particles are lost
+  void reserve(const CFuint capacity);
+
+  /// @return the maximum number of particles
+  CFuint capacity() const {return m_cellIDs.size();}
+
+  /// @return the number of particles
+  CFuint size() const {return m_size;}
+
+  /// Removes all the particles
+  void clear() {m_size = 0;}
+
+  /// Adds a particle, the capacity being increased if needed
+  /// @return the index of the particle
+  CFuint add(const CommonData& particle);
+
+  /// Removes the given particle, replacing it by the last one
+  void remove(const CFuint i);
+
+  /// Moves the given particle to the cell reached by the last tracking step
+  void enterExitCell(const CFuint i)
+  {
+    m_cellIDs[i] = m_exitCellIDs[i];
+    ++m_nbSteps[i];
+  }
+
+  /// Sets the direction of the given particle, from its current point
+  void setDirection(const CFuint i, const RealVector& direction);
+
+  /// Copies the geometric data of the given particle
+  void getCommonData(const CFuint i, CommonData& particle) const;
+
+  /// Copies the current point of the given particle
+  void getPoint(const CFuint i, RealVector& point) const;
+
+  /// @return the current cell of the given particle
+  CFuint getCellID(const CFuint i) const {return m_cellIDs[i];}
+
+  /// @return the number of cells crossed by the given particle
+  CFuint getNbSteps(const CFuint i) const {return m_nbSteps[i];}
+
+  /// @return the distance covered by the given particle at the last step
+  CFreal getStepDistance(const CFuint i) const {return m_stepDistances[i];}
+
+  /// @return the face crossed by the given particle at the last step (-1 if none)
+  CFint getExitFaceID(const CFuint i) const {return m_exitFaceIDs[i];}
+
+  /// @return the cell reached by the given particle at the last step
+  CFuint getExitCellID(const CFuint i) const {return m_exitCellIDs[i];}
+
+public: // data accessed by the tracking algorithms
+
+  /// current cells
+  std::vector<CFuint> m_cellIDs;
+
+  /// current points (3 components, stride equal to the capacity)
+  std::vector<CFreal> m_points;
+
+  /// directions (3 components, stride equal to the capacity)
+  std::vector<CFreal> m_directions;
+
+  /// distances covered at the last step
+  std::vector<CFreal> m_stepDistances;
+
+  /// faces crossed at the last step (-1 if no exit was found)
+  std::vector<CFint> m_exitFaceIDs;
+
+  /// cells reached at the last step
+  std::vector<CFuint> m_exitCellIDs;
+
+  /// number of cells crossed
+  std::vector<CFuint> m_nbSteps;
+
+private: // data
+
+  /// number of particles
+  CFuint m_size;
+
+}; // end of class ParticleBatch
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace LagrangianSolver
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_LagrangianSolver_ParticleBatch_hh
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "LagrangianSolver/ParallelVector/ParallelVector.hh"
 #include "ParticleTracking.hh"
 #include "Framework/PhysicalModel.hh"
@@ -30,7 +32,9 @@ ParticleTracking::ParticleTracking(const std::string& name) :
   m_faceIdx(0),
   m_dim(2), 
   m_normals(CFNULL),
-  m_cartNormal(2)
+  m_cartNormal(2),
+  m_cellFaces(),
+  m_batchFaces()
 {
 }
 
@@ -46,6 +50,48 @@ void ParticleTracking::setupAlgorithm()
 {
   m_normals = m_sockets.normals.getDataHandle();
   m_dim = Framework::PhysicalModelStack::getActive()->getDim();
+  
+  // the face planes are computed once for all the tracking steps
+  if (!m_cellFaces.isBuilt()) {
+    m_cellFaces.build(m_cellBuilder, m_dim);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParticleTracking::batchTrackingStep(ParticleBatch& batch)
+{
+  const CFuint nbParticles = batch.size();
+  if (nbParticles == 0) return;
+  
+  const CFuint stride = batch.capacity();
+  if (m_dim == DIM_2D) {
+    // the third components must not change the planes intersections
+    std::fill(batch.m_points.begin() + 2*stride, batch.m_points.end(), 0.);
+    std::fill(batch.m_directions.begin() + 2*stride, batch.m_directions.end(), 0.);
+  }
+  
+  // the particles start from their current point and keep their current cell
+  std::copy(batch.m_cellIDs.begin(), batch.m_cellIDs.begin() + nbParticles,
+	    batch.m_exitCellIDs.begin());
+  std::fill(batch.m_stepDistances.begin(), batch.m_stepDistances.begin() + nbParticles, 0.);
+  m_batchFaces.resize(nbParticles);
+  
+  m_cellFaces.advance(nbParticles, stride, &batch.m_exitCellIDs[0], &batch.m_points[0],
+		      &batch.m_directions[0], &batch.m_stepDistances[0], &m_batchFaces[0]);
+  
+  for (CFuint d = 0; d < 3; ++d) {
+    CFreal *const points = &batch.m_points[d*stride];
+    const CFreal *const directions = &batch.m_directions[d*stride];
+    for (CFuint i = 0; i < nbParticles; ++i) {
+      points[i] += directions[i]*batch.m_stepDistances[i];
+    }
+  }
+  
+  for (CFuint i = 0; i < nbParticles; ++i) {
+    batch.m_exitFaceIDs[i] = (m_batchFaces[i] >= 0) ?
+      static_cast<CFint>(m_cellFaces.getFaceID(m_batchFaces[i])) : -1;
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
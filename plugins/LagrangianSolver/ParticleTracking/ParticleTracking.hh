@@ -5,6 +5,8 @@
 
 #include "Framework/SocketBundleSetter.hh"
 #include "LagrangianSolver/ParticleData.hh"
+#include "LagrangianSolver/ParticleTracking/CellFacePlanes.hh"
+#include "LagrangianSolver/ParticleTracking/ParticleBatch.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -53,6 +55,12 @@ public:
 
   virtual void trackingStep()=0;
 
+  /**
+   * Advances all the particles of the batch to the exit of their current
+   * cell, through the planes of the faces of the cells (CellFacePlanes)
+   */
+  virtual void batchTrackingStep(ParticleBatch& batch);
+
   virtual void getExitPoint(RealVector &exitPoint) = 0;
 
   virtual CFreal getStepDistance() = 0;
@@ -67,6 +75,9 @@ public:
 		    std::vector<std::string>& wallNames,
                     std::vector<std::string>& boundaryNames);
   
+  /// @return the planes of the faces of the local cells
+  const CellFacePlanes& getCellFacePlanes() const {return m_cellFaces;}
+  
 protected: // functions
   void getAxiNormals(CFuint faceID, RealVector &CartPosition, RealVector &faceNormal);
   
@@ -88,6 +99,12 @@ protected: // data
   Framework::DataHandle<CFreal> m_normals;
   RealVector m_cartNormal;
   
+  /// planes of the faces of the local cells, used to walk from cell to cell
+  CellFacePlanes m_cellFaces;
+  
+  /// face entries crossed by the particles of a batch
+  std::vector<CFint> m_batchFaces;
+  
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -110,81 +110,27 @@ void ParticleTracking2D::newDirection(RealVector &direction)
 
 void ParticleTracking2D::trackingStep()
 {
-  static DataHandle<CFint> faceIsOutwards= m_sockets.isOutward.getDataHandle();
   m_entryCellID = m_exitCellID;
   
   m_exitCellID=-1;
   m_exitFaceID=-1;
   
-  CellTrsGeoBuilder::GeoData& cellData = m_cellBuilder.getDataGE();
+  // the line is parametrized from the point given to newDirection()
+  const CFreal origin[3] = { m_x0, m_y0, 0. };
+  const CFreal direction[3] = { m_a, m_b, 0. };
+  CFreal t = m_particle_t;
   
-  cellData.idx = m_entryCellID;
-  
-  GeometricEntity *const cell = m_cellBuilder.buildGE();
-  CFuint nFaces = cell->nbNeighborGeos();
-  
-  //        cout<<"****************************************************"<<endl;
-  //        cout<<"New Step!"<<endl<<"on Cell with ID: "<<  m_entryCellID<<endl;
-  
-  //      cout<<"direction: "<<
-  //          m_particleCommonData.direction[0]<<' '<<
-  //          m_particleCommonData.direction[1]<<' '<<
-  //          m_particleCommonData.direction[2]<< endl;
-  
-  //      cout<<"Particle t: "<<m_particle_t<<endl;
-  
-  //      cout<<"position: "<<
-  //            m_particleCommonData.currentPoint[0] + m_particle_t * m_particleCommonData.direction[0]<<' '<<
-  //            m_particleCommonData.currentPoint[1] + m_particle_t * m_particleCommonData.direction[1]<<' '<<
-  //            m_particleCommonData.currentPoint[2] + m_particle_t * m_particleCommonData.direction[2]<< endl;
-  
-  static DataHandle<CFreal> normals= m_sockets.normals.getDataHandle();
-  
-  for(CFuint f=0; f<nFaces; ++f){
-    GeometricEntity* const exitFace = cell->getNeighborGeo(f);
-    vector<Node*>& nodes = *exitFace->getNodes();
-    CFint faceID=exitFace->getID();
-    m_x1 = (*(nodes[0]))[XX]; m_x2 = (*(nodes[1]))[XX];
-    m_y1 = (*(nodes[0]))[YY]; m_y2 = (*(nodes[1]))[YY];
+  const CFint exitFace = m_cellFaces.findExit(m_entryCellID, origin, direction, t);
+  if (exitFace >= 0) {
+    m_particle_t_old = m_particle_t;
+    m_particle_t = t;
     
-    m_dx=m_x2-m_x1; m_dy=m_y2-m_y1;
-    m_xx=m_x0-m_x1; m_yy=m_y0-m_y1;
-    
-    m_A = 1./(m_a*m_dy-m_b*m_dx);
-    m_ss =(m_a*m_yy-m_b*m_xx)*m_A;
-    
-    const CFreal circulation = (static_cast<CFuint>(faceIsOutwards[faceID])==m_entryCellID) ? -1.:1.;
-    CFuint faceIdx = faceID*2;
-    
-    m_innerProd = normals[faceIdx+0]*circulation * m_a + normals[faceIdx+1]*circulation* m_b;
-    
-    // this way we assume that the parametrization runs clockwise over the cell's facets.
-    // so that the face normal points outwards
-    // CF doesn't impose this condition ( bug? ), so we have to correct it
-    
-    const bool isExitPoint = m_ss<1. && m_ss>0. && m_innerProd > 0;
-    if(isExitPoint){
-      m_particle_t_old=m_particle_t;
-      m_particle_t  = (m_dx*m_yy-m_dy*m_xx)*m_A;
-      
-      m_exitFaceID = exitFace->getID();
-      m_exitCellID = exitFace->getState(0)->getLocalID();
-      
-      m_exitCellID =  (m_exitCellID ==  m_entryCellID && !exitFace->getState(1)->isGhost() ) ?
-	exitFace->getState(1)->getLocalID() : m_exitCellID;
-      
-      m_cellBuilder.releaseGE();
-      //          cout<<"found Exit Point:"<<" faceID: "<<
-      //                m_exitFaceID<<" newCell ID: "<<m_exitCellID<<" new t: "<<m_particle_t<<endl;
-      return;
-    }
+    m_exitFaceID = m_cellFaces.getFaceID(exitFace);
+    m_exitCellID = m_cellFaces.getExitCellID(exitFace);
+    return;
   }
   
   CFLog(VERBOSE, "ParticleTracking2D::trackingStep() => Can't find an exit Point!!\n");
-  m_exitCellID=-1;
-  m_exitFaceID=-1;
-  m_cellBuilder.releaseGE();
-  //    //return out;
 }
   
 //////////////////////////////////////////////////////////////////////////////
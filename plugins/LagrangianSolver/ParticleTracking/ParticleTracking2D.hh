@@ -31,10 +31,8 @@ class ParticleTracking2D : public ParticleTracking
 
 private:
 
-  CFreal m_dx,m_dy,m_yy,m_A,m_xx,m_a,m_b,m_x0,m_y0,m_x1,m_x2,m_y1,m_y2;
-  CFreal m_particle_t,m_particle_t_old, m_face_s,m_tt,m_ss, m_innerProd;
-  RealVector faceOutNormal;
-  RealVector particleTangent;
+  CFreal m_a,m_b,m_x0,m_y0;
+  CFreal m_particle_t,m_particle_t_old;
 
 };
 
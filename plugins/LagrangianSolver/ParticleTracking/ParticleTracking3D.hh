@@ -13,8 +13,6 @@ namespace LagrangianSolver {
 
 //////////////////////////////////////////////////////////////////////////////
 
-typedef CFreal Vec3[3];
-  
 class ParticleTracking3D : public ParticleTracking
 {
 public:
@@ -45,21 +43,6 @@ public:
 
 private:
   
-  /// compute the triangle intersection
-  /// @param V1   triangle vertex 1
-  /// @param V2   triangle vertex 2
-  /// @param V3   triangle vertex 3 (centroid)
-  /// @param O    ray origin
-  /// @param D    ray direction
-  /// @param out  ray intersection
-  bool triangle_intersection(const Vec3& V1, const Vec3& V2, 
-			     const Vec3& V3, const Vec3& O, 
-			     const Vec3& D, CFreal* out);
-  
-private:
-  
-  Framework::DataHandle<CFint> m_isOutward; 
-  Framework::DataHandle<CFreal> m_faceCenters; 
   std::vector<CFreal> m_centroids;
   CFuint m_maxNbFaces;
   RealVector m_exitPoint;
@@ -159,12 +159,9 @@ void ParticleTrackingAxi::trackingStep()
   static vector<CFreal> t_candidates(m_maxNbFaces*2);
   static vector<CFuint> f_candidates(m_maxNbFaces*2);
 
-  CellTrsGeoBuilder::GeoData& cellData = m_cellBuilder.getDataGE();
   //this->m_cellIdx = this->m_CellIDmap.find(this->m_entryCellID);
   m_cellIdx = m_entryCellID;
-  cellData.idx = m_cellIdx;
 
-  GeometricEntity *const cell = m_cellBuilder.buildGE();
 //  vector<Node*>& myNodes = *cell->getNodes();
 //  for(CFuint ii=0; ii<myNodes.size()-1; ++ii){
 //    m_z1 = (*(myNodes[ii]))[XX]; m_z2 = (*(myNodes[ii+1]))[XX];
@@ -172,14 +169,15 @@ void ParticleTrackingAxi::trackingStep()
 //    cout<<"line: ( "<< m_z1 <<" , "<< m_r1 <<" ) to ( "<< m_z2 <<" , "<< m_r2 <<" )"<<endl;
 //  }
 
+  // the end points of the faces are cached (no GeometricEntity to build)
   CFuint candId = 0;
-  CFuint nFaces = cell->nbNeighborGeos();
+  const CFuint startFace = m_cellFaces.getCellStart(m_cellIdx);
+  const CFuint nFaces = m_cellFaces.getNbFaces(m_cellIdx);
   for(CFuint f=0; f<nFaces; ++f){
-    GeometricEntity* const face = cell->getNeighborGeo(f);
-    vector<Node*>& nodes = *face->getNodes();
-    CFint faceID=face->getID();
-    m_z1 = (*(nodes[0]))[XX]; m_z2 = (*(nodes[1]))[XX];
-    m_r1 = (*(nodes[0]))[YY]; m_r2 = (*(nodes[1]))[YY];
+    const CFuint faceID = m_cellFaces.getFaceID(startFace + f);
+    const CFreal *const segment = m_cellFaces.getSegment(startFace + f);
+    m_z1 = segment[0]; m_z2 = segment[2];
+    m_r1 = segment[1]; m_r2 = segment[3];
     //cout<<"line: ( "<< m_z1 <<" , "<< m_r1 <<" ) to ( "<< m_z2 <<" , "<< m_r2 <<" )"<<endl;
     //cout<<' ';
     m_dr=m_r2-m_r1; m_dz=m_z2-m_z1; m_zz=m_x0-m_z1;
@@ -244,7 +242,6 @@ void ParticleTrackingAxi::trackingStep()
     CFLog(VERBOSE, "ParticleTrackingAxi::trackingStep() => Can't find an exit Point!!\n");
     m_exitCellID=-1;
     m_exitFaceID=-1;
-    m_cellBuilder.releaseGE();
     return;
   }
 
@@ -269,20 +266,35 @@ void ParticleTrackingAxi::trackingStep()
   //cout<<"ray.t: "<<ray.tt<<endl;
   //cout<<"localGE face ID: "<<fCandidates[index]<<endl;
   //cout<<currentCellID<<" END2"<<endl;
-  GeometricEntity* exitFace = cell->getNeighborGeo(f_candidates[index]);
-  m_exitFaceID = exitFace->getID();
-
-  m_exitFaceID = exitFace->getID();
-  m_exitCellID = exitFace->getState(0)->getLocalID();
+  const CFuint exitFace = startFace + f_candidates[index];
+  m_exitFaceID = m_cellFaces.getFaceID(exitFace);
+  m_exitCellID = m_cellFaces.getExitCellID(exitFace);
+}
 
-  m_exitCellID =  (m_exitCellID ==  m_entryCellID && !exitFace->getState(1)->isGhost() ) ?
-    exitFace->getState(1)->getLocalID() : m_exitCellID;
+/////////////////////////////////////////////////////////////////////////////
 
-  m_cellBuilder.releaseGE();
+void ParticleTrackingAxi::batchTrackingStep(ParticleBatch& batch)
+{
+  static RealVector exitPoint(3);
+  CommonData particle;
+  
+  const CFuint stride = batch.capacity();
+  for (CFuint i = 0; i < batch.size(); ++i) {
+    batch.getCommonData(i, particle);
+    newParticle(particle);
+    trackingStep();
+    
+    batch.m_exitFaceIDs[i] = static_cast<CFint>(m_exitFaceID);
+    batch.m_exitCellIDs[i] = m_exitCellID;
+    batch.m_stepDistances[i] = getStepDistance();
+    getExitPoint(exitPoint);
+    for (CFuint d = 0; d < 3; ++d) {
+      batch.m_points[d*stride + i] = exitPoint[d];
+    }
+  }
 }
 
 /////////////////////////////////////////////////////////////////////////////
 
 }
 }
-
@@ -24,6 +24,10 @@ public:
 
     void trackingStep();
 
+    /// The faces are surfaces of revolution in the axisymmetric case: the
+    /// particles of the batch are traced one after the other by trackingStep()
+    void batchTrackingStep(ParticleBatch& batch);
+
     void getExitPoint(RealVector &exitPoint);
 
     void newParticle(CommonData &particle);
@@ -90,36 +90,52 @@ bool SendBuffer<T>::sincronize( std::vector<T> &recvBuffer, bool isLastPhoton)
     nbPhotonsSend += m_sendCounts[i];
   }
   
-  m_sendBufferOrdered.resize(nbPhotonsSend);
+  //each process gets, with the number of photons it receives, the number of
+  //photons sent by the sender and whether the sender still generates photons,
+  //so that the finish condition needs no other collective
+  std::vector<int> sendInfo(3*m_nbProcesses);
+  std::vector<int> recvInfo(3*m_nbProcesses);
+  for(CFuint i=0; i< m_nbProcesses ; ++i ){
+    sendInfo[3*i]   = m_sendCounts[i];
+    sendInfo[3*i+1] = nbPhotonsSend;
+    sendInfo[3*i+2] = (isLastPhoton)? 0 : 1;
+  }
+  MPI_Alltoall(&sendInfo[0], 3, Common::MPIStructDef::getMPIType(&sendInfo[0]), 
+	       &recvInfo[0], 3, Common::MPIStructDef::getMPIType(&recvInfo[0]), m_comm);
   
-  //get the number of photons to receive
   std::vector<int> recvCounts(m_nbProcesses);
   std::vector<int> recvDisps(m_nbProcesses);
-  MPI_Alltoall(&m_sendCounts[0], 1, Common::MPIStructDef::getMPIType(&m_sendCounts[0]), 
-	       &recvCounts[0], 1, Common::MPIStructDef::getMPIType(&recvCounts[0]), m_comm);
-  
   CFuint nbPhotonsRecv=0;
+  CFuint totalPhotonsSend=0;
+  CFuint nbGenerating=0;
   for(CFuint i=0; i< m_nbProcesses ; ++i ){
+    recvCounts[i]  = recvInfo[3*i];
     recvDisps[i]   = nbPhotonsRecv;
     nbPhotonsRecv += recvCounts[i];
+    totalPhotonsSend += recvInfo[3*i+1];
+    nbGenerating += recvInfo[3*i+2];
   }
   
   recvBuffer.resize(nbPhotonsRecv);
   
-  //copy and organize the data into the new buffer
-  //TODO: let's look for a way to do it without an extra buffer!
-  std::vector<int> tempDisps= displacements;
-  int *tempDisp;
-  for( CFuint i=0; i < m_sendBuffer.size(); ++i ){
-    tempDisp= &(tempDisps[ m_sendRanks[i] ]);
-    m_sendBufferOrdered[ *tempDisp ] = m_sendBuffer[i];
-    ++ *tempDisp;
+  //all the photons leaving the partitions are exchanged at once
+  if (totalPhotonsSend > 0) {
+    //copy and organize the data into the new buffer
+    //TODO: let's look for a way to do it without an extra buffer!
+    m_sendBufferOrdered.resize(nbPhotonsSend);
+    std::vector<int> tempDisps= displacements;
+    int *tempDisp;
+    for( CFuint i=0; i < m_sendBuffer.size(); ++i ){
+      tempDisp= &(tempDisps[ m_sendRanks[i] ]);
+      m_sendBufferOrdered[ *tempDisp ] = m_sendBuffer[i];
+      ++ *tempDisp;
+    }
+    
+    MPI_Alltoallv(&m_sendBufferOrdered[0], &m_sendCounts[0], &displacements[0],
+		  m_MPIdatatype, &recvBuffer[0], &recvCounts[0],
+		  &recvDisps[0], m_MPIdatatype, m_comm );
   }
   
-  MPI_Alltoallv(&m_sendBufferOrdered[0], &m_sendCounts[0], &displacements[0],
-		m_MPIdatatype, &recvBuffer[0], &recvCounts[0],
-		&recvDisps[0], m_MPIdatatype, m_comm );
-  
   //clear the sendbuffers
   m_sendBuffer.clear();
   m_sendRanks.clear();
@@ -128,12 +144,7 @@ bool SendBuffer<T>::sincronize( std::vector<T> &recvBuffer, bool isLastPhoton)
   }
   
   //check finish condition (all buffers have zero size and all partitions have generated all photons)
-  CFuint totalPhotonsRecv;
-  nbPhotonsRecv += (isLastPhoton)? 0 : 1 ;
-  
-  MPI_Allreduce(&nbPhotonsRecv, &totalPhotonsRecv, 1, 
-		Common::MPIStructDef::getMPIType(&nbPhotonsRecv), MPI_SUM, m_comm);
-  return (totalPhotonsRecv == 0);
+  return (totalPhotonsSend == 0 && nbGenerating == 0);
 }  
   
 }
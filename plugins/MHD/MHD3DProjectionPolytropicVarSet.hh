@@ -5,6 +5,7 @@
 
 #include "Framework/ConvectiveVarSet.hh"
 #include "MHD/MHDProjectionPolytropicTerm.hh"
+#include "MHD/PFSSMagneticField.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -313,6 +314,9 @@ private:
   /// flux vector for Tanaka flux
   RealVector _tanakaFlux;
 
+  /// evaluator of the PFSS magnetic field
+  PFSSMagneticField _pfss;
+
 }; // end of class MHD3DProjectionPolytropicVarSet
 
 //////////////////////////////////////////////////////////////////////////////
@@ -4,10 +4,6 @@
 #include "Framework/DataHandle.hh"
 #include "Framework/MeshData.hh"
 
-#ifdef CF_HAVE_GSL
-#include <gsl/gsl_sf_legendre.h>
-#endif
-
 //////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -27,7 +23,8 @@ MHD3DProjectionVarSet::MHD3DProjectionVarSet(Common::SafePtr<Framework::BaseTerm
   ConvectiveVarSet(term),
   _model(term.d_castTo<MHDProjectionTerm>()),
   _BDipole(),
-  _tanakaFlux()
+  _tanakaFlux(),
+  _pfss()
 {
 }
 
@@ -293,7 +290,6 @@ void MHD3DProjectionVarSet::computePFSSMagneticField(const RealVector& stateCoor
                                         RealVector& BPFSSCartesian,
                                         RealMatrix& sphCarTransMat)
 {
-#ifdef CF_HAVE_GSL
   CFreal r = stateCoordsSpherical[0];
   const CFreal theta = stateCoordsSpherical[1];
   const CFreal phi = stateCoordsSpherical[2];
@@ -329,68 +325,20 @@ void MHD3DProjectionVarSet::computePFSSMagneticField(const RealVector& stateCoor
   DataHandle<std::vector<CFreal> > Blmreal = MeshDataStack::getActive()->getDataStorage()->getData<std::vector<CFreal> >(datahandleName3);
   DataHandle<std::vector<CFreal> > Blmimg = MeshDataStack::getActive()->getDataStorage()->getData<std::vector<CFreal> >(datahandleName4);
 
-  const CFuint nbLModes = getModel()->getNbLModes();
-
-  CFreal Br = 0.0, Btheta = 0.0, Bphi = 0.0;
-
-  for (CFuint l = 0; l <= nbLModes; ++l) {
-      for (CFuint m = 0; m <= l; ++m) {
-          // Assign the real part of B(r,phi)          
-          const CFreal Ylmampl = gsl_sf_legendre_sphPlm(l,m,cos(theta));
-          const CFreal Brreal = -(Almreal[l])[m]*(double)l*pow(r,(double)l-1.0)+(Blmreal[l])[m]*((double)l+1.0)*pow(r,-(double)l-2.0);
-          const CFreal Brimg = -(Almimg[l])[m]*(double)l*pow(r,(double)l-1.0)+(Blmimg[l])[m]*((double)l+1.0)*pow(r,-(double)l-2.0);
-          const CFreal BthetaCoeff = -1.0/(r*sin(theta));
-          const CFreal Bphireal = BthetaCoeff*(double)m*((Almreal[l])[m]*pow(r,(double)l)+(Blmreal[l])[m]*pow(r,-(double)l-1.0));
-          const CFreal Bphiimg = BthetaCoeff*(double)m*((Almimg[l])[m]*pow(r,(double)l)+(Blmimg[l])[m]*pow(r,-(double)l-1.0));
-
-          const CFreal Brampl = sqrt(Brreal*Brreal+Brimg*Brimg);
-          const CFreal Bphiampl = sqrt(Bphireal*Bphireal+Bphiimg*Bphiimg);
-
-          // TBD: In order to obtain the correct polarity of the magnetic dipoles on the photosphere -= is used instead of += for Br, Bphi and Btheta. This should be checked.
-          const CFreal Brangle = atan2(Brimg,Brreal);
-          Br -= Brampl*Ylmampl*cos(Brangle+(double)m*phi);
-
-          const CFreal Bphiangle = atan2(Bphiimg,Bphireal);
-          Bphi -= Bphiampl*Ylmampl*cos(Bphiangle+(double)m*phi+0.5*MathTools::MathConsts::CFrealPi());
-      }
-   }
-
-   for (CFuint l = 1; l <= (nbLModes-1); ++l) {
-      for (CFuint m = 0; m <= l; ++m) {
-          const CFreal Rlm = sqrt(((double)l*(double)l-(double)m*(double)m)/(4.0*(double)l*(double)l-1.0));
-          const CFreal Rlpl1m = sqrt((((double)l+1.0)*((double)l+1.0)-(double)m*(double)m)/(4.0*((double)l+1.0)*((double)l+1.0)-1.0));
-          // Assign the real part of B(theta)          
-          const CFreal Ylmampl = gsl_sf_legendre_sphPlm(l,m,cos(theta));
-          const CFreal BthetaCoeff = -1.0/(r*sin(theta));
-          const CFreal Bthetareal = BthetaCoeff*(Rlm*((double)l-1.0)*((Almreal[l-1])[m]*pow(r,(double)l-1.0)+(Blmreal[l-1])[m]*pow(r,-(double)l))
-                                            -Rlpl1m*((double)l+2.0)*((Almreal[l+1])[m]*pow(r,(double)l+1.0)+(Blmreal[l+1])[m]*pow(r,-(double)l-2.0)));
-          const CFreal Bthetaimg = BthetaCoeff*(Rlm*((double)l-1.0)*((Almimg[l-1])[m]*pow(r,(double)l-1.0)+(Blmimg[l-1])[m]*pow(r,-(double)l))
-                                            -Rlpl1m*((double)l+2.0)*((Almimg[l+1])[m]*pow(r,(double)l+1.0)+(Blmimg[l+1])[m]*pow(r,-(double)l-2.0)));
-
-          const CFreal Bthetaampl = sqrt(Bthetareal*Bthetareal+Bthetaimg*Bthetaimg);
-
-          const CFreal Bthetaangle = atan2(Bthetaimg,Bthetareal);
-          Btheta -= Bthetaampl*Ylmampl*cos(Bthetaangle+(double)m*phi);
-      }
-  }
-
   RealVector BPFSSSpherical(PhysicalModelStack::getActive()->getDim());
+  _pfss.compute(getModel()->getNbLModes(), r, theta, phi,
+                Almreal, Almimg, Blmreal, Blmimg, BPFSSSpherical);
 
-  BPFSSSpherical[0] = Br;
-  if (rTemp < rSource) {
-        BPFSSSpherical[1] = Btheta;
-        BPFSSSpherical[2] = Bphi;
-  } else {
+  if (rTemp >= rSource) {
         if (rTemp > rSource) {
               // B field is radial and decreases by r^2 beyond the source surface
-              BPFSSSpherical[0] = Br/(rTemp*rTemp);
+              BPFSSSpherical[0] /= (rTemp*rTemp);
         }
         BPFSSSpherical[1] = 0.0;
         BPFSSSpherical[2] = 0.0;
   }
 
   BPFSSCartesian = sphCarTransMat*BPFSSSpherical;
-#endif
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,220 @@
+#include "MHD/PFSSMagneticField.hh"
+#include "MathTools/MathConsts.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Physics {
+
+    namespace MHD {
+
+//////////////////////////////////////////////////////////////////////////////
+
+PFSSMagneticField::PFSSMagneticField() :
+  m_nbLModes(0),
+  m_Rlm(),
+  m_invRlm(),
+  m_Plm(),
+  m_rPow(),
+  m_cosmphi(),
+  m_sinmphi()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+PFSSMagneticField::~PFSSMagneticField()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void PFSSMagneticField::setNbLModes(const CFuint nbLModes)
+{
+  if (nbLModes == m_nbLModes && m_Plm.size() > 0) return;
+
+  m_nbLModes = nbLModes;
+
+  const CFuint nbModes = idx(nbLModes+1,0);
+  m_Rlm.resize(nbModes);
+  m_invRlm.resize(nbModes);
+  m_Plm.resize(nbModes);
+  m_rPow.resize(2*nbLModes+4);
+  m_cosmphi.resize(nbLModes+1);
+  m_sinmphi.resize(nbLModes+1);
+
+  for (CFuint l = 0; l <= nbLModes; ++l) {
+    for (CFuint m = 0; m <= l; ++m) {
+      const CFreal dl = (CFreal)l;
+      const CFreal dm = (CFreal)m;
+      const CFuint lm = idx(l,m);
+      m_Rlm[lm]    = (l > m) ? sqrt((dl*dl - dm*dm)/(4.0*dl*dl - 1.0)) : 0.0;
+      m_invRlm[lm] = (l > m) ? 1.0/m_Rlm[lm] : 0.0;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void PFSSMagneticField::computeLegendre(const CFreal x, const CFreal sinTheta)
+{
+  // Ylm(theta,0) = sqrt((2l+1)/(4pi) (l-m)!/(l+m)!) Plm(cos(theta)), computed
+  // row by row in l: for a given l, the modes m < l-1 are independent of
+  // each other and only the two last ones start a new column
+  m_Plm[0] = 1.0/sqrt(4.0*MathTools::MathConsts::CFrealPi());
+
+  for (CFuint l = 1; l <= m_nbLModes; ++l) {
+    const CFuint l0 = idx(l,0);
+    const CFuint l1 = idx(l-1,0);
+    const CFuint l2 = (l > 1) ? idx(l-2,0) : 0;
+
+    // Rlm Plm = x Pl-1m - Rl-1m Pl-2m
+    for (CFuint m = 0; m + 2 <= l; ++m) {
+      m_Plm[l0+m] = (x*m_Plm[l1+m] - m_Rlm[l1+m]*m_Plm[l2+m])*m_invRlm[l0+m];
+    }
+
+    const CFreal dl = (CFreal)l;
+    m_Plm[l0+l-1] = x*sqrt(2.0*dl + 1.0)*m_Plm[l1+l-1];
+    m_Plm[l0+l]   = -sqrt((2.0*dl + 1.0)/(2.0*dl))*sinTheta*m_Plm[l1+l-1];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void PFSSMagneticField::computePowers(const CFreal r)
+{
+  const CFuint zero = m_nbLModes + 2;
+  const CFreal invR = 1.0/r;
+
+  m_rPow[zero] = 1.0;
+  for (CFuint k = 1; k <= m_nbLModes + 1; ++k) {
+    m_rPow[zero+k] = m_rPow[zero+k-1]*r;
+  }
+  for (CFuint k = 1; k <= m_nbLModes + 2; ++k) {
+    m_rPow[zero-k] = m_rPow[zero-k+1]*invR;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void PFSSMagneticField::computeHarmonics(const CFreal phi)
+{
+  const CFreal cosPhi = cos(phi);
+  const CFreal sinPhi = sin(phi);
+
+  m_cosmphi[0] = 1.0;
+  m_sinmphi[0] = 0.0;
+  for (CFuint m = 1; m <= m_nbLModes; ++m) {
+    m_cosmphi[m] = m_cosmphi[m-1]*cosPhi - m_sinmphi[m-1]*sinPhi;
+    m_sinmphi[m] = m_sinmphi[m-1]*cosPhi + m_cosmphi[m-1]*sinPhi;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void PFSSMagneticField::compute(const CFuint nbLModes,
+                                const CFreal r, const CFreal theta, const CFreal phi,
+                                const DataHandle<std::vector<CFreal> >& Almreal,
+                                const DataHandle<std::vector<CFreal> >& Almimg,
+                                const DataHandle<std::vector<CFreal> >& Blmreal,
+                                const DataHandle<std::vector<CFreal> >& Blmimg,
+                                RealVector& BSpherical)
+{
+  setNbLModes(nbLModes);
+
+  const CFreal x = cos(theta);
+  computeLegendre(x, sqrt((1.0 - x)*(1.0 + x)));
+  computePowers(r);
+  computeHarmonics(phi);
+
+  const CFreal BthetaCoeff = -1.0/(r*sin(theta));
+
+  // the real part of Flm*exp(i*m*phi), with Flm = ampl*exp(i*angle), is
+  // ampl*cos(angle + m*phi) = Flmreal*cos(m*phi) - Flmimg*sin(m*phi)
+  // TBD: In order to obtain the correct polarity of the magnetic dipoles on
+  // the photosphere -= is used instead of += for Br, Bphi and Btheta.
+  // This should be checked.
+  CFreal Br = 0.0, Btheta = 0.0, Bphi = 0.0;
+
+  for (CFuint l = 0; l <= nbLModes; ++l) {
+    const int il = (int)l;
+    const CFreal dl = (CFreal)l;
+    const CFreal rBrA = -dl*rPow(il-1);
+    const CFreal rBrB = (dl + 1.0)*rPow(-il-2);
+    const CFreal rBphiA = rPow(il);
+    const CFreal rBphiB = rPow(-il-1);
+    const vector<CFreal>& Alr = Almreal[l];
+    const vector<CFreal>& Ali = Almimg[l];
+    const vector<CFreal>& Blr = Blmreal[l];
+    const vector<CFreal>& Bli = Blmimg[l];
+    const CFuint l0 = idx(l,0);
+
+    for (CFuint m = 0; m <= l; ++m) {
+      const CFreal Ylm = m_Plm[l0+m];
+      const CFreal Brreal = Alr[m]*rBrA + Blr[m]*rBrB;
+      const CFreal Brimg  = Ali[m]*rBrA + Bli[m]*rBrB;
+      const CFreal coeff = BthetaCoeff*(CFreal)m;
+      const CFreal Bphireal = coeff*(Alr[m]*rBphiA + Blr[m]*rBphiB);
+      const CFreal Bphiimg  = coeff*(Ali[m]*rBphiA + Bli[m]*rBphiB);
+
+      Br -= Ylm*(Brreal*m_cosmphi[m] - Brimg*m_sinmphi[m]);
+      // cos(angle + m*phi + pi/2) = -sin(angle + m*phi)
+      Bphi += Ylm*(Bphiimg*m_cosmphi[m] + Bphireal*m_sinmphi[m]);
+    }
+  }
+
+  for (CFuint l = 1; l + 1 <= nbLModes; ++l) {
+    const int il = (int)l;
+    const CFreal dl = (CFreal)l;
+    const CFreal rLm1A = (dl - 1.0)*rPow(il-1);
+    const CFreal rLm1B = (dl - 1.0)*rPow(-il);
+    const CFreal rLp1A = (dl + 2.0)*rPow(il+1);
+    const CFreal rLp1B = (dl + 2.0)*rPow(-il-2);
+    const vector<CFreal>& Alr = Almreal[l-1];
+    const vector<CFreal>& Ali = Almimg[l-1];
+    const vector<CFreal>& Blr = Blmreal[l-1];
+    const vector<CFreal>& Bli = Blmimg[l-1];
+    const vector<CFreal>& Alp1r = Almreal[l+1];
+    const vector<CFreal>& Alp1i = Almimg[l+1];
+    const vector<CFreal>& Blp1r = Blmreal[l+1];
+    const vector<CFreal>& Blp1i = Blmimg[l+1];
+    const CFuint l0 = idx(l,0);
+    const CFuint lp10 = idx(l+1,0);
+
+    for (CFuint m = 0; m <= l; ++m) {
+      const CFreal Ylm = m_Plm[l0+m];
+      const CFreal Rlm = m_Rlm[l0+m];
+      const CFreal Rlp1m = m_Rlm[lp10+m];
+
+      // Rlm = 0 for m = l, where the mode l-1 does not exist
+      CFreal Bthetareal = -Rlp1m*(Alp1r[m]*rLp1A + Blp1r[m]*rLp1B);
+      CFreal Bthetaimg  = -Rlp1m*(Alp1i[m]*rLp1A + Blp1i[m]*rLp1B);
+      if (m < l) {
+        Bthetareal += Rlm*(Alr[m]*rLm1A + Blr[m]*rLm1B);
+        Bthetaimg  += Rlm*(Ali[m]*rLm1A + Bli[m]*rLm1B);
+      }
+
+      Btheta -= Ylm*BthetaCoeff*(Bthetareal*m_cosmphi[m] - Bthetaimg*m_sinmphi[m]);
+    }
+  }
+
+  BSpherical[0] = Br;
+  BSpherical[1] = Btheta;
+  BSpherical[2] = Bphi;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace MHD
+
+  } // namespace Physics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,129 @@
+#ifndef COOLFluiD_Physics_MHD_PFSSMagneticField_hh
+#define COOLFluiD_Physics_MHD_PFSSMagneticField_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataHandle.hh"
+#include "MathTools/RealVector.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Physics {
+
+    namespace MHD {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class evaluates the coronal magnetic field of the potential field
+ * source surface (PFSS) model from the spherical harmonics coefficients
+ * Alm, Blm of the magnetogram.
+ *
+ * The normalized associated Legendre functions (same normalization and
+ * Condon-Shortley phase as gsl_sf_legendre_sphPlm) are computed for all
+ * the (l,m) modes at once with the three-term recurrence in l, the powers
+ * of r and the harmonics in phi incrementally, so that the cost of one
+ * evaluation is O(nbLModes^2) without any call to pow() or to the special
+ * functions library.
+ */
+class PFSSMagneticField {
+public:
+
+  /**
+   * Default constructor
+   */
+  PFSSMagneticField();
+
+  /**
+   * Default destructor
+   */
+  ~PFSSMagneticField();
+
+  /**
+   * Compute the spherical components (Br, Btheta, Bphi) of the PFSS
+   * magnetic field at the point (r, theta, phi) below the source surface
+   * @param nbLModes  highest l mode used in the reconstruction
+   * @param Almreal   real part of Alm, indexed as Almreal[l][m]
+   * @param Almimg    imaginary part of Alm
+   * @param Blmreal   real part of Blm
+   * @param Blmimg    imaginary part of Blm
+   * @param BSpherical  resulting spherical components
+   */
+  void compute(const CFuint nbLModes,
+               const CFreal r, const CFreal theta, const CFreal phi,
+               const Framework::DataHandle<std::vector<CFreal> >& Almreal,
+               const Framework::DataHandle<std::vector<CFreal> >& Almimg,
+               const Framework::DataHandle<std::vector<CFreal> >& Blmreal,
+               const Framework::DataHandle<std::vector<CFreal> >& Blmimg,
+               RealVector& BSpherical);
+
+private: // helper functions
+
+  /**
+   * Position of the mode (l,m) in the triangular tables
+   */
+  static CFuint idx(const CFuint l, const CFuint m) {return l*(l+1)/2 + m;}
+
+  /**
+   * Resize the tables and compute the recurrence coefficients for nbLModes
+   */
+  void setNbLModes(const CFuint nbLModes);
+
+  /**
+   * Compute the normalized associated Legendre functions at x = cos(theta)
+   */
+  void computeLegendre(const CFreal x, const CFreal sinTheta);
+
+  /**
+   * Compute r^k for -(nbLModes+2) <= k <= nbLModes+1
+   */
+  void computePowers(const CFreal r);
+
+  /**
+   * Compute cos(m*phi) and sin(m*phi) for 0 <= m <= nbLModes
+   */
+  void computeHarmonics(const CFreal phi);
+
+  /**
+   * r^k, with k in [-(nbLModes+2), nbLModes+1]
+   */
+  CFreal rPow(const int k) const {return m_rPow[k + m_nbLModes + 2];}
+
+private: // data
+
+  /// number of l modes for which the tables are built
+  CFuint m_nbLModes;
+
+  /// Rlm = sqrt((l^2-m^2)/(4l^2-1)), coefficient of the recurrence in l
+  std::vector<CFreal> m_Rlm;
+
+  /// 1/Rlm, 0 for l = m
+  std::vector<CFreal> m_invRlm;
+
+  /// normalized associated Legendre functions
+  std::vector<CFreal> m_Plm;
+
+  /// powers of r
+  std::vector<CFreal> m_rPow;
+
+  /// cos(m*phi)
+  std::vector<CFreal> m_cosmphi;
+
+  /// sin(m*phi)
+  std::vector<CFreal> m_sinmphi;
+
+}; // end of class PFSSMagneticField
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace MHD
+
+  } // namespace Physics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Physics_MHD_PFSSMagneticField_hh
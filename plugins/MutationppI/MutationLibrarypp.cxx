@@ -72,6 +72,9 @@ MutationLibrarypp::MutationLibrarypp(const std::string& name) :
   m_hr(),
   m_hf(),  
   m_Tstate(),
+  m_TstatePert(),
+  m_omegaPert(),
+  m_dOmegaDRhoi(),
   _nameToIdxVar(), //@modif_LkT
   _lookUpTables()
 {
@@ -195,6 +198,9 @@ void MutationLibrarypp::setup()
   _hasElectrons = m_gasMixture->hasElectrons();  
   
   m_Tstate.resize(_nbTvibLocal+1);
+  m_TstatePert.resize(_nbTvibLocal+1);
+  m_omegaPert.resize(_NS);
+  m_dOmegaDRhoi.resize(_NS*_NS);
   
   CFLog(VERBOSE, "MutationLibrarypp::setup() => _nbTvibLocal = " << _nbTvibLocal << "\n");
   
@@ -642,7 +648,52 @@ void MutationLibrarypp::getMassProductionTerm(CFdouble& temperature,
     
   CFLog(DEBUG_MAX, "Mutation::getMassProductionTerm() => omega = " << omega << "\n\n");
   //EXIT_AT(1000);
-  // TODO: Need to figure out how to do the Jacobian later
+  
+  if (flagJac) {
+    computeMassProductionJacobian(omega, jacobian);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationLibrarypp::computeMassProductionJacobian(const RealVector& omega,
+						       RealMatrix& jacobian)
+{
+  // jacobian (nbEq*nbEq) contains the derivatives of the species rows in the
+  // order [rho_i v T Tv], the temperatures being the last variables
+  const CFuint nbEqs = jacobian.nbCols();
+  const CFuint nbT = m_Tstate.size();
+  const CFuint nbSpecies = _NS;
+  cf_assert(nbEqs >= nbSpecies + nbT);
+  const CFuint startT = nbEqs - nbT;
+  
+  jacobian = 0.0;
+  if (_freezeChemistry) return;
+  
+  // derivatives in the partial densities at constant temperatures
+  m_gasMixture->jacobianRho(&m_dOmegaDRhoi[0]);
+  for (CFuint is = 0; is < nbSpecies; ++is) {
+    for (CFuint js = 0; js < nbSpecies; ++js) {
+      jacobian(is,js) = m_dOmegaDRhoi[is*nbSpecies + js];
+    }
+  }
+  
+  // derivatives in the temperatures: one evaluation of the rates per temperature
+  for (CFuint it = 0; it < nbT; ++it) {
+    m_TstatePert = m_Tstate;
+    const CFdouble dT = 1.0e-7*std::max(m_Tstate[it], 1.0);
+    m_TstatePert[it] += dT;
+    m_gasMixture->setState(&m_rhoiv[0], &m_TstatePert[0], 1);
+    m_gasMixture->netProductionRates(&m_omegaPert[0]);
+    
+    const CFdouble ovDT = 1.0/dT;
+    for (CFuint is = 0; is < nbSpecies; ++is) {
+      jacobian(is,startT+it) = (m_omegaPert[is] - omega[is])*ovDT;
+    }
+  }
+  
+  // restore the unperturbed state
+  m_gasMixture->setState(&m_rhoiv[0], &m_Tstate[0], 1);
 }
       
 //////////////////////////////////////////////////////////////////////////////
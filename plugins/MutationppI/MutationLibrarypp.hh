@@ -595,6 +595,16 @@ protected: // helper function
    */
   void setTables(std::vector<ComputeQuantity>& varComputeVec);
   
+  /**
+   * Compute the Jacobian of the mass production terms with respect to
+   * the variables [rho_i v T Tv] at the state set by the last setState():
+   * the derivatives in rho_i are given by the kinetics, the ones in the
+   * temperatures by one-sided differences
+   * @param omega the unperturbed mass production terms
+   */
+  void computeMassProductionJacobian(const RealVector& omega,
+				     RealMatrix& jacobian);
+  
 protected: //variables
 
   /// flag telling if to use the look up tables
@@ -669,6 +679,15 @@ protected: //variables
   /// state temperatures
   RealVector m_Tstate;
 
+  /// perturbed state temperatures
+  RealVector m_TstatePert;
+
+  /// perturbed mass production terms
+  RealVector m_omegaPert;
+
+  /// derivatives of the mass production terms in the partial densities
+  std::vector<CFdouble> m_dOmegaDRhoi;
+
   /// mixture name
   std::string _mixtureName;
     
@@ -137,7 +137,10 @@ void BDF2::takeStepImpl()
    
     CFLog(VERBOSE, "BDF2::takeStep(): m_data->freezeJacobian() " << m_data->freezeJacobian() << "\n");
     // this will make the solvers compute the jacobian only during the first iteration at each time step
-    (m_data->freezeJacobian() && k > 1) ? m_data->setDoComputeJacobFlag(false) : m_data->setDoComputeJacobFlag(true);
+    // or when decided by the jacobian reuse policy: the time contribution changes from backward Euler
+    // to BDF2 at the second time step, so that the jacobian cannot be reused there
+    setDoComputeJacobFlag(k == 0, m_data->freezeJacobian() && k > 1,
+			  k == 0 && subSysStatus->getNbIter() <= 2);
     
     // this is needed for cases like jacobian free or in case the jacobian needs to be frozen for k>=1
     getMethodData()->getCollaborator<SpaceMethod>()->setComputeJacobianFlag(m_data->getDoComputeJacobFlag());
@@ -173,6 +176,7 @@ void BDF2::takeStepImpl()
     
     // synchronize the states and compute the residual norms
     ConvergenceMethod::syncGlobalDataComputeResidual(true);
+    updateJacobianReusePolicy();
 
     // Display info over each step of the Newton iterator
     if (m_data->isPrintHistory())
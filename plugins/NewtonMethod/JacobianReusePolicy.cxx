@@ -0,0 +1,222 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <cmath>
+
+#include "Common/BadValueException.hh"
+#include "Common/CFLog.hh"
+
+#include "NewtonMethod/JacobianReusePolicy.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace NewtonMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+void JacobianReusePolicy::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< bool >("Active","Reuse the jacobian and the preconditioner according to the convergence (the default false assembles them at every step).");
+  options.addConfigOption< CFuint >("MaxJacobianAge","Maximum number of Newton steps with the same jacobian.");
+  options.addConfigOption< CFuint >("MaxPreconditionerAge","Maximum number of jacobians with the same preconditioner.");
+  options.addConfigOption< CFreal >("MaxContraction","Maximum ratio of two successive Newton residuals of a time step with a reused jacobian.");
+  options.addConfigOption< CFreal >("MaxLinearIterRatio","Maximum ratio of the linear iterations to the ones obtained with a new preconditioner.");
+  options.addConfigOption< CFreal >("MaxCFLChange","Maximum relative change of the CFL with the same preconditioner.");
+  options.addConfigOption< CFreal >("MaxDTChange","Maximum relative change of the time step with the same jacobian.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+JacobianReusePolicy::JacobianReusePolicy() :
+  OwnedObject(),
+  ConfigObject("JacobianReuse"),
+  m_jacobianAge(0),
+  m_preconditionerAge(0),
+  m_hasJacobian(false),
+  m_cflFactor(0.),
+  m_dtJacobian(0.),
+  m_lastResidual(0.),
+  m_residual(0.),
+  m_hasLastResidual(false),
+  m_hasResidual(false),
+  m_nbLinearIter(0),
+  m_refLinearIter(0),
+  m_lastFactor(false),
+  m_nbAssemblies(0),
+  m_nbFactorizations(0),
+  m_nbReuses(0)
+{
+  addConfigOptionsTo(this);
+
+  m_isActive = false;
+  setParameter("Active",&m_isActive);
+
+  m_maxJacobianAge = 10;
+  setParameter("MaxJacobianAge",&m_maxJacobianAge);
+
+  m_maxPreconditionerAge = 1;
+  setParameter("MaxPreconditionerAge",&m_maxPreconditionerAge);
+
+  m_maxContraction = 0.5;
+  setParameter("MaxContraction",&m_maxContraction);
+
+  m_maxLinearIterRatio = 2.;
+  setParameter("MaxLinearIterRatio",&m_maxLinearIterRatio);
+
+  m_maxCFLChange = 0.5;
+  setParameter("MaxCFLChange",&m_maxCFLChange);
+
+  m_maxDTChange = 0.1;
+  setParameter("MaxDTChange",&m_maxDTChange);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+JacobianReusePolicy::~JacobianReusePolicy()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void JacobianReusePolicy::configure(Config::ConfigArgs& args)
+{
+  ConfigObject::configure(args);
+
+  if (m_maxJacobianAge == 0 || m_maxPreconditionerAge == 0) {
+    throw BadValueException
+      (FromHere(), "JacobianReusePolicy::configure() => MaxJacobianAge and MaxPreconditionerAge must be > 0");
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+JacobianReusePolicy::Decision JacobianReusePolicy::decide(const bool newTimeStep,
+                                                          const bool force,
+                                                          const CFreal cfl,
+                                                          const CFreal dt)
+{
+  // the contraction is only measured between the steps of the same time step
+  if (newTimeStep) {
+    m_hasResidual = false;
+    m_hasLastResidual = false;
+  }
+
+  bool assemble = false;
+  bool factor = false;
+  std::string reason = "";
+
+  if (!m_hasJacobian || force) {
+    assemble = factor = true;
+    reason = "first or forced";
+  }
+  else {
+    if (m_jacobianAge >= m_maxJacobianAge) {
+      assemble = true;
+      reason = "jacobian age";
+    }
+    else if (dt > 0. && m_dtJacobian > 0. &&
+             std::abs(dt - m_dtJacobian) > m_maxDTChange*m_dtJacobian) {
+      assemble = factor = true;
+      reason = "time step change";
+    }
+    else if (m_hasLastResidual && m_jacobianAge > 1 &&
+             std::pow(10., m_residual - m_lastResidual) > m_maxContraction) {
+      assemble = true;
+      reason = "contraction";
+    }
+
+    if (m_refLinearIter > 0 && m_nbLinearIter > m_maxLinearIterRatio*m_refLinearIter) {
+      assemble = factor = true;
+      reason = "linear iterations";
+    }
+
+    if (assemble && !factor) {
+      if (m_preconditionerAge >= m_maxPreconditionerAge) {
+        factor = true;
+        reason += ", preconditioner age";
+      }
+      else if (std::abs(cfl - m_cflFactor) > m_maxCFLChange*m_cflFactor) {
+        factor = true;
+        reason += ", CFL change";
+      }
+    }
+  }
+
+  Decision decision = REUSE;
+  if (assemble) {
+    m_hasJacobian = true;
+    m_jacobianAge = 0;
+    m_dtJacobian = dt;
+    ++m_nbAssemblies;
+
+    if (factor) {
+      m_preconditionerAge = 0;
+      m_cflFactor = cfl;
+      ++m_nbFactorizations;
+    }
+    ++m_preconditionerAge;
+    decision = (factor) ? ASSEMBLE_AND_FACTOR : ASSEMBLE;
+  }
+  else {
+    ++m_nbReuses;
+  }
+  ++m_jacobianAge;
+  m_lastFactor = factor;
+
+  const std::string name = (decision == ASSEMBLE_AND_FACTOR) ? "assemble jacobian and preconditioner" :
+    (decision == ASSEMBLE) ? "assemble jacobian, reuse preconditioner" : "reuse jacobian and preconditioner";
+  CFLog(VERBOSE, "JacobianReusePolicy::decide() => " << name
+        << (reason.empty() ? std::string("") : " [" + reason + "]")
+        << ", assemblies [" << m_nbAssemblies << "], factorizations ["
+        << m_nbFactorizations << "], reuses [" << m_nbReuses << "]\n");
+
+  return decision;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void JacobianReusePolicy::update(const CFreal residual, const CFuint nbLinearIter)
+{
+  if (m_hasResidual) {
+    m_lastResidual = m_residual;
+    m_hasLastResidual = true;
+  }
+  m_residual = residual;
+  m_hasResidual = true;
+
+  m_nbLinearIter = nbLinearIter;
+  if (m_lastFactor) {
+    m_refLinearIter = nbLinearIter;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void JacobianReusePolicy::printStatistics() const
+{
+  CFLog(INFO, "JacobianReusePolicy => jacobian assemblies [" << m_nbAssemblies
+        << "], preconditioner computations [" << m_nbFactorizations
+        << "], steps reusing both [" << m_nbReuses << "]\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace NewtonMethod
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
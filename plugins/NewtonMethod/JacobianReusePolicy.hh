@@ -0,0 +1,159 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_NewtonMethod_JacobianReusePolicy_hh
+#define COOLFluiD_Numerics_NewtonMethod_JacobianReusePolicy_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Common/OwnedObject.hh"
+#include "Config/ConfigObject.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace NewtonMethod {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class decides, before each Newton step, whether the jacobian has to
+/// be assembled again and whether the preconditioner has to be recomputed,
+/// or whether both can be reused from the previous steps (also across time
+/// steps).
+///
+/// The jacobian is assembled again when it gets too old, when the nonlinear
+/// iterations stop contracting, when the time step changes or when the
+/// linear iterations grow with respect to the ones obtained right after the
+/// last preconditioner computation. Otherwise the jacobian and the
+/// preconditioner are both reused. When the jacobian is assembled again, the
+/// preconditioner is recomputed only if it is too old, if the CFL changed or
+/// if the linear iterations grew.
+///
+/// The residuals are the ones of the SubSystemStatus (in log10).
+class JacobianReusePolicy :
+    public Common::OwnedObject,
+    public Config::ConfigObject {
+public:
+
+  /// Decision taken before a Newton step
+  enum Decision {ASSEMBLE_AND_FACTOR=0, ASSEMBLE=1, REUSE=2};
+
+  /// Defines the Config Option's of this class
+  /// @param options a OptionList where to add the Option's
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /// Constructor
+  JacobianReusePolicy();
+
+  /// Destructor
+  ~JacobianReusePolicy();
+
+  /// Configure the object
+  virtual void configure(Config::ConfigArgs& args);
+
+  /// Tell if the policy is active
+  bool isActive() const {return m_isActive;}
+
+  /// Decide what to do at the next Newton step
+  /// @param newTimeStep  the step is the first one of a new time step
+  /// @param force        the jacobian and the preconditioner must be recomputed
+  /// @param cfl          current CFL number
+  /// @param dt           current time step (<= 0 for steady computations)
+  Decision decide(const bool newTimeStep, const bool force,
+                  const CFreal cfl, const CFreal dt);
+
+  /// Account for the outcome of the last Newton step
+  /// @param residual     residual after the step
+  /// @param nbLinearIter iterations of the linear solver (0 if unknown)
+  void update(const CFreal residual, const CFuint nbLinearIter);
+
+  /// Print the counters of the decisions
+  void printStatistics() const;
+
+private: // data
+
+  /// flag telling if the policy is active
+  bool m_isActive;
+
+  /// maximum number of Newton steps with the same jacobian
+  CFuint m_maxJacobianAge;
+
+  /// maximum number of jacobians with the same preconditioner
+  CFuint m_maxPreconditionerAge;
+
+  /// maximum ratio of two successive residuals with a reused jacobian
+  CFreal m_maxContraction;
+
+  /// maximum ratio of the linear iterations to the reference ones
+  CFreal m_maxLinearIterRatio;
+
+  /// maximum relative change of the CFL since the last preconditioner
+  CFreal m_maxCFLChange;
+
+  /// maximum relative change of the time step since the last jacobian
+  CFreal m_maxDTChange;
+
+  /// Newton steps done with the current jacobian
+  CFuint m_jacobianAge;
+
+  /// jacobians assembled with the current preconditioner
+  CFuint m_preconditionerAge;
+
+  /// flag telling if a jacobian has been assembled
+  bool m_hasJacobian;
+
+  /// CFL when the preconditioner was computed
+  CFreal m_cflFactor;
+
+  /// time step when the jacobian was assembled
+  CFreal m_dtJacobian;
+
+  /// residual before the last step
+  CFreal m_lastResidual;
+
+  /// residual after the last step
+  CFreal m_residual;
+
+  /// flag telling if m_lastResidual is valid
+  bool m_hasLastResidual;
+
+  /// flag telling if m_residual is valid
+  bool m_hasResidual;
+
+  /// linear iterations of the last step
+  CFuint m_nbLinearIter;
+
+  /// linear iterations of the first step after the last preconditioner computation
+  CFuint m_refLinearIter;
+
+  /// flag telling if the last step recomputed the preconditioner
+  bool m_lastFactor;
+
+  /// number of jacobian assemblies
+  CFuint m_nbAssemblies;
+
+  /// number of preconditioner computations
+  CFuint m_nbFactorizations;
+
+  /// number of steps reusing both
+  CFuint m_nbReuses;
+
+}; // end of class JacobianReusePolicy
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace NewtonMethod
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_NewtonMethod_JacobianReusePolicy_hh
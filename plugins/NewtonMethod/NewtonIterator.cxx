@@ -4,6 +4,8 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include <algorithm>
+
 #include "Common/Stopwatch.hh"
 
 #include "Environment/ObjectProvider.hh"
@@ -147,6 +149,10 @@ void NewtonIterator::setMethodImpl()
 
 void NewtonIterator::unsetMethodImpl()
 {
+  if (m_data->getJacobianReusePolicy().isActive()) {
+    m_data->getJacobianReusePolicy().printStatistics();
+  }
+  
   m_unSetup->execute();
   unsetupCommandsAndStrategies();
 
@@ -233,7 +239,8 @@ void NewtonIterator::takeStepImpl()
    
     CFLog(VERBOSE, "NewtonIterator::takeStep(): m_data->freezeJacobian() " << m_data->freezeJacobian() << "\n");
     // this will make the solvers compute the jacobian only during the first iteration at each time step
-    (m_data->freezeJacobian() && k > 1) ? m_data->setDoComputeJacobFlag(false) : m_data->setDoComputeJacobFlag(true);
+    // or when decided by the jacobian reuse policy
+    setDoComputeJacobFlag(k == 1, m_data->freezeJacobian() && k > 1, false);
     
     // this is needed for cases like jacobian free
     getMethodData()->getCollaborator<SpaceMethod>()->setComputeJacobianFlag( m_data->getDoComputeJacobFlag() );
@@ -284,6 +291,7 @@ void NewtonIterator::takeStepImpl()
     
     // synchronize the states and compute the residual norms
     ConvergenceMethod::syncGlobalDataComputeResidual(true);
+    updateJacobianReusePolicy();
 
     getMethodData()->getCollaborator<SpaceMethod>()->postProcessSolution();
     getConvergenceMethodData()->getConvergenceStatus().res = subSysStatus->getResidual();
@@ -305,6 +313,47 @@ void NewtonIterator::takeStepImpl()
   CFLog(VERBOSE, "NewtonIterator::takeStepImpl() END\n");
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+void NewtonIterator::setDoComputeJacobFlag(const bool newTimeStep,
+					   const bool freeze,
+					   const bool force)
+{
+  JacobianReusePolicy& policy = m_data->getJacobianReusePolicy();
+  if (!policy.isActive()) {
+    m_data->setDoComputeJacobFlag(!freeze);
+    return;
+  }
+  
+  const CFreal cfl = getConvergenceMethodData()->getCFL()->getCFLValue();
+  const CFreal dt  = SubSystemStatusStack::getActive()->getDT();
+  const JacobianReusePolicy::Decision decision = policy.decide(newTimeStep, force, cfl, dt);
+  
+  m_data->setDoComputeJacobFlag(decision != JacobianReusePolicy::REUSE);
+  
+  MultiMethodHandle<LinearSystemSolver> lss = getLinearSystemSolver();
+  for (CFuint i = 0; i < lss.size(); ++i) {
+    lss[i]->setReusePreconditioner(decision != JacobianReusePolicy::ASSEMBLE_AND_FACTOR);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void NewtonIterator::updateJacobianReusePolicy()
+{
+  JacobianReusePolicy& policy = m_data->getJacobianReusePolicy();
+  if (!policy.isActive()) return;
+  
+  // the slowest linear system drives the decisions
+  CFuint nbLinearIter = 0;
+  MultiMethodHandle<LinearSystemSolver> lss = getLinearSystemSolver();
+  for (CFuint i = 0; i < lss.size(); ++i) {
+    nbLinearIter = std::max(nbLinearIter, lss[i]->getNbIterations());
+  }
+  
+  policy.update(SubSystemStatusStack::getActive()->getResidual(), nbLinearIter);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
     } // namespace NewtonMethod
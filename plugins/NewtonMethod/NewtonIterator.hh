@@ -60,6 +60,17 @@ protected: // helper functions
   /// @return SafePtr to the ConvergenceMethodData
   virtual Common::SafePtr<Framework::ConvergenceMethodData> getConvergenceMethodData();
 
+  /// Sets the flag telling to compute the jacobian at the next Newton step,
+  /// following the jacobian reuse policy if it is active or FreezeJacobian
+  /// otherwise
+  /// @param newTimeStep  the step is the first one of a new time step
+  /// @param freeze       the jacobian is frozen (without reuse policy)
+  /// @param force        the jacobian and the preconditioner must be recomputed
+  void setDoComputeJacobFlag(const bool newTimeStep, const bool freeze, const bool force);
+
+  /// Gives the outcome of the last Newton step to the jacobian reuse policy
+  void updateJacobianReusePolicy();
+
 protected: // abstract interface implementations
 
   /// Take one timestep
@@ -42,7 +42,8 @@ void NewtonIteratorData::defineConfigOptions(Config::OptionList& options)
 NewtonIteratorData::NewtonIteratorData(Common::SafePtr<Framework::Method> owner)
   : ConvergenceMethodData(owner),
     m_achieved(false),
-    m_lss()
+    m_lss(),
+    m_jacobianReuse()
 {
    addConfigOptionsTo(this);
 
@@ -71,6 +72,8 @@ void NewtonIteratorData::configure ( Config::ConfigArgs& args )
 {
   ConvergenceMethodData::configure(args);
 
+  configureNested(&m_jacobianReuse, args);
+
   // if the maximum number of steps has not been specified, just resize
   // the corresponding vector and set it to 1
   if (m_maxSteps.size() == 0) {
@@ -16,6 +16,7 @@
 #include "Framework/ComputeNorm.hh"
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/ConvergenceMethodData.hh"
+#include "NewtonMethod/JacobianReusePolicy.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -106,6 +107,12 @@ public: // functions
     cf_assert(m_lss.isNotNull());
     return m_lss;
   }
+
+  /// Get the policy deciding when the jacobian and the preconditioner are reused
+  JacobianReusePolicy& getJacobianReusePolicy()
+  {
+    return m_jacobianReuse;
+  }
   
 private: // data
 
@@ -127,6 +134,9 @@ private: // data
   /// flag to indicate saving files of system matrix, rhs and solution vectors at each iteration
   bool m_saveSystemToFile;
 
+  /// policy deciding when the jacobian and the preconditioner are reused
+  JacobianReusePolicy m_jacobianReuse;
+
 }; // end of class NewtonIteratorData
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,54 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_Petsc_FloatBILUPcContext_hh
+#define COOLFluiD_Numerics_Petsc_FloatBILUPcContext_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Petsc/PetscMatrix.hh"
+#include "Petsc/FloatBlockILU.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Petsc {
+    class JFContext;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class represents a tuple of data to be passed to the single precision
+ * block ILU(0) user defined preconditioner of Petsc
+ *
+ */
+class FloatBILUPcContext {
+public: // functions
+
+  /// Constructor
+  FloatBILUPcContext() : pJFC(CFNULL), precondMat(CFNULL), ilu() {}
+
+  /// pointer to JFContext
+  JFContext* pJFC;
+
+  /// preconditioner matrix
+  PetscMatrix* precondMat;
+
+  /// single precision factors of the local part of the preconditioner matrix
+  FloatBlockILU ilu;
+
+}; // end of class FloatBILUPcContext
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace Petsc
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_Petsc_FloatBILUPcContext_hh
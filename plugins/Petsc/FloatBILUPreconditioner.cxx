@@ -0,0 +1,221 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Petsc/FloatBILUPreconditioner.hh"
+#include "Petsc/PetscLSSData.hh"
+#include "Petsc/Petsc.hh"
+
+#include "Common/CFLog.hh"
+#include "Framework/MethodStrategyProvider.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::MathTools;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+    namespace Petsc {
+
+    extern PetscErrorCode FloatBILUPcApply(PC pc, Vec X, Vec Y);
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodStrategyProvider<FloatBILUPreconditioner,
+                       PetscLSSData,
+                       ShellPreconditioner,
+                       PetscModule>
+FloatBILUPreconditionerProvider("FloatBILU");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FloatBILUPreconditioner::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< CFreal >
+    ("RefactorRatio","Recompute the factorization when the Krylov iterations exceed this ratio of the ones obtained with the fresh factorization (<= 1 recomputes it at every system)");
+  options.addConfigOption< CFuint >
+    ("MaxReuse","Maximum number of systems solved with the same factorization");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FloatBILUPreconditioner::FloatBILUPreconditioner(const std::string& name) :
+  ShellPreconditioner(name),
+  _pcc(),
+  _nbReuse(0),
+  _refIter(0),
+  _needFactorization(true)
+{
+  addConfigOptionsTo(this);
+
+  _refactorRatio = 0.;
+  setParameter("RefactorRatio", &_refactorRatio);
+
+  _maxReuse = 10;
+  setParameter("MaxReuse", &_maxReuse);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FloatBILUPreconditioner::~FloatBILUPreconditioner()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FloatBILUPreconditioner::setPreconditioner()
+{
+  // getting the JFContext pointer into FloatBILUPcContext pcc
+  _pcc.pJFC = getMethodData().getJFContext();
+
+  PetscMatrix& precondMat = getMethodData().getPreconditionerMatrix();
+  _pcc.precondMat = &precondMat;
+
+  // here set the shell preconditioner
+  CF_CHKERRCONTINUE(PCShellSetContext(_pcc.pJFC->petscData->getPreconditioner(), &_pcc));
+  CF_CHKERRCONTINUE(PCShellSetApply(_pcc.pJFC->petscData->getPreconditioner(), FloatBILUPcApply));
+
+  _needFactorization = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FloatBILUPreconditioner::computeBeforeSolving()
+{
+  if (!_needFactorization) {
+    CFLog(VERBOSE, "FloatBILUPreconditioner::computeBeforeSolving() => reusing factorization ["
+          << _nbReuse << "]\n");
+    return;
+  }
+
+  copyMatrix();
+  _pcc.ilu.factorize();
+
+  _nbReuse = 0;
+  _refIter = 0;
+  _needFactorization = false;
+
+  CFLog(VERBOSE, "FloatBILUPreconditioner::computeBeforeSolving() => factors take ["
+        << _pcc.ilu.getMemorySize() << "] bytes\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FloatBILUPreconditioner::computeAfterSolving()
+{
+  CFint iter = 0;
+  CF_CHKERRCONTINUE(KSPGetIterationNumber(getMethodData().getKSP(), &iter));
+
+  // the first system solved gives the reference convergence
+  if (_nbReuse == 0) {
+    _refIter = iter;
+  }
+  ++_nbReuse;
+
+  _needFactorization = (_refactorRatio <= 1.) || (_nbReuse >= _maxReuse) ||
+    (iter > _refactorRatio*_refIter);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FloatBILUPreconditioner::copyMatrix()
+{
+  // local diagonal block of the preconditioner matrix (the matrix itself in serial)
+  Mat localMat;
+  CF_CHKERRCONTINUE(MatGetDiagonalBlock(_pcc.precondMat->getMat(), &localMat));
+
+  CFint nbRows = 0;
+  CFint nbCols = 0;
+  CF_CHKERRCONTINUE(MatGetSize(localMat, &nbRows, &nbCols));
+
+  const CFuint bs = getMethodData().getNbSysEquations();
+  cf_assert(nbRows % bs == 0);
+  const CFuint nbBlockRows = nbRows/bs;
+
+  CFint nbEntries = 0;
+  const CFint* cols = CFNULL;
+  const CFreal* vals = CFNULL;
+
+  // the first scalar row of each block row gives the block columns
+  if (!_pcc.ilu.hasPattern()) {
+    vector<CFuint> rowStart(1, 0);
+    vector<CFuint> blockCols;
+    rowStart.reserve(nbBlockRows + 1);
+    for (CFuint i = 0; i < nbBlockRows; ++i) {
+      CF_CHKERRCONTINUE(MatGetRow(localMat, i*bs, &nbEntries, &cols, CFNULL));
+      for (CFint k = 0; k < nbEntries; k += bs) {
+        blockCols.push_back(cols[k]/bs);
+      }
+      CF_CHKERRCONTINUE(MatRestoreRow(localMat, i*bs, &nbEntries, &cols, CFNULL));
+      rowStart.push_back(blockCols.size());
+    }
+    _pcc.ilu.setPattern(bs, rowStart, blockCols);
+  }
+  cf_assert(_pcc.ilu.getNbBlockRows() == nbBlockRows);
+
+  // the blocks are stored column by column
+  for (CFuint i = 0; i < nbBlockRows; ++i) {
+    const CFuint start = _pcc.ilu.getRowStart(i);
+    for (CFuint ir = 0; ir < bs; ++ir) {
+      const CFuint row = i*bs + ir;
+      CF_CHKERRCONTINUE(MatGetRow(localMat, row, &nbEntries, &cols, &vals));
+      cf_assert(static_cast<CFuint>(nbEntries) == (_pcc.ilu.getRowStart(i+1) - start)*bs);
+      for (CFint k = 0; k < nbEntries; ++k) {
+        const CFuint kb = start + k/bs;
+        cf_assert(_pcc.ilu.getBlockCol(kb) == static_cast<CFuint>(cols[k])/bs);
+        _pcc.ilu.getBlock(kb)[(cols[k]%bs)*bs + ir] = vals[k];
+      }
+      CF_CHKERRCONTINUE(MatRestoreRow(localMat, row, &nbEntries, &cols, &vals));
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+PetscErrorCode FloatBILUPcApply(PC pc, Vec X, Vec Y)
+{
+  // X is input vector - vector to be preconditioned
+  // Y is output vector - preconditioned vector X
+  PetscFunctionBegin;
+
+  void* ctx;  CF_CHKERRCONTINUE(PCShellGetContext(pc,&ctx));
+
+  // getting the FloatBILU preconditioner context
+  FloatBILUPcContext* pcContext = (FloatBILUPcContext*)(ctx);
+
+  CFreal* xArray;
+  CFreal* yArray;
+  CF_CHKERRCONTINUE(VecGetArray(X, &xArray));
+  CF_CHKERRCONTINUE(VecGetArray(Y, &yArray));
+
+  pcContext->ilu.solve(xArray, yArray);
+
+  CF_CHKERRCONTINUE(VecRestoreArray(X, &xArray));
+  CF_CHKERRCONTINUE(VecRestoreArray(Y, &yArray));
+
+  PetscFunctionReturn(0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > FloatBILUPreconditioner::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result = ShellPreconditioner::needsSockets();
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace Petsc
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,111 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_Petsc_FloatBILUPreconditioner_hh
+#define COOLFluiD_Numerics_Petsc_FloatBILUPreconditioner_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Petsc/ShellPreconditioner.hh"
+#include "Petsc/FloatBILUPcContext.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Petsc {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class represents a shell preconditioner applying a block ILU(0)
+ * factorization of the local part of the preconditioner matrix, stored in
+ * single precision while the Krylov vectors stay in double precision.
+ *
+ * The factorization can be reused over several linear systems, until the
+ * number of Krylov iterations grows beyond a given ratio of the one
+ * obtained with the fresh factorization.
+ *
+ */
+class FloatBILUPreconditioner : public ShellPreconditioner {
+public:
+
+  /**
+   * Constructor
+   */
+  FloatBILUPreconditioner(const std::string& name);
+
+  /**
+   * Default destructor
+   */
+  ~FloatBILUPreconditioner();
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Set the preconditioner
+   */
+  virtual void setPreconditioner();
+
+  /**
+   * Compute before solving the system
+   */
+  virtual void computeBeforeSolving();
+
+  /**
+   * Compute after solving the system
+   */
+  virtual void computeAfterSolving();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  virtual std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+private:
+
+  /**
+   * Copy the local part of the preconditioner matrix into the factors,
+   * setting their pattern at the first call
+   */
+  void copyMatrix();
+
+private:
+
+  /// FloatBILU context
+  FloatBILUPcContext _pcc;
+
+  /// ratio of Krylov iterations beyond which the factorization is recomputed
+  CFreal _refactorRatio;
+
+  /// maximum number of linear systems solved with the same factorization
+  CFuint _maxReuse;
+
+  /// number of linear systems solved with the current factorization
+  CFuint _nbReuse;
+
+  /// number of Krylov iterations of the first system solved with the current factorization
+  CFint _refIter;
+
+  /// flag telling if the factorization has to be recomputed
+  bool _needFactorization;
+
+}; // end of class FloatBILUPreconditioner
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Petsc
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_Petsc_FloatBILUPreconditioner_hh
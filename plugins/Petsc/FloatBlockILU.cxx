@@ -0,0 +1,222 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "MathTools/MatrixInverter.hh"
+
+#include "Petsc/FloatBlockILU.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::MathTools;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Petsc {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Computes y -= b*x for a block b stored column by column: the inner loop
+/// runs over a contiguous column, so that it is vectorized by the compiler
+static inline void multSubBlock(const float *const b, const CFreal *const x,
+                                CFreal *const y, const CFuint n)
+{
+  for (CFuint j = 0; j < n; ++j) {
+    const CFreal xj = x[j];
+    const float *const bj = b + j*n;
+    for (CFuint i = 0; i < n; ++i) {
+      y[i] -= bj[i]*xj;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FloatBlockILU::FloatBlockILU() :
+  m_blockSize(0),
+  m_rowStart(),
+  m_cols(),
+  m_diag(),
+  m_values(),
+  m_work(),
+  m_inverter(CFNULL),
+  m_diagBlock(),
+  m_invDiagBlock()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FloatBlockILU::~FloatBlockILU()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FloatBlockILU::setPattern(const CFuint blockSize,
+                               const std::vector<CFuint>& rowStart,
+                               const std::vector<CFuint>& cols)
+{
+  cf_assert(blockSize > 0);
+  cf_assert(rowStart.size() > 0);
+  cf_assert(rowStart.back() == cols.size());
+
+  m_blockSize = blockSize;
+  m_rowStart = rowStart;
+  m_cols = cols;
+
+  const CFuint nbRows = getNbBlockRows();
+  m_diag.resize(nbRows);
+  for (CFuint i = 0; i < nbRows; ++i) {
+    CFuint k = m_rowStart[i];
+    while (k < m_rowStart[i+1] && m_cols[k] < i) {
+      ++k;
+    }
+    // ILU(0) needs all the diagonal blocks
+    cf_always_assert(k < m_rowStart[i+1] && m_cols[k] == i);
+    m_diag[i] = k;
+  }
+
+  const CFuint blockSize2 = blockSize*blockSize;
+  m_values.resize(m_cols.size()*blockSize2);
+  m_work.resize(blockSize2);
+
+  m_inverter.reset(MatrixInverter::create(blockSize, false));
+  m_diagBlock.resize(blockSize, blockSize);
+  m_invDiagBlock.resize(blockSize, blockSize);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FloatBlockILU::factorize()
+{
+  const CFuint n2 = m_blockSize*m_blockSize;
+  const CFuint nbRows = getNbBlockRows();
+
+  for (CFuint i = 0; i < nbRows; ++i) {
+    const CFuint rowEnd = m_rowStart[i+1];
+
+    for (CFuint kk = m_rowStart[i]; kk < m_diag[i]; ++kk) {
+      const CFuint k = m_cols[kk];
+
+      // L_ik = A_ik*inv(D_k), the diagonal blocks being stored inverted
+      multBlocks(block(kk), block(m_diag[k]));
+      float *const lik = getBlock(kk);
+      for (CFuint m = 0; m < n2; ++m) {
+        lik[m] = m_work[m];
+      }
+
+      // A_ij -= L_ik*U_kj for the blocks j > k present in both rows
+      CFuint jj = kk + 1;
+      CFuint pp = m_diag[k] + 1;
+      const CFuint kEnd = m_rowStart[k+1];
+      while (jj < rowEnd && pp < kEnd) {
+        if (m_cols[jj] < m_cols[pp]) {
+          ++jj;
+        }
+        else if (m_cols[jj] > m_cols[pp]) {
+          ++pp;
+        }
+        else {
+          multBlocks(lik, block(pp));
+          float *const aij = getBlock(jj);
+          for (CFuint m = 0; m < n2; ++m) {
+            aij[m] -= m_work[m];
+          }
+          ++jj;
+          ++pp;
+        }
+      }
+    }
+
+    invertBlock(getBlock(m_diag[i]));
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FloatBlockILU::solve(const CFreal *const x, CFreal *const y) const
+{
+  const CFuint n = m_blockSize;
+  const CFuint nbRows = getNbBlockRows();
+
+  // forward substitution with the unit lower factor
+  for (CFuint i = 0; i < nbRows; ++i) {
+    CFreal *const yi = y + i*n;
+    for (CFuint d = 0; d < n; ++d) {
+      yi[d] = x[i*n + d];
+    }
+    for (CFuint kk = m_rowStart[i]; kk < m_diag[i]; ++kk) {
+      multSubBlock(block(kk), y + m_cols[kk]*n, yi, n);
+    }
+  }
+
+  // backward substitution with the upper factor
+  for (CFuint i = nbRows; i > 0; --i) {
+    const CFuint row = i - 1;
+    CFreal *const yi = y + row*n;
+    for (CFuint kk = m_diag[row] + 1; kk < m_rowStart[row+1]; ++kk) {
+      multSubBlock(block(kk), y + m_cols[kk]*n, yi, n);
+    }
+
+    // y_i = inv(D_i)*y_i
+    for (CFuint d = 0; d < n; ++d) {
+      m_work[d] = -yi[d];
+      yi[d] = 0.;
+    }
+    multSubBlock(block(m_diag[row]), &m_work[0], yi, n);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FloatBlockILU::multBlocks(const float *const a, const float *const b) const
+{
+  const CFuint n = m_blockSize;
+  for (CFuint j = 0; j < n; ++j) {
+    CFreal *const cj = &m_work[j*n];
+    for (CFuint i = 0; i < n; ++i) {
+      cj[i] = 0.;
+    }
+    for (CFuint k = 0; k < n; ++k) {
+      const CFreal bkj = b[j*n + k];
+      const float *const ak = a + k*n;
+      for (CFuint i = 0; i < n; ++i) {
+        cj[i] += ak[i]*bkj;
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FloatBlockILU::invertBlock(float *const a)
+{
+  const CFuint n = m_blockSize;
+  for (CFuint j = 0; j < n; ++j) {
+    for (CFuint i = 0; i < n; ++i) {
+      m_diagBlock(i,j) = a[j*n + i];
+    }
+  }
+
+  m_inverter->invert(m_diagBlock, m_invDiagBlock);
+
+  for (CFuint j = 0; j < n; ++j) {
+    for (CFuint i = 0; i < n; ++i) {
+      a[j*n + i] = m_invDiagBlock(i,j);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Petsc
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
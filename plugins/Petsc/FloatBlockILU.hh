@@ -0,0 +1,152 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_Petsc_FloatBlockILU_hh
+#define COOLFluiD_Numerics_Petsc_FloatBlockILU_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <memory>
+#include <vector>
+
+#include "Common/NonCopyable.hh"
+#include "MathTools/RealMatrix.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MathTools {
+    class MatrixInverter;
+  }
+
+  namespace Petsc {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class represents a block ILU(0) factorization stored in single
+ * precision in block compressed sparse row (BCSR) format.
+ *
+ * The blocks are stored column by column, as in the Petsc BAIJ matrices,
+ * so that the block-vector products of the triangular solves run over
+ * contiguous columns. The diagonal blocks are stored inverted.
+ * The factorization and the solves accumulate in double precision, only
+ * the storage of the factors is in single precision.
+ *
+ */
+class FloatBlockILU : public Common::NonCopyable<FloatBlockILU> {
+public:
+
+  /**
+   * Constructor
+   */
+  FloatBlockILU();
+
+  /**
+   * Default destructor
+   */
+  ~FloatBlockILU();
+
+  /**
+   * Set the block sparsity pattern
+   * @param blockSize  size of the blocks
+   * @param rowStart   start of each block row in cols
+   * @param cols       block columns, sorted in each row, which must
+   *                   include the diagonal block
+   */
+  void setPattern(const CFuint blockSize,
+                  const std::vector<CFuint>& rowStart,
+                  const std::vector<CFuint>& cols);
+
+  /// @return true if the sparsity pattern has been set
+  bool hasPattern() const {return m_rowStart.size() > 1;}
+
+  /// @return the size of the blocks
+  CFuint getBlockSize() const {return m_blockSize;}
+
+  /// @return the number of block rows
+  CFuint getNbBlockRows() const {return m_rowStart.size() - 1;}
+
+  /// @return the start of the given block row
+  CFuint getRowStart(const CFuint row) const {return m_rowStart[row];}
+
+  /// @return the block column of the given block
+  CFuint getBlockCol(const CFuint k) const {return m_cols[k];}
+
+  /// @return the column-wise storage of the given block
+  float* getBlock(const CFuint k) {return &m_values[k*m_blockSize*m_blockSize];}
+
+  /// @return the memory taken by the factors, in bytes
+  CFuint getMemorySize() const
+  {
+    return m_values.size()*sizeof(float) +
+      (m_rowStart.size() + m_cols.size() + m_diag.size())*sizeof(CFuint);
+  }
+
+  /**
+   * Factorize in place the blocks previously filled with the matrix values
+   */
+  void factorize();
+
+  /**
+   * Solve L*U*y = x
+   * @param x  right hand side, of size getNbBlockRows()*getBlockSize()
+   * @param y  solution
+   */
+  void solve(const CFreal *const x, CFreal *const y) const;
+
+private: // helper functions
+
+  /// @return the column-wise storage of the given block
+  const float* block(const CFuint k) const {return &m_values[k*m_blockSize*m_blockSize];}
+
+  /// Computes c = a*b in the work array
+  void multBlocks(const float *const a, const float *const b) const;
+
+  /// Inverts the given block
+  void invertBlock(float *const a);
+
+private: // data
+
+  /// size of the blocks
+  CFuint m_blockSize;
+
+  /// start of each block row in m_cols
+  std::vector<CFuint> m_rowStart;
+
+  /// block columns
+  std::vector<CFuint> m_cols;
+
+  /// position of the diagonal block of each row
+  std::vector<CFuint> m_diag;
+
+  /// blocks of the matrix, then of the factors
+  std::vector<float> m_values;
+
+  /// work array of the size of a block
+  mutable std::vector<CFreal> m_work;
+
+  /// matrix inverter for the diagonal blocks
+  std::auto_ptr<MathTools::MatrixInverter> m_inverter;
+
+  /// diagonal block in double precision
+  RealMatrix m_diagBlock;
+
+  /// inverse of the diagonal block in double precision
+  RealMatrix m_invDiagBlock;
+
+}; // end of class FloatBlockILU
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Petsc
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_Petsc_FloatBlockILU_hh
@@ -162,6 +162,7 @@ void NewParSetup::setMatrix(const CFuint localSize,
                     0, &allNonZeroUp[0],
                     0, &outDiagNonZeroUp[0],
                     "Jacobian");
+  mat.accountMemory(nsp);
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -193,6 +193,7 @@ void ParJFSetup::setMatrix(const CFuint localSize,
                                0, &allNonZeroUp[0],
                                "PreconditionerMatrix");
     }
+    precondMat.accountMemory(nsp);
   }
 }
 
@@ -152,6 +152,7 @@ void ParMFSetup::setMatrix(const CFuint localSize,
 			0, &allNonZeroUp[0],
 			0, &outDiagNonZeroUp[0],
 			"PreconditionerMatrix");
+  precMat.accountMemory(nsp);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -7,6 +7,7 @@
 #include "Petsc/PetscHeaders.hh" // must come before any header
 
 #include "Common/PE.hh"
+#include "Common/MemoryAccounting.hh"
 #include "Framework/BlockAccumulator.hh"
 #include "Petsc/PetscMatrix.hh"
 
@@ -207,6 +208,21 @@ void PetscMatrix::createParBAIJ(MPI_Comm comm,
 
 //////////////////////////////////////////////////////////////////////////////
 
+void PetscMatrix::accountMemory(const std::string& nspaceName)
+{
+  const char* name = CFNULL;
+  CF_CHKERRCONTINUE(PetscObjectGetName((PetscObject) m_mat, &name));
+  
+  MatInfo info;
+  CF_CHKERRCONTINUE(MatGetInfo(m_mat, MAT_LOCAL, &info));
+  
+  const std::string label = nspaceName + "_PETSc_" + ((name != CFNULL) ? name : "Matrix");
+  Common::MemoryAccounting::getInstance().setGroup(label, nspaceName);
+  Common::MemoryAccounting::getInstance().setSize(label, info.memory);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 #ifdef CF_HAVE_MPI
 void PetscMatrix::createParJFMat(MPI_Comm comm,
 				 const CFint m,
@@ -159,6 +159,13 @@ public: // functions
 		      const char* name = CFNULL);
 #endif
   
+  /**
+   * Report the memory allocated for this matrix on this rank to the
+   * MemoryAccounting, under the label "<namespace>_PETSc_<matrix name>"
+   * @pre the matrix must be created and preallocated (not a shell matrix)
+   */
+  void accountMemory(const std::string& nspaceName);
+  
   /**
    * Start to assemble the matrix
    */
@@ -118,6 +118,7 @@ void StdSeqSetup::setMatrix(const CFuint localSize,
 		    nbNonZeroBlocks,
 		    &allNonZero[0],
 		    "Jacobian");
+  mat.accountMemory(getMethodData().getNamespace());
 }
 
 //////////////////////////////////////////////////////////////////////////////
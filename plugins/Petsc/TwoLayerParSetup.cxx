@@ -141,6 +141,7 @@ void TwoLayerParSetup::setMatrix(const CFuint localSize,
                     0, &allNonZeroUp[0],
                     0, &outDiagNonZeroUp[0],
                     "Jacobian");
+  mat.accountMemory(nsp);
 }
 
 //////////////////////////////////////////////////////////////////////////////
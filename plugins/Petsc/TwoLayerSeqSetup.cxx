@@ -110,6 +110,7 @@ void TwoLayerSeqSetup::setMatrix(const CFuint localSize,
                     nbNonZeroBlocks,
                     &totalAllNonZero[0],
                     "Jacobian");
+  mat.accountMemory(getMethodData().getNamespace());
 }
 
 //////////////////////////////////////////////////////////////////////////////
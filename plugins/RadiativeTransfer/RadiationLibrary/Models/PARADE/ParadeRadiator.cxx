@@ -68,6 +68,10 @@ void ParadeRadiator::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< bool > ("Equilibrium","Activation LTE");
  options.addConfigOption< bool > ("WriteHSNB","Writing HSNB input file");
   options.addConfigOption< bool > ("DataMassFractions","Activating mass fractions reading");
+  options.addConfigOption< string >
+    ("RunCommand", "Command running PARADE inside the local directory (a stand-in writing parade.rad can be given for testing).");
+  options.addConfigOption< CFreal >
+    ("CacheTolerance", "Relative tolerance on the temperatures and number densities below which the spectra computed for a previous state are reused (0 deactivates the cache).");
 }
   
 //////////////////////////////////////////////////////////////////////////////
@@ -88,7 +92,10 @@ ParadeRadiator::ParadeRadiator(const std::string& name) :
   m_elTempID(),
   m_vibTempID(),
   m_isLTE(),
-  m_massfraction()
+  m_massfraction(),
+  m_useCache(false),
+  m_cache(),
+  m_localInputs()
 {
   addConfigOptionsTo(this);
   
@@ -142,6 +149,12 @@ ParadeRadiator::ParadeRadiator(const std::string& name) :
 
   m_Equilibrium = false;
   setParameter("Equilibrium",&m_Equilibrium);
+  
+  m_runCommand = "./parade > outfile";
+  setParameter("RunCommand",&m_runCommand);
+  
+  m_cacheTolerance = 0.;
+  setParameter("CacheTolerance",&m_cacheTolerance);
 }
   
 //////////////////////////////////////////////////////////////////////////////
@@ -156,6 +169,8 @@ void ParadeRadiator::configure ( Config::ConfigArgs& args )
 {
   Radiator::configure(args);
   ConfigObject::configure(args);
+  
+  m_cache.setTolerance(m_cacheTolerance);
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -294,6 +309,8 @@ void ParadeRadiator::setLibrarySequentially()
             
 void ParadeRadiator::unsetup()
 {
+  m_cache.clear();
+  
   Radiator::unsetup();
 }
   
@@ -313,6 +330,9 @@ void ParadeRadiator::setupSpectra(CFreal wavMin, CFreal wavMax)
 	<<m_wavMin<<", wavMax: "<<m_wavMax<<"), dWav: "<<m_dWav<<
         " nbPoints: "<<m_nbPoints<<"\n");
   
+  // the existing radiative data are given for all the states
+  m_useCache = m_cache.isActive() && !m_reuseProperties;
+  
   if (!m_reuseProperties) {
     stp.start();
     // update the wavelength range inside parade.con
@@ -323,7 +343,9 @@ void ParadeRadiator::setupSpectra(CFreal wavMin, CFreal wavMax)
     writeLocalData();
     
     // run concurrently Parade in each local directory, one per process 
-    runLibraryInParallel();
+    if (!m_useCache || m_cache.getNbMisses() > 0) {
+      runLibraryInParallel();
+    }
   }
   
   PE::GetPE().setBarrier(m_namespace);
@@ -434,166 +456,88 @@ void ParadeRadiator::writeLocalData()
   const CFuint dim = PhysicalModelStack::getActive()->getDim();
   const CFuint nbTemps = m_radPhysicsHandlerPtr->getNbTemps();
   const CFuint tempID = m_radPhysicsHandlerPtr->getTempID();
+  const CFuint nbSpecies = m_library->getNbSpecies();
+  const CFuint nbInputs = nbTemps + nbSpecies;
   
   const CFuint totalNbPoints = m_pstates->getSize();
-  CFuint nbPoints = totalNbPoints;
-  CFuint countNode = 0;
-  // if the full mesh is in this process than you only write a part of its data
-  if (fullGridInProcess()) {
-    const CFuint nbPointsPerProc = nbPoints/m_nbProc;
-    nbPoints = (m_rank < m_nbProc-1) ? nbPointsPerProc : nbPointsPerProc + nbPoints%m_nbProc;
-    for (CFuint i = 0; i < m_rank; ++i) {
-      countNode += nbPointsPerProc;
-    }
-  }
-  
-  const CFuint startNode = countNode;
+  CFuint startNode = 0;
+  CFuint nbPoints = 0;
+  getLocalStatesRange(startNode, nbPoints);
   
   CFLog(INFO, "ParadeRadiator::writeLocalData() => nbPoints = " 
 	<< nbPoints << ", nbTemps = " << nbTemps 
 	<< ", tempID = " << tempID << "\n");
   
-  // write the mesh file
-  ofstream& foutG = m_outFileHandle->open(m_gridFile);
-  foutG << "TINA" << endl;
-  foutG << 1 << " " << nbPoints << endl;
-  for (CFuint i =0; i < nbPoints; ++i, ++countNode) {
-    foutG.precision(14);
-    foutG.setf(ios::scientific,ios::floatfield);
-    cf_assert(countNode < totalNbPoints);
-    CFreal *const node = m_pstates->getNode(countNode);
-    
-    if (dim == DIM_1D) {
-      foutG << node[XX] << " " << 0.0 << " " << 0.0  << endl;
-    }
-    if (dim == DIM_2D) {
-      foutG << node[XX] << " " << node[YY] << " " << 0.0  << endl;
-    }
-    if (dim == DIM_3D) {
-      foutG << node[XX] << " " << node[YY] << " " << node[ZZ] << endl;
-    }
-  } 
-  foutG.close();
-  
-  CFLog(INFO, "ParadeRadiator::writeLocalData() => written coordinates for cells [" 
-	<< startNode << ", " << countNode << "]\n");
-  
-  // write the temperatures
-  ofstream& foutT = m_outFileHandle->open(m_tempFile);
-  //const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
-  foutT << 1 << " " << nbPoints << " " <<  nbTemps << endl;
-  // here it is assumed that the temperatures are the LAST variables 
-  countNode = startNode;
-  for (CFuint i = 0; i < nbPoints; ++i, ++countNode) {
-    cf_assert(countNode < totalNbPoints);
-    CFreal *const currState = m_pstates->getState(countNode);
-    for (CFuint t = 0; t < nbTemps; ++t) {
-      foutT.precision(14);
-      foutT.setf(ios::scientific,ios::floatfield);
-      const CFreal temp = std::max(currState[tempID + t], m_TminFix);
-      foutT << temp << " ";
+  computeLocalInputs(startNode, nbPoints);
+  
+  // only the states which are not in the cache are given to PARADE
+  CFuint nbCells = nbPoints;
+  if (m_useCache) {
+    m_cache.beginUpdate(m_wavMin, m_wavMax, m_nbPoints*3);
+    for (CFuint i = 0; i < nbPoints; ++i) {
+      m_cache.addCell(&m_localInputs[i*nbInputs], nbInputs);
     }
-    foutT << endl;
+    m_cache.printStatistics();
+    nbCells = m_cache.getNbMisses();
   }
-  foutT.close();
-  
-  CFLog(INFO, "ParadeRadiator::writeLocalData() => written temperature for cells [" 
-	<< startNode << ", " << countNode << "]\n");
   
-  // write the number densities
-  ofstream& foutD = m_outFileHandle->open(m_densFile);
-  const CFuint nbSpecies = m_library->getNbSpecies();
-  foutD << 1 << " " << nbPoints << " " << nbSpecies << endl;  
-
-  //write species partial density
- foutD.precision(14);
- foutD.setf(ios::scientific,ios::floatfield);
- countNode = startNode;
-
- if(!m_massfraction){
- 
-  if(m_isLTE) {	  
-    // LTE: composition is computed though the chemical library
-    RealVector x(nbSpecies);
-    RealVector y(nbSpecies);	 
-    CFreal rhoi = 0.;
-    for (CFuint i = 0; i < nbPoints; ++i, ++countNode) {
-      cf_assert(countNode < totalNbPoints);
-      CFreal *const currState = m_pstates->getState(countNode);
-      CFreal temp  = currState[tempID];
-      CFreal press = currState[0];
-      m_library->setComposition(temp, press, &x);
-      m_library->getSpeciesMassFractions(x,y);
-      const CFreal rho = m_library->density(temp, press, CFNULL);
-
-      for (CFuint t = 0; t < nbSpecies; ++t) {
-        // number Density = partial density/ molar mass * Avogadro number
-        rhoi = rho*y[t];
-        const CFreal nb = std::max(rhoi*m_avogadroOvMM[t],m_ndminFix);
-        foutD << nb << " ";
+  if (nbCells > 0) {
+    // write the mesh file
+    ofstream& foutG = m_outFileHandle->open(m_gridFile);
+    foutG << "TINA" << endl;
+    foutG << 1 << " " << nbCells << endl;
+    foutG.precision(14);
+    foutG.setf(ios::scientific,ios::floatfield);
+    for (CFuint c = 0; c < nbCells; ++c) {
+      const CFuint i = (m_useCache) ? m_cache.getMissCell(c) : c;
+      cf_assert(startNode + i < totalNbPoints);
+      CFreal *const node = m_pstates->getNode(startNode + i);
+      
+      if (dim == DIM_1D) {
+	foutG << node[XX] << " " << 0.0 << " " << 0.0  << endl;
       }
-      foutD << endl;
-    }
-  } 
-  else{ 
-    // NEQ: species partial density is a system state
-    // here it is assumed that the species densities are the FIRST variables 
-    for (CFuint i =0; i < nbPoints; ++i, ++countNode) {
-      cf_assert(countNode < totalNbPoints);
-      CFreal *const currState = m_pstates->getState(countNode);
-      for(CFuint t=0; t<nbSpecies; ++t){
-	const CFreal nb = std::max(currState[t]*m_avogadroOvMM[t],m_ndminFix);
-	foutD << nb << " ";
+      if (dim == DIM_2D) {
+	foutG << node[XX] << " " << node[YY] << " " << 0.0  << endl;
       }
-      foutD << endl;
-    }
-  }
- }
- else{
-  if(m_isLTE) {	  
-    // LTE: composition is computed though the chemical library
-    RealVector x(nbSpecies);
-    RealVector y(nbSpecies);	 
-    CFreal rhoi = 0.;
-    for (CFuint i = 0; i < nbPoints; ++i, ++countNode) {
-      cf_assert(countNode < totalNbPoints);
-      CFreal *const currState = m_pstates->getState(countNode);
-      CFreal temp  = currState[tempID];
-      CFreal press = currState[0];
-      m_library->setComposition(temp, press, &x);
-      m_library->getSpeciesMassFractions(x,y);
-      const CFreal rho = m_library->density(temp, press, CFNULL);
-
-      for (CFuint t = 0; t < nbSpecies; ++t) {
-        // number Density = partial density/ molar mass * Avogadro number
-        rhoi = rho*y[t];
-        const CFreal nb = std::max(rhoi*m_avogadroOvMM[t],m_ndminFix);
-        foutD << nb << " ";
+      if (dim == DIM_3D) {
+	foutG << node[XX] << " " << node[YY] << " " << node[ZZ] << endl;
       }
-      foutD << endl;
+    } 
+    foutG.close();
+    
+    // write the temperatures
+    ofstream& foutT = m_outFileHandle->open(m_tempFile);
+    foutT << 1 << " " << nbCells << " " <<  nbTemps << endl;
+    foutT.precision(14);
+    foutT.setf(ios::scientific,ios::floatfield);
+    for (CFuint c = 0; c < nbCells; ++c) {
+      const CFuint i = (m_useCache) ? m_cache.getMissCell(c) : c;
+      const CFreal *const input = &m_localInputs[i*nbInputs];
+      for (CFuint t = 0; t < nbTemps; ++t) {
+	foutT << input[t] << " ";
+      }
+      foutT << endl;
     }
-  } 
-  else{ 
-    // NEQ: species partial density is a system state
-    // here it is assumed that the species densities are the FIRST variables 
-    for (CFuint i =0; i < nbPoints; ++i, ++countNode) {
-      cf_assert(countNode < totalNbPoints);
-      CFreal *const currState = m_pstates->getState(countNode);
-      CFreal temp  = currState[tempID];
-      CFuint pressID = currState[0];
-      CFreal press = currState[pressID];
-CFLog(INFO,"The pressure in this state is = " << press << "\n");
-      const CFreal rho = m_library->density(temp, press, CFNULL);
-      for(CFuint t=0; t<nbSpecies; ++t){
-	const CFreal nb = std::max(currState[t]*rho*m_avogadroOvMM[t],m_ndminFix);
-	foutD << nb << " ";
+    foutT.close();
+    
+    // write the number densities
+    ofstream& foutD = m_outFileHandle->open(m_densFile);
+    foutD << 1 << " " << nbCells << " " << nbSpecies << endl;  
+    foutD.precision(14);
+    foutD.setf(ios::scientific,ios::floatfield);
+    for (CFuint c = 0; c < nbCells; ++c) {
+      const CFuint i = (m_useCache) ? m_cache.getMissCell(c) : c;
+      const CFreal *const input = &m_localInputs[i*nbInputs + nbTemps];
+      for (CFuint t = 0; t < nbSpecies; ++t) {
+	foutD << input[t] << " ";
       }
       foutD << endl;
     }
+    foutD.close();
   }
- }
-
   
+  CFLog(INFO, "ParadeRadiator::writeLocalData() => written " << nbCells << " out of cells [" 
+	<< startNode << ", " << startNode + nbPoints << "]\n");
 
 if(m_writeHSNB){
 
@@ -672,12 +616,81 @@ fout << endl;
  fout.close();
  }
 
-  CFLog(INFO, "ParadeRadiator::writeLocalData() => written densities for cells [" 
-	<< startNode << ", " << countNode << "]\n");
-  
-  CFLog(VERBOSE, "ParadeRadiator::writeLocalData() => START\n");
+  CFLog(VERBOSE, "ParadeRadiator::writeLocalData() => END\n");
 }   
       
+//////////////////////////////////////////////////////////////////////////////
+
+void ParadeRadiator::getLocalStatesRange(CFuint& startNode, CFuint& nbPoints) const
+{
+  startNode = 0;
+  nbPoints = m_pstates->getSize();
+  // if the full mesh is in this process than you only write a part of its data
+  if (fullGridInProcess()) {
+    const CFuint nbPointsPerProc = nbPoints/m_nbProc;
+    nbPoints = (m_rank < m_nbProc-1) ? nbPointsPerProc : nbPointsPerProc + nbPoints%m_nbProc;
+    startNode = m_rank*nbPointsPerProc;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParadeRadiator::computeLocalInputs(const CFuint startNode, const CFuint nbPoints)
+{
+  const CFuint nbTemps = m_radPhysicsHandlerPtr->getNbTemps();
+  const CFuint tempID = m_radPhysicsHandlerPtr->getTempID();
+  const CFuint nbSpecies = m_library->getNbSpecies();
+  const CFuint nbInputs = nbTemps + nbSpecies;
+  
+  // for each state: temperatures, then species number densities
+  m_localInputs.resize(nbPoints*nbInputs);
+  
+  RealVector x(nbSpecies);
+  RealVector y(nbSpecies);
+  for (CFuint i = 0; i < nbPoints; ++i) {
+    cf_assert(startNode + i < m_pstates->getSize());
+    CFreal *const currState = m_pstates->getState(startNode + i);
+    CFreal *const temps = &m_localInputs[i*nbInputs];
+    CFreal *const dens  = temps + nbTemps;
+    
+    // here it is assumed that the temperatures are the LAST variables 
+    for (CFuint t = 0; t < nbTemps; ++t) {
+      temps[t] = std::max(currState[tempID + t], m_TminFix);
+    }
+    
+    if (m_isLTE) {
+      // LTE: composition is computed though the chemical library
+      CFreal temp  = currState[tempID];
+      CFreal press = currState[0];
+      m_library->setComposition(temp, press, &x);
+      m_library->getSpeciesMassFractions(x,y);
+      const CFreal rho = m_library->density(temp, press, CFNULL);
+      for (CFuint t = 0; t < nbSpecies; ++t) {
+	// number Density = partial density/ molar mass * Avogadro number
+	dens[t] = std::max(rho*y[t]*m_avogadroOvMM[t],m_ndminFix);
+      }
+    }
+    else if (!m_massfraction) {
+      // NEQ: species partial density is a system state
+      // here it is assumed that the species densities are the FIRST variables 
+      for (CFuint t = 0; t < nbSpecies; ++t) {
+	dens[t] = std::max(currState[t]*m_avogadroOvMM[t],m_ndminFix);
+      }
+    }
+    else {
+      // NEQ: species mass fractions are system states
+      CFreal temp  = currState[tempID];
+      CFuint pressID = currState[0];
+      CFreal press = currState[pressID];
+      CFLog(INFO,"The pressure in this state is = " << press << "\n");
+      const CFreal rho = m_library->density(temp, press, CFNULL);
+      for (CFuint t = 0; t < nbSpecies; ++t) {
+	dens[t] = std::max(currState[t]*rho*m_avogadroOvMM[t],m_ndminFix);
+      }
+    }
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////
   
 void ParadeRadiator::readLocalRadCoeff()
@@ -689,18 +702,35 @@ void ParadeRadiator::readLocalRadCoeff()
   /// emission coeff   = m_radCoeff(local state ID, spectral point idx*3+1)
   /// absorption coeff = m_radCoeff(local state ID, spectral point idx*3+2)
 
-  fstream& fin = m_inFileHandle->openBinary(m_radFile);
-  //string nam = "file-" + StringOps::to_str(PE::GetPE().GetRank());
+  // with the cache, the file only contains the states missing from it
+  const bool readFile = (!m_useCache || m_cache.getNbMisses() > 0);
   
-  int one = 0;
-  fin.read((char*)&one, sizeof(int));
-  //fout << "one = "<< one;
-  cf_assert(one == 1);
+  int nbCells = (m_useCache) ? m_cache.getNbCells() : 0;
+  int nbFileCells = 0;
+  fstream* fin = CFNULL;
+  if (readFile) {
+    fin = &m_inFileHandle->openBinary(m_radFile);
+    
+    int one = 0;
+    fin->read((char*)&one, sizeof(int));
+    cf_assert(one == 1);
+    
+    fin->read((char*)&nbFileCells, sizeof(int));
+    
+    vector<int> wavptsmx(3);
+    fin->read((char*)&wavptsmx[0], 3*sizeof(int));
+    cf_assert(wavptsmx[0] == (int) m_nbPoints);
+  }
   
-  int nbCells = 0;
-  fin.read((char*)&nbCells, sizeof(int));
+  if (!m_useCache) {
+    nbCells = nbFileCells;
+  }
+  else {
+    cf_assert(nbFileCells == (int)m_cache.getNbMisses());
+  }
   
-  CFLog(VERBOSE,"ParadeRadiator::readLocalRadCoeff() => nbCells = " << nbCells << "\n");
+  CFLog(VERBOSE,"ParadeRadiator::readLocalRadCoeff() => nbCells = " << nbCells 
+	<< ", read from file = " << nbFileCells << "\n");
   if (!fullGridInProcess()) {
     cf_assert(nbCells == (int)m_pstates->getSize()  );
   }
@@ -708,10 +738,6 @@ void ParadeRadiator::readLocalRadCoeff()
     cf_assert(nbCells <= (int)m_pstates->getSize()  );
   }
   
-  vector<int> wavptsmx(3);
-  fin.read((char*)&wavptsmx[0], 3*sizeof(int));
-  //fout << "wav3 =  "<< wavptsmx[0] << " " << wavptsmx[1] << " " << wavptsmx[2]<< endl;
-  cf_assert(wavptsmx[0] == (int) m_nbPoints);
   const CFuint totalNbCells = m_pstates->getSize();
   const CFuint sizeLocalCells = (!m_saveMemory) ? totalNbCells : nbCells;
   m_data.resize(sizeLocalCells*m_nbPoints*3);
@@ -725,19 +751,26 @@ void ParadeRadiator::readLocalRadCoeff()
     currData = &partialData;
   }
   
-  double etot = 0.;
-  int wavpts = 0;
   const CFuint sizeCoeff = m_nbPoints*3;
-  for (int iCell = 0 ; iCell < nbCells; ++iCell) {
-    fin.read((char*)&etot, sizeof(double));
-    //fout << "etot = " << etot << endl;
-    fin.read((char*)&wavpts, sizeof(int));
-    cf_assert(wavpts == (int)m_nbPoints);
-    //fout << "wavpt = " <<  wavpts << endl;
-    // this reads [wavelength, emission, absorption] for each cell
-    fin.read((char*)&((*currData)[iCell*sizeCoeff]), sizeCoeff*sizeof(double));
+  if (readFile) {
+    double etot = 0.;
+    int wavpts = 0;
+    for (int iCell = 0 ; iCell < nbFileCells; ++iCell) {
+      fin->read((char*)&etot, sizeof(double));
+      fin->read((char*)&wavpts, sizeof(int));
+      cf_assert(wavpts == (int)m_nbPoints);
+      // this reads [wavelength, emission, absorption] for each cell
+      CFreal *const coeff = (m_useCache) ? 
+	m_cache.getMissRecord(iCell) : &((*currData)[iCell*sizeCoeff]);
+      fin->read((char*)coeff, sizeCoeff*sizeof(double));
+    }
+    fin->close();
+  }
+  
+  if (m_useCache) {
+    // copy the spectra of all the local cells, computed or cached
+    m_cache.endUpdate(&((*currData)[0]));
   }
-  fin.close();
   
   if (fullGridInProcess() && !m_saveMemory) {
     // in case the full mesh is stored in each process, since we have read in only a part 
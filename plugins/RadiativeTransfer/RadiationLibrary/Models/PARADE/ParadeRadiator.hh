@@ -4,6 +4,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "RadiativeTransfer/RadiationLibrary/Radiator.hh"
+#include "RadiativeTransfer/RadiationLibrary/Models/PARADE/ParadeResultCache.hh"
 #include "MathTools/RealMatrix.hh"
 #include "MathTools/RealVector.hh"
 #include "Common/OSystem.hh"
@@ -134,6 +135,12 @@ protected:
   /// write the data (grid, temperatue, densities) corresponding to the local mesh
   virtual void writeLocalData();
   
+  /// get the range of states whose data are written by this process
+  void getLocalStatesRange(CFuint& startNode, CFuint& nbPoints) const;
+  
+  /// compute the temperatures and number densities given to PARADE for the local states
+  void computeLocalInputs(const CFuint startNode, const CFuint nbPoints);
+  
   /// read the radiative coefficients corresponding to the local mesh
   virtual void readLocalRadCoeff();
   
@@ -143,15 +150,14 @@ protected:
   /// run PARADE
   void runLibrary() const
   {
-    std::string command = "./parade > outfile";
-    Common::OSystem::getInstance().executeCommand(command);
+    Common::OSystem::getInstance().executeCommand(m_runCommand);
   }
   
   /// run PARADE in parallel
   void runLibraryInParallel() const
   { 
     CFLog(VERBOSE, "ParadeRadiator::runLibraryInParallel()\n");
-    std::string command = "cd " + m_paradeDir.string() + " ; ./parade > outfile ; cd -";
+    std::string command = "cd " + m_paradeDir.string() + " ; " + m_runCommand + " ; cd -";
     Common::OSystem::getInstance().executeCommand(command);
   }
   
@@ -332,6 +338,21 @@ protected:
   /// bool to write the table in a file
   bool m_writeHSNB;
   
+  /// command running PARADE (or a stand-in) inside the local directory
+  std::string m_runCommand;
+  
+  /// relative tolerance on the states below which the spectra are reused
+  CFreal m_cacheTolerance;
+  
+  /// flag telling whether the cache is used in the current spectral loop
+  bool m_useCache;
+  
+  /// cache of the spectra indexed by the quantized states
+  ParadeResultCache m_cache;
+  
+  /// temperatures and number densities of the local states
+  std::vector<CFreal> m_localInputs;
+  
 }; // end of class ParadeRadiator
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Common/CFLog.hh"
+
+#include "RadiativeTransfer/RadiationLibrary/Models/PARADE/ParadeResultCache.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+namespace RadiativeTransfer {
+
+//////////////////////////////////////////////////////////////////////////////
+
+ParadeResultCache::ParadeResultCache() :
+  m_tolerance(0.),
+  m_logSpacing(0.),
+  m_recordSize(0),
+  m_entries(),
+  m_range(0., 0.),
+  m_next(),
+  m_cellEntry(),
+  m_missCells(),
+  m_missEntries(),
+  m_key(),
+  m_nbLookups(0),
+  m_nbHits(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ParadeResultCache::~ParadeResultCache()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParadeResultCache::setTolerance(const CFreal tolerance)
+{
+  m_tolerance = tolerance;
+  m_logSpacing = (tolerance > 0.) ? std::log(1. + tolerance) : 0.;
+  clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParadeResultCache::beginUpdate(const CFreal wavMin, const CFreal wavMax,
+				    const CFuint recordSize)
+{
+  cf_assert(isActive());
+  cf_assert(recordSize > 0);
+
+  // a change in the spectral discretization invalidates all the entries
+  if (recordSize != m_recordSize) {
+    clear();
+    m_recordSize = recordSize;
+  }
+
+  m_range = Range(wavMin, wavMax);
+  m_next.index.clear();
+  m_next.records.clear();
+  m_cellEntry.clear();
+  m_missCells.clear();
+  m_missEntries.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool ParadeResultCache::addCell(const CFreal *const state, const CFuint size)
+{
+  computeKey(state, size);
+
+  const CFuint cellID = m_cellEntry.size();
+  ++m_nbLookups;
+
+  // state already met in this update
+  map<Key, CFuint>::const_iterator it = m_next.index.find(m_key);
+  if (it != m_next.index.end()) {
+    m_cellEntry.push_back(it->second);
+    ++m_nbHits;
+    return true;
+  }
+
+  const CFuint entryID = m_next.index.size();
+  m_next.index.insert(make_pair(m_key, entryID));
+  m_next.records.resize((entryID+1)*m_recordSize);
+  m_cellEntry.push_back(entryID);
+
+  // state computed in a previous update of the same spectral range
+  map<Range, Entries>::const_iterator itOld = m_entries.find(m_range);
+  if (itOld != m_entries.end()) {
+    map<Key, CFuint>::const_iterator itKey = itOld->second.index.find(m_key);
+    if (itKey != itOld->second.index.end()) {
+      const CFreal *const record = &itOld->second.records[itKey->second*m_recordSize];
+      std::copy(record, record + m_recordSize, &m_next.records[entryID*m_recordSize]);
+      ++m_nbHits;
+      return true;
+    }
+  }
+
+  m_missCells.push_back(cellID);
+  m_missEntries.push_back(entryID);
+  return false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParadeResultCache::endUpdate(CFreal *const data)
+{
+  const CFuint nbCells = m_cellEntry.size();
+  for (CFuint i = 0; i < nbCells; ++i) {
+    const CFreal *const record = &m_next.records[m_cellEntry[i]*m_recordSize];
+    std::copy(record, record + m_recordSize, &data[i*m_recordSize]);
+  }
+
+  // the entries not used in this update are released
+  Entries& entries = m_entries[m_range];
+  entries.index.swap(m_next.index);
+  entries.records.swap(m_next.records);
+  m_next.index.clear();
+  vector<CFreal>().swap(m_next.records);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParadeResultCache::clear()
+{
+  m_entries.clear();
+  m_next.index.clear();
+  vector<CFreal>().swap(m_next.records);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParadeResultCache::printStatistics() const
+{
+  const CFuint nbCells = m_cellEntry.size();
+  const CFuint nbHits  = nbCells - m_missCells.size();
+  const CFreal rate = (nbCells > 0) ? 100.*nbHits/nbCells : 0.;
+  const CFreal totalRate = (m_nbLookups > 0) ? 100.*m_nbHits/m_nbLookups : 0.;
+
+  CFLog(INFO, "ParadeResultCache => range [" << m_range.first << ", " << m_range.second
+	<< "]: hits = " << nbHits << ", misses = " << m_missCells.size()
+	<< " (hit rate " << rate << "%), total hit rate " << totalRate << "% over "
+	<< m_nbLookups << " lookups\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParadeResultCache::computeKey(const CFreal *const state, const CFuint size)
+{
+  m_key.resize(size);
+  for (CFuint i = 0; i < size; ++i) {
+    // the temperatures and number densities are clipped to positive minima
+    cf_assert(state[i] > 0.);
+    m_key[i] = static_cast<long>(std::floor(std::log(state[i])/m_logSpacing + 0.5));
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace RadiativeTransfer
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
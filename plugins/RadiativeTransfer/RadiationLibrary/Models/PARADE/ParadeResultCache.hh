@@ -0,0 +1,164 @@
+#ifndef COOLFluiD_RadiativeTransfer_ParadeResultCache_hh
+#define COOLFluiD_RadiativeTransfer_ParadeResultCache_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <vector>
+
+#include "Common/NonCopyable.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace RadiativeTransfer {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class stores the spectra computed by PARADE, indexed by the
+ * thermodynamic state (temperatures and number densities) of the cells.
+ *
+ * Each state is quantized on a logarithmic grid of relative spacing
+ * given by the tolerance, so that two states falling in the same bin differ
+ * by less than the tolerance on each of their components. Only one cell per
+ * bin which is not already in the cache has to be computed by PARADE.
+ *
+ * One set of entries is kept per spectral range. At each update of a range,
+ * the entries which are not used by any cell are released, so that the
+ * cache never stores more spectra per range than the number of cells.
+ */
+class ParadeResultCache : public Common::NonCopyable<ParadeResultCache> {
+public:
+
+  /**
+   * Constructor
+   */
+  ParadeResultCache();
+
+  /**
+   * Destructor
+   */
+  ~ParadeResultCache();
+
+  /**
+   * Sets the relative tolerance on the states (<= 0 deactivates the cache)
+   */
+  void setTolerance(const CFreal tolerance);
+
+  /// @return true if the cache is active
+  bool isActive() const {return m_tolerance > 0.;}
+
+  /**
+   * Starts the update of the given spectral range
+   * @param recordSize size of the spectrum of one cell
+   */
+  void beginUpdate(const CFreal wavMin, const CFreal wavMax, const CFuint recordSize);
+
+  /**
+   * Looks up the state of the next cell of the update
+   * @param state  temperatures and number densities of the cell
+   * @return true if the spectrum of the cell does not need to be computed
+   */
+  bool addCell(const CFreal *const state, const CFuint size);
+
+  /// @return the number of cells added to the current update
+  CFuint getNbCells() const {return m_cellEntry.size();}
+
+  /// @return the number of spectra to compute in the current update
+  CFuint getNbMisses() const {return m_missCells.size();}
+
+  /// @return the cell whose state has to be computed for the given miss
+  CFuint getMissCell(const CFuint miss) const {return m_missCells[miss];}
+
+  /// @return the storage of the spectrum computed for the given miss
+  CFreal* getMissRecord(const CFuint miss)
+  {
+    return &m_next.records[m_missEntries[miss]*m_recordSize];
+  }
+
+  /**
+   * Ends the update and copies the spectrum of every cell
+   * @param data  spectra of the cells, stored cell by cell
+   */
+  void endUpdate(CFreal *const data);
+
+  /**
+   * Releases all the entries
+   */
+  void clear();
+
+  /**
+   * Prints the hit rates of the last update and of the whole simulation
+   */
+  void printStatistics() const;
+
+private: // helper functions
+
+  /// Computes the quantized key of the given state
+  void computeKey(const CFreal *const state, const CFuint size);
+
+private: // data
+
+  /// quantized state
+  typedef std::vector<long> Key;
+
+  /// spectral range
+  typedef std::pair<CFreal, CFreal> Range;
+
+  /// entries of a spectral range
+  struct Entries {
+    /// index of the entry of each key
+    std::map<Key, CFuint> index;
+    /// spectra of the entries, stored entry by entry
+    std::vector<CFreal> records;
+  };
+
+  /// relative tolerance on the states
+  CFreal m_tolerance;
+
+  /// logarithm of the spacing of the quantization grid
+  CFreal m_logSpacing;
+
+  /// size of the spectrum of one cell
+  CFuint m_recordSize;
+
+  /// entries of each spectral range
+  std::map<Range, Entries> m_entries;
+
+  /// spectral range of the current update
+  Range m_range;
+
+  /// entries being built by the current update
+  Entries m_next;
+
+  /// entry of each cell of the current update
+  std::vector<CFuint> m_cellEntry;
+
+  /// cells to compute in the current update
+  std::vector<CFuint> m_missCells;
+
+  /// entries of the cells to compute in the current update
+  std::vector<CFuint> m_missEntries;
+
+  /// work key
+  Key m_key;
+
+  /// total number of cells looked up
+  CFuint m_nbLookups;
+
+  /// total number of cells found in the cache
+  CFuint m_nbHits;
+
+}; // end of class ParadeResultCache
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace RadiativeTransfer
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_RadiativeTransfer_ParadeResultCache_hh
@@ -122,9 +122,11 @@ private:
    void MonteCarlo();
   
   /**
-   * ray tracing
+   * ray tracing of the photons of the batch of the Lagrangian solver, which
+   * are advanced together cell by cell until they are absorbed, leave the
+   * domain or cross a partition face
    */
-  CFuint rayTracing(Photon& photon);
+  void rayTracingBatch();
   
   /**
    * build vector of radiative heat source along a single radius in the middle of the cilinder
@@ -247,6 +249,9 @@ private:
   /// maximum number of visited cells
   CFuint m_maxVisitedCells;
   
+  /// number of particles traced by the tracking benchmark at setup (0 = no benchmark)
+  CFuint m_nbBenchmarkParticles;
+  
   /// True if it is an axisymmetric simulation
   bool m_isAxi;
   
@@ -305,6 +310,7 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::defineConfigOptions
   
   options.addConfigOption< CFuint >("numberOfRays","number of rays sent by each element.");
   options.addConfigOption< CFuint >("MaxNbVisitedCells","Maximum number of visited cells.");
+  options.addConfigOption< CFuint >("TrackingBenchmark","Number of particles traced at setup to measure the tracking throughput (0 = no benchmark).");
   options.addConfigOption< bool >("Axi","True if it is an axisymmetric simulation.");
   options.addConfigOption< string >("PostProcessName","Name of the post process routine");
   options.addConfigOption< CFuint >("sendBufferSize","Size of the buffer for communication");
@@ -360,6 +366,9 @@ RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::RadiativeTransferMonteCarlo
   m_maxVisitedCells = 10000;
   setParameter("MaxNbVisitedCells",&m_maxVisitedCells);
 
+  m_nbBenchmarkParticles = 0;
+  setParameter("TrackingBenchmark",&m_nbBenchmarkParticles);
+
   m_maxNbTrajectories=10;
   setParameter("MaxNbTrajectories",&m_maxNbTrajectories);
 
@@ -586,6 +595,10 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::setup()
   m_radiation->getWallTRSnames(wallTrsNames);
 
   m_lagrangianSolver.setFaceTypes(wallTrsNames, boundaryTrsNames );
+  
+  if (m_nbBenchmarkParticles > 0) {
+    m_lagrangianSolver.benchmarkTracking(m_nbBenchmarkParticles, m_maxVisitedCells, m_dim2);
+  }
 
   // preallocation of memory for qradFluxWall
   CFuint nbFaces = 0;
@@ -972,7 +985,7 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::computePhotons()
       if(getCellPhotonData( photon )){
         //CFLog(INFO,"PHOTON: " << photon.cellID<<' '<<photon.userData.KS<<'\n' );
         //printPhoton(photon);
-        rayTracing(photon);
+        m_lagrangianSolver.addToBatch(photon);
 
       }
       --toGenerateCellPhotons;
@@ -982,7 +995,7 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::computePhotons()
     for(CFuint i=0; i < nbWallPhotons ; ++i ){
       if(getFacePhotonData( photon )){
 	//printPhoton(photon);
-        rayTracing(photon);
+        m_lagrangianSolver.addToBatch(photon);
       }
       -- toGenerateWallPhotons;
       if (m_myProcessRank == 0)  ++*(progressBar);
@@ -994,9 +1007,12 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::computePhotons()
       //CFLog(INFO,"PHOTON: " << photon.cellID<<' '<<photon.userData.KS<<'\n' );
 //      printPhoton(photonStack[i]);
 
-      rayTracing( photonStack[i] );
+      m_lagrangianSolver.addToBatch( photonStack[i] );
     }
     
+    //the photons leaving the partition are buffered and exchanged all together
+    rayTracingBatch();
+    
 
     //sincronize
     //      CFLog(INFO, "sincronizing\n");
@@ -1070,7 +1086,7 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::MonteCarlo()
 /////////////////////////////////////////////////////////////////////////////
 
 template<class PARTICLE_TRACKING>
-CFuint RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::rayTracing(Photon& beam)
+void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::rayTracingBatch()
 {
   using namespace std;
   using namespace COOLFluiD::Framework;
@@ -1079,149 +1095,94 @@ CFuint RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::rayTracing(Photon& beam)
   using namespace COOLFluiD::Numerics::FiniteVolume;
   using namespace COOLFluiD::LagrangianSolver;
   
-  CFuint nbCrossedCells = 0;
-  CFuint nbIter = 0;
-  CFint exitCellID = 0;
-  CFint exitFaceID = 0; 
-  CFint currentCellID = 0;
+  ParticleBatch& batch = m_lagrangianSolver.getBatch();
   
-  CFLog(DEBUG_MED, "RadiativeTransferMonteCarlo::rayTracing() => START\n");
+  CFLog(DEBUG_MED, "RadiativeTransferMonteCarlo::rayTracingBatch() => START with "
+	<< batch.size() << " photons\n");
   
-  m_lagrangianSolver.newParticle(beam);
-  
-  CFLog(DEBUG_MED, "RadiativeTransferMonteCarlo::rayTracing() => particle ID: "<<beam.commonData.cellID<< "\n");
-  
-  CommonData trackingCommonData;
-  PhotonData &beamData = m_lagrangianSolver.getUserDataPtr();
-  exitCellID=m_lagrangianSolver.getExitCellID();
-  
-  //bool foundEntity = false;
-  //cout<<"Start K= "<<previousK<<endl;
-  //cout<<"Beam KS= "<<beam.KS<<endl;
-  while(nbIter <= m_maxVisitedCells){
-    //CFLog(INFO, "New step!\n");
-    nbIter++;
-    //GeoEntOut out;
-    //if(_Axi) {
-    //cout<<"beam.tt before: "<<beam.tt<<endl;
-    //cout<<"beam.tt after: "<<beam.tt<<endl;
+  CommonData beam;
+  RealVector null;
+  while (batch.size() > 0) {
+    m_lagrangianSolver.batchTrackingStep();
     
-    currentCellID = exitCellID;
-
-    m_lagrangianSolver.trackingStep();
-    exitFaceID=m_lagrangianSolver.getExitFaceID();
-    exitCellID=m_lagrangianSolver.getExitCellID();
-
-    if(exitFaceID>=0){
-
-      const CFreal stepDistance=m_lagrangianSolver.getStepDistance();
-      RealVector null;
+    // the photons which stop are replaced by the last ones of the batch
+    CFuint i = 0;
+    while (i < batch.size()) {
+      const CFint exitFaceID = batch.getExitFaceID(i);
+      if (exitFaceID < 0) {
+	CFLog(VERBOSE, "RadiativeTransferMonteCarlo::rayTracingBatch() => enter negligible\n");
+	m_lagrangianSolver.removeFromBatch(i);
+	continue;
+      }
       
-      //CFLog(INFO, "Absorption IN!\n");
-      const CFreal cellK= m_radiation->getCellDistPtr(currentCellID)
-          ->getRadiatorPtr()->getAbsorption(beamData.wavelength, null);
-
-      //CFLog(INFO, "Absorption OUT!\n");
-
-      beamData.KS -= stepDistance*cellK;
-      //cout<<"beam data: "<<beamData.KS<<endl;
-      //cout<<"currentCellID: "<< currentCellID <<endl;
-
-      //_actualPoint = _internalPoint;
-      //_intersectionPointOld = _intersectionPoint;
-      //cout<<"New K= "<<beamData.KS<<" cellK: "<<cellK<<endl;
-      if(beamData.KS <= 0.){ // photon absorbed by a cell
-        //entity = INTERNAL_CELL;
-        //CFLog(INFO, "PARTICLE ABSORBED!!\n");
-        const CFuint gEndId = currentCellID;
-        //CFuint gStartId = beam.emittingEntityID;
-        const CFreal energyFraction = beamData.energyFraction;
-        //        cout<<"sizeBuffer: "<< m_gInRadPowers.size()<<endl;
-        //add directly to the in Rad Heat Power vector
-        //cout<<"energy added : "<<energyFraction<<endl;
-        cf_assert(gEndId < m_stateInRadPowers.size());
-        m_stateInRadPowers[gEndId]+=energyFraction;
-        //cout<<"new energy: "<<m_gInRadPowers[gEndId]<<endl;
-        //foundEntity = true;
-
-        return currentCellID;
+      PhotonData& beamData = m_lagrangianSolver.getBatchUserData(i);
+      const CFuint currentCellID = batch.getCellID(i);
+      const CFreal cellK = m_radiation->getCellDistPtr(currentCellID)
+	->getRadiatorPtr()->getAbsorption(beamData.wavelength, null);
+      
+      beamData.KS -= batch.getStepDistance(i)*cellK;
+      if (beamData.KS <= 0.) { // photon absorbed by a cell
+	cf_assert(currentCellID < m_stateInRadPowers.size());
+	m_stateInRadPowers[currentCellID] += beamData.energyFraction;
+	m_lagrangianSolver.removeFromBatch(i);
+	continue;
       }
-
+      
       const CFuint faceType = m_lagrangianSolver.getFaceType(exitFaceID);
       
-      if ( faceType == ParticleTracking::WALL_FACE){
-        //CFLog(INFO,"HERE WALL !!\n");
-        CommonData beam2;
-        m_lagrangianSolver.getCommonData(beam2);
-        for(CFuint i=0; i < m_dim2; ++i){
-          m_entryDirection[i]= beam2.direction[i];
-        }
-	
-        m_lagrangianSolver.getExitPoint(m_position);
+      if (faceType == ParticleTracking::WALL_FACE) {
+	batch.getCommonData(i, beam);
+	for (CFuint d = 0; d < m_dim2; ++d) {
+	  m_entryDirection[d] = beam.direction[d];
+	}
+	batch.getPoint(i, m_position);
 	
-        //CFuint stateID = m_lagrangianSolver.getWallGhotsStateId(exitFaceID);
-        const CFuint ghostStateID = m_lagrangianSolver.getWallGhotsStateId(exitFaceID);
+	const CFuint ghostStateID = m_lagrangianSolver.getWallGhotsStateId(exitFaceID);
+	const CFreal wallK = m_radiation->getWallDistPtr(ghostStateID)
+	  ->getRadiatorPtr()->getAbsorption( beamData.wavelength, m_entryDirection );
 	
-        const CFreal wallK = m_radiation->getWallDistPtr(ghostStateID)
-            ->getRadiatorPtr()->getAbsorption( beamData.wavelength, m_entryDirection );
+	m_lagrangianSolver.getNormals(exitFaceID, m_position, m_normal);
 	
-        m_lagrangianSolver.getNormals(exitFaceID, m_position, m_normal);
-	
-        const CFreal reflectionProbability =  m_rand.uniformRand();
+	const CFreal reflectionProbability = m_rand.uniformRand();
 	CFLog(DEBUG_MIN, "reflectionProbability[" << reflectionProbability << "] <= wallK[" 
 	      << wallK << "]\n");
 	
-        if (reflectionProbability <= wallK){ // the photon is absorbed by the wall
-          //cout<<"ABSORBED!"<<endl;
-          //entity = WALL_FACE;
-          const CFuint ghostStateID = m_lagrangianSolver.getWallGhotsStateId(exitFaceID);
+	if (reflectionProbability <= wallK) { // the photon is absorbed by the wall
 	  m_ghostStateInRadPowers[ghostStateID] += beamData.energyFraction;
 	  CFLog(DEBUG_MIN, "Rad power in ghostStateID[" << ghostStateID << "] = " << 
 		m_ghostStateInRadPowers[ghostStateID] << "\n");
-	  //foundEntity = true;
-
-
-          return exitFaceID;
-        }
-        else {
-	  m_radiation->getWallDistPtr(ghostStateID)->getReflectorPtr()->getRandomDirection
-	    (beamData.wavelength, m_exitDirection, m_entryDirection, m_normal);
-          m_lagrangianSolver.newDirection( m_exitDirection );
-	  
-
-          CFLog(DEBUG_MED, "Particle reflected with Entry Direction[" << m_entryDirection 
-		<< "], Normal[ " << m_normal << "], Exit direction [" << m_exitDirection << "]\n");
-        }
+	  m_lagrangianSolver.removeFromBatch(i);
+	  continue;
+	}
+	
+	m_radiation->getWallDistPtr(ghostStateID)->getReflectorPtr()->getRandomDirection
+	  (beamData.wavelength, m_exitDirection, m_entryDirection, m_normal);
+	batch.setDirection(i, m_exitDirection);
+	
+	CFLog(DEBUG_MED, "Particle reflected with Entry Direction[" << m_entryDirection 
+	      << "], Normal[ " << m_normal << "], Exit direction [" << m_exitDirection << "]\n");
       }
-
-
-
-      if (faceType == ParticleTracking::BOUNDARY_FACE ){
-        //CFLog(INFO,"HERE BOUNDARY !!\n");
-        //entity = DISAPPEARED;
-        //foundEntity = true;
-        return 0;
+      
+      if (faceType == ParticleTracking::BOUNDARY_FACE) {
+	m_lagrangianSolver.removeFromBatch(i);
+	continue;
       }
-
-      if(faceType == ParticleTracking::COMP_DOMAIN_FACE){
-      //CFLog(INFO,"HERE DOMAIN FACE!!\n");
-          m_lagrangianSolver.bufferCommitParticle(exitFaceID);
-        return 0;
+      
+      if (faceType == ParticleTracking::COMP_DOMAIN_FACE) {
+	m_lagrangianSolver.bufferCommitBatchParticle(i, exitFaceID);
+	m_lagrangianSolver.removeFromBatch(i);
+	continue;
       }
-
-      nbCrossedCells++;
+      
+      batch.enterExitCell(i);
+      if (batch.getNbSteps(i) > m_maxVisitedCells) {
+	CFLog(INFO, "RadiativeTransferMonteCarlo::rayTracingBatch() => Max number of steps reached! \n");
+	m_lagrangianSolver.removeFromBatch(i);
+	continue;
+      }
+      ++i;
     }
-  else{
-    CFLog(VERBOSE, "RadiativeTransferMonteCarlo::rayTracing() => enter negligible\n");
-    //entity = NEGLIGIBLE;
-
-
-
-    return 0;
-  }
   }
-  CFLog(INFO, "RadiativeTransferMonteCarlo::rayTracing() => Max number of steps reached! \n");
-  return 0;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,373 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+#include "Common/CFLog.hh"
+
+#include "RungeKuttaLS/Agglomeration.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+const CFuint Agglomeration::NO_AGGLOMERATE = std::numeric_limits<CFuint>::max();
+
+//////////////////////////////////////////////////////////////////////////////
+
+Agglomeration::Agglomeration() :
+  m_stateToAgglomerate(),
+  m_nbAgglomerates(),
+  m_parent(),
+  m_geometry(),
+  m_stateVolumes()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Agglomeration::clear()
+{
+  vector<vector<CFuint> >().swap(m_stateToAgglomerate);
+  vector<CFuint>().swap(m_nbAgglomerates);
+  vector<vector<CFuint> >().swap(m_parent);
+  vector<CoarseGeometry>().swap(m_geometry);
+  vector<CFreal>().swap(m_stateVolumes);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Agglomeration::build(SafePtr<TopologicalRegionSet> faces,
+                          DataHandle<State*, GLOBAL> states,
+                          CFuint nbLevels)
+{
+  CFAUTOTRACE;
+
+  cf_assert(nbLevels > 0);
+  const CFuint nbStates = states.size();
+
+  vector<bool> isActive(nbStates);
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    isActive[iState] = states[iState]->isParUpdatable();
+  }
+
+  vector<CFuint> offsets;
+  vector<CFuint> neighbours;
+  buildGraph(faces, isActive, offsets, neighbours);
+
+  m_stateToAgglomerate.assign(1, vector<CFuint>());
+  m_nbAgglomerates.assign(1, nbStates);
+  m_parent.clear();
+  m_geometry.clear();
+
+  vector<CFuint> parent;
+  for (CFuint iLevel = 1; iLevel < nbLevels; ++iLevel) {
+    const CFuint nbCoarse = agglomerate(offsets, neighbours, isActive, parent);
+
+    // no point going further if the level does not coarsen
+    const CFuint nbFine = m_nbAgglomerates.back();
+    if (nbCoarse == nbFine) break;
+
+    // compose with the agglomerates of the previous level
+    vector<CFuint> stateToAgglomerate(nbStates, NO_AGGLOMERATE);
+    for (CFuint iState = 0; iState < nbStates; ++iState) {
+      const CFuint fine = (iLevel == 1) ? iState : m_stateToAgglomerate[iLevel-1][iState];
+      if (fine != NO_AGGLOMERATE) {
+        stateToAgglomerate[iState] = parent[fine];
+      }
+    }
+
+    m_stateToAgglomerate.push_back(vector<CFuint>());
+    m_stateToAgglomerate.back().swap(stateToAgglomerate);
+    m_nbAgglomerates.push_back(nbCoarse);
+    m_parent.push_back(parent);
+
+    CFLog(VERBOSE, "Agglomeration::build() => level " << iLevel << ": "
+          << nbCoarse << " agglomerates\n");
+
+    if (iLevel < nbLevels - 1) {
+      coarsenGraph(offsets, neighbours, parent, nbCoarse);
+      isActive.assign(nbCoarse, true);
+    }
+  }
+
+  if (m_stateToAgglomerate.size() < nbLevels) {
+    CFLog(WARN, "Agglomeration::build() => only " << m_stateToAgglomerate.size()
+          << " levels could be built\n");
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Agglomeration::buildGeometry(const vector<SafePtr<TopologicalRegionSet> >& trsList,
+                                  SafePtr<TopologicalRegionSet> cells,
+                                  DataHandle<State*, GLOBAL> states,
+                                  DataHandle<State*> gstates,
+                                  DataHandle<CFreal> normals,
+                                  DataHandle<CFreal> volumes,
+                                  CFuint dim)
+{
+  CFAUTOTRACE;
+
+  const CFuint nbStates = states.size();
+  m_stateVolumes.assign(nbStates, 0.);
+  const CFuint nbCells = cells->getLocalNbGeoEnts();
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    m_stateVolumes[cells->getStateID(iCell, 0)] = volumes[iCell];
+  }
+
+  const CFuint nbLevels = getNbLevels();
+  m_geometry.assign(nbLevels, CoarseGeometry());
+  for (CFuint iLevel = 1; iLevel < nbLevels; ++iLevel) {
+    CoarseGeometry& geo = m_geometry[iLevel];
+    const vector<CFuint>& agglo = m_stateToAgglomerate[iLevel];
+
+    geo.volumes.assign(m_nbAgglomerates[iLevel], 0.);
+    for (CFuint iState = 0; iState < nbStates; ++iState) {
+      if (agglo[iState] != NO_AGGLOMERATE) {
+        geo.volumes[agglo[iState]] += m_stateVolumes[iState];
+      }
+    }
+
+    // coarse inner face of each pair of neighbouring agglomerates
+    map<pair<CFuint, CFuint>, CFuint> innerFaceID;
+
+    for (CFuint iTRS = 0; iTRS < trsList.size(); ++iTRS) {
+      SafePtr<TopologicalRegionSet> trs = trsList[iTRS];
+      if (!trs->hasTag("face")) continue;
+
+      // the second state of the boundary faces is a ghost state
+      const bool isBoundary = trs->hasTag("boundary") || trs->hasTag("partition");
+      const CFuint nbFaces = trs->getLocalNbGeoEnts();
+      for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+        const CFreal *const normal = &normals[trs->getLocalGeoID(iFace)*dim];
+        const CFuint s0 = trs->getStateID(iFace, 0);
+        const CFuint s1 = trs->getStateID(iFace, 1);
+        const CFuint a0 = agglo[s0];
+
+        if (isBoundary) {
+          if (a0 != NO_AGGLOMERATE) {
+            addBoundaryFace(geo, a0, gstates[s1], normal, 1., dim);
+          }
+          continue;
+        }
+
+        // faces inside an agglomerate do not contribute to the coarse level
+        const CFuint a1 = agglo[s1];
+        if (a0 == a1) continue;
+
+        if (a1 == NO_AGGLOMERATE) {
+          addBoundaryFace(geo, a0, states[s1], normal, 1., dim);
+        }
+        else if (a0 == NO_AGGLOMERATE) {
+          addBoundaryFace(geo, a1, states[s0], normal, -1., dim);
+        }
+        else {
+          const pair<CFuint, CFuint> key(std::min(a0, a1), std::max(a0, a1));
+          map<pair<CFuint, CFuint>, CFuint>::iterator it = innerFaceID.find(key);
+          if (it == innerFaceID.end()) {
+            const CFuint newID = geo.innerFaces.size()/2;
+            it = innerFaceID.insert(make_pair(key, newID)).first;
+            geo.innerFaces.push_back(key.first);
+            geo.innerFaces.push_back(key.second);
+            geo.innerNormals.resize(geo.innerNormals.size() + dim, 0.);
+          }
+
+          const CFreal sign = (a0 < a1) ? 1. : -1.;
+          CFreal *const coarseNormal = &geo.innerNormals[it->second*dim];
+          for (CFuint iDim = 0; iDim < dim; ++iDim) {
+            coarseNormal[iDim] += sign*normal[iDim];
+          }
+        }
+      }
+    }
+
+    CFLog(VERBOSE, "Agglomeration::buildGeometry() => level " << iLevel << ": "
+          << geo.innerFaces.size()/2 << " inner faces, "
+          << geo.bFaceAgglomerates.size() << " boundary faces\n");
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Agglomeration::addBoundaryFace(CoarseGeometry& geo,
+                                    CFuint agglomerate,
+                                    State* outerState,
+                                    const CFreal* normal,
+                                    CFreal sign,
+                                    CFuint dim)
+{
+  geo.bFaceAgglomerates.push_back(agglomerate);
+  geo.bFaceStates.push_back(outerState);
+  for (CFuint iDim = 0; iDim < dim; ++iDim) {
+    geo.bFaceNormals.push_back(sign*normal[iDim]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Agglomeration::buildGraph(SafePtr<TopologicalRegionSet> faces,
+                               const vector<bool>& isActive,
+                               vector<CFuint>& offsets,
+                               vector<CFuint>& neighbours)
+{
+  const CFuint nbStates = isActive.size();
+  const CFuint nbFaces = faces->getLocalNbGeoEnts();
+  offsets.assign(nbStates + 1, 0);
+  for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+    cf_assert(faces->getNbStatesInGeo(iFace) == 2);
+    const CFuint s0 = faces->getStateID(iFace, 0);
+    const CFuint s1 = faces->getStateID(iFace, 1);
+    if (isActive[s0] && isActive[s1]) {
+      ++offsets[s0 + 1];
+      ++offsets[s1 + 1];
+    }
+  }
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    offsets[iState + 1] += offsets[iState];
+  }
+
+  neighbours.resize(offsets[nbStates]);
+  vector<CFuint> count(offsets.begin(), offsets.end() - 1);
+  for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+    const CFuint s0 = faces->getStateID(iFace, 0);
+    const CFuint s1 = faces->getStateID(iFace, 1);
+    if (isActive[s0] && isActive[s1]) {
+      neighbours[count[s0]++] = s1;
+      neighbours[count[s1]++] = s0;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint Agglomeration::agglomerate(const vector<CFuint>& offsets,
+                                  const vector<CFuint>& neighbours,
+                                  const vector<bool>& isActive,
+                                  vector<CFuint>& parent)
+{
+  const CFuint nbVertices = offsets.size() - 1;
+  parent.assign(nbVertices, NO_AGGLOMERATE);
+
+  // each free seed takes its free neighbours
+  CFuint nbAgglomerates = 0;
+  vector<CFuint> size;
+  for (CFuint iv = 0; iv < nbVertices; ++iv) {
+    if (isActive[iv] && parent[iv] == NO_AGGLOMERATE) {
+      parent[iv] = nbAgglomerates;
+      CFuint nbMembers = 1;
+      for (CFuint in = offsets[iv]; in < offsets[iv+1]; ++in) {
+        const CFuint nb = neighbours[in];
+        if (parent[nb] == NO_AGGLOMERATE) {
+          parent[nb] = nbAgglomerates;
+          ++nbMembers;
+        }
+      }
+      size.push_back(nbMembers);
+      ++nbAgglomerates;
+    }
+  }
+
+  // isolated seeds join the smallest neighbouring agglomerate
+  for (CFuint iv = 0; iv < nbVertices; ++iv) {
+    if (parent[iv] != NO_AGGLOMERATE && size[parent[iv]] == 1) {
+      CFuint best = NO_AGGLOMERATE;
+      for (CFuint in = offsets[iv]; in < offsets[iv+1]; ++in) {
+        const CFuint a = parent[neighbours[in]];
+        if (a != parent[iv] && (best == NO_AGGLOMERATE || size[a] < size[best])) {
+          best = a;
+        }
+      }
+      if (best != NO_AGGLOMERATE) {
+        size[parent[iv]] = 0;
+        parent[iv] = best;
+        ++size[best];
+      }
+    }
+  }
+
+  // number the remaining agglomerates contiguously
+  vector<CFuint> newID(nbAgglomerates, NO_AGGLOMERATE);
+  CFuint count = 0;
+  for (CFuint ia = 0; ia < nbAgglomerates; ++ia) {
+    if (size[ia] > 0) newID[ia] = count++;
+  }
+  for (CFuint iv = 0; iv < nbVertices; ++iv) {
+    if (parent[iv] != NO_AGGLOMERATE) parent[iv] = newID[parent[iv]];
+  }
+
+  return count;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Agglomeration::coarsenGraph(vector<CFuint>& offsets,
+                                 vector<CFuint>& neighbours,
+                                 const vector<CFuint>& parent,
+                                 CFuint nbCoarse)
+{
+  const CFuint nbVertices = offsets.size() - 1;
+
+  // fine vertices of each agglomerate
+  vector<CFuint> memberOffsets(nbCoarse + 1, 0);
+  for (CFuint iv = 0; iv < nbVertices; ++iv) {
+    if (parent[iv] != NO_AGGLOMERATE) ++memberOffsets[parent[iv] + 1];
+  }
+  for (CFuint ia = 0; ia < nbCoarse; ++ia) {
+    memberOffsets[ia + 1] += memberOffsets[ia];
+  }
+  vector<CFuint> members(memberOffsets[nbCoarse]);
+  vector<CFuint> count(memberOffsets.begin(), memberOffsets.end() - 1);
+  for (CFuint iv = 0; iv < nbVertices; ++iv) {
+    if (parent[iv] != NO_AGGLOMERATE) members[count[parent[iv]]++] = iv;
+  }
+
+  // neighbouring agglomerates, without duplicates
+  vector<CFuint> coarseOffsets(nbCoarse + 1, 0);
+  vector<CFuint> coarseNeighbours;
+  coarseNeighbours.reserve(neighbours.size()/2);
+  for (CFuint ia = 0; ia < nbCoarse; ++ia) {
+    const CFuint start = coarseNeighbours.size();
+    for (CFuint im = memberOffsets[ia]; im < memberOffsets[ia+1]; ++im) {
+      const CFuint iv = members[im];
+      for (CFuint in = offsets[iv]; in < offsets[iv+1]; ++in) {
+        const CFuint a = parent[neighbours[in]];
+        if (a != ia) coarseNeighbours.push_back(a);
+      }
+    }
+    sort(coarseNeighbours.begin() + start, coarseNeighbours.end());
+    coarseNeighbours.erase(unique(coarseNeighbours.begin() + start, coarseNeighbours.end()),
+                           coarseNeighbours.end());
+    coarseOffsets[ia + 1] = coarseNeighbours.size();
+  }
+
+  offsets.swap(coarseOffsets);
+  neighbours.swap(coarseNeighbours);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
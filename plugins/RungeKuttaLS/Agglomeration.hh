@@ -0,0 +1,235 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_RungeKuttaLS_Agglomeration_hh
+#define COOLFluiD_Numerics_RungeKuttaLS_Agglomeration_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Common/SafePtr.hh"
+#include "Framework/DataSocketSink.hh"
+#include "Framework/State.hh"
+#include "Framework/TopologicalRegionSet.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class builds a hierarchy of agglomerated levels of the states
+ * connected by the faces of a TopologicalRegionSet (typically the
+ * "InnerFaces" of a cell centered finite volume mesh, whose two states are
+ * the neighbouring cells).
+ * Each coarse level is built by a greedy pass over the previous one: a seed
+ * takes all its free neighbours, and isolated seeds join a neighbouring
+ * agglomerate. Only parallel updatable states are agglomerated and only
+ * through faces joining two of them, so that agglomerates never cross a
+ * partition boundary.
+ * Once the mesh geometry is available, the geometry of each coarse level is
+ * built from the fine one: the volume of an agglomerate is the sum of the
+ * volumes of its cells, and the fine faces between two agglomerates are
+ * merged into one coarse face whose normal is the sum of their normals.
+ * The fine faces between an agglomerate and a ghost state or a state which
+ * is not agglomerated are kept as boundary faces of the coarse level.
+ */
+class Agglomeration {
+public:
+
+  /// agglomerate of the states which are not agglomerated
+  static const CFuint NO_AGGLOMERATE;
+
+  /// geometry of a coarse level
+  struct CoarseGeometry {
+    /// volume of each agglomerate
+    std::vector<CFreal> volumes;
+    /// the two agglomerates of each inner face
+    std::vector<CFuint> innerFaces;
+    /// normal of each inner face, scaled by its area and pointing from the
+    /// first agglomerate to the second one
+    std::vector<CFreal> innerNormals;
+    /// agglomerate of each boundary face
+    std::vector<CFuint> bFaceAgglomerates;
+    /// state outside each boundary face
+    std::vector<Framework::State*> bFaceStates;
+    /// normal of each boundary face, scaled by its area and pointing
+    /// out of the agglomerate
+    std::vector<CFreal> bFaceNormals;
+  };
+
+  /// Constructor
+  Agglomeration();
+
+  /**
+   * Builds the levels
+   * @param faces     faces connecting the states
+   * @param states    states to agglomerate
+   * @param nbLevels  number of levels, including the finest one
+   */
+  void build(Common::SafePtr<Framework::TopologicalRegionSet> faces,
+             Framework::DataHandle<Framework::State*, Framework::GLOBAL> states,
+             CFuint nbLevels);
+
+  /// @return the number of levels, including the finest one
+  CFuint getNbLevels() const {return m_stateToAgglomerate.size();}
+
+  /// @return the number of agglomerates on the given level
+  CFuint getNbAgglomerates(CFuint level) const
+  {
+    cf_assert(level < m_nbAgglomerates.size());
+    return m_nbAgglomerates[level];
+  }
+
+  /// @return the agglomerate of the given state on the given level (> 0),
+  ///         or NO_AGGLOMERATE if the state is not agglomerated
+  CFuint getAgglomerate(CFuint level, CFuint iState) const
+  {
+    cf_assert(level > 0 && level < m_stateToAgglomerate.size());
+    cf_assert(iState < m_stateToAgglomerate[level].size());
+    return m_stateToAgglomerate[level][iState];
+  }
+
+  /// @return the agglomerate of the next coarser level containing the given
+  ///         state (level 0) or agglomerate, or NO_AGGLOMERATE
+  CFuint getParent(CFuint level, CFuint i) const
+  {
+    cf_assert(level + 1 < m_stateToAgglomerate.size());
+    cf_assert(i < m_parent[level].size());
+    return m_parent[level][i];
+  }
+
+  /**
+   * Builds the geometry of the coarse levels
+   * @param trsList  TRSs of the mesh, all the ones tagged "face" are used
+   * @param cells    cells of the mesh, holding one state each
+   * @param states   states
+   * @param gstates  ghost states
+   * @param normals  normals of the faces scaled by their area, pointing from
+   *                 the first state of the face to the second one
+   * @param volumes  volumes of the cells
+   * @param dim      dimension of the mesh
+   */
+  void buildGeometry(const std::vector<Common::SafePtr<Framework::TopologicalRegionSet> >& trsList,
+                     Common::SafePtr<Framework::TopologicalRegionSet> cells,
+                     Framework::DataHandle<Framework::State*, Framework::GLOBAL> states,
+                     Framework::DataHandle<Framework::State*> gstates,
+                     Framework::DataHandle<CFreal> normals,
+                     Framework::DataHandle<CFreal> volumes,
+                     CFuint dim);
+
+  /// @return true if the geometry of the coarse levels has been built
+  bool hasGeometry() const {return !m_geometry.empty();}
+
+  /// @return the geometry of the given coarse level
+  const CoarseGeometry& getGeometry(CFuint level) const
+  {
+    cf_assert(level > 0 && level < m_geometry.size());
+    return m_geometry[level];
+  }
+
+  /// @return the volume of the cell of the given state
+  CFreal getStateVolume(CFuint iState) const
+  {
+    cf_assert(iState < m_stateVolumes.size());
+    return m_stateVolumes[iState];
+  }
+
+  /// Releases the memory
+  void clear();
+
+  /**
+   * Builds the graph of the active states joined by the faces, in compressed
+   * sparse row format
+   * @param faces      faces joining two states
+   * @param isActive   flags of the states to put in the graph
+   * @param offsets    offsets of the neighbours of each state
+   * @param neighbours neighbours of the states
+   */
+  static void buildGraph(Common::SafePtr<Framework::TopologicalRegionSet> faces,
+                         const std::vector<bool>& isActive,
+                         std::vector<CFuint>& offsets,
+                         std::vector<CFuint>& neighbours);
+
+private:
+
+  /**
+   * Adds a boundary face to the geometry of a coarse level
+   * @param geo          geometry of the coarse level
+   * @param agglomerate  agglomerate inside the face
+   * @param outerState   state outside the face
+   * @param normal       normal of the face
+   * @param sign         sign making the normal point out of the agglomerate
+   * @param dim          dimension of the mesh
+   */
+  static void addBoundaryFace(CoarseGeometry& geo,
+                              CFuint agglomerate,
+                              Framework::State* outerState,
+                              const CFreal* normal,
+                              CFreal sign,
+                              CFuint dim);
+
+  /**
+   * Agglomerates a graph stored in compressed sparse row format
+   * @param offsets    offsets of the neighbours of each vertex
+   * @param neighbours neighbours of the vertices
+   * @param isActive   flags of the vertices to agglomerate
+   * @param parent     agglomerate of each vertex (NO_AGGLOMERATE if inactive)
+   * @return the number of agglomerates
+   */
+  static CFuint agglomerate(const std::vector<CFuint>& offsets,
+                            const std::vector<CFuint>& neighbours,
+                            const std::vector<bool>& isActive,
+                            std::vector<CFuint>& parent);
+
+  /**
+   * Builds the graph of the agglomerates
+   * @param offsets    offsets of the neighbours of each vertex, overwritten by the coarse ones
+   * @param neighbours neighbours of the vertices, overwritten by the coarse ones
+   * @param parent     agglomerate of each vertex
+   * @param nbCoarse   number of agglomerates
+   */
+  static void coarsenGraph(std::vector<CFuint>& offsets,
+                           std::vector<CFuint>& neighbours,
+                           const std::vector<CFuint>& parent,
+                           CFuint nbCoarse);
+
+private:
+
+  /// agglomerate of each state, per level (empty for the finest level)
+  std::vector<std::vector<CFuint> > m_stateToAgglomerate;
+
+  /// number of agglomerates per level
+  std::vector<CFuint> m_nbAgglomerates;
+
+  /// agglomerate of the next coarser level of each state or agglomerate, per level
+  std::vector<std::vector<CFuint> > m_parent;
+
+  /// geometry per level (empty for the finest level)
+  std::vector<CoarseGeometry> m_geometry;
+
+  /// volume of the cell of each state
+  std::vector<CFreal> m_stateVolumes;
+
+}; // end of class Agglomeration
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_RungeKuttaLS_Agglomeration_hh
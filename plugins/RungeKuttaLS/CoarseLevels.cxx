@@ -0,0 +1,356 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <cmath>
+
+#include "Common/CFLog.hh"
+#include "Common/PtrAlloc.hh"
+#include "MathTools/MathChecks.hh"
+#include "Framework/PhysicalModel.hh"
+#include "Framework/BaseTerm.hh"
+
+#include "RungeKuttaLS/CoarseLevels.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::MathTools;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+CoarseLevels::CoarseLevels() :
+  m_agglomeration(CFNULL),
+  m_varSet(CFNULL),
+  m_nbEqs(0),
+  m_dim(0),
+  m_levels(),
+  m_restrictedRhs(),
+  m_stateL(CFNULL),
+  m_stateR(CFNULL),
+  m_pdataL(),
+  m_pdataR(),
+  m_unitNormal(),
+  m_fluxL(),
+  m_flux()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CoarseLevels::~CoarseLevels()
+{
+  clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CoarseLevels::setup(const Agglomeration& agglomeration,
+                         SafePtr<ConvectiveVarSet> varSet)
+{
+  cf_assert(agglomeration.hasGeometry());
+
+  m_agglomeration = &agglomeration;
+  m_varSet = varSet;
+  m_nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  m_dim = PhysicalModelStack::getActive()->getDim();
+
+  const CFuint nbLevels = agglomeration.getNbLevels();
+  m_levels.assign(nbLevels, Level());
+  for (CFuint iLevel = 1; iLevel < nbLevels; ++iLevel) {
+    const CFuint nbAgglomerates = agglomeration.getNbAgglomerates(iLevel);
+    Level& level = m_levels[iLevel];
+    level.states.assign(nbAgglomerates*m_nbEqs, 0.);
+    level.u0.assign(nbAgglomerates*m_nbEqs, 0.);
+    level.restricted.assign(nbAgglomerates*m_nbEqs, 0.);
+    level.forcing.assign(nbAgglomerates*m_nbEqs, 0.);
+    level.rhs.assign(nbAgglomerates*m_nbEqs, 0.);
+    level.updateCoeff.assign(nbAgglomerates, 0.);
+  }
+
+  deletePtr(m_stateL);
+  deletePtr(m_stateR);
+  m_stateL = new State();
+  m_stateR = new State();
+
+  SafePtr<BaseTerm> convTerm = PhysicalModelStack::getActive()->getImplementor()->getConvectiveTerm();
+  convTerm->resizePhysicalData(m_pdataL);
+  convTerm->resizePhysicalData(m_pdataR);
+
+  m_unitNormal.resize(m_dim);
+  m_fluxL.resize(m_nbEqs);
+  m_flux.resize(m_nbEqs);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CoarseLevels::clear()
+{
+  vector<Level>().swap(m_levels);
+  vector<CFreal>().swap(m_restrictedRhs);
+  deletePtr(m_stateL);
+  deletePtr(m_stateR);
+  m_agglomeration = CFNULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CoarseLevels::restrictStates(DataHandle<State*, GLOBAL> states,
+                                  DataHandle<CFreal> rhs,
+                                  bool withForcing)
+{
+  cf_assert(m_levels.size() > 1);
+
+  Level& coarse = m_levels[1];
+  coarse.states.assign(coarse.states.size(), 0.);
+  m_restrictedRhs.assign(coarse.states.size(), 0.);
+
+  const CFuint nbStates = states.size();
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    const CFuint a = m_agglomeration->getParent(0, iState);
+    if (a == Agglomeration::NO_AGGLOMERATE) continue;
+
+    const CFreal volume = m_agglomeration->getStateVolume(iState);
+    const State& state = *states[iState];
+    for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+      coarse.states[a*m_nbEqs + iEq] += volume*state[iEq];
+    }
+
+    if (withForcing) {
+      for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+        m_restrictedRhs[a*m_nbEqs + iEq] += rhs(iState, iEq, m_nbEqs);
+      }
+    }
+  }
+
+  finishRestriction(1, withForcing);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CoarseLevels::restrictLevel(CFuint level, bool withForcing)
+{
+  cf_assert(level > 0 && level + 1 < m_levels.size());
+
+  // residual of the level at its current solution
+  if (withForcing) {
+    computeResidual(level);
+  }
+
+  const Level& fine = m_levels[level];
+  Level& coarse = m_levels[level + 1];
+  coarse.states.assign(coarse.states.size(), 0.);
+  m_restrictedRhs.assign(coarse.states.size(), 0.);
+
+  const vector<CFreal>& volumes = m_agglomeration->getGeometry(level).volumes;
+  const CFuint nbFine = volumes.size();
+  for (CFuint iFine = 0; iFine < nbFine; ++iFine) {
+    const CFuint a = m_agglomeration->getParent(level, iFine);
+    cf_assert(a != Agglomeration::NO_AGGLOMERATE);
+
+    for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+      coarse.states[a*m_nbEqs + iEq] += volumes[iFine]*fine.states[iFine*m_nbEqs + iEq];
+    }
+
+    if (withForcing) {
+      for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+        m_restrictedRhs[a*m_nbEqs + iEq] += fine.rhs[iFine*m_nbEqs + iEq];
+      }
+    }
+  }
+
+  finishRestriction(level + 1, withForcing);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CoarseLevels::finishRestriction(CFuint level, bool withForcing)
+{
+  Level& coarse = m_levels[level];
+
+  const vector<CFreal>& volumes = m_agglomeration->getGeometry(level).volumes;
+  const CFuint nbAgglomerates = volumes.size();
+  for (CFuint a = 0; a < nbAgglomerates; ++a) {
+    cf_assert(volumes[a] > 0.);
+    const CFreal invVolume = 1./volumes[a];
+    for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+      coarse.states[a*m_nbEqs + iEq] *= invVolume;
+    }
+  }
+  coarse.restricted = coarse.states;
+
+  coarse.forcing.assign(coarse.forcing.size(), 0.);
+  if (withForcing) {
+    // the restricted problem is solved exactly by the restricted solution
+    computeResidual(level);
+    for (CFuint i = 0; i < coarse.forcing.size(); ++i) {
+      coarse.forcing[i] = m_restrictedRhs[i] - coarse.rhs[i];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CoarseLevels::computeResidual(CFuint level)
+{
+  cf_assert(level > 0 && level < m_levels.size());
+
+  Level& lev = m_levels[level];
+  const Agglomeration::CoarseGeometry& geo = m_agglomeration->getGeometry(level);
+
+  lev.rhs = lev.forcing;
+  lev.updateCoeff.assign(lev.updateCoeff.size(), 0.);
+
+  const CFuint nbInnerFaces = geo.innerFaces.size()/2;
+  for (CFuint iFace = 0; iFace < nbInnerFaces; ++iFace) {
+    const CFuint aL = geo.innerFaces[2*iFace];
+    const CFuint aR = geo.innerFaces[2*iFace + 1];
+    for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+      (*m_stateL)[iEq] = lev.states[aL*m_nbEqs + iEq];
+      (*m_stateR)[iEq] = lev.states[aR*m_nbEqs + iEq];
+    }
+
+    const CFreal coeff = computeFlux(&geo.innerNormals[iFace*m_dim]);
+    for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+      lev.rhs[aL*m_nbEqs + iEq] -= m_flux[iEq];
+      lev.rhs[aR*m_nbEqs + iEq] += m_flux[iEq];
+    }
+    lev.updateCoeff[aL] += coeff;
+    lev.updateCoeff[aR] += coeff;
+  }
+
+  const CFuint nbBFaces = geo.bFaceAgglomerates.size();
+  for (CFuint iFace = 0; iFace < nbBFaces; ++iFace) {
+    const CFuint a = geo.bFaceAgglomerates[iFace];
+    const State& outerState = *geo.bFaceStates[iFace];
+    for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+      (*m_stateL)[iEq] = lev.states[a*m_nbEqs + iEq];
+      (*m_stateR)[iEq] = outerState[iEq];
+    }
+
+    const CFreal coeff = computeFlux(&geo.bFaceNormals[iFace*m_dim]);
+    for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+      lev.rhs[a*m_nbEqs + iEq] -= m_flux[iEq];
+    }
+    lev.updateCoeff[a] += coeff;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal CoarseLevels::computeFlux(const CFreal* normal)
+{
+  CFreal area = 0.;
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    area += normal[iDim]*normal[iDim];
+  }
+  area = std::sqrt(area);
+  cf_assert(area > 0.);
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    m_unitNormal[iDim] = normal[iDim]/area;
+  }
+
+  m_varSet->computePhysicalData(*m_stateL, m_pdataL);
+  m_varSet->computePhysicalData(*m_stateR, m_pdataR);
+
+  m_fluxL = m_varSet->getFlux()(m_pdataL, m_unitNormal);
+  m_flux  = m_varSet->getFlux()(m_pdataR, m_unitNormal);
+
+  const CFreal lambda = std::max(m_varSet->getMaxAbsEigenValue(m_pdataL, m_unitNormal),
+                                 m_varSet->getMaxAbsEigenValue(m_pdataR, m_unitNormal));
+
+  for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+    m_flux[iEq] = 0.5*area*(m_fluxL[iEq] + m_flux[iEq] - lambda*((*m_stateR)[iEq] - (*m_stateL)[iEq]));
+  }
+
+  return lambda*area;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CoarseLevels::updateStage(CFuint level, CFuint stage, CFreal alphaCFL)
+{
+  cf_assert(level > 0 && level < m_levels.size());
+
+  Level& lev = m_levels[level];
+
+  // store the solution at the beginning of the smoothing step
+  if (stage == 0) {
+    lev.u0 = lev.states;
+  }
+
+  const CFuint nbAgglomerates = lev.updateCoeff.size();
+  for (CFuint a = 0; a < nbAgglomerates; ++a) {
+    if (MathChecks::isNotZero(lev.updateCoeff[a])) {
+      const CFreal dt = alphaCFL/lev.updateCoeff[a];
+      for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+        const CFuint i = a*m_nbEqs + iEq;
+        lev.states[i] = lev.u0[i] + dt*lev.rhs[i];
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CoarseLevels::prolongStates(DataHandle<State*, GLOBAL> states, bool inject)
+{
+  cf_assert(m_levels.size() > 1);
+
+  const Level& coarse = m_levels[1];
+  const CFuint nbStates = states.size();
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    const CFuint a = m_agglomeration->getParent(0, iState);
+    if (a == Agglomeration::NO_AGGLOMERATE || !states[iState]->isParUpdatable()) continue;
+
+    State& state = *states[iState];
+    for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+      const CFuint i = a*m_nbEqs + iEq;
+      state[iEq] = (inject) ? coarse.states[i] : state[iEq] + coarse.states[i] - coarse.restricted[i];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CoarseLevels::prolongLevel(CFuint level, bool inject)
+{
+  cf_assert(level > 0 && level + 1 < m_levels.size());
+
+  Level& fine = m_levels[level];
+  const Level& coarse = m_levels[level + 1];
+  const CFuint nbFine = fine.updateCoeff.size();
+  for (CFuint iFine = 0; iFine < nbFine; ++iFine) {
+    const CFuint a = m_agglomeration->getParent(level, iFine);
+    cf_assert(a != Agglomeration::NO_AGGLOMERATE);
+
+    for (CFuint iEq = 0; iEq < m_nbEqs; ++iEq) {
+      const CFuint i = a*m_nbEqs + iEq;
+      CFreal& value = fine.states[iFine*m_nbEqs + iEq];
+      value = (inject) ? coarse.states[i] : value + coarse.states[i] - coarse.restricted[i];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,213 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_RungeKuttaLS_CoarseLevels_hh
+#define COOLFluiD_Numerics_RungeKuttaLS_CoarseLevels_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Common/NonCopyable.hh"
+#include "Framework/ConvectiveVarSet.hh"
+#include "RungeKuttaLS/Agglomeration.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class holds the solution of the coarse levels of the agglomeration
+ * multigrid and implements the full approximation scheme (FAS) on them.
+ *
+ * The residual of a coarse level is the balance of first order Rusanov
+ * fluxes through the faces of its agglomerates, computed with the update
+ * variable set of the space method; the states outside the boundary faces
+ * keep their fine values while the coarse level is visited. When the problem
+ * is transferred from level l to level l+1:
+ *   u(l+1) = volume weighted average of u(l) over each agglomerate
+ *   P(l+1) = sum of (R(l)(u(l)) + P(l)) over each agglomerate - R(l+1)(u(l+1))
+ * with P(0) = 0, and level l+1 is smoothed on R(l+1)(u) + P(l+1). Level l is
+ * then corrected by the change of the solution of its agglomerate.
+ * The converged fine solution is a fixed point of the cycle whatever the
+ * accuracy of the coarse residual, which only affects the convergence rate.
+ *
+ * Limitation: the coarse residual does not use the flux splitter, the
+ * reconstruction nor the boundary conditions configured in the FVMCC space
+ * method. It always uses the Rusanov flux through the faces of FacesTRS, so
+ * the faces of the boundary TRSs and their boundary conditions only enter
+ * through the forcing term. The states outside the coarse boundary faces
+ * (partition ghosts and states left out of the agglomeration) are read
+ * through the pointers stored with the geometry, and so keep the fine
+ * values they had when the coarse levels were entered. Boundary conditions
+ * depending strongly on the interior state may therefore slow down the
+ * convergence of the cycle, without changing the converged solution.
+ */
+class CoarseLevels : public Common::NonCopyable<CoarseLevels> {
+public:
+
+  /// Constructor
+  CoarseLevels();
+
+  /// Destructor
+  ~CoarseLevels();
+
+  /**
+   * Allocates the solution of the coarse levels
+   * @param agglomeration  agglomerated levels, with their geometry
+   * @param varSet         variable set of the states
+   */
+  void setup(const Agglomeration& agglomeration,
+             Common::SafePtr<Framework::ConvectiveVarSet> varSet);
+
+  /// Releases the memory
+  void clear();
+
+  /**
+   * Transfers the problem from the mesh states to level 1
+   * @param states  states of the mesh
+   * @param rhs     residual of the states, if withForcing
+   * @param withForcing  compute the forcing term of level 1, or set it to 0
+   */
+  void restrictStates(Framework::DataHandle<Framework::State*, Framework::GLOBAL> states,
+                      Framework::DataHandle<CFreal> rhs,
+                      bool withForcing);
+
+  /**
+   * Transfers the problem from a coarse level to the next coarser one
+   * @param level        coarse level (> 0)
+   * @param withForcing  compute the forcing term of the next level, or set it to 0
+   */
+  void restrictLevel(CFuint level, bool withForcing);
+
+  /**
+   * Computes the residual of a coarse level, including its forcing term,
+   * and the update coefficients of its agglomerates
+   * @param level  coarse level (> 0)
+   */
+  void computeResidual(CFuint level);
+
+  /**
+   * Updates the solution of a coarse level for one stage of the Runge-Kutta
+   * smoother: u = u0 + alpha*cfl*rhs/updateCoeff
+   * @param level     coarse level (> 0)
+   * @param stage     stage of the smoother, the solution being stored at stage 0
+   * @param alphaCFL  coefficient of the stage times the CFL of the level
+   */
+  void updateStage(CFuint level, CFuint stage, CFreal alphaCFL);
+
+  /**
+   * Corrects the mesh states with level 1
+   * @param states  states of the mesh
+   * @param inject  replace the states by the solution of level 1 instead
+   *                of correcting them
+   */
+  void prolongStates(Framework::DataHandle<Framework::State*, Framework::GLOBAL> states,
+                     bool inject);
+
+  /**
+   * Corrects a coarse level with the next coarser one
+   * @param level   coarse level (> 0)
+   * @param inject  replace the solution by the one of the coarser level
+   *                instead of correcting it
+   */
+  void prolongLevel(CFuint level, bool inject);
+
+private: // helper functions
+
+  /**
+   * Computes the Rusanov flux through a face between m_stateL and m_stateR
+   * into m_flux
+   * @param normal  normal of the face, scaled by its area
+   * @return the maximum absolute eigenvalue times the area of the face
+   */
+  CFreal computeFlux(const CFreal* normal);
+
+  /**
+   * Sets the solution of the next coarser level as the volume weighted
+   * average of the one of a level and computes its forcing term from the
+   * summed residual stored in m_restrictedRhs
+   * @param level        coarse level to set (> 0)
+   * @param withForcing  compute the forcing term, or set it to 0
+   */
+  void finishRestriction(CFuint level, bool withForcing);
+
+private: // data
+
+  /// solution and residual of a coarse level
+  struct Level {
+    /// solution
+    std::vector<CFreal> states;
+    /// solution at the beginning of the smoothing step
+    std::vector<CFreal> u0;
+    /// solution restricted from the finer level
+    std::vector<CFreal> restricted;
+    /// forcing term
+    std::vector<CFreal> forcing;
+    /// residual, including the forcing term
+    std::vector<CFreal> rhs;
+    /// denominators of the coefficients for the update
+    std::vector<CFreal> updateCoeff;
+  };
+
+  /// agglomerated levels
+  const Agglomeration* m_agglomeration;
+
+  /// variable set of the states
+  Common::SafePtr<Framework::ConvectiveVarSet> m_varSet;
+
+  /// number of equations
+  CFuint m_nbEqs;
+
+  /// dimension of the mesh
+  CFuint m_dim;
+
+  /// solution per level (empty for the finest level)
+  std::vector<Level> m_levels;
+
+  /// residual of the finer level summed over the agglomerates
+  std::vector<CFreal> m_restrictedRhs;
+
+  /// left state of a face
+  Framework::State* m_stateL;
+
+  /// right state of a face
+  Framework::State* m_stateR;
+
+  /// physical data of the left state
+  RealVector m_pdataL;
+
+  /// physical data of the right state
+  RealVector m_pdataR;
+
+  /// unit normal of a face
+  RealVector m_unitNormal;
+
+  /// flux of the left state
+  RealVector m_fluxL;
+
+  /// flux through a face
+  RealVector m_flux;
+
+}; // end of class CoarseLevels
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_RungeKuttaLS_CoarseLevels_hh
@@ -0,0 +1,268 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Environment/ObjectProvider.hh"
+#include "Framework/SpaceMethod.hh"
+#include "Framework/CFL.hh"
+#include "Framework/SubSystemStatus.hh"
+
+#include "RungeKuttaLS/RungeKuttaLS.hh"
+#include "RungeKuttaLS/RKMultigrid.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+Environment::ObjectProvider<RKMultigrid,
+               ConvergenceMethod,
+               RungeKuttaLSModule,
+               1>
+rkMultigridConvergenceMethodProvider("RKMultigrid");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigrid::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< std::string >("SetupCom","SetupCommand to run. This command seldomly needs overriding.");
+  options.addConfigOption< std::string >("UnSetupCom","UnSetupCommand to run. This command seldomly needs overriding.");
+  options.addConfigOption< std::string >("SmoothCom","Smoothing step command to run.");
+  options.addConfigOption< std::string >("RestrictCom","Command transferring a level to the next coarser one.");
+  options.addConfigOption< std::string >("ProlongCom","Command correcting a level with the next coarser one.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigrid::RKMultigrid(const std::string& name) :
+  ConvergenceMethod(name)
+{
+  addConfigOptionsTo(this);
+
+  m_data.reset(new RKMultigridData(this));
+
+  m_setupStr = "StdSetup";
+  setParameter("SetupCom",&m_setupStr);
+
+  m_unSetupStr = "StdUnSetup";
+  setParameter("UnSetupCom",&m_unSetupStr);
+
+  m_smoothStr = "StdSmooth";
+  setParameter("SmoothCom",&m_smoothStr);
+
+  m_restrictStr = "StdRestrict";
+  setParameter("RestrictCom",&m_restrictStr);
+
+  m_prolongStr = "StdProlong";
+  setParameter("ProlongCom",&m_prolongStr);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigrid::~RKMultigrid()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+Common::SafePtr<MethodData> RKMultigrid::getMethodData() const
+{
+  return m_data.getPtr();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+Common::SafePtr<ConvergenceMethodData> RKMultigrid::getConvergenceMethodData()
+{
+  return m_data.getPtr();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigrid::configure ( Config::ConfigArgs& args )
+{
+  ConvergenceMethod::configure(args);
+  configureNested ( m_data.getPtr(), args );
+
+  configureCommand<RKMultigridData,RKMultigridComProvider>( args, m_setup,m_setupStr,m_data);
+
+  configureCommand<RKMultigridData,RKMultigridComProvider>( args, m_unSetup,m_unSetupStr,m_data);
+
+  configureCommand<RKMultigridData,RKMultigridComProvider>( args, m_smooth,m_smoothStr,m_data);
+
+  configureCommand<RKMultigridData,RKMultigridComProvider>( args, m_restrict,m_restrictStr,m_data);
+
+  configureCommand<RKMultigridData,RKMultigridComProvider>( args, m_prolong,m_prolongStr,m_data);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigrid::setMethodImpl()
+{
+  ConvergenceMethod::setMethodImpl();
+
+  setupCommandsAndStrategies();
+  m_setup->execute();
+
+  setCycle(m_data->getNbLevels(),
+           m_data->getNbCoarseVisits(),
+           m_data->getNbPreSmoothing(),
+           m_data->getNbPostSmoothing(),
+           m_data->getNbCoarsestSmoothing(),
+           m_data->getNbFMGCycles());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigrid::unsetMethodImpl()
+{
+  m_unSetup->execute();
+  unsetupCommandsAndStrategies();
+
+  ConvergenceMethod::unsetMethodImpl();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigrid::takeStepImpl()
+{
+  CFAUTOTRACE;
+
+  // update number of iterations, time step and CFL
+  SubSystemStatusStack::getActive()->updateNbIter();
+  SubSystemStatusStack::getActive()->updateTimeStep();
+  getConvergenceMethodData()->getCFL()->update();
+
+  const CFuint topLevel = getTopLevel(SubSystemStatusStack::getActive()->getNbIter());
+  if (topLevel == 0)
+  {
+    runCycle(0, true);
+    return;
+  }
+
+  // full multigrid start: the residual of the iteration is the one of the
+  // mesh states at its beginning, then the problem of the top level is
+  // solved on its own and its solution is injected into the mesh states
+  computeSpaceResidual();
+  ConvergenceMethod::syncGlobalDataComputeResidual(true);
+
+  m_data->setFMGTransfer(true);
+  for (CFuint level = 0; level < topLevel; ++level)
+  {
+    m_data->setCurrentLevel(level);
+    m_restrict->execute();
+  }
+  m_data->setFMGTransfer(false);
+
+  runCycle(topLevel, false);
+
+  m_data->setFMGTransfer(true);
+  for (CFuint level = topLevel; level > 0; --level)
+  {
+    prolongToFine(level - 1);
+  }
+  m_data->setFMGTransfer(false);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigrid::smooth(CFuint level, CFuint nbSteps, bool isLast)
+{
+  m_data->setCurrentLevel(level);
+
+  const CFuint nbStages = m_data->getNbStages();
+
+  // the coarse levels only involve the smoothing command
+  if (level > 0)
+  {
+    for (CFuint iStep = 0; iStep < nbSteps; ++iStep)
+    {
+      for (CFuint iStage = 0; iStage < nbStages; ++iStage)
+      {
+        m_data->setCurrentStage(iStage);
+        m_smooth->execute();
+      }
+    }
+    return;
+  }
+
+  for (CFuint iStep = 0; iStep < nbSteps; ++iStep)
+  {
+    for (CFuint iStage = 0; iStage < nbStages; ++iStage)
+    {
+      m_data->setCurrentStage(iStage);
+
+      // Compute the RHS
+      computeSpaceResidual();
+
+      // update the solution of this stage
+      m_smooth->execute();
+
+      // Synchronize the states, compute the residual only at the end of the iteration
+      const bool computeResidual = isLast && iStep == nbSteps - 1 && iStage == nbStages - 1;
+      ConvergenceMethod::syncGlobalDataComputeResidual(computeResidual);
+
+      // postprocess the solution
+      m_data->getCollaborator<SpaceMethod>()->postProcessSolution();
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigrid::restrictToCoarse(CFuint level)
+{
+  // the forcing term of level 1 needs the residual of the current mesh states
+  if (level == 0)
+  {
+    computeSpaceResidual();
+  }
+
+  m_data->setCurrentLevel(level);
+  m_restrict->execute();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigrid::prolongToFine(CFuint level)
+{
+  m_data->setCurrentLevel(level);
+  m_prolong->execute();
+
+  if (level == 0)
+  {
+    ConvergenceMethod::syncGlobalDataComputeResidual(false);
+    m_data->getCollaborator<SpaceMethod>()->postProcessSolution();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigrid::computeSpaceResidual()
+{
+  m_data->getCollaborator<SpaceMethod>()->prepareComputation();
+  m_data->getCollaborator<SpaceMethod>()->computeSpaceResidual(1.0);
+  m_data->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
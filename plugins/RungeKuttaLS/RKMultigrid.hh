@@ -0,0 +1,173 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_RungeKuttaLS_RKMultigrid_hh
+#define COOLFluiD_Numerics_RungeKuttaLS_RKMultigrid_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/ConvergenceMethod.hh"
+#include "Framework/MultigridCycle.hh"
+#include "RungeKuttaLS/RKMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class defines a ConvergenceMethod that implements an agglomeration
+ * multigrid for steady cell centered finite volume computations, with the
+ * full approximation scheme (FAS).
+ * Each level is smoothed by an explicit multistage Runge-Kutta scheme. The
+ * finest level is the mesh, smoothed on the residual of the space method.
+ * The coarse levels have their own solution and geometry and are smoothed
+ * on a first order residual of their agglomerates plus the forcing term
+ * given by the residual of the finer level (see CoarseLevels).
+ * That coarse residual always uses the Rusanov flux and frozen outer
+ * states, not the flux splitter and the boundary conditions configured in
+ * the FVMCC space method.
+ * V and W cycles are available, optionally preceded by a full multigrid
+ * start on the coarse levels.
+ */
+class RKMultigrid : public Framework::ConvergenceMethod,
+                    public Framework::MultigridCycle {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Constructor.
+   *
+   * @param name missing documentation
+   */
+  explicit RKMultigrid(const std::string& name);
+
+  /**
+   * Default destructor
+   */
+  ~RKMultigrid();
+
+  /**
+   * Configures the method, by allocating the it's dynamic members.
+   *
+   * @param args missing documentation
+   */
+  virtual void configure ( Config::ConfigArgs& args );
+
+protected: // helper functions
+
+  /**
+   * Gets the Data aggregator of this method
+   * @return SafePtr to the MethodData
+   */
+  virtual Common::SafePtr< Framework::MethodData > getMethodData () const;
+
+  /**
+   * Gets the Data aggregator of this method
+   * @return SafePtr to the ConvergenceMethodData
+   */
+  virtual Common::SafePtr<Framework::ConvergenceMethodData> getConvergenceMethodData();
+
+  /**
+   * Smooths the given level
+   * @see MultigridCycle::smooth()
+   */
+  virtual void smooth(CFuint level, CFuint nbSteps, bool isLast);
+
+  /**
+   * Transfers the solution and the residual of the given level to the next
+   * coarser one
+   * @see MultigridCycle::restrictToCoarse()
+   */
+  virtual void restrictToCoarse(CFuint level);
+
+  /**
+   * Corrects the given level with the next coarser one
+   * @see MultigridCycle::prolongToFine()
+   */
+  virtual void prolongToFine(CFuint level);
+
+  /// Computes the residual of the mesh states with the space method
+  void computeSpaceResidual();
+
+protected: // abstract interface implementations
+
+  /**
+   * Take one timestep
+   * @see ConvergenceMethod::takeStep()
+   */
+  virtual void takeStepImpl();
+
+  /**
+   * UnSets the data of the method.
+   * @see Method::unsetMethod()
+   */
+  virtual void unsetMethodImpl();
+
+  /**
+   * Sets up the data for the method commands to be applied.
+   * @see Method::setMethod()
+   */
+  virtual void setMethodImpl();
+
+protected: // member data
+
+  ///The Setup command to use
+  Common::SelfRegistPtr<RKMultigridCom> m_setup;
+
+  ///The UnSetup command to use
+  Common::SelfRegistPtr<RKMultigridCom> m_unSetup;
+
+  ///The smoothing step command to use
+  Common::SelfRegistPtr<RKMultigridCom> m_smooth;
+
+  ///The restriction command to use
+  Common::SelfRegistPtr<RKMultigridCom> m_restrict;
+
+  ///The prolongation command to use
+  Common::SelfRegistPtr<RKMultigridCom> m_prolong;
+
+  ///The Setup string for configuration
+  std::string m_setupStr;
+
+  ///The UnSetup string for configuration
+  std::string m_unSetupStr;
+
+  ///The smoothing step string for configuration
+  std::string m_smoothStr;
+
+  ///The restriction string for configuration
+  std::string m_restrictStr;
+
+  ///The prolongation string for configuration
+  std::string m_prolongStr;
+
+  ///The data to share between RKMultigrid commands
+  Common::SharedPtr<RKMultigridData> m_data;
+
+}; // class RKMultigrid
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_RungeKuttaLS_RKMultigrid_hh
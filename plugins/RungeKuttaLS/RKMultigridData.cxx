@@ -0,0 +1,150 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/BadValueException.hh"
+#include "Framework/MethodCommandProvider.hh"
+
+#include "RungeKuttaLS/RungeKuttaLS.hh"
+#include "RungeKuttaLS/RKMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<NullMethodCommand<RKMultigridData>, RKMultigridData, RungeKuttaLSModule>
+  nullRKMultigridComProvider("Null");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigridData::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< CFuint >("NbLevels","Number of levels, including the finest one. The coarse levels use a first order Rusanov flux through the faces of FacesTRS with frozen outer states, not the configured FVMCC flux splitter and boundary conditions.");
+  options.addConfigOption< std::string >("FacesTRS","Name of the TRS of the faces joining the cells.");
+  options.addConfigOption< std::string >("CycleType","Type of multigrid cycle (V or W).");
+  options.addConfigOption< CFuint >("PreSmoothing","Number of smoothing steps before visiting the coarser level.");
+  options.addConfigOption< CFuint >("PostSmoothing","Number of smoothing steps after visiting the coarser level.");
+  options.addConfigOption< CFuint >("CoarsestSmoothing","Number of smoothing steps on the coarsest level.");
+  options.addConfigOption< CFuint >("FMGCycles","Number of cycles starting from each coarse level at the beginning of the computation (full multigrid), 0 to disable.");
+  options.addConfigOption< std::vector<CFreal> >("Alpha","Coefficients of the stages of the Runge-Kutta smoother.");
+  options.addConfigOption< CFreal >("CoarseCFLFactor","Factor multiplying the CFL from one level to the next coarser one.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigridData::RKMultigridData(Common::SafePtr<Framework::Method> owner)
+  : ConvergenceMethodData(owner),
+    m_agglomeration(),
+    m_coarseLevels(),
+    m_isFMGTransfer(false),
+    m_level(0),
+    m_stage(0),
+    m_alpha()
+{
+  addConfigOptionsTo(this);
+
+  m_nbLevels = 3;
+  setParameter("NbLevels",&m_nbLevels);
+
+  m_facesTRSName = "InnerFaces";
+  setParameter("FacesTRS",&m_facesTRSName);
+
+  m_cycleType = "V";
+  setParameter("CycleType",&m_cycleType);
+
+  m_nbPreSmoothing = 1;
+  setParameter("PreSmoothing",&m_nbPreSmoothing);
+
+  m_nbPostSmoothing = 1;
+  setParameter("PostSmoothing",&m_nbPostSmoothing);
+
+  m_nbCoarsestSmoothing = 2;
+  setParameter("CoarsestSmoothing",&m_nbCoarsestSmoothing);
+
+  m_nbFMGCycles = 0;
+  setParameter("FMGCycles",&m_nbFMGCycles);
+
+  setParameter("Alpha",&m_alpha);
+
+  m_coarseCFLFactor = 1.0;
+  setParameter("CoarseCFLFactor",&m_coarseCFLFactor);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigridData::~RKMultigridData()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigridData::configure ( Config::ConfigArgs& args )
+{
+  ConvergenceMethodData::configure(args);
+
+  if (m_cycleType != "V" && m_cycleType != "W")
+  {
+    throw BadValueException (FromHere(),"RKMultigridData::configure() => CycleType must be V or W, not " + m_cycleType);
+  }
+
+  if (m_alpha.size() == 0)
+  {
+    // 4-stage Jameson scheme
+    m_alpha.resize(4);
+    m_alpha[0] = 1.0/4.0;
+    m_alpha[1] = 1.0/3.0;
+    m_alpha[2] = 1.0/2.0;
+    m_alpha[3] = 1.0;
+  }
+
+  if (m_nbLevels == 0)
+  {
+    CFLog(WARN, "RKMultigridData::configure() => NbLevels = 0, set to 1\n");
+    m_nbLevels = 1;
+  }
+
+  // the residual of the iteration is computed by the last smoothing step
+  // of the finest level
+  if (m_nbPostSmoothing == 0)
+  {
+    CFLog(WARN, "RKMultigridData::configure() => PostSmoothing = 0, set to 1\n");
+    m_nbPostSmoothing = 1;
+  }
+
+  if (m_nbCoarsestSmoothing == 0)
+  {
+    CFLog(WARN, "RKMultigridData::configure() => CoarsestSmoothing = 0, set to 1\n");
+    m_nbCoarsestSmoothing = 1;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal RKMultigridData::getCFLFactor(CFuint level) const
+{
+  return std::pow(m_coarseCFLFactor, static_cast<CFreal>(level));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,236 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_RungeKuttaLS_RKMultigridData_hh
+#define COOLFluiD_Numerics_RungeKuttaLS_RKMultigridData_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/MethodCommand.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/ConvergenceMethodData.hh"
+#include "RungeKuttaLS/Agglomeration.hh"
+#include "RungeKuttaLS/CoarseLevels.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class represents the data shared by the commands of the
+ * agglomeration multigrid method.
+ * Level 0 is the mesh itself, each coarser level agglomerates the cells of
+ * the previous one and has its own solution, held by CoarseLevels.
+ */
+class RKMultigridData : public Framework::ConvergenceMethodData {
+
+public: // functions
+
+  /// Defines the Config Option's of this class
+  /// @param options a OptionList where to add the Option's
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /// Constructor
+  RKMultigridData(Common::SafePtr<Framework::Method> owner);
+
+  /// Destructor
+  ~RKMultigridData();
+
+  /// Configure the data from the supplied arguments.
+  virtual void configure ( Config::ConfigArgs& args );
+
+  /// Gets the Class name
+  static std::string getClassName()
+  {
+    return "RKMultigrid";
+  }
+
+  /// @return the number of levels requested in the configuration
+  CFuint getNbRequestedLevels() const
+  {
+    return m_nbLevels;
+  }
+
+  /// @return the name of the TRS of the faces joining the cells
+  const std::string& getFacesTRSName() const
+  {
+    return m_facesTRSName;
+  }
+
+  /// @return the agglomerated levels
+  Agglomeration& getAgglomeration()
+  {
+    return m_agglomeration;
+  }
+
+  /// @return the solution of the coarse levels
+  CoarseLevels& getCoarseLevels()
+  {
+    return m_coarseLevels;
+  }
+
+  /// @return true if the solution is transferred between the levels for the
+  ///         full multigrid start, without forcing term and by injection
+  bool isFMGTransfer() const
+  {
+    return m_isFMGTransfer;
+  }
+
+  /// Sets if the solution is transferred between the levels for the full
+  /// multigrid start
+  void setFMGTransfer(bool isFMGTransfer)
+  {
+    m_isFMGTransfer = isFMGTransfer;
+  }
+
+  /// @return the number of levels
+  CFuint getNbLevels() const
+  {
+    return m_agglomeration.getNbLevels();
+  }
+
+  /// @return the current level
+  CFuint getCurrentLevel() const
+  {
+    return m_level;
+  }
+
+  /// Sets the current level
+  void setCurrentLevel(CFuint level)
+  {
+    m_level = level;
+  }
+
+  /// @return the current stage of the smoother
+  CFuint getCurrentStage() const
+  {
+    return m_stage;
+  }
+
+  /// Sets the current stage of the smoother
+  void setCurrentStage(CFuint stage)
+  {
+    m_stage = stage;
+  }
+
+  /// @return the number of stages of the smoother
+  CFuint getNbStages() const
+  {
+    return m_alpha.size();
+  }
+
+  /// @return the coefficient of the given stage of the smoother
+  CFreal getAlpha(CFuint stage) const
+  {
+    cf_assert(stage < m_alpha.size());
+    return m_alpha[stage];
+  }
+
+  /// @return the number of coarser levels visited from each level (1 for V, 2 for W cycles)
+  CFuint getNbCoarseVisits() const
+  {
+    return (m_cycleType == "W") ? 2 : 1;
+  }
+
+  /// @return the number of smoothing steps before visiting the coarser level
+  CFuint getNbPreSmoothing() const
+  {
+    return m_nbPreSmoothing;
+  }
+
+  /// @return the number of smoothing steps after visiting the coarser level
+  CFuint getNbPostSmoothing() const
+  {
+    return m_nbPostSmoothing;
+  }
+
+  /// @return the number of smoothing steps on the coarsest level
+  CFuint getNbCoarsestSmoothing() const
+  {
+    return m_nbCoarsestSmoothing;
+  }
+
+  /// @return the number of cycles starting from each coarse level
+  /// at the beginning of the computation (full multigrid)
+  CFuint getNbFMGCycles() const
+  {
+    return m_nbFMGCycles;
+  }
+
+  /// @return the factor multiplying the CFL on the given level
+  CFreal getCFLFactor(CFuint level) const;
+
+private: // data
+
+  /// agglomerated levels
+  Agglomeration m_agglomeration;
+
+  /// solution of the coarse levels
+  CoarseLevels m_coarseLevels;
+
+  /// flag telling if the solution is transferred for the full multigrid start
+  bool m_isFMGTransfer;
+
+  /// current level
+  CFuint m_level;
+
+  /// current stage of the smoother
+  CFuint m_stage;
+
+  /// number of levels, including the finest one
+  CFuint m_nbLevels;
+
+  /// name of the TRS of the faces joining the cells
+  std::string m_facesTRSName;
+
+  /// type of cycle (V or W)
+  std::string m_cycleType;
+
+  /// number of smoothing steps before visiting the coarser level
+  CFuint m_nbPreSmoothing;
+
+  /// number of smoothing steps after visiting the coarser level
+  CFuint m_nbPostSmoothing;
+
+  /// number of smoothing steps on the coarsest level
+  CFuint m_nbCoarsestSmoothing;
+
+  /// number of cycles starting from each coarse level at the beginning
+  CFuint m_nbFMGCycles;
+
+  /// coefficients of the stages of the smoother
+  std::vector<CFreal> m_alpha;
+
+  /// factor multiplying the CFL from one level to the next coarser one
+  CFreal m_coarseCFLFactor;
+
+}; // end of class RKMultigridData
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Definition of a command for the agglomeration multigrid
+typedef Framework::MethodCommand<RKMultigridData> RKMultigridCom;
+
+/// Definition of a command provider for the agglomeration multigrid
+typedef Framework::MethodCommand<RKMultigridData>::PROVIDER RKMultigridComProvider;
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_RungeKuttaLS_RKMultigridData_hh
@@ -0,0 +1,84 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Framework/MethodCommandProvider.hh"
+
+#include "RungeKuttaLS/RungeKuttaLS.hh"
+#include "RungeKuttaLS/RKMultigridProlong.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<RKMultigridProlong, RKMultigridData, RungeKuttaLSModule>
+  rkMultigridProlongProvider("StdProlong");
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigridProlong::RKMultigridProlong(const std::string& name) :
+  RKMultigridCom(name),
+  socket_states("states")
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigridProlong::~RKMultigridProlong()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > RKMultigridProlong::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_states);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigridProlong::execute()
+{
+  CFAUTOTRACE;
+
+  CoarseLevels& coarseLevels = getMethodData().getCoarseLevels();
+  const bool inject = getMethodData().isFMGTransfer();
+  const CFuint level = getMethodData().getCurrentLevel();
+
+  if (level > 0)
+  {
+    coarseLevels.prolongLevel(level, inject);
+  }
+  else
+  {
+    coarseLevels.prolongStates(socket_states.getDataHandle(), inject);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,70 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_RungeKuttaLS_RKMultigridProlong_hh
+#define COOLFluiD_Numerics_RungeKuttaLS_RKMultigridProlong_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/State.hh"
+#include "Framework/Storage.hh"
+#include "RungeKuttaLS/RKMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class corrects the solution of the current level of the
+ * agglomeration multigrid with the change of the solution of the next
+ * coarser level since its restriction, each state or agglomerate receiving
+ * the correction of its agglomerate.
+ * During the full multigrid start, the solution of the coarser level is
+ * injected instead.
+ */
+class RKMultigridProlong : public RKMultigridCom {
+public:
+
+  /// Constructor.
+  explicit RKMultigridProlong(const std::string& name);
+
+  /// Destructor.
+  ~RKMultigridProlong();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+  /// Execute Processing actions
+  void execute();
+
+protected:
+
+  /// handle to states
+  Framework::DataSocketSink < Framework::State* , Framework::GLOBAL > socket_states;
+
+}; // class RKMultigridProlong
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_RungeKuttaLS_RKMultigridProlong_hh
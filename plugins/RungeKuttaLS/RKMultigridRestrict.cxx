@@ -0,0 +1,134 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/BadValueException.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/PhysicalModel.hh"
+#include "Framework/SpaceMethod.hh"
+#include "Framework/SpaceMethodData.hh"
+
+#include "RungeKuttaLS/RungeKuttaLS.hh"
+#include "RungeKuttaLS/RKMultigridRestrict.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<RKMultigridRestrict, RKMultigridData, RungeKuttaLSModule>
+  rkMultigridRestrictProvider("StdRestrict");
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigridRestrict::RKMultigridRestrict(const std::string& name) :
+  RKMultigridCom(name),
+  socket_rhs("rhs"),
+  socket_updateCoeff("updateCoeff"),
+  socket_states("states"),
+  socket_gstates("gstates"),
+  socket_normals("normals"),
+  socket_volumes("volumes")
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigridRestrict::~RKMultigridRestrict()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > RKMultigridRestrict::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_rhs);
+  result.push_back(&socket_updateCoeff);
+  result.push_back(&socket_states);
+  result.push_back(&socket_gstates);
+  result.push_back(&socket_normals);
+  result.push_back(&socket_volumes);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigridRestrict::execute()
+{
+  CFAUTOTRACE;
+
+  if (!getMethodData().getAgglomeration().hasGeometry())
+  {
+    setupCoarseLevels();
+  }
+
+  CoarseLevels& coarseLevels = getMethodData().getCoarseLevels();
+  const bool withForcing = !getMethodData().isFMGTransfer();
+  const CFuint level = getMethodData().getCurrentLevel();
+
+  if (level > 0)
+  {
+    coarseLevels.restrictLevel(level, withForcing);
+    return;
+  }
+
+  coarseLevels.restrictStates(socket_states.getDataHandle(), socket_rhs.getDataHandle(), withForcing);
+
+  // the update coefficients of the residual are not used
+  DataHandle<CFreal> updateCoeff = socket_updateCoeff.getDataHandle();
+  updateCoeff = 0.0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigridRestrict::setupCoarseLevels()
+{
+  // the coarse residual is made of fluxes of the update variables, while the
+  // fine residual is transformed from the solution to the update variables
+  SafePtr<SpaceMethodData> spaceData =
+    getMethodData().getCollaborator<SpaceMethod>()->getSpaceMethodData();
+  if (spaceData->getUpdateVarStr() != spaceData->getSolutionVarStr())
+  {
+    throw BadValueException (FromHere(),"RKMultigridRestrict::setupCoarseLevels() => the coarse levels need the same update and solution variables, not "
+                             + spaceData->getUpdateVarStr() + " and " + spaceData->getSolutionVarStr());
+  }
+
+  SafePtr<MeshData> meshData = MeshDataStack::getActive();
+  Agglomeration& agglomeration = getMethodData().getAgglomeration();
+  agglomeration.buildGeometry(meshData->getTrsList(),
+                              meshData->getTrs("InnerCells"),
+                              socket_states.getDataHandle(),
+                              socket_gstates.getDataHandle(),
+                              socket_normals.getDataHandle(),
+                              socket_volumes.getDataHandle(),
+                              PhysicalModelStack::getActive()->getDim());
+
+  getMethodData().getCoarseLevels().setup(agglomeration, spaceData->getUpdateVar());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
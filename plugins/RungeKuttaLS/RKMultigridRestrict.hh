@@ -0,0 +1,91 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_RungeKuttaLS_RKMultigridRestrict_hh
+#define COOLFluiD_Numerics_RungeKuttaLS_RKMultigridRestrict_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/State.hh"
+#include "Framework/Storage.hh"
+#include "RungeKuttaLS/RKMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class transfers the problem of the current level of the agglomeration
+ * multigrid to the next coarser one: the solution is averaged over the
+ * agglomerates and the forcing term of the coarser level is computed from
+ * the residual of the current one, which must be in rhs on the finest level.
+ * During the full multigrid start, only the solution is transferred.
+ * The first execution builds the geometry of the coarse levels from the
+ * normals and volumes of the cell centered finite volume mesh.
+ */
+class RKMultigridRestrict : public RKMultigridCom {
+public:
+
+  /// Constructor.
+  explicit RKMultigridRestrict(const std::string& name);
+
+  /// Destructor.
+  ~RKMultigridRestrict();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+  /// Execute Processing actions
+  void execute();
+
+protected:
+
+  /// Builds the geometry of the coarse levels and allocates their solution
+  void setupCoarseLevels();
+
+protected:
+
+  /// socket for rhs
+  Framework::DataSocketSink<CFreal> socket_rhs;
+
+  /// socket for updateCoeff
+  Framework::DataSocketSink<CFreal> socket_updateCoeff;
+
+  /// handle to states
+  Framework::DataSocketSink < Framework::State* , Framework::GLOBAL > socket_states;
+
+  /// handle to ghost states
+  Framework::DataSocketSink<Framework::State*> socket_gstates;
+
+  /// socket for the normals of the faces
+  Framework::DataSocketSink<CFreal> socket_normals;
+
+  /// socket for the volumes of the cells
+  Framework::DataSocketSink<CFreal> socket_volumes;
+
+}; // class RKMultigridRestrict
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_RungeKuttaLS_RKMultigridRestrict_hh
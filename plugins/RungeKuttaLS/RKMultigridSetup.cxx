@@ -0,0 +1,116 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Framework/MeshData.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/PhysicalModel.hh"
+
+#include "RungeKuttaLS/RungeKuttaLS.hh"
+#include "RungeKuttaLS/RKMultigridSetup.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<RKMultigridSetup, RKMultigridData, RungeKuttaLSModule>
+  rkMultigridSetupProvider("StdSetup");
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigridSetup::RKMultigridSetup(const std::string& name) :
+  RKMultigridCom(name),
+  socket_rhs("rhs"),
+  socket_u0("u0"),
+  socket_updateCoeff("updateCoeff"),
+  socket_states("states")
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigridSetup::~RKMultigridSetup()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector<Common::SafePtr<BaseDataSocketSource> >
+RKMultigridSetup::providesSockets()
+{
+  std::vector<Common::SafePtr<BaseDataSocketSource> > result;
+
+  result.push_back(&socket_rhs);
+  result.push_back(&socket_u0);
+  result.push_back(&socket_updateCoeff);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > RKMultigridSetup::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_states);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigridSetup::execute()
+{
+  CFAUTOTRACE;
+
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+
+  const CFuint nbStates = states.size();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+  rhs.resize(nbStates*nbEqs);
+  rhs = 0.0;
+
+  DataHandle<CFreal> u0 = socket_u0.getDataHandle();
+  u0.resize(nbStates*nbEqs);
+
+  DataHandle<CFreal> updateCoeff = socket_updateCoeff.getDataHandle();
+  updateCoeff.resize(nbStates);
+  updateCoeff = 0.0;
+
+  SafePtr<TopologicalRegionSet> faces =
+    MeshDataStack::getActive()->getTrs(getMethodData().getFacesTRSName());
+
+  Agglomeration& agglomeration = getMethodData().getAgglomeration();
+  agglomeration.build(faces, states, getMethodData().getNbRequestedLevels());
+
+  CFLog(INFO, "RKMultigridSetup::execute() => " << agglomeration.getNbLevels()
+        << " levels, " << agglomeration.getNbAgglomerates(agglomeration.getNbLevels()-1)
+        << " agglomerates on the coarsest one\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,83 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_RungeKuttaLS_RKMultigridSetup_hh
+#define COOLFluiD_Numerics_RungeKuttaLS_RKMultigridSetup_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/DataSocketSource.hh"
+#include "Framework/State.hh"
+#include "Framework/Storage.hh"
+#include "RungeKuttaLS/RKMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class sets up the agglomeration multigrid method: it allocates the
+ * sockets and agglomerates the levels.
+ */
+class RKMultigridSetup : public RKMultigridCom {
+public:
+
+  /// Constructor.
+  explicit RKMultigridSetup(const std::string& name);
+
+  /// Destructor.
+  ~RKMultigridSetup();
+
+  /**
+   * Returns the DataSocket's that this command provides as sources
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSource> > providesSockets();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  virtual std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+  /// Execute Processing actions
+  void execute();
+
+protected:
+
+  /// socket for rhs
+  Framework::DataSocketSource<CFreal> socket_rhs;
+
+  /// socket for the solution at the beginning of the smoothing step
+  Framework::DataSocketSource<CFreal> socket_u0;
+
+  /// socket for updateCoeff
+  /// denominators of the coefficients for the update
+  Framework::DataSocketSource<CFreal> socket_updateCoeff;
+
+  /// handle to states
+  Framework::DataSocketSink < Framework::State* , Framework::GLOBAL > socket_states;
+
+}; // class RKMultigridSetup
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_RungeKuttaLS_RKMultigridSetup_hh
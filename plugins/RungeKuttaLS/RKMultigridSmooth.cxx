@@ -0,0 +1,137 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/CFLog.hh"
+#include "MathTools/MathChecks.hh"
+#include "Framework/CFL.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/PhysicalModel.hh"
+
+#include "RungeKuttaLS/RungeKuttaLS.hh"
+#include "RungeKuttaLS/RKMultigridSmooth.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::MathTools;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<RKMultigridSmooth, RKMultigridData, RungeKuttaLSModule>
+  rkMultigridSmoothProvider("StdSmooth");
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigridSmooth::RKMultigridSmooth(const std::string& name) :
+  RKMultigridCom(name),
+  socket_rhs("rhs"),
+  socket_u0("u0"),
+  socket_updateCoeff("updateCoeff"),
+  socket_states("states")
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigridSmooth::~RKMultigridSmooth()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > RKMultigridSmooth::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_rhs);
+  result.push_back(&socket_u0);
+  result.push_back(&socket_updateCoeff);
+  result.push_back(&socket_states);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigridSmooth::execute()
+{
+  CFAUTOTRACE;
+
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle<CFreal> u0          = socket_u0         .getDataHandle();
+  DataHandle<CFreal> rhs         = socket_rhs        .getDataHandle();
+  DataHandle<CFreal> updateCoeff = socket_updateCoeff.getDataHandle();
+
+  const CFuint level = getMethodData().getCurrentLevel();
+  const CFuint stage = getMethodData().getCurrentStage();
+  const CFreal alpha = getMethodData().getAlpha(stage);
+  const CFreal cfl   = getMethodData().getCFL()->getCFLValue()*getMethodData().getCFLFactor(level);
+
+  // the coarse levels compute their own residual
+  if (level > 0)
+  {
+    CoarseLevels& coarseLevels = getMethodData().getCoarseLevels();
+    coarseLevels.computeResidual(level);
+    coarseLevels.updateStage(level, stage, alpha*cfl);
+    return;
+  }
+
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFuint nbStates = states.size();
+
+  // store the solution at the beginning of the smoothing step
+  if (stage == 0)
+  {
+    for (CFuint i = 0; i < nbStates; ++i)
+    {
+      for (CFuint j = 0; j < nbEqs; ++j)
+      {
+        u0(i,j,nbEqs) = (*states[i])[j];
+      }
+    }
+  }
+
+  // update the states
+  for (CFuint i = 0; i < nbStates; ++i)
+  {
+    if (states[i]->isParUpdatable())
+    {
+      if (MathChecks::isNotZero(updateCoeff[i]))
+      {
+        const CFreal dt = alpha*cfl/updateCoeff[i];
+        for (CFuint j = 0; j < nbEqs; ++j)
+        {
+          (*states[i])[j] = u0(i,j,nbEqs) + dt*rhs(i,j,nbEqs);
+        }
+      }
+
+      cf_assert(states[i]->isValid());
+    }
+
+    // reset to 0 the update coefficient
+    updateCoeff[i] = 0.0;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
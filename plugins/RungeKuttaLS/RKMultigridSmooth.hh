@@ -0,0 +1,79 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_RungeKuttaLS_RKMultigridSmooth_hh
+#define COOLFluiD_Numerics_RungeKuttaLS_RKMultigridSmooth_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/State.hh"
+#include "Framework/Storage.hh"
+#include "RungeKuttaLS/RKMultigridData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class performs one stage of the Runge-Kutta smoother on the current
+ * level of the agglomeration multigrid:
+ *   u = u0 + alpha*cfl*rhs/updateCoeff
+ * On the finest level, rhs and updateCoeff are computed by the space method
+ * for the mesh states. On the coarse levels, they are computed for the
+ * agglomerates by CoarseLevels, including the forcing term of the level.
+ */
+class RKMultigridSmooth : public RKMultigridCom {
+public:
+
+  /// Constructor.
+  explicit RKMultigridSmooth(const std::string& name);
+
+  /// Destructor.
+  ~RKMultigridSmooth();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+  /// Execute Processing actions
+  void execute();
+
+protected:
+
+  /// socket for rhs
+  Framework::DataSocketSink<CFreal> socket_rhs;
+
+  /// socket for the solution at the beginning of the smoothing step
+  Framework::DataSocketSink<CFreal> socket_u0;
+
+  /// socket for updateCoeff
+  Framework::DataSocketSink<CFreal> socket_updateCoeff;
+
+  /// handle to states
+  Framework::DataSocketSink < Framework::State* , Framework::GLOBAL > socket_states;
+
+}; // class RKMultigridSmooth
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_RungeKuttaLS_RKMultigridSmooth_hh
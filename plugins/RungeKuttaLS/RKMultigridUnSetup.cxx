@@ -0,0 +1,81 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Framework/MethodCommandProvider.hh"
+
+#include "RungeKuttaLS/RungeKuttaLS.hh"
+#include "RungeKuttaLS/RKMultigridUnSetup.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace RungeKuttaLS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<RKMultigridUnSetup, RKMultigridData, RungeKuttaLSModule>
+  rkMultigridUnSetupProvider("StdUnSetup");
+
+//////////////////////////////////////////////////////////////////////////////
+
+RKMultigridUnSetup::RKMultigridUnSetup(const std::string& name) :
+  RKMultigridCom(name),
+  socket_rhs("rhs"),
+  socket_u0("u0"),
+  socket_updateCoeff("updateCoeff")
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > RKMultigridUnSetup::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_rhs);
+  result.push_back(&socket_u0);
+  result.push_back(&socket_updateCoeff);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void RKMultigridUnSetup::execute()
+{
+  CFAUTOTRACE;
+
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+  rhs.resize(0);
+
+  DataHandle<CFreal> u0 = socket_u0.getDataHandle();
+  u0.resize(0);
+
+  DataHandle<CFreal> updateCoeff = socket_updateCoeff.getDataHandle();
+  updateCoeff.resize(0);
+
+  getMethodData().getCoarseLevels().clear();
+  getMethodData().getAgglomeration().clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace RungeKuttaLS
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
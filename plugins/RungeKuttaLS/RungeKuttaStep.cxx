@@ -6,6 +6,8 @@
 
 
 
+#include <algorithm>
+
 #include "Common/CFLog.hh"
 #include "MathTools/MathChecks.hh"
 #include "Framework/State.hh"
@@ -14,6 +16,7 @@
 #include "Framework/MeshData.hh"
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/SocketException.hh"
+#include "RungeKuttaLS/Agglomeration.hh"
 #include "RungeKuttaLS/RungeKuttaLS.hh"
 #include "RungeKuttaLS/RungeKuttaStep.hh"
 
@@ -38,14 +41,42 @@ MethodCommandProvider<RungeKuttaStep, RKLSData, RungeKuttaLSModule> RungeKuttaSt
 
 //////////////////////////////////////////////////////////////////////////////
 
+void RungeKuttaStep::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< CFreal >("SmoothingCoeff","Implicit residual smoothing coefficient (0 to disable, steady computations only).");
+  options.addConfigOption< CFuint >("SmoothingIter","Number of Jacobi iterations of the implicit residual smoothing.");
+  options.addConfigOption< std::vector<CFuint> >("SmoothedStages","Stages whose update is smoothed (all if empty).");
+  options.addConfigOption< std::string >("SmoothingFacesTRS","Name of the TRS of the faces joining the states for the residual smoothing.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 RungeKuttaStep::RungeKuttaStep(const std::string& name) :
     RKLSCom(name),
     socket_rhs("rhs"),
     socket_u0("u0"),
     socket_updateCoeff("updateCoeff"),
     socket_states("states"),
-    socket_volumes("volumes",false)
+    socket_volumes("volumes",false),
+    m_smoothedStages(),
+    m_offsets(),
+    m_neighbours(),
+    m_du0(),
+    m_du(),
+    m_duOld()
 {
+  addConfigOptionsTo(this);
+
+  m_smoothingCoeff = 0.;
+  setParameter("SmoothingCoeff",&m_smoothingCoeff);
+
+  m_nbSmoothingIter = 2;
+  setParameter("SmoothingIter",&m_nbSmoothingIter);
+
+  setParameter("SmoothedStages",&m_smoothedStages);
+
+  m_facesTRSName = "InnerFaces";
+  setParameter("SmoothingFacesTRS",&m_facesTRSName);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -60,12 +91,41 @@ void RungeKuttaStep::setup()
 {
   if (!socket_volumes.isConnected() && getMethodData().isTimeAccurate())
       throw SocketException (FromHere(),"Non essential 'volumes' socket must be plugged for time accurate RungeKuttaLS computation");
+
+  if (m_smoothingCoeff > 0. && getMethodData().isTimeAccurate())
+  {
+    CFLog(WARN, "RungeKuttaStep::setup() => residual smoothing disabled for time accurate computation\n");
+    m_smoothingCoeff = 0.;
+  }
+
+  if (m_smoothingCoeff > 0.)
+  {
+    // graph of the parallel updatable states joined by a face
+    DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+    const CFuint nbStates = states.size();
+    vector<bool> isUpdatable(nbStates);
+    for (CFuint i = 0; i < nbStates; ++i)
+    {
+      isUpdatable[i] = states[i]->isParUpdatable();
+    }
+
+    SafePtr<TopologicalRegionSet> faces = MeshDataStack::getActive()->getTrs(m_facesTRSName);
+    Agglomeration::buildGraph(faces, isUpdatable, m_offsets, m_neighbours);
+
+    CFLog(VERBOSE, "RungeKuttaStep::setup() => residual smoothing over "
+          << m_neighbours.size()/2 << " faces\n");
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void RungeKuttaStep::unsetup()
 {
+  vector<CFuint>().swap(m_offsets);
+  vector<CFuint>().swap(m_neighbours);
+  vector<CFreal>().swap(m_du0);
+  vector<CFreal>().swap(m_du);
+  vector<CFreal>().swap(m_duOld);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -110,6 +170,17 @@ void RungeKuttaStep::execute()
   const CFreal beta  = getMethodData().getBeta(step);
   const CFreal oEminusAlpha = 1.0 - alpha;
 
+  // the updates of the smoothed stages are stored before being applied
+  bool doSmoothing = m_smoothingCoeff > 0.;
+  if (doSmoothing && m_smoothedStages.size() > 0)
+  {
+    doSmoothing = std::find(m_smoothedStages.begin(), m_smoothedStages.end(), step) != m_smoothedStages.end();
+  }
+  if (doSmoothing)
+  {
+    m_du0.assign(nbStates*nbEqs, 0.);
+  }
+
   // loop over states
   for (CFuint i = 0; i < nbStates; ++i)
   {
@@ -165,18 +236,46 @@ void RungeKuttaStep::execute()
       // update solution
       // Uk+1 = (1.0-alpha[k])*U0 + alpha[k]*Uk + beta[k]*dt*rhs[k]
       dt *= beta;
-      for (CFuint j = 0; j < nbEqs; ++j)
+      if (doSmoothing)
       {
-        // update of the state
-        (*states[i])[j] = oEminusAlpha*u0[i][j] + alpha*(*states[i])[j] + rhs(i,j,nbEqs) * dt;
+        for (CFuint j = 0; j < nbEqs; ++j)
+        {
+          m_du0[i*nbEqs+j] = rhs(i,j,nbEqs) * dt;
+        }
       }
+      else
+      {
+        for (CFuint j = 0; j < nbEqs; ++j)
+        {
+          // update of the state
+          (*states[i])[j] = oEminusAlpha*u0[i][j] + alpha*(*states[i])[j] + rhs(i,j,nbEqs) * dt;
+        }
 
-      cf_assert(states[i]->isValid());
+        cf_assert(states[i]->isValid());
+      }
     }
     // reset to 0 the update coefficient
     updateCoeff[i] = 0.0;
   }
 
+  if (doSmoothing)
+  {
+    smoothUpdates(nbEqs);
+
+    for (CFuint i = 0; i < nbStates; ++i)
+    {
+      if (states[i]->isParUpdatable())
+      {
+        for (CFuint j = 0; j < nbEqs; ++j)
+        {
+          (*states[i])[j] = oEminusAlpha*u0[i][j] + alpha*(*states[i])[j] + m_du[i*nbEqs+j];
+        }
+
+        cf_assert(states[i]->isValid());
+      }
+    }
+  }
+
   if(isTimeAccurate && isTimeStepTooLarge)
   {
     CFLog(WARN, "The chosen time step is too large as it gives a maximum CFL of " << maxCFL <<".\n");
@@ -191,6 +290,36 @@ void RungeKuttaStep::execute()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void RungeKuttaStep::smoothUpdates(const CFuint nbEqs)
+{
+  const CFuint nbStates = m_offsets.size() - 1;
+  const CFreal eps = m_smoothingCoeff;
+
+  m_du = m_du0;
+  m_duOld.resize(m_du0.size());
+  for (CFuint iter = 0; iter < m_nbSmoothingIter; ++iter)
+  {
+    m_du.swap(m_duOld);
+    for (CFuint i = 0; i < nbStates; ++i)
+    {
+      const CFuint start = m_offsets[i];
+      const CFuint end   = m_offsets[i+1];
+      const CFreal invDiag = 1./(1. + eps*(end - start));
+      for (CFuint j = 0; j < nbEqs; ++j)
+      {
+        CFreal sum = 0.;
+        for (CFuint in = start; in < end; ++in)
+        {
+          sum += m_duOld[m_neighbours[in]*nbEqs+j];
+        }
+        m_du[i*nbEqs+j] = (m_du0[i*nbEqs+j] + eps*sum)*invDiag;
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 vector<SafePtr<BaseDataSocketSink> > RungeKuttaStep::needsSockets()
 {
   vector<SafePtr<BaseDataSocketSink> > result;
@@ -26,11 +26,23 @@ namespace COOLFluiD {
 
   /**
    * This command implements a R-K stage
+   *
+   * For steady computations, the local time stepped update of the selected
+   * stages can be smoothed implicitly over the graph of the states joined by
+   * the faces of a TRS (Jameson's residual smoothing):
+   *   (1 + eps*n_i) du_i - eps*sum_j du_j = dt_i*rhs_i
+   * solved by a few Jacobi iterations, which allows a larger CFL.
    * @author Kris Van den Abeele
    */
 class RungeKuttaStep : public RKLSCom {
 public:
 
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
   /**
    * Constructor.
    */
@@ -62,6 +74,11 @@ public:
    */
   virtual std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
 
+protected:
+
+  /// Smooths the updates in m_du by Jacobi iterations
+  void smoothUpdates(const CFuint nbEqs);
+
 protected:
 
   /// socket for rhs
@@ -79,6 +96,33 @@ protected:
   /// handle to volumes
   Framework::DataSocketSink<CFreal> socket_volumes;
 
+  /// residual smoothing coefficient (0 to disable the smoothing)
+  CFreal m_smoothingCoeff;
+
+  /// number of Jacobi iterations of the residual smoothing
+  CFuint m_nbSmoothingIter;
+
+  /// stages whose update is smoothed (all if empty)
+  std::vector<CFuint> m_smoothedStages;
+
+  /// name of the TRS of the faces joining the states
+  std::string m_facesTRSName;
+
+  /// offsets of the neighbours of each state in m_neighbours
+  std::vector<CFuint> m_offsets;
+
+  /// neighbours of the states
+  std::vector<CFuint> m_neighbours;
+
+  /// unsmoothed updates of the states
+  std::vector<CFreal> m_du0;
+
+  /// smoothed updates of the states
+  std::vector<CFreal> m_du;
+
+  /// smoothed updates of the states at the previous Jacobi iteration
+  std::vector<CFreal> m_duOld;
+
 }; // class Setup
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,298 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <new>
+#include <sstream>
+
+#include "Common/AllocationTracker.hh"
+#include "Common/BadValueException.hh"
+#include "Common/CFLog.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef CF_ENABLE_ALLOCATION_TRACKER
+
+#if __cplusplus >= 201103L
+#define CF_THROW_BAD_ALLOC
+#define CF_NO_THROW noexcept
+#else
+#define CF_THROW_BAD_ALLOC throw(std::bad_alloc)
+#define CF_NO_THROW throw()
+#endif
+
+namespace {
+
+/// Allocates with malloc, as the default operator new does
+inline void* trackedNew(std::size_t size)
+{
+  if (COOLFluiD::Common::AllocationTracker::isActive()) {
+    COOLFluiD::Common::AllocationTracker::getInstance().recordAllocation(size);
+  }
+
+  if (size == 0) size = 1;
+  for (;;) {
+    void* p = std::malloc(size);
+    if (p != 0) return p;
+
+    std::new_handler handler = std::set_new_handler(0);
+    std::set_new_handler(handler);
+    if (handler == 0) throw std::bad_alloc();
+    handler();
+  }
+}
+
+/// Allocates without throwing
+inline void* trackedNewNoThrow(std::size_t size)
+{
+  try {
+    return trackedNew(size);
+  }
+  catch (...) {
+    return 0;
+  }
+}
+
+}
+
+// replacements of the global allocation functions, see AllocationTracker
+
+void* operator new(std::size_t size) CF_THROW_BAD_ALLOC
+{
+  return trackedNew(size);
+}
+
+void* operator new[](std::size_t size) CF_THROW_BAD_ALLOC
+{
+  return trackedNew(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) CF_NO_THROW
+{
+  return trackedNewNoThrow(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) CF_NO_THROW
+{
+  return trackedNewNoThrow(size);
+}
+
+void operator delete(void* p) CF_NO_THROW
+{
+  std::free(p);
+}
+
+void operator delete[](void* p) CF_NO_THROW
+{
+  std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) CF_NO_THROW
+{
+  std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) CF_NO_THROW
+{
+  std::free(p);
+}
+
+#endif // CF_ENABLE_ALLOCATION_TRACKER
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+namespace COOLFluiD {
+
+    namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// one line of the report
+struct ReportLine {
+  ReportLine() : name(), nbAllocations(0), bytes(0.), budget(0) {}
+  std::string name;
+  CFuint nbAllocations;
+  CFdouble bytes;
+  CFuint budget;
+};
+
+/// Orders report lines by decreasing number of allocations
+struct MoreAllocations {
+  bool operator() (const ReportLine& a, const ReportLine& b) const
+  {
+    return (a.nbAllocations != b.nbAllocations) ?
+      (a.nbAllocations > b.nbAllocations) : (a.bytes > b.bytes);
+  }
+};
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+const CFuint AllocationTracker::NO_BUDGET = std::numeric_limits<CFuint>::max();
+
+bool AllocationTracker::s_active = false;
+
+//////////////////////////////////////////////////////////////////////////////
+
+AllocationTracker& AllocationTracker::getInstance()
+{
+  // never destroyed: allocations can still happen during the static destruction
+  static AllocationTracker* tracker = new AllocationTracker();
+  return *tracker;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+AllocationTracker::AllocationTracker() :
+  m_isRecording(true),
+  m_nbIterations(0),
+  m_budget(NO_BUDGET),
+  m_strict(false),
+  m_names(),
+  m_ids(),
+  m_counters(),
+  m_stack()
+{
+  // root scope, for the allocations outside any scope
+  pushScope(std::string("Other"));
+  m_isRecording = false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AllocationTracker::setActive(bool active)
+{
+#ifdef CF_ENABLE_ALLOCATION_TRACKER
+  s_active = active;
+#else
+  if (active) {
+    CFLog(WARN, "AllocationTracker: tracking the allocations requires a build with CF_ENABLE_ALLOCATION_TRACKER\n");
+  }
+  s_active = false;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AllocationTracker::pushScope(const NamedObject& object, const std::string& suffix)
+{
+  m_isRecording = true;
+  pushScope(object.getName() + suffix);
+  m_isRecording = false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AllocationTracker::pushScope(const NamedObject& object, const NamedObject& subObject)
+{
+  m_isRecording = true;
+  pushScope(object.getName() + "@" + subObject.getName());
+  m_isRecording = false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AllocationTracker::pushScope(const std::string& name)
+{
+  std::map<std::string, CFuint>::const_iterator it = m_ids.find(name);
+  CFuint id = 0;
+  if (it == m_ids.end()) {
+    id = m_names.size();
+    m_ids[name] = id;
+    m_names.push_back(name);
+    m_counters.push_back(Counter());
+  }
+  else {
+    id = it->second;
+  }
+  m_stack.push_back(id);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AllocationTracker::popScope()
+{
+  // the root scope is never left
+  cf_assert(m_stack.size() > 1);
+  m_stack.pop_back();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::string AllocationTracker::endIteration(CFuint iter)
+{
+  m_isRecording = true;
+
+  std::vector<ReportLine> lines;
+  std::string exceeded;
+  for (CFuint id = 0; id < m_counters.size(); ++id) {
+    const Counter& counter = m_counters[id];
+    if (counter.nbAllocations == 0) continue;
+
+    ReportLine line;
+    line.name = m_names[id];
+    line.nbAllocations = counter.nbAllocations;
+    line.bytes = counter.bytes;
+    line.budget = m_budget;
+    lines.push_back(line);
+
+    // the first iteration sets up the work arrays
+    if (m_nbIterations > 0 && line.nbAllocations > line.budget) {
+      exceeded += " " + line.name;
+    }
+  }
+  std::sort(lines.begin(), lines.end(), MoreAllocations());
+
+  std::ostringstream out;
+  out << "Heap allocations during iteration " << iter << ":\n";
+  out << std::setw(12) << "Count" << std::setw(14) << "KB" << std::setw(12) << "Budget" << "  Scope\n";
+  for (CFuint i = 0; i < lines.size(); ++i) {
+    out << std::setw(12) << lines[i].nbAllocations
+        << std::setw(14) << std::fixed << std::setprecision(1) << lines[i].bytes/1024.
+        << std::setw(12);
+    if (lines[i].budget == NO_BUDGET) {
+      out << "-";
+    }
+    else {
+      out << lines[i].budget;
+    }
+    out << "  " << lines[i].name << "\n";
+  }
+
+  for (CFuint id = 0; id < m_counters.size(); ++id) {
+    m_counters[id] = Counter();
+  }
+  ++m_nbIterations;
+
+  if (!exceeded.empty()) {
+    if (m_strict) {
+      m_isRecording = false;
+      throw BadValueException (FromHere(), "Allocation budget exceeded by:" + exceeded + "\n" + out.str());
+    }
+    CFLog(WARN, "Allocation budget of " << m_budget << " exceeded during iteration "
+          << iter << " by:" << exceeded << "\n");
+  }
+
+  m_isRecording = false;
+
+  return out.str();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
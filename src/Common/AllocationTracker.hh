@@ -0,0 +1,176 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Common_AllocationTracker_hh
+#define COOLFluiD_Common_AllocationTracker_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Common/COOLFluiD.hh"
+#include "Common/NonCopyable.hh"
+#include "Common/NamedObject.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+    namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class counts the heap allocations done through operator new and
+/// attributes them to the innermost active scope (a method function, a
+/// command applied on a TRS, ...), iteration by iteration.
+/// The global operator new and delete are only replaced when the build
+/// option CF_ENABLE_ALLOCATION_TRACKER is on; tracking is then turned on at
+/// runtime (CFEnv option TrackAllocations), and costs one test per allocation
+/// when off.
+/// All the scopes share one budget of allocations per iteration (CFEnv option
+/// AllocationBudget): exceeding it after the first iteration is logged as a
+/// warning, or throws an exception in strict mode.
+/// The counters are not atomic: the allocations of threaded regions are
+/// attributed to the scope which started them, but may be undercounted.
+class Common_API AllocationTracker : public NonCopyable<AllocationTracker> {
+public:
+
+  /// value of the budget meaning that there is no budget
+  static const CFuint NO_BUDGET;
+
+  /// @return the single instance of this class
+  static AllocationTracker& getInstance();
+
+  /// @return true if the allocations are being tracked
+  static bool isActive() {return s_active;}
+
+  /// Turns the tracking on or off
+  void setActive(bool active);
+
+  /// Sets the budget of allocations per iteration of every scope
+  void setBudget(CFuint nbAllocations) {m_budget = nbAllocations;}
+
+  /// Makes exceeding a budget an error
+  void setStrict(bool strict) {m_strict = strict;}
+
+  /// Enters the scope named by the given object and suffix
+  void pushScope(const NamedObject& object, const std::string& suffix);
+
+  /// Enters the scope named by the given objects
+  void pushScope(const NamedObject& object, const NamedObject& subObject);
+
+  /// Leaves the current scope
+  void popScope();
+
+  /// Records an allocation of the given size in the current scope
+  void recordAllocation(std::size_t size)
+  {
+    if (m_isRecording) return;
+    Counter& counter = m_counters[m_stack.back()];
+    ++counter.nbAllocations;
+    counter.bytes += size;
+  }
+
+  /// Ends the current iteration: checks the budgets and resets the counters
+  /// @return the table of the allocations per scope during the iteration
+  std::string endIteration(CFuint iter);
+
+private:
+
+  /// Constructor
+  AllocationTracker();
+
+  /// Enters the scope with the given name
+  void pushScope(const std::string& name);
+
+private:
+
+  /// allocations of one scope during the current iteration
+  struct Counter {
+    Counter() : nbAllocations(0), bytes(0.) {}
+    CFuint nbAllocations;
+    CFdouble bytes;
+  };
+
+  /// flag telling if allocations are tracked
+  static bool s_active;
+
+  /// flag set while the tracker itself allocates
+  bool m_isRecording;
+
+  /// number of iterations ended
+  CFuint m_nbIterations;
+
+  /// budget of allocations per iteration of every scope
+  CFuint m_budget;
+
+  /// flag telling if exceeding a budget is an error
+  bool m_strict;
+
+  /// names of the scopes, indexed by scope ID
+  std::vector<std::string> m_names;
+
+  /// IDs of the scopes, sorted by name
+  std::map<std::string, CFuint> m_ids;
+
+  /// counters per scope ID
+  std::vector<Counter> m_counters;
+
+  /// IDs of the active scopes, innermost last
+  std::vector<CFuint> m_stack;
+
+}; // end class AllocationTracker
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class enters an allocation tracking scope in its constructor and
+/// leaves it in its destructor, if the tracking is active.
+class Common_API AllocationScope : public NonCopyable<AllocationScope> {
+public:
+
+  /// Constructor
+  AllocationScope(const NamedObject& object, const char* suffix) : m_pushed(false)
+  {
+    if (AllocationTracker::isActive()) {
+      AllocationTracker::getInstance().pushScope(object, suffix);
+      m_pushed = true;
+    }
+  }
+
+  /// Constructor
+  AllocationScope(const NamedObject& object, const NamedObject& subObject) : m_pushed(false)
+  {
+    if (AllocationTracker::isActive()) {
+      AllocationTracker::getInstance().pushScope(object, subObject);
+      m_pushed = true;
+    }
+  }
+
+  /// Destructor
+  ~AllocationScope()
+  {
+    if (m_pushed) AllocationTracker::getInstance().popScope();
+  }
+
+private:
+
+  /// flag telling if a scope was entered
+  bool m_pushed;
+
+}; // end class AllocationScope
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Common_AllocationTracker_hh
@@ -83,6 +83,9 @@ public:
   /// For valarray compatibility
   void resize (size_t NewSize);
   
+  /// Access the underlying memory allocator (e.g. for statistics)
+  const ALLOC& getMemAllocator() const {return MemAlloc;}
+  
 private:
 
   /// Disallow copy
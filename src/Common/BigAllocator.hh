@@ -11,7 +11,9 @@
 #  include "coolfluid_config.h"
 #endif // CF_HAVE_CONFIG_H
 
-#ifdef CF_HAVE_ALLOC_MMAP
+#if defined(CF_HAVE_ALLOC_HUGEPAGE)
+#  include "Common/MemoryAllocatorHugePage.hh"
+#elif defined(CF_HAVE_ALLOC_MMAP)
 #  include "Common/MemoryAllocatorMMap.hh"
 #else
 #  include "Common/MemoryAllocatorNormal.hh"
@@ -24,7 +26,11 @@ namespace COOLFluiD {
 
 //////////////////////////////////////////////////////////////////////////////
 
-#ifdef CF_HAVE_ALLOC_MMAP
+/// MemoryAllocatorHugePage with the default MemoryPolicy behaves like
+/// MemoryAllocatorMMap, the policy can then be changed per socket
+#if defined(CF_HAVE_ALLOC_HUGEPAGE)
+  typedef MemoryAllocatorHugePage BigAllocator;
+#elif defined(CF_HAVE_ALLOC_MMAP)
   typedef MemoryAllocatorMMap   BigAllocator;
 #else
   typedef MemoryAllocatorNormal BigAllocator;
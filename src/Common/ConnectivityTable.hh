@@ -121,6 +121,12 @@ public: // methods
     return m_nbentries;
   }
 
+  /// Get the number of bytes held by the table
+  CFdouble getMemorySize() const
+  {
+    return static_cast<CFdouble>(m_table.capacity())*sizeof(T);
+  }
+
   /// Resize the table
   /// @param columnPattern gives the number of columns per row
   /// @param value         initializing value
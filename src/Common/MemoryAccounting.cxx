@@ -0,0 +1,246 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "Common/MemoryAccounting.hh"
+#include "Common/OSystem.hh"
+#include "Common/ProcessInfo.hh"
+#include "Common/PE.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+namespace COOLFluiD {
+
+    namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// one line of the report
+struct ReportLine {
+  ReportLine() : label(), group(), current(0.), peak(0.), nbChanges(0) {}
+  std::string label;
+  std::string group;
+  CFdouble current;
+  CFdouble peak;
+  CFuint nbChanges;
+};
+
+/// Orders report lines by decreasing peak, then by decreasing current size
+struct BiggerLine {
+  bool operator() (const ReportLine& a, const ReportLine& b) const
+  {
+    return (a.peak != b.peak) ? (a.peak > b.peak) : (a.current > b.current);
+  }
+};
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryAccounting& MemoryAccounting::getInstance()
+{
+  // never destroyed: allocators can still be freed during the static destruction
+  static MemoryAccounting* accounting = new MemoryAccounting();
+  return *accounting;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryAccounting::MemoryAccounting() :
+  m_entries(),
+  m_groups(),
+  m_total(0.),
+  m_peakTotal(0.)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryAccounting::update(const std::string& label, CFdouble oldSize, CFdouble newSize)
+{
+  if (label.empty()) return;
+
+  Entry& entry = m_entries[label];
+  entry.current += newSize - oldSize;
+  entry.current  = std::max(entry.current, 0.);
+  entry.peak     = std::max(entry.peak, entry.current);
+  ++entry.nbChanges;
+
+  m_total    += newSize - oldSize;
+  m_peakTotal = std::max(m_peakTotal, m_total);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble MemoryAccounting::getSize(const std::string& label) const
+{
+  map<string, Entry>::const_iterator it = m_entries.find(label);
+  return (it != m_entries.end()) ? it->second.current : 0.;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryAccounting::setGroup(const std::string& prefix, const std::string& group)
+{
+  m_groups[prefix] = group;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::string MemoryAccounting::getGroup(const std::string& label) const
+{
+  string group = "-";
+  CFuint matchLength = 0;
+  for (map<string, string>::const_iterator it = m_groups.begin(); it != m_groups.end(); ++it) {
+    if (it->first.size() >= matchLength && label.compare(0, it->first.size(), it->first) == 0) {
+      group = it->second;
+      matchLength = it->first.size();
+    }
+  }
+  return group;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::string MemoryAccounting::getReport(const std::string& nspaceName) const
+{
+  const CFdouble MB = 1024.*1024.;
+  const CFdouble processSize = OSystem::getInstance().getProcessInfo()->memoryUsageBytes();
+
+  vector<ReportLine> lines;
+  map<string, ReportLine> groups;
+  for (map<string, Entry>::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it) {
+    ReportLine line;
+    line.label     = it->first;
+    line.group     = getGroup(it->first);
+    line.current   = it->second.current;
+    line.peak      = it->second.peak;
+    line.nbChanges = it->second.nbChanges;
+    lines.push_back(line);
+
+    // the peak of a group is bounded by the sum of the peaks of its labels
+    ReportLine& g = groups[line.group];
+    g.label      = line.group;
+    g.current   += line.current;
+    g.peak      += line.peak;
+    g.nbChanges += line.nbChanges;
+  }
+  std::sort(lines.begin(), lines.end(), BiggerLine());
+
+  vector<ReportLine> groupLines;
+  for (map<string, ReportLine>::const_iterator it = groups.begin(); it != groups.end(); ++it) {
+    groupLines.push_back(it->second);
+  }
+  std::sort(groupLines.begin(), groupLines.end(), BiggerLine());
+
+  const CFuint rank = PE::GetPE().GetRank(nspaceName);
+
+  ostringstream oss;
+  oss << fixed << setprecision(2);
+  oss << "Memory accounting on rank " << rank << " [MB]: tracked " << m_total/MB
+      << ", tracked peak " << m_peakTotal/MB << ", process " << processSize/MB << "\n";
+  oss << setw(48) << left << "label" << setw(24) << "group" << right
+      << setw(12) << "current" << setw(12) << "peak" << setw(10) << "changes" << "\n";
+  for (CFuint i = 0; i < lines.size(); ++i) {
+    oss << setw(48) << left << lines[i].label << setw(24) << lines[i].group << right
+        << setw(12) << lines[i].current/MB << setw(12) << lines[i].peak/MB
+        << setw(10) << lines[i].nbChanges << "\n";
+  }
+  oss << setw(48) << left << "group" << setw(24) << "" << right
+      << setw(12) << "current" << setw(12) << "sum peaks" << "\n";
+  for (CFuint i = 0; i < groupLines.size(); ++i) {
+    oss << setw(48) << left << groupLines[i].label << setw(24) << "" << right
+        << setw(12) << groupLines[i].current/MB << setw(12) << groupLines[i].peak/MB << "\n";
+  }
+
+#ifdef CF_HAVE_MPI
+  if (PE::GetPE().GetProcessorCount(nspaceName) > 1) {
+    MPI_Comm comm = PE::GetPE().GetCommunicator(nspaceName);
+
+    // the labels of the first rank are used on all the others
+    string allLabels;
+    for (map<string, Entry>::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it) {
+      allLabels += it->first + "\n";
+    }
+    int length = allLabels.size();
+    MPI_Bcast(&length, 1, MPI_INT, 0, comm);
+    vector<char> buffer(length + 1, '\0');
+    std::copy(allLabels.begin(), allLabels.end(), buffer.begin());
+    MPI_Bcast(&buffer[0], length, MPI_CHAR, 0, comm);
+
+    vector<string> labels;
+    istringstream iss(string(&buffer[0], length));
+    string label;
+    while (getline(iss, label)) {
+      labels.push_back(label);
+    }
+
+    // current and peak of each label, followed by the totals
+    const CFuint nbValues = labels.size() + 2;
+    vector<CFdouble> current(nbValues, 0.);
+    vector<CFdouble> peak(nbValues, 0.);
+    for (CFuint i = 0; i < labels.size(); ++i) {
+      map<string, Entry>::const_iterator it = m_entries.find(labels[i]);
+      if (it != m_entries.end()) {
+        current[i] = it->second.current;
+        peak[i]    = it->second.peak;
+      }
+    }
+    current[labels.size()]   = m_total;
+    peak[labels.size()]      = m_peakTotal;
+    current[labels.size()+1] = processSize;
+    peak[labels.size()+1]    = processSize;
+
+    vector<CFdouble> minCurrent(nbValues, 0.);
+    vector<CFdouble> maxCurrent(nbValues, 0.);
+    vector<CFdouble> maxPeak(nbValues, 0.);
+    MPI_Allreduce(&current[0], &minCurrent[0], nbValues, MPI_DOUBLE, MPI_MIN, comm);
+    MPI_Allreduce(&current[0], &maxCurrent[0], nbValues, MPI_DOUBLE, MPI_MAX, comm);
+    MPI_Allreduce(&peak[0], &maxPeak[0], nbValues, MPI_DOUBLE, MPI_MAX, comm);
+
+    // labels sorted by decreasing peak over the ranks, then the totals
+    vector<pair<CFdouble, CFuint> > order;
+    for (CFuint i = 0; i < labels.size(); ++i) {
+      order.push_back(make_pair(-maxPeak[i], i));
+    }
+    std::sort(order.begin(), order.end());
+    order.push_back(make_pair(0., (CFuint) labels.size()));
+    order.push_back(make_pair(0., (CFuint) labels.size()+1));
+    labels.push_back("TOTAL tracked");
+    labels.push_back("TOTAL process");
+
+    oss << "Memory accounting over " << PE::GetPE().GetProcessorCount(nspaceName)
+        << " ranks of " << nspaceName << " [MB]\n";
+    oss << setw(48) << left << "label" << right << setw(12) << "min" << setw(12) << "max"
+        << setw(12) << "max peak" << setw(12) << "imbalance" << "\n";
+    for (CFuint i = 0; i < nbValues; ++i) {
+      const CFuint idx = order[i].second;
+      const CFdouble imbalance = (minCurrent[idx] > 0.) ? maxCurrent[idx]/minCurrent[idx] : 0.;
+      oss << setw(48) << left << labels[idx] << right
+          << setw(12) << minCurrent[idx]/MB << setw(12) << maxCurrent[idx]/MB
+          << setw(12) << maxPeak[idx]/MB << setw(12) << imbalance << "\n";
+    }
+  }
+#endif
+
+  return oss.str();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
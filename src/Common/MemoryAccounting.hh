@@ -0,0 +1,110 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Common_MemoryAccounting_hh
+#define COOLFluiD_Common_MemoryAccounting_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <string>
+
+#include "Common/COOLFluiD.hh"
+#include "Common/NonCopyable.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+    namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class keeps track of the bytes held by the big data structures of
+/// this rank (socket arrays, connectivity tables, linear system matrices),
+/// each one identified by a label, together with the high-water mark of
+/// every label and of their sum.
+/// The big allocators report automatically the allocations made under a
+/// labelled MemoryPolicy, the other owners set their size explicitly.
+/// Labels are gathered in groups (typically namespaces) by prefix.
+class Common_API MemoryAccounting : public NonCopyable<MemoryAccounting> {
+public:
+
+  /// @return the single instance of this class
+  static MemoryAccounting& getInstance();
+
+  /// Records that the allocation with the given label changed size
+  /// @param label    name of the allocation, ignored if empty
+  /// @param oldSize  previous size in bytes
+  /// @param newSize  current size in bytes
+  void update(const std::string& label, CFdouble oldSize, CFdouble newSize);
+
+  /// Sets the size of the allocation with the given label
+  void setSize(const std::string& label, CFdouble size)
+  {
+    update(label, getSize(label), size);
+  }
+
+  /// @return the current size in bytes of the allocation with the given label
+  CFdouble getSize(const std::string& label) const;
+
+  /// Assigns all the labels starting with the given prefix to a group
+  /// (the longest matching prefix wins)
+  void setGroup(const std::string& prefix, const std::string& group);
+
+  /// @return the bytes currently held by all the labels
+  CFdouble getTotalSize() const {return m_total;}
+
+  /// @return the highest value ever reached by getTotalSize()
+  CFdouble getPeakTotalSize() const {return m_peakTotal;}
+
+  /// Builds a table of current and peak size per label and per group,
+  /// sorted by decreasing size, followed (in parallel) by the minimum and
+  /// maximum over the ranks of the given namespace.
+  /// In parallel this is a collective call on the namespace communicator.
+  std::string getReport(const std::string& nspaceName) const;
+
+private:
+
+  /// Constructor
+  MemoryAccounting();
+
+  /// @return the group of the given label
+  std::string getGroup(const std::string& label) const;
+
+private:
+
+  /// size and high-water mark of one label
+  struct Entry {
+    Entry() : current(0.), peak(0.), nbChanges(0) {}
+    CFdouble current;
+    CFdouble peak;
+    CFuint nbChanges;
+  };
+
+  /// entries sorted by label
+  std::map<std::string, Entry> m_entries;
+
+  /// groups sorted by label prefix
+  std::map<std::string, std::string> m_groups;
+
+  /// sum of all the current sizes
+  CFdouble m_total;
+
+  /// high-water mark of m_total
+  CFdouble m_peakTotal;
+
+}; // end class MemoryAccounting
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Common_MemoryAccounting_hh
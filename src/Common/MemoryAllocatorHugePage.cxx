@@ -0,0 +1,334 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "Common/COOLFluiD.hh"
+#include "Common/CFLog.hh"
+#include "Common/MemoryAccounting.hh"
+#include "Common/MemoryAllocatorHugePage.hh"
+
+// values from linux/mempolicy.h, not always installed with the libc headers
+#ifndef MPOL_BIND
+#  define MPOL_BIND       2
+#endif
+#ifndef MPOL_INTERLEAVE
+#  define MPOL_INTERLEAVE 3
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+namespace COOLFluiD {
+
+    namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Reads the list of online NUMA nodes (e.g. "0-1,3") from sysfs
+std::vector<CFuint> getOnlineNumaNodes()
+{
+  std::vector<CFuint> nodes;
+  ifstream fin("/sys/devices/system/node/online");
+  string list;
+  if (fin && (fin >> list)) {
+    istringstream ss(list);
+    string range;
+    while (getline(ss, range, ',')) {
+      unsigned int first = 0;
+      unsigned int last  = 0;
+      const int nread = sscanf(range.c_str(), "%u-%u", &first, &last);
+      if (nread < 1) continue;
+      if (nread == 1) last = first;
+      for (unsigned int n = first; n <= last; ++n) {
+        nodes.push_back(n);
+      }
+    }
+  }
+  if (nodes.empty()) nodes.push_back(0);
+  return nodes;
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryAllocatorHugePage::MemoryAllocatorHugePage (MA_Size InitialSize)
+  : DataPtr(0), CurrentSize(0), m_policy(MemoryPolicy::getCurrent())
+{
+  Alloc(InitialSize);
+  if (!m_policy.label.empty()) {
+    registry().insert(this);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryAllocatorHugePage::~MemoryAllocatorHugePage ()
+{
+  registry().erase(this);
+  Free ();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::set<MemoryAllocatorHugePage*>& MemoryAllocatorHugePage::registry ()
+{
+  // never destroyed: allocators can still be freed during the static destruction
+  static std::set<MemoryAllocatorHugePage*>* allocators = new std::set<MemoryAllocatorHugePage*>();
+  return *allocators;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryAllocatorHugePage::MA_Size MemoryAllocatorHugePage::GetGranularity () const
+{
+  return (m_policy.useHugePages) ? getHugePageSize() : (MA_Size) sysconf(_SC_PAGESIZE);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryAllocatorHugePage::MA_Size MemoryAllocatorHugePage::getHugePageSize ()
+{
+  static MA_Size hugePageSize = 0;
+  if (hugePageSize == 0) {
+    // default on x86_64, overwritten by the value given by the kernel
+    hugePageSize = 2*1024*1024;
+    ifstream fin("/proc/meminfo");
+    string line;
+    while (getline(fin, line)) {
+      unsigned long kb = 0;
+      if (sscanf(line.c_str(), "Hugepagesize: %lu kB", &kb) == 1) {
+        hugePageSize = kb*1024;
+        break;
+      }
+    }
+  }
+  return hugePageSize;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryAllocatorHugePage::Alloc (MA_Size size)
+{
+  cf_assert (DataPtr==0);
+
+  // Minimum size
+  if (size==0)
+      size=1;
+
+  DataPtr = mmap (0, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if (DataPtr == MAP_FAILED)
+  {
+    DataPtr=0;
+    throw MemoryAllocatorException (FromHere());
+  }
+  cf_assert (DataPtr!=0);
+
+  CurrentSize = size;
+  MemoryAccounting::getInstance().update(m_policy.label, 0, CurrentSize);
+
+  applyPolicy();
+  firstTouch(0, CurrentSize);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryAllocatorHugePage::Free ()
+{
+  cf_assert (DataPtr != 0);
+
+  int Ret = munmap (DataPtr, CurrentSize);
+  if (Ret < 0)
+    throw MemoryAllocatorException (FromHere());
+  DataPtr = 0;
+  MemoryAccounting::getInstance().update(m_policy.label, CurrentSize, 0);
+  CurrentSize = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryAllocatorHugePage::MA_Size MemoryAllocatorHugePage::Resize (MA_Size NewSize)
+{
+  if (NewSize==0)
+      NewSize=1;
+
+  if (CurrentSize==NewSize)
+      return CurrentSize;
+
+  cf_assert (DataPtr != 0);
+
+  MA_Ptr NewData = mremap (DataPtr, CurrentSize, NewSize, MREMAP_MAYMOVE);
+  if (NewData == MAP_FAILED)
+    throw MemoryAllocatorException (FromHere());
+
+  const MA_Size OldSize = CurrentSize;
+  MemoryAccounting::getInstance().update(m_policy.label, OldSize, NewSize);
+  CurrentSize = NewSize;
+  DataPtr = NewData;
+
+  // the advice and the policy follow a moved mapping, but an extension
+  // in place may have created a new region without them
+  if (NewSize > OldSize) {
+    applyPolicy();
+    firstTouch(OldSize, NewSize);
+  }
+
+  return CurrentSize;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryAllocatorHugePage::applyPolicy ()
+{
+  if (m_policy.isDefault()) return;
+
+#ifdef MADV_HUGEPAGE
+  if (m_policy.useHugePages) {
+    if (madvise(DataPtr, CurrentSize, MADV_HUGEPAGE) != 0) {
+      CFLog(WARN, "MemoryAllocatorHugePage: madvise(MADV_HUGEPAGE) failed for ["
+            << m_policy.label << "], using normal pages\n");
+    }
+  }
+#endif
+
+  if (m_policy.numaMode != MemoryPolicy::NUMA_DEFAULT) {
+    const std::vector<CFuint> nodes = (m_policy.numaNodes.empty()) ?
+      getOnlineNumaNodes() : m_policy.numaNodes;
+
+    const CFuint bitsPerLong = 8*sizeof(unsigned long);
+    const CFuint maxNode = *std::max_element(nodes.begin(), nodes.end()) + 1;
+    std::vector<unsigned long> mask(maxNode/bitsPerLong + 1, 0);
+    for (CFuint i = 0; i < nodes.size(); ++i) {
+      mask[nodes[i]/bitsPerLong] |= (1UL << (nodes[i]%bitsPerLong));
+    }
+
+    const int mode = (m_policy.numaMode == MemoryPolicy::NUMA_BIND) ? MPOL_BIND : MPOL_INTERLEAVE;
+    if (syscall(SYS_mbind, DataPtr, CurrentSize, mode, &mask[0], mask.size()*bitsPerLong + 1, 0) != 0) {
+      CFLog(WARN, "MemoryAllocatorHugePage: mbind() failed for ["
+            << m_policy.label << "], using default NUMA placement\n");
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryAllocatorHugePage::firstTouch (MA_Size begin, MA_Size end)
+{
+  if (!m_policy.parallelFirstTouch) return;
+
+  const long pageSize = sysconf(_SC_PAGESIZE);
+  char* const start = static_cast<char*>(DataPtr);
+  const long firstPage = begin/pageSize;
+  const long lastPage  = (end + pageSize - 1)/pageSize;
+
+  // static schedule, as in the loops which will use the data afterwards
+#ifdef CF_HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (long iPage = firstPage; iPage < lastPage; ++iPage) {
+    const MA_Size offset = std::max((MA_Size) (iPage*pageSize), begin);
+    start[offset] = 0;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryAllocatorHugePage::MA_Size MemoryAllocatorHugePage::getResidentSize () const
+{
+  const long pageSize = sysconf(_SC_PAGESIZE);
+  const MA_Size nbPages = (CurrentSize + pageSize - 1)/pageSize;
+  std::vector<unsigned char> resident(nbPages, 0);
+  if (mincore(DataPtr, CurrentSize, &resident[0]) != 0) return 0;
+
+  MA_Size nbResident = 0;
+  for (MA_Size i = 0; i < nbPages; ++i) {
+    nbResident += (resident[i] & 1);
+  }
+  return std::min(nbResident*pageSize, CurrentSize);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryAllocatorHugePage::MA_Size MemoryAllocatorHugePage::getHugePageBackedSize () const
+{
+  const unsigned long address = reinterpret_cast<unsigned long>(DataPtr);
+  ifstream fin("/proc/self/smaps");
+  string line;
+  bool inMapping = false;
+  while (getline(fin, line)) {
+    unsigned long first = 0;
+    unsigned long last  = 0;
+    if (sscanf(line.c_str(), "%lx-%lx ", &first, &last) == 2) {
+      inMapping = (address >= first && address < last);
+      continue;
+    }
+    unsigned long kb = 0;
+    if (inMapping && sscanf(line.c_str(), "AnonHugePages: %lu kB", &kb) == 1) {
+      return std::min((MA_Size) (kb*1024), CurrentSize);
+    }
+  }
+  return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Orders allocators by decreasing size
+struct BiggerAllocation {
+  bool operator() (const MemoryAllocatorHugePage* a, const MemoryAllocatorHugePage* b) const
+  {
+    return a->GetSize() > b->GetSize();
+  }
+};
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::string MemoryAllocatorHugePage::getStatistics ()
+{
+  const double MB = 1024.*1024.;
+  std::vector<MemoryAllocatorHugePage*> all(registry().begin(), registry().end());
+  std::sort(all.begin(), all.end(), BiggerAllocation());
+
+  ostringstream oss;
+  oss << "Big allocations (huge page size " << getHugePageSize()/1024 << " kB)\n";
+  oss << setw(40) << left << "label" << right
+      << setw(12) << "size [MB]" << setw(14) << "resident [MB]"
+      << setw(12) << "huge [MB]" << setw(6) << "THP" << setw(12) << "NUMA" << "\n";
+
+  for (CFuint i = 0; i < all.size(); ++i) {
+    const MemoryPolicy& p = all[i]->getPolicy();
+    const char* numa = (p.numaMode == MemoryPolicy::NUMA_BIND) ? "bind" :
+      (p.numaMode == MemoryPolicy::NUMA_INTERLEAVE) ? "interleave" : "default";
+    oss << setw(40) << left << p.label << right << fixed << setprecision(2)
+        << setw(12) << all[i]->GetSize()/MB
+        << setw(14) << all[i]->getResidentSize()/MB
+        << setw(12) << all[i]->getHugePageBackedSize()/MB
+        << setw(6) << (p.useHugePages ? "on" : "off")
+        << setw(12) << numa << "\n";
+  }
+  return oss.str();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // End namespace Common
+
+} // End namespace COOLFluiD
@@ -0,0 +1,137 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef MEM_ALLOC_HUGEPAGE_HH
+#define MEM_ALLOC_HUGEPAGE_HH
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <set>
+
+#include "Common/MemoryAllocator.hh"
+#include "Common/MemoryPolicy.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+    namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This allocator maps anonymous memory and grows it with mremap (zero copy)
+/// like MemoryAllocatorMMap, but it also applies the MemoryPolicy which is
+/// current at construction: transparent huge pages (MADV_HUGEPAGE), NUMA
+/// interleave or bind (mbind) and parallel first-touch of the new pages.
+/// With the default policy it behaves exactly like MemoryAllocatorMMap.
+/// Every allocator with a labelled policy is registered so that page size
+/// and residency statistics can be reported per label.
+class  Common_API  MemoryAllocatorHugePage : public MemoryAllocator {
+public:
+
+  /// Constructor:
+  /// InitialSize: size in bytes
+  MemoryAllocatorHugePage (MA_Size InitialSize = 0);
+
+  /// virtual destructor
+  virtual ~MemoryAllocatorHugePage();
+
+  /// Returns the size of the allocated memory
+  virtual MA_Size GetSize () const
+  {
+    return CurrentSize;
+  }
+
+  /// Returns a pointer to the allocated memory
+  virtual MA_Ptr GetPtr () const
+  {
+    return DataPtr;
+  }
+
+  /// Resize the allocated memory
+  virtual MA_Size Resize (MA_Size NewSize);
+
+  /// Returns true if the object points to valid memory
+  bool IsValid () const
+  {
+    return (DataPtr != 0);
+  }
+
+  /// Determines the overhead of the resize operation
+  bool IsZeroCopy () const
+  {
+    return true;
+  }
+
+  /// Returns the granularity (the huge page size if huge pages are used)
+  virtual MA_Size GetGranularity () const;
+
+  /// Returns the policy applied to this allocation
+  const MemoryPolicy& getPolicy () const
+  {
+    return m_policy;
+  }
+
+  /// Returns the number of bytes currently resident in physical memory
+  MA_Size getResidentSize () const;
+
+  /// Returns the number of bytes backed by transparent huge pages
+  /// (approximate if the kernel merged this mapping with a neighbouring one)
+  MA_Size getHugePageBackedSize () const;
+
+  /// Returns the huge page size of the system
+  static MA_Size getHugePageSize ();
+
+  /// Returns a table with size, residency and huge page coverage of all the
+  /// live allocators with a labelled policy, sorted by decreasing size
+  static std::string getStatistics ();
+
+  /// easy access
+  operator bool () const
+  {
+    return IsValid();
+  }
+
+  operator MA_Ptr () const
+  {
+    return GetPtr ();
+  }
+
+private:
+
+  /// Prevent copy
+  MemoryAllocatorHugePage (const MemoryAllocatorHugePage & M);
+  MemoryAllocatorHugePage& operator =(const MemoryAllocatorHugePage & M);
+
+  void Alloc (MA_Size size);
+  void Free ();
+
+  /// Applies huge page advice and NUMA placement to the whole mapping
+  void applyPolicy ();
+
+  /// Touches the pages in [begin, end) from all threads
+  void firstTouch (MA_Size begin, MA_Size end);
+
+  /// live allocators with a labelled policy
+  static std::set<MemoryAllocatorHugePage*>& registry ();
+
+private:
+
+  MA_Ptr DataPtr;
+  MA_Size CurrentSize;
+  MemoryPolicy m_policy;
+
+}; // end class MemoryAllocatorHugePage
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } //namespace Common
+
+} // Namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // MEM_ALLOC_HUGEPAGE_HH
@@ -6,6 +6,8 @@
 
 #include "Common/COOLFluiD.hh"
 #include "Common/MemoryAllocatorMMap.hh"
+#include "Common/MemoryAccounting.hh"
+#include "Common/MemoryPolicy.hh"
 
 #include <unistd.h>
 #include <sys/mman.h>
@@ -29,7 +31,7 @@ MemoryAllocatorMMap::~MemoryAllocatorMMap ()
 //////////////////////////////////////////////////////////////////////////////
 
 MemoryAllocatorMMap::MemoryAllocatorMMap (MA_Size InitialSize)
-    : DataPtr(0),CurrentSize(0),FileDesc(-1)
+    : DataPtr(0),CurrentSize(0),FileDesc(-1),Label(MemoryPolicy::getCurrent().label)
 {
     Alloc(InitialSize);
 }
@@ -69,6 +71,7 @@ void MemoryAllocatorMMap::Alloc (MA_Size size)
   cf_assert (DataPtr!=0);
 
   CurrentSize = size;
+  MemoryAccounting::getInstance().update(Label, 0, CurrentSize);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -86,6 +89,7 @@ void MemoryAllocatorMMap::Free ()
   Ret = close (FileDesc);
   cf_assert (Ret>= 0);
   FileDesc = -1;
+  MemoryAccounting::getInstance().update(Label, CurrentSize, 0);
   CurrentSize = 0;
 }
 
@@ -107,6 +111,7 @@ MemoryAllocatorMMap::MA_Size MemoryAllocatorMMap::Resize (MA_Size NewSize)
   if (NewData == MA_Ptr(-1))
     throw MemoryAllocatorException (FromHere());
 
+  MemoryAccounting::getInstance().update(Label, CurrentSize, NewSize);
   CurrentSize = NewSize;
   DataPtr = NewData;
   return CurrentSize;
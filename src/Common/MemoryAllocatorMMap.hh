@@ -9,6 +9,8 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <string>
+
 #include "Common/MemoryAllocator.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -26,6 +28,9 @@ private:
   MA_Size CurrentSize;
   int FileDesc;
 
+  /// label of the MemoryPolicy current at construction, used for accounting
+  std::string Label;
+
 
   void Alloc (MA_Size size);
   void Free ();
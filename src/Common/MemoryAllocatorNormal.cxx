@@ -9,6 +9,8 @@
 #include "Common/COOLFluiD.hh"
 #include "Common/CFLog.hh"
 #include "Common/MemoryAllocatorNormal.hh"
+#include "Common/MemoryAccounting.hh"
+#include "Common/MemoryPolicy.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -18,7 +20,7 @@ namespace COOLFluiD {
 //////////////////////////////////////////////////////////////////////////////
 
 MemoryAllocatorNormal::MemoryAllocatorNormal (MA_Size _initsize)
-    : _ptr(0), _size(0)
+    : _ptr(0), _size(0), _label(MemoryPolicy::getCurrent().label)
 {
     _ptr=malloc(_initsize);
 
@@ -26,6 +28,7 @@ MemoryAllocatorNormal::MemoryAllocatorNormal (MA_Size _initsize)
      throw MemoryAllocatorException ( FromHere(), "Memory may have exhausted" );
 
     _size=_initsize;
+    MemoryAccounting::getInstance().update(_label, 0, _size);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -35,6 +38,7 @@ MemoryAllocatorNormal::~MemoryAllocatorNormal ()
     if (_ptr) {
      free(_ptr);
     }
+    MemoryAccounting::getInstance().update(_label, _size, 0);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -49,6 +53,7 @@ MemoryAllocatorNormal::MA_Size MemoryAllocatorNormal::Resize(MA_Size _newsize)
    if ( _newsize > 0 && NewPtr == NULL )
      throw MemoryAllocatorException ( FromHere(), "Memory may have exhausted" );
 
+   MemoryAccounting::getInstance().update(_label, _size, _newsize);
    _ptr = NewPtr;
    _size = _newsize;
 
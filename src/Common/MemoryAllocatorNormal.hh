@@ -9,6 +9,8 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <string>
+
 #include "Common/MemoryAllocator.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -35,6 +37,9 @@ private:
     MA_Ptr _ptr;
     MA_Size _size;
 
+    /// label of the MemoryPolicy current at construction, used for accounting
+    std::string _label;
+
 public:
 
   MemoryAllocatorNormal (MA_Size _initsize = 0);
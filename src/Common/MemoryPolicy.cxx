@@ -0,0 +1,68 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/MemoryPolicy.hh"
+#include "Common/NoSuchValueException.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+    namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryPolicy::MemoryPolicy() :
+  useHugePages(false),
+  parallelFirstTouch(false),
+  numaMode(NUMA_DEFAULT),
+  numaNodes(),
+  label()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryPolicy::NumaMode MemoryPolicy::convertNumaMode(const std::string& name)
+{
+  if (name == "Default")    return NUMA_DEFAULT;
+  if (name == "Interleave") return NUMA_INTERLEAVE;
+  if (name == "Bind")       return NUMA_BIND;
+  throw NoSuchValueException
+    (FromHere(), "MemoryPolicy: unknown NUMA mode <" + name + ">, use Default, Interleave or Bind");
+  return NUMA_DEFAULT;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryPolicy& MemoryPolicy::current()
+{
+  static MemoryPolicy policy;
+  return policy;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryPolicy::Scoped::Scoped(const MemoryPolicy& policy) :
+  m_previous(MemoryPolicy::current())
+{
+  MemoryPolicy::current() = policy;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryPolicy::Scoped::~Scoped()
+{
+  MemoryPolicy::current() = m_previous;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
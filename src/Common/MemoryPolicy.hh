@@ -0,0 +1,109 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Common_MemoryPolicy_hh
+#define COOLFluiD_Common_MemoryPolicy_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "Common/COOLFluiD.hh"
+#include "Common/NonCopyable.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+    namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class describes how a big allocator should place the memory it maps:
+/// transparent huge pages, NUMA placement and parallel first-touch.
+/// An allocator takes the policy which is current at its construction
+/// and keeps it for its whole life, including all the following resizes.
+/// Allocators which cannot honour the policy (e.g. MemoryAllocatorNormal)
+/// simply ignore it.
+class Common_API MemoryPolicy {
+public:
+
+  /// NUMA placement of the mapped pages
+  enum NumaMode {NUMA_DEFAULT=0, NUMA_INTERLEAVE=1, NUMA_BIND=2};
+
+  /// Default constructor: plain pages, kernel default placement
+  MemoryPolicy();
+
+  /// Converts "Default", "Interleave" or "Bind" into a NumaMode
+  static NumaMode convertNumaMode(const std::string& name);
+
+  /// @return true if the placement is the default one
+  bool isDefault() const
+  {
+    return (!useHugePages && !parallelFirstTouch && numaMode == NUMA_DEFAULT);
+  }
+
+  /// @return the policy to apply to the allocators constructed now
+  static const MemoryPolicy& getCurrent() {return current();}
+
+  /// Makes a policy current for the lifetime of the object
+  class Scoped;
+
+public: // data
+
+  /// ask the kernel to back the mapping with transparent huge pages
+  bool useHugePages;
+
+  /// touch newly mapped pages from all the OpenMP threads with a static
+  /// schedule, so that first-touch places them close to their user
+  bool parallelFirstTouch;
+
+  /// NUMA placement mode
+  NumaMode numaMode;
+
+  /// NUMA nodes used by NUMA_INTERLEAVE and NUMA_BIND (empty means all)
+  std::vector<CFuint> numaNodes;
+
+  /// label under which the allocator statistics are reported
+  std::string label;
+
+private:
+
+  /// storage for the current policy
+  static MemoryPolicy& current();
+
+}; // end class MemoryPolicy
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class makes a policy current for the allocators constructed
+/// during its lifetime and restores the previous one on destruction
+class Common_API MemoryPolicy::Scoped : public NonCopyable<MemoryPolicy::Scoped> {
+public:
+
+  /// Constructor
+  explicit Scoped(const MemoryPolicy& policy);
+
+  /// Destructor
+  ~Scoped();
+
+private:
+
+  /// policy which was current before this one
+  MemoryPolicy m_previous;
+
+}; // end class MemoryPolicy::Scoped
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Common_MemoryPolicy_hh
@@ -22,6 +22,7 @@
 #include "Common/SignalHandler.hh"
 #include "Common/OSystem.hh"
 #include "Common/FactoryRegistry.hh"
+#include "Common/AllocationTracker.hh"
 
 #include "Environment/SingleBehaviorFactory.hh"
 #include "Environment/DirPaths.hh"
@@ -74,6 +75,9 @@ void CFEnv::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< std::string >("MainLoggerFileName", "Name of main log file");
   options.addConfigOption< CFuint >("NbWriters", "Number of writing processes in parallel I/O");
   options.addConfigOption< std::string >("SyncAlgo", "Choose the synchronization algorithm (Old, Bcast, AllToAll");
+  options.addConfigOption< bool >("TrackAllocations", "Report the heap allocations per method function and command at each iteration (needs CF_ENABLE_ALLOCATION_TRACKER)");
+  options.addConfigOption< CFint >("AllocationBudget", "Maximum number of heap allocations per function or command and per iteration (negative for no budget)");
+  options.addConfigOption< bool >("StrictAllocationBudget", "Exceeding the allocation budget after the first iteration is an error");
 }
     
 //////////////////////////////////////////////////////////////////////////////
@@ -105,6 +109,9 @@ CFEnv::CFEnv() :
   setParameter("ExceptionLogLevel",     &(m_env_vars->ExceptionLogLevel));
   setParameter("NbWriters",     &(m_env_vars->NbWriters));
   setParameter("SyncAlgo",   &(m_env_vars->SyncAlgo));
+  setParameter("TrackAllocations",       &(m_env_vars->TrackAllocations));
+  setParameter("AllocationBudget",       &(m_env_vars->AllocationBudget));
+  setParameter("StrictAllocationBudget", &(m_env_vars->StrictAllocationBudget));
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -116,6 +123,12 @@ void CFEnv::configure ( Config::ConfigArgs& args )
   
   ConfigObject::configure(args);
   
+  AllocationTracker& tracker = AllocationTracker::getInstance();
+  tracker.setBudget((m_env_vars->AllocationBudget < 0) ?
+                    AllocationTracker::NO_BUDGET : m_env_vars->AllocationBudget);
+  tracker.setStrict(m_env_vars->StrictAllocationBudget);
+  tracker.setActive(m_env_vars->TrackAllocations);
+  
   CFLog(VERBOSE, "Configuring OSystem signal handlers ... \n");
   if ( m_env_vars->RegistSignalHandlers )
   {
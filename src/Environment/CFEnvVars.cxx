@@ -28,7 +28,10 @@ CFEnvVars::CFEnvVars() :
   MainLoggerFileName("output.log"),
   SyncAlgo("Old"),
   ExceptionLogLevel( (CFuint) VERBOSE),
-  InitArgs()
+  InitArgs(),
+  TrackAllocations     ( false ),
+  AllocationBudget     ( -1 ),
+  StrictAllocationBudget ( false )
 {
   InitArgs.first  = 0;
   InitArgs.second = CFNULL;
@@ -57,6 +57,12 @@ class Environment_API CFEnvVars : public Common::NonCopyable<CFEnvVars>
     std::pair<int,char**> InitArgs;
     /// number of writing processes in parallel I/O
     CFuint NbWriters;
+    /// track the heap allocations per scope and iteration
+    bool TrackAllocations;
+    /// budget of heap allocations per scope and iteration (negative for none)
+    CFint AllocationBudget;
+    /// exceeding the budget of heap allocations is an error
+    bool StrictAllocationBudget;
         
 }; // end class CFEnvVars
 
@@ -12,6 +12,12 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
+#ifdef CF_HAVE_OMP
+#  include <omp.h>
+#endif
+
 #include "MathTools/RealVector.hh"
 #include "Common/NonCopyable.hh"
 #include "Config/ConfigObject.hh"
@@ -40,6 +46,7 @@ class Framework_API BaseTerm : public Common::NonCopyable<BaseTerm>,
   BaseTerm(const std::string& name) :
     ConfigObject(name),
     m_physicalData(),
+    m_threadPhysicalData(),
     m_refPhysicalData(),
     m_startVar(0),
     m_currNbEqs(0)
@@ -60,12 +67,32 @@ class Framework_API BaseTerm : public Common::NonCopyable<BaseTerm>,
   /// Set physical data
   virtual void setupPhysicalData() = 0;
 
-  /// Get the array based physical data
+  /// Get the array based physical data (the one of the calling thread
+  /// inside a parallel region, if setNbThreads() was called)
   RealVector& getPhysicalData()
   {
+#ifdef CF_HAVE_OMP
+    if (!m_threadPhysicalData.empty()) {
+      const int iThread = omp_get_thread_num();
+      if (iThread > 0) {
+        cf_assert(static_cast<CFuint>(iThread) <= m_threadPhysicalData.size());
+        return m_threadPhysicalData[iThread-1];
+      }
+    }
+#endif
     return m_physicalData;
   }
 
+  /// Gives each of the given number of threads its own copy of the physical
+  /// data, so that the threads can linearize and evaluate the term
+  /// concurrently (the physical data must have been set up)
+  void setNbThreads(CFuint nbThreads)
+  {
+    if (nbThreads > m_threadPhysicalData.size() + 1) {
+      m_threadPhysicalData.assign(nbThreads - 1, m_physicalData);
+    }
+  }
+
   /// Get the reference array based physical data
   RealVector& getReferencePhysicalData()
   {
@@ -92,6 +119,9 @@ protected:
   /// array data
   RealVector m_physicalData;
 
+  /// array data of the threads other than the first one
+  std::vector<RealVector> m_threadPhysicalData;
+
   /// array reference data
   RealVector m_refPhysicalData;
 
@@ -10,6 +10,7 @@
 #include "Common/PE.hh"
 #include "Common/ProcessInfo.hh"
 #include "Common/OSystem.hh"
+#include "Common/AllocationTracker.hh"
 
 #include "Environment/FileHandlerOutput.hh"
 #include "Environment/CFEnvVars.hh"
@@ -153,9 +154,17 @@ void ConvergenceMethod::takeStep()
 
   if (m_stopwatch.isNotRunning()) { m_stopwatch.start(); }
 
-  takeStepImpl();
+  {
+    Common::AllocationScope scope(*this, "::takeStep");
+    takeStepImpl();
+  }
   if ( hasToUpdateConv() ) updateConvergenceFile();
 
+  if (Common::AllocationTracker::isActive()) {
+    const CFuint iter = SubSystemStatusStack::getActive()->getNbIter();
+    CFLog(INFO, Common::AllocationTracker::getInstance().endIteration(iter));
+  }
+
   popNamespace();
 }
 
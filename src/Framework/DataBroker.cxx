@@ -183,6 +183,15 @@ void DataBroker::unregisterSource ( BaseDataSocketSource* source )
 
   const key_t lkey = source->makeID();
   std::map < key_t, source_t >::iterator fitr = m_regsrcs.find ( lkey );
+  bool is_namespace_not_null = !( source->getNamespace() == DataSocket::defaultNamespace() );
+  
+  // several sources can be registered in the default namespace, the last one
+  // replacing the others: the ones which are replaced are not there anymore
+  if ( !is_namespace_not_null && ( fitr == m_regsrcs.end() || fitr->second != source ) )
+  {
+    return;
+  }
+  
   if ( fitr == m_regsrcs.end() )
   {
     ostringstream msg;
@@ -10,6 +10,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "Common/NonCopyable.hh"
+#include "Common/MemoryAccounting.hh"
 
 #include "Framework/BaseDataSocketSource.hh"
 #include "Framework/DataSocketHelper.hh"
@@ -47,6 +48,10 @@ public:
   /// Checks if this socket has been allocated
   bool isAllocated () const { return m_storage.isNotNull(); }
   
+  /// Sets the placement policy (huge pages, NUMA) of the underlying array
+  /// @pre must be called before the socket is allocated
+  void setMemoryPolicy (const Common::MemoryPolicy& policy) { m_memoryPolicy = policy; }
+  
   /// @return the global size of the underlying data array
   virtual CFuint getGlobalSize() const {return getDataHandle().getGlobalSize();}
   
@@ -60,6 +65,9 @@ private:
 
   /// Acquaintance of the DataStorage from which the DataHandle was allocated
   Common::SafePtr<DataStorage> m_storage;
+  
+  /// placement policy requested for the underlying array
+  Common::MemoryPolicy m_memoryPolicy;
 
 }; // end of class DataSocketSource
 
@@ -93,7 +101,8 @@ DataSocketSource<TYPE,STORAGETYPE>::
 DataSocketSource(const std::string& name) :
   BaseDataSocketSource(name,DEMANGLED_TYPEID(STORAGETYPE),DEMANGLED_TYPEID(TYPE)),
   m_handle(CFNULL),
-  m_storage(CFNULL)
+  m_storage(CFNULL),
+  m_memoryPolicy()
 {
   DataBroker::getInstance().registerSource ( this );
 }
@@ -114,7 +123,14 @@ void DataSocketSource<TYPE,STORAGETYPE>::allocate(Common::SafePtr<DataStorage> s
 {
   deallocate();
   m_storage = storage;
-
+  
+  if (!m_memoryPolicy.isDefault()) {
+    m_storage->setMemoryPolicy(getDataSocketFullStorageName(), m_memoryPolicy);
+  }
+  
+  // the memory of this socket is accounted to its namespace
+  Common::MemoryAccounting::getInstance().setGroup(getDataSocketFullStorageName(), nspaceName);
+  
   const CFuint MIN_SIZE = 0; // 1 creates memory leaks but 0 is also problematic
   // creates an empty data storage
   CreateDataHandle<TYPE, STORAGETYPE>(m_storage, getDataSocketFullStorageName(), 
@@ -57,5 +57,42 @@ CF_DEBUG_POINT;
 
 //////////////////////////////////////////////////////////////////////////////
 
+void DataStorage::setMemoryPolicy(const std::string& name, const Common::MemoryPolicy& policy)
+{
+  m_memoryPolicies[name] = policy;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+Common::MemoryPolicy DataStorage::getMemoryPolicy(const std::string& name) const
+{
+  // global storages are split into "_local" and "_global" parts
+  string baseName = name;
+  const string parts[2] = {"_local", "_global"};
+  for (CFuint i = 0; i < 2; ++i) {
+    if (baseName.size() > parts[i].size() &&
+	baseName.compare(baseName.size() - parts[i].size(), parts[i].size(), parts[i]) == 0) {
+      baseName.erase(baseName.size() - parts[i].size());
+      break;
+    }
+  }
+  
+  Common::MemoryPolicy policy;
+  for (map<string, Common::MemoryPolicy>::const_iterator it = m_memoryPolicies.begin();
+       it != m_memoryPolicies.end(); ++it) {
+    const string suffix = "_" + it->first;
+    if (baseName == it->first ||
+	(baseName.size() > suffix.size() &&
+	 baseName.compare(baseName.size() - suffix.size(), suffix.size(), suffix) == 0)) {
+      policy = it->second;
+      break;
+    }
+  }
+  policy.label = name;
+  return policy;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 }  //  namespace Framework
 }  //  namespace COOLFluiD
@@ -16,6 +16,7 @@
 
 #include "Common/NoSuchStorageException.hh"
 #include "Common/StorageExistsException.hh"
+#include "Common/MemoryPolicy.hh"
 
 #include "Common/CFLog.hh"
 
@@ -112,7 +113,19 @@ public:
   
   /// Dumps the contents of the DataStorage to a string
   std::string dump () const;
-
+  
+  /// Sets the memory policy of the storages created from now on whose name
+  /// is either the given name or ends with "_" + name (i.e. the socket name
+  /// without namespace)
+  /// @param name std::string identifier for the storage or the socket
+  /// @param policy placement policy for the big allocators of the storage
+  void setMemoryPolicy(const std::string& name, const Common::MemoryPolicy& policy);
+  
+  /// Gets the memory policy to apply to the storage with the given name
+  /// @param name std::string identifier for the storage
+  /// @return the policy, labelled with the storage name
+  Common::MemoryPolicy getMemoryPolicy(const std::string& name) const;
+  
 private:
 
   /// Places a storage inside.
@@ -136,6 +149,9 @@ private: // data
 
   /// map to store the pointers that hold the data
   MapType m_dataStorage;
+  
+  /// memory policies requested for given storage or socket names
+  std::map<std::string, Common::MemoryPolicy> m_memoryPolicies;
 
 }; // end class DataStorageInternal
 
@@ -170,6 +186,7 @@ DataHandle< TYPE, LOCAL> DataStorage::createDataDynamic
 
   if(!checkData(name))
   {
+    Common::MemoryPolicy::Scoped policy(getMemoryPolicy(name));
     ContainerType* ptr = new ContainerType(init,size,elementSize);
     setDataPtr(name,ptr);
     CFLogDebugMin("Created Storage(dynamic): " << name << "\n");
@@ -193,6 +210,7 @@ DataHandle< TYPE, LOCAL> DataStorage::createData
 
   if(!checkData(name))
   {
+    Common::MemoryPolicy::Scoped policy(getMemoryPolicy(name));
     ContainerType* ptr = new ContainerType(init,size); // this will not work with std::vector(size,init)
     setDataPtr(name,ptr);
     CFLogDebugMin("Created Storage: " << name << "\n");
@@ -288,12 +306,14 @@ const typename Framework::GlobalTypeTrait<TYPE>::GTYPE & init)
     throw Common::StorageExistsException
       (FromHere(),name + " already exists (createDataDynamic)!");
 
-  LocalVectorType* vLocal = new LocalVectorType(CFNULL, size, elementSize);
   const std::string localname  = name + "_local";
+  Common::MemoryPolicy::Scoped localPolicy(getMemoryPolicy(localname));
+  LocalVectorType* vLocal = new LocalVectorType(CFNULL, size, elementSize);
   m_dataStorage[localname] = static_cast<void *>(vLocal);
 
-  GlobalVectorType* vGlobal = new GlobalVectorType (init, size, elementSize);
   const std::string globalname = name + "_global";
+  Common::MemoryPolicy::Scoped globalPolicy(getMemoryPolicy(globalname));
+  GlobalVectorType* vGlobal = new GlobalVectorType (init, size, elementSize);
   m_dataStorage[globalname] = static_cast<void *>(vGlobal);
 
   return DataHandle<TYPE,GLOBAL>(static_cast<void *>(vLocal),static_cast<void *>(vGlobal));
@@ -340,12 +360,14 @@ DataHandle<TYPE,GLOBAL> DataStorage::createGlobalData
     throw Common::StorageExistsException
       (FromHere(),name + " already exists (createDataDynamic)!");
 
-  LocalVectorType* vLocal = new LocalVectorType(CFNULL, size);
   const std::string localname  = name + "_local";
+  Common::MemoryPolicy::Scoped localPolicy(getMemoryPolicy(localname));
+  LocalVectorType* vLocal = new LocalVectorType(CFNULL, size);
   m_dataStorage[localname] = static_cast<void *>(vLocal);
   
-  GlobalVectorType* vGlobal = new GlobalVectorType (nspaceName, init, size);
   const std::string globalname = name + "_global";
+  Common::MemoryPolicy::Scoped globalPolicy(getMemoryPolicy(globalname));
+  GlobalVectorType* vGlobal = new GlobalVectorType (nspaceName, init, size);
   m_dataStorage[globalname] = static_cast<void *>(vGlobal);
   
   return DataHandle<TYPE,GLOBAL>(static_cast<void *>(vLocal),static_cast<void *>(vGlobal));
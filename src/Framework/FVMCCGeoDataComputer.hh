@@ -25,12 +25,19 @@ namespace COOLFluiD {
 
 /// This class offers a basic interface for (re-)computing geometric data 
 /// (normals, volumes, etc.) for a cell-centered Finite Volume discretization, 
-/// assuming that all data arrays have been already resized correctly
+/// assuming that all data arrays have been already resized correctly.
+/// With the option IncrementalUpdate, the node coordinates are compared to
+/// the ones of the previous update and only the geometric data of the cells
+/// and faces touching moved nodes are recomputed.
 /// @author Andrea Lani
 template < typename METHODDATA >
 class FVMCCGeoDataComputer : public Framework::GeoDataComputer<METHODDATA> {
 public:
 
+  /// Defines the Config Option's of this class
+  /// @param options a OptionList where to add the Option's
+  static void defineConfigOptions(Config::OptionList& options);
+  
   /// Constructor
   FVMCCGeoDataComputer(const std::string& name);
 
@@ -64,6 +71,23 @@ protected: // helper functions
   /// Compute the face centers
   virtual void computeFaceCenters();
   
+  /// Flag the cells and the faces touching nodes which moved since the last
+  /// call to compute()
+  /// @return true if only the flagged entities need to be updated
+  bool findUpdatedEntities();
+  
+  /// @return true if the geometric data of the given cell must be updated
+  bool isUpdatedCell(CFuint cellID) const
+  {
+    return (!m_isIncremental || m_updatedCells[cellID]);
+  }
+  
+  /// @return true if the geometric data of the given face must be updated
+  bool isUpdatedFace(CFuint faceID) const
+  {
+    return (!m_isIncremental || m_updatedFaces[faceID]);
+  }
+  
 protected:
   
   /// storage of face normals
@@ -85,6 +109,21 @@ protected:
   /// storage of the cell volumes
   Framework::DataSocketSink<CFreal> socket_volumes;
   
+  /// node coordinates at the last call to compute()
+  std::vector<CFreal> m_oldNodeCoords;
+  
+  /// flags telling which cells have at least one moved node
+  std::vector<bool> m_updatedCells;
+  
+  /// flags telling which faces only belong to updated cells
+  std::vector<bool> m_updatedFaces;
+  
+  /// true if the current update is restricted to the flagged entities
+  bool m_isIncremental;
+  
+  /// flag telling to recompute only the geometry touching moved nodes
+  bool m_incrementalUpdate;
+  
 }; // end of class FVMCCGeoDataComputer
       
 //////////////////////////////////////////////////////////////////////////////
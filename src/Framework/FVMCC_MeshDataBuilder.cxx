@@ -1,9 +1,18 @@
 #include <set>
 #include <numeric>
+#include <limits>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/operations.hpp>
 
 #include "Common/SwapEmpty.hh"
 
 #include "Common/CFLog.hh"
+#include "Common/PE.hh"
+#include "Common/MemoryAccounting.hh"
 #include "Environment/ObjectProvider.hh"
 
 #include "Framework/MeshData.hh"
@@ -40,6 +49,42 @@ connFVMCCProvider("FVMCC");
 
 //////////////////////////////////////////////////////////////////////////////
 
+/// version of the layout of the face cache files, to be increased at each change
+static const CFuint FACE_CACHE_VERSION = 1;
+
+/// magic number at the beginning of the face cache files
+static const char FACE_CACHE_MAGIC[8] = {'C','F','F','A','C','E','S','\0'};
+
+/// Orders element faces by their sorted node IDs, then by their index
+struct FaceKeyLess {
+  FaceKeyLess(const CFuint* keys, CFuint keySize) : m_keys(keys), m_keySize(keySize) {}
+  
+  bool operator() (CFuint a, CFuint b) const
+  {
+    const CFuint* ka = m_keys + a*m_keySize;
+    const CFuint* kb = m_keys + b*m_keySize;
+    for (CFuint i = 0; i < m_keySize; ++i) {
+      if (ka[i] != kb[i]) return ka[i] < kb[i];
+    }
+    return a < b;
+  }
+  
+  const CFuint* m_keys;
+  CFuint m_keySize;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_MeshDataBuilder::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< std::string >
+    ("FaceCacheDir","Directory where the cell-face connectivity is cached for later runs with the same mesh and partitioning (none if empty).");
+  options.addConfigOption< CFuint >
+    ("NbThreadsOMP","Number of OpenMP threads for the face matching.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 FVMCC_MeshDataBuilder::FVMCC_MeshDataBuilder(const std::string& name) :
    MeshDataBuilder(name),
    m_nbFaces(0),
@@ -58,6 +103,13 @@ FVMCC_MeshDataBuilder::FVMCC_MeshDataBuilder(const std::string& name) :
    m_mapStateIdToFaceIdx(),
    m_isPartitionFace()
  {
+   addConfigOptionsTo(this);
+   
+   m_faceCacheDir = "";
+   setParameter("FaceCacheDir",&m_faceCacheDir);
+   
+   m_nbThreadsOMP = 1;
+   setParameter("NbThreadsOMP",&m_nbThreadsOMP);
  }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -162,17 +214,6 @@ void FVMCC_MeshDataBuilder::createCellFaces()
   ConnTable* cellFaces = new ConnTable(m_nbFacesPerElem);
   MeshDataStack::getActive()->storeConnectivity("cellFaces", cellFaces);
 
-  const CFuint totNbNodes = MeshDataStack::getActive()->getNbNodes();
-
-  // allocate a table mapping node-face ID
-  vector < vector<CFuint> > mapNodeFace(totNbNodes);
-
-  // atomic number to indicate the maximum possible number
-  // of nodes in a face
-  // allows to avoid frequent reallocations of the vector nodesInFace
-  const CFuint maxNbNodesInFace = 100;
-  vector<CFuint> nodesInFace(maxNbNodesInFace);
-
   const std::string faceProviderName = "Face";
 
   // number of boundary faces in TRS data read from mesh file
@@ -196,22 +237,16 @@ void FVMCC_MeshDataBuilder::createCellFaces()
   vector<CFuint> nbFaceNodes;
   nbFaceNodes.reserve(maxTotalNbFaces);
 
-  // loop over the elements and construct faceIDs
-  CFuint elemID = 0;
   CFuint countInFaces = 0;
   std::string providerName = "";
 
-  // during the first big loop the following is done:
-  // 1. set the element-faces connectivity
-  // 2. set the geometric entity type IDs of each face
-  // 3. select which are the boundary faces and which are internal ones
-
-  // loop over the types
+  // geometric entity types of the faces of each element type
+  vector< vector<CFuint> > faceGeoTypeIDs(nbElemTypes);
   for (CFuint iType = 0; iType < nbElemTypes; ++iType)
   {
     /// @todo for now all geoents have same geometric and solution polyorder
     const CFuint nbElemFaces = faceShapesPerElemType[iType].size();
-    vector<CFuint> faceGeoTypeID(nbElemFaces);
+    faceGeoTypeIDs[iType].resize(nbElemFaces);
 
     // create the GeometricEntityProviders corresponding to each
     // single face of this element type
@@ -226,115 +261,23 @@ void FVMCC_MeshDataBuilder::createCellFaces()
 
       CFLogDebugMin("FVMCC Face provider [" << providerName << "]\n");
 
-      faceGeoTypeID[iFace] = m_mapGeoProviderNameToType.find(providerName);
+      faceGeoTypeIDs[iType][iFace] = m_mapGeoProviderNameToType.find(providerName);
     }
-
-    // loop over the elements of this type
-    const CFuint nbElemPerType = (*elementType)[iType].getNbElems();
-    for (CFuint iElem = 0; iElem < nbElemPerType; ++iElem, ++elemID)
-    {
-      // loop over the faces in the current element
-      const CFuint nbElemFaces = m_nbFacesPerElem[elemID];
-      for (CFuint iFace = 0; iFace < nbElemFaces; ++iFace)
-      {
-	// construct sets of nodes that make the corresponding face in this element
-	const CFuint nbNodesPerFace = m_faceNodeElement[iType]->nbCols(iFace);
-	for (CFuint iNode = 0; iNode < nbNodesPerFace; ++iNode)
-	{
-	  const CFuint localNodeID = (*m_faceNodeElement[iType])(iFace, iNode); 
-          nodesInFace[iNode] = getCFmeshData().getElementNode(elemID, localNodeID);
-	}
-
-        // consider the first node belonging to the current face
-        // check if you find a face ID shared between all the other
-        // nodes building a face
-        const CFuint nodeID = nodesInFace[0];
-	
-        // number of faceIDs referencing node
-        const CFuint nbFaceIDsRefNode = mapNodeFace[nodeID].size();
-	// loop over all the faceIDs referenced by the first node to see if
-        // all the other nodes reference the same face
-        bool faceFound = false;
-        CFuint countNodes = 0;
-        CFuint currFaceID = 0;
-        for (CFuint iFaceID = 0;
-             iFaceID < nbFaceIDsRefNode && (faceFound == false);
-             ++iFaceID)
-        {
-          currFaceID = mapNodeFace[nodeID][iFaceID];
-          countNodes = 1;
-	  
-          if (nbNodesPerFace > 1) {
-	    for (CFuint iNode = 1; iNode < nbNodesPerFace; ++iNode) {
-	      const CFuint newNodeID = nodesInFace[iNode];
-	      // number of faceIDs referencing node
-	      const CFuint nbFaceIDsRefThisNode = mapNodeFace[newNodeID].size();
-	      for (CFuint jFaceID = 0; jFaceID < nbFaceIDsRefThisNode; ++jFaceID) {
-		if (mapNodeFace[newNodeID][jFaceID] == currFaceID) {
-		  ++countNodes;
-		  break;
-		}
-	      }
-	      
-	      if (countNodes == nbNodesPerFace)
-	      {
-		// the corresponding faceID already exists, meaning
-		// that the face is an internal one, shared by two elements
-		// here you set the second element (==state) neighbor of the face
-		faceFound = true;
-		(*cellFaces)(elemID, iFace) = currFaceID;
-		
-		// since it has two neighbor cells,
-		// this face is surely NOT a boundary face
-		m_isBFace[currFaceID] = false;
-		
-		// increment number of inner faces (they always have 2 states)
-		countInFaces++;
-		break;
-	      }
-	    }
-	  }
-	  else {
-	    // this only applies to the 1D case 
-	    cf_assert(nbNodesPerFace == 1);
-	    
-	    // the corresponding faceID already exists, meaning
-	    // that the face is an internal one, shared by two elements
-	    // here you set the second element (==state) neighbor of the face
-	    faceFound = true;
-	    (*cellFaces)(elemID, iFace) = currFaceID;
-	    
-	    // since it has two neighbor cells,
-	    // this face is surely NOT a boundary face
-	    m_isBFace[currFaceID] = false;
-	    
-	    // increment number of inner faces (they always have 2 states)
-	    countInFaces++;
-	  }
-	}
-	
-        if (!faceFound || nbFaceIDsRefNode == 0) {
-          // a new face has been found
-          // add the ID of the new face in the corresponding nodes
-          // referencing it
-          for (CFuint i = 0; i < nbNodesPerFace; ++i) {
-            const CFuint currNodeID = nodesInFace[i];
-            mapNodeFace[currNodeID].push_back(m_nbFaces);
-          }
-
-          // store the geometric entity type for the current face
-          m_geoTypeIDs[m_nbFaces] = faceGeoTypeID[iFace];
-
-          (*cellFaces)(elemID, iFace) = m_nbFaces;
-          nbFaceNodes.push_back(nbNodesPerFace);
-
-          // increment the number of faces
-          m_nbFaces++;
-        }
-      }
+  }
+  
+  // the faces of a previous run with the same local mesh can be reused
+  const string cacheFile = getFaceCacheFile();
+  const boost::uint64_t cacheKey = (!cacheFile.empty()) ? computeFaceCacheKey(faceGeoTypeIDs) : 0;
+  const bool cacheFound = (!cacheFile.empty()) &&
+    readFaceCache(cacheFile, cacheKey, *cellFaces, nbFaceNodes, countInFaces);
+  
+  if (!cacheFound) {
+    matchCellFaces(faceGeoTypeIDs, *cellFaces, nbFaceNodes, countInFaces);
+    if (!cacheFile.empty()) {
+      writeFaceCache(cacheFile, cacheKey, *cellFaces, nbFaceNodes, countInFaces);
     }
   }
-
+  
   cf_assert(m_nbFaces <= maxTotalNbFaces);
   cf_assert(countInFaces <= maxTotalNbFaces);
 
@@ -366,6 +309,333 @@ void FVMCC_MeshDataBuilder::createCellFaces()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void FVMCC_MeshDataBuilder::matchCellFaces(const vector< vector<CFuint> >& faceGeoTypeIDs,
+					   ConnTable& cellFaces,
+					   vector<CFuint>& nbFaceNodes,
+					   CFuint& nbInnerFaces)
+{
+  CFAUTOTRACE;
+  
+  SafePtr<vector<ElementTypeData> > elementType = getCFmeshData().getElementTypeData();
+  const CFuint nbElem = getNbElements();
+  const CFuint nbElemTypes = elementType->size();
+  const CFuint totNbNodes = MeshDataStack::getActive()->getNbNodes();
+  
+  // offset of the first face of each element in the list of all the element faces
+  vector<CFuint> elemFaceOffset(nbElem + 1, 0);
+  for (CFuint elemID = 0; elemID < nbElem; ++elemID) {
+    elemFaceOffset[elemID+1] = elemFaceOffset[elemID] + m_nbFacesPerElem[elemID];
+  }
+  const CFuint nbElemFaces = elemFaceOffset[nbElem];
+  
+  // all the keys have the same width: the sorted face nodes, padded
+  CFuint keySize = 1;
+  for (CFuint iType = 0; iType < nbElemTypes; ++iType) {
+    for (CFuint iFace = 0; iFace < m_faceNodeElement[iType]->nbRows(); ++iFace) {
+      keySize = max(keySize, m_faceNodeElement[iType]->nbCols(iFace));
+    }
+  }
+  
+  const CFdouble keyBytes = static_cast<CFdouble>(nbElemFaces)*(keySize + 2)*sizeof(CFuint);
+  const std::string nsp = MeshDataStack::getActive()->getPrimaryNamespace();
+  const std::string memLabel = nsp + "_FVMCC_FaceKeys";
+  MemoryAccounting::getInstance().setSize(memLabel, keyBytes);
+  CFLog(INFO, "FVMCC face keys [" << keyBytes/(1024.*1024.) << " MB]\n");
+  
+#ifndef CF_HAVE_OMP
+  if (m_nbThreadsOMP > 1) {
+    CFLog(WARN, "FVMCC_MeshDataBuilder::matchCellFaces() => NbThreadsOMP > 1 but OpenMP is not available\n");
+    m_nbThreadsOMP = 1;
+  }
+#endif
+  
+  const CFuint NO_NODE = numeric_limits<CFuint>::max();
+  vector<CFuint> keys(nbElemFaces*keySize, NO_NODE);
+  const int nbThreads = m_nbThreadsOMP;
+  
+  // 1. build the key of each element face
+  CFuint firstElem = 0;
+  for (CFuint iType = 0; iType < nbElemTypes; ++iType) {
+    const Table<CFuint>& faceNodes = *m_faceNodeElement[iType];
+    const int nbElemPerType = (*elementType)[iType].getNbElems();
+    
+#ifdef CF_HAVE_OMP
+#pragma omp parallel for schedule(static) num_threads(nbThreads)
+#endif
+    for (int iElem = 0; iElem < nbElemPerType; ++iElem) {
+      const CFuint elemID = firstElem + iElem;
+      for (CFuint iFace = 0; iFace < m_nbFacesPerElem[elemID]; ++iFace) {
+	CFuint *const key = &keys[(elemFaceOffset[elemID] + iFace)*keySize];
+	const CFuint nbNodesPerFace = faceNodes.nbCols(iFace);
+	for (CFuint iNode = 0; iNode < nbNodesPerFace; ++iNode) {
+	  key[iNode] = getCFmeshData().getElementNode(elemID, faceNodes(iFace, iNode));
+	}
+	std::sort(key, key + nbNodesPerFace);
+      }
+    }
+    firstElem += nbElemPerType;
+  }
+  
+  // 2. bucket the element faces by their smallest node, then sort each bucket:
+  // equal keys end up contiguous, ordered by element face index
+  const CFuint nbBuckets = max(static_cast<CFuint>(1), min(totNbNodes, static_cast<CFuint>(64*nbThreads)));
+  const CFuint bucketWidth = (totNbNodes + nbBuckets - 1)/nbBuckets;
+  vector<CFuint> bucketOffset(nbBuckets + 1, 0);
+  for (CFuint f = 0; f < nbElemFaces; ++f) {
+    ++bucketOffset[keys[f*keySize]/bucketWidth + 1];
+  }
+  for (CFuint b = 0; b < nbBuckets; ++b) {
+    bucketOffset[b+1] += bucketOffset[b];
+  }
+  vector<CFuint> order(nbElemFaces);
+  {
+    vector<CFuint> fill(bucketOffset.begin(), bucketOffset.end() - 1);
+    for (CFuint f = 0; f < nbElemFaces; ++f) {
+      order[fill[keys[f*keySize]/bucketWidth]++] = f;
+    }
+  }
+  
+  const FaceKeyLess keyLess(&keys[0], keySize);
+  const int nbBucketsInt = nbBuckets;
+#ifdef CF_HAVE_OMP
+#pragma omp parallel for schedule(dynamic) num_threads(nbThreads)
+#endif
+  for (int b = 0; b < nbBucketsInt; ++b) {
+    std::sort(&order[0] + bucketOffset[b], &order[0] + bucketOffset[b+1], keyLess);
+  }
+  
+  // 3. each element face points to the first element face with the same key
+  vector<CFuint> first(nbElemFaces);
+  for (CFuint i = 0; i < nbElemFaces; ++i) {
+    const bool newKey = (i == 0) || 
+      !std::equal(&keys[order[i]*keySize], &keys[order[i]*keySize] + keySize, &keys[order[i-1]*keySize]);
+    first[order[i]] = (newKey) ? order[i] : first[order[i-1]];
+  }
+  SwapEmpty(order);
+  SwapEmpty(keys);
+  
+  // 4. number the faces in the order of the elements, as in the original
+  // node-face matching: the face ID of each element face is stored in "first"
+  CFuint elemID = 0;
+  nbInnerFaces = 0;
+  for (CFuint iType = 0; iType < nbElemTypes; ++iType) {
+    const CFuint nbElemPerType = (*elementType)[iType].getNbElems();
+    for (CFuint iElem = 0; iElem < nbElemPerType; ++iElem, ++elemID) {
+      for (CFuint iFace = 0; iFace < m_nbFacesPerElem[elemID]; ++iFace) {
+	const CFuint f = elemFaceOffset[elemID] + iFace;
+	if (first[f] == f) {
+	  // a new face has been found
+	  m_geoTypeIDs[m_nbFaces] = faceGeoTypeIDs[iType][iFace];
+	  nbFaceNodes.push_back(m_faceNodeElement[iType]->nbCols(iFace));
+	  first[f] = m_nbFaces++;
+	}
+	else {
+	  // the face is shared with a previous element, so it is an inner face
+	  cf_assert(first[f] < f);
+	  first[f] = first[first[f]];
+	  m_isBFace[first[f]] = false;
+	  ++nbInnerFaces;
+	}
+	cellFaces(elemID, iFace) = first[f];
+      }
+    }
+  }
+  
+  MemoryAccounting::getInstance().setSize(memLabel, 0.);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::string FVMCC_MeshDataBuilder::getFaceCacheFile() const
+{
+  if (m_faceCacheDir.empty()) return "";
+  
+  const std::string nsp = MeshDataStack::getActive()->getPrimaryNamespace();
+  ostringstream fileName;
+  fileName << "FVMCC_Faces-N" << PE::GetPE().GetProcessorCount(nsp)
+	   << "-P" << PE::GetPE().GetRank(nsp) << ".bin";
+  return (boost::filesystem::path(m_faceCacheDir) / fileName.str()).string();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+boost::uint64_t FVMCC_MeshDataBuilder::computeFaceCacheKey
+(const vector< vector<CFuint> >& faceGeoTypeIDs)
+{
+  // FNV-1a hash of everything the faces depend on
+  boost::uint64_t key = 14695981039346656037ULL;
+  const CFuint nbElem = getNbElements();
+  const std::string nsp = MeshDataStack::getActive()->getPrimaryNamespace();
+  
+  vector<CFuint> header;
+  header.push_back(FACE_CACHE_VERSION);
+  header.push_back(PE::GetPE().GetProcessorCount(nsp));
+  header.push_back(PE::GetPE().GetRank(nsp));
+  header.push_back(getGeometricPolyOrder());
+  header.push_back(getNbElementTypes());
+  header.push_back(nbElem);
+  header.push_back(MeshDataStack::getActive()->getNbNodes());
+  for (CFuint iType = 0; iType < faceGeoTypeIDs.size(); ++iType) {
+    header.push_back(faceGeoTypeIDs[iType].size());
+    header.insert(header.end(), faceGeoTypeIDs[iType].begin(), faceGeoTypeIDs[iType].end());
+  }
+  for (CFuint i = 0; i < header.size(); ++i) {
+    key = (key ^ static_cast<boost::uint64_t>(header[i]))*1099511628211ULL;
+  }
+  
+  // name of the builder, i.e. of the space method type
+  const std::string& name = getName();
+  for (CFuint i = 0; i < name.size(); ++i) {
+    key = (key ^ static_cast<boost::uint64_t>(name[i]))*1099511628211ULL;
+  }
+  
+  // local element-node connectivity
+  SafePtr<vector<ElementTypeData> > elementType = getCFmeshData().getElementTypeData();
+  CFuint elemID = 0;
+  for (CFuint iType = 0; iType < elementType->size(); ++iType) {
+    const CFuint nbElemPerType = (*elementType)[iType].getNbElems();
+    const CFuint nbNodesPerElem = (*elementType)[iType].getNbNodes();
+    for (CFuint iElem = 0; iElem < nbElemPerType; ++iElem, ++elemID) {
+      for (CFuint iNode = 0; iNode < nbNodesPerElem; ++iNode) {
+	const boost::uint64_t nodeID = getCFmeshData().getElementNode(elemID, iNode);
+	key = (key ^ nodeID)*1099511628211ULL;
+      }
+    }
+  }
+  
+  return key;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool FVMCC_MeshDataBuilder::readFaceCache(const std::string& fileName,
+					  boost::uint64_t key,
+					  ConnTable& cellFaces,
+					  std::vector<CFuint>& nbFaceNodes,
+					  CFuint& nbInnerFaces)
+{
+  CFAUTOTRACE;
+  
+  ifstream file(fileName.c_str(), ios::in | ios::binary);
+  if (!file) {
+    CFLog(INFO, "FVMCC face cache " << fileName << " not found, building the faces\n");
+    return false;
+  }
+  
+  char magic[8];
+  boost::uint64_t header[6];
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(header), sizeof(header));
+  const CFuint nbFacesInCells = m_nbFacesPerElem.sum();
+  if (!file || !std::equal(magic, magic + 8, FACE_CACHE_MAGIC) ||
+      header[0] != FACE_CACHE_VERSION || header[1] != sizeof(CFuint) ||
+      header[2] != key || header[3] != nbFacesInCells ||
+      header[4] > m_geoTypeIDs.size() || header[5] > header[4]) {
+    CFLog(WARN, "FVMCC face cache " << fileName << " is outdated, building the faces\n");
+    return false;
+  }
+  
+  const CFuint nbFaces = header[4];
+  vector<CFuint> faceIDs(nbFacesInCells);
+  vector<char> isBFace(nbFaces);
+  nbFaceNodes.resize(nbFaces);
+  if (nbFacesInCells > 0) {
+    file.read(reinterpret_cast<char*>(&faceIDs[0]), nbFacesInCells*sizeof(CFuint));
+  }
+  if (nbFaces > 0) {
+    file.read(reinterpret_cast<char*>(&m_geoTypeIDs[0]), nbFaces*sizeof(CFuint));
+    file.read(&isBFace[0], nbFaces);
+    file.read(reinterpret_cast<char*>(&nbFaceNodes[0]), nbFaces*sizeof(CFuint));
+  }
+  if (!file) {
+    CFLog(WARN, "FVMCC face cache " << fileName << " is truncated, building the faces\n");
+    nbFaceNodes.clear();
+    return false;
+  }
+  
+  CFuint count = 0;
+  for (CFuint elemID = 0; elemID < m_nbFacesPerElem.size(); ++elemID) {
+    for (CFuint iFace = 0; iFace < m_nbFacesPerElem[elemID]; ++iFace, ++count) {
+      cellFaces(elemID, iFace) = faceIDs[count];
+    }
+  }
+  for (CFuint i = 0; i < nbFaces; ++i) {
+    m_isBFace[i] = (isBFace[i] != 0);
+  }
+  m_nbFaces = nbFaces;
+  nbInnerFaces = header[5];
+  
+  CFLog(INFO, "FVMCC faces read from cache " << fileName << "\n");
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_MeshDataBuilder::writeFaceCache(const std::string& fileName,
+					   boost::uint64_t key,
+					   const ConnTable& cellFaces,
+					   const std::vector<CFuint>& nbFaceNodes,
+					   CFuint nbInnerFaces)
+{
+  CFAUTOTRACE;
+  
+  const CFuint nbFacesInCells = m_nbFacesPerElem.sum();
+  vector<CFuint> faceIDs;
+  faceIDs.reserve(nbFacesInCells);
+  for (CFuint elemID = 0; elemID < m_nbFacesPerElem.size(); ++elemID) {
+    for (CFuint iFace = 0; iFace < m_nbFacesPerElem[elemID]; ++iFace) {
+      faceIDs.push_back(cellFaces(elemID, iFace));
+    }
+  }
+  vector<char> isBFace(m_nbFaces);
+  for (CFuint i = 0; i < m_nbFaces; ++i) {
+    isBFace[i] = m_isBFace[i];
+  }
+  
+  boost::uint64_t header[6];
+  header[0] = FACE_CACHE_VERSION;
+  header[1] = sizeof(CFuint);
+  header[2] = key;
+  header[3] = nbFacesInCells;
+  header[4] = m_nbFaces;
+  header[5] = nbInnerFaces;
+  
+  // write to a temporary file first, so that an interrupted run
+  // never leaves a truncated cache behind
+  const std::string tmpName = fileName + ".tmp";
+  try {
+    boost::filesystem::create_directories(boost::filesystem::path(fileName).branch_path());
+    
+    ofstream file(tmpName.c_str(), ios::out | ios::binary | ios::trunc);
+    file.write(FACE_CACHE_MAGIC, sizeof(FACE_CACHE_MAGIC));
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    if (nbFacesInCells > 0) {
+      file.write(reinterpret_cast<const char*>(&faceIDs[0]), nbFacesInCells*sizeof(CFuint));
+    }
+    if (m_nbFaces > 0) {
+      file.write(reinterpret_cast<const char*>(&m_geoTypeIDs[0]), m_nbFaces*sizeof(CFuint));
+      file.write(&isBFace[0], m_nbFaces);
+      file.write(reinterpret_cast<const char*>(&nbFaceNodes[0]), m_nbFaces*sizeof(CFuint));
+    }
+    file.close();
+    
+    if (!file) {
+      CFLog(WARN, "FVMCC face cache " << tmpName << " could not be written\n");
+      boost::filesystem::remove(tmpName);
+      return;
+    }
+    boost::filesystem::rename(tmpName, fileName);
+  }
+  catch (boost::filesystem::filesystem_error& e) {
+    CFLog(WARN, "FVMCC face cache " << fileName << " could not be written: " << e.what() << "\n");
+    return;
+  }
+  
+  CFLog(INFO, "FVMCC faces written to cache " << fileName << "\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void FVMCC_MeshDataBuilder::createInnerFacesTRS()
 {
   CFAUTOTRACE;
@@ -3,6 +3,8 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <boost/cstdint.hpp>
+
 #include "Common/CFMultiMap.hh"
 
 #include "Framework/MeshDataBuilder.hh"
@@ -31,6 +33,12 @@ public: // typedefs
 
 public: // functions
 
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
   /**
    * Constructor
    *
@@ -91,6 +99,56 @@ private: // helper functions
    */
   void createCellFaces();
 
+  /**
+   * Matches the faces of all the elements: the sorted node IDs of each
+   * element face are used as a key, equal keys are grouped by sorting (in
+   * parallel with OpenMP) and the faces are then numbered in the order of
+   * the elements. It sets the cell-face connectivity, the face geometric
+   * types and the boundary flags.
+   * @param faceGeoTypeIDs  geometric entity type of each face of each element type
+   * @param cellFaces       cell-face connectivity to fill
+   * @param nbFaceNodes     filled with the number of nodes of each face
+   * @param nbInnerFaces    set to the number of inner faces
+   */
+  void matchCellFaces(const std::vector< std::vector<CFuint> >& faceGeoTypeIDs,
+		      ConnTable& cellFaces,
+		      std::vector<CFuint>& nbFaceNodes,
+		      CFuint& nbInnerFaces);
+
+  /**
+   * @return the name of the face cache file of this rank,
+   *         empty if the cache is disabled
+   */
+  std::string getFaceCacheFile() const;
+
+  /**
+   * Computes the key identifying the faces of the local mesh: it depends
+   * on the local element-node connectivity, on the face types, on the
+   * number of processors and on the rank
+   */
+  boost::uint64_t computeFaceCacheKey
+  (const std::vector< std::vector<CFuint> >& faceGeoTypeIDs);
+
+  /**
+   * Reads the cell-face connectivity, the face types and boundary flags
+   * and the number of nodes per face from the face cache
+   * @return false if the cache is missing or does not match the given key
+   */
+  bool readFaceCache(const std::string& fileName,
+		     boost::uint64_t key,
+		     ConnTable& cellFaces,
+		     std::vector<CFuint>& nbFaceNodes,
+		     CFuint& nbInnerFaces);
+
+  /**
+   * Writes the data read by readFaceCache() in the face cache
+   */
+  void writeFaceCache(const std::string& fileName,
+		      boost::uint64_t key,
+		      const ConnTable& cellFaces,
+		      const std::vector<CFuint>& nbFaceNodes,
+		      CFuint nbInnerFaces);
+
   /**
    * Renumber local cells so that their IDs are equal to the
    * local state IDs
@@ -166,6 +224,12 @@ private: // data
   /// flag telling if the face is a partition face
   std::valarray<bool> m_isPartitionFace;
 
+  /// directory of the face cache files
+  std::string m_faceCacheDir;
+
+  /// number of OpenMP threads for the face matching
+  CFuint m_nbThreadsOMP;
+
 }; // end of class FVMCC_MeshDataBuilder
 
 //////////////////////////////////////////////////////////////////////////////
@@ -121,6 +121,18 @@ public: // functions
   /// Flag telling to use node-based sparsity an assembly (instead of state-based)
   bool useNodeBased() const {return m_useNodeBased;}
   
+  /// Gets the number of iterations of the last solve (0 if not provided by the solver)
+  CFuint getNbIterations() const {return m_nbIterations;}
+  
+  /// Sets the number of iterations of the last solve
+  void setNbIterations(const CFuint nbIterations) {m_nbIterations = nbIterations;}
+  
+  /// Flag telling that the convergence method asks to keep the current preconditioner
+  bool reusePreconditioner() const {return m_reusePreconditioner;}
+  
+  /// Asks to keep (or not) the current preconditioner at the next solves
+  void setReusePreconditioner(const bool reuse) {m_reusePreconditioner = reuse;}
+  
  private: // data
   
   /// mapping local to global indices numbering
@@ -162,6 +174,12 @@ public: // functions
   /// use node-based sparsity and assembly (instead of state-based)
   bool m_useNodeBased;
   
+  /// number of iterations of the last solve
+  CFuint m_nbIterations;
+  
+  /// the convergence method asks to keep the current preconditioner
+  bool m_reusePreconditioner;
+  
 }; // end of class LSSData
 
 //////////////////////////////////////////////////////////////////////////////
@@ -76,6 +76,34 @@ public:
   {
     throw Common::NotImplementedException (FromHere(),"Limiter::limitScalar()");
   }
+  
+  /// Apply the limiter to all the variables of one cell, given the extrema
+  /// in its stencil and the unlimited increments at its quadrature points.
+  /// It must not modify this object, so that cells can be limited concurrently.
+  /// @param nbEqs         number of variables
+  /// @param nbPoints      number of quadrature points of the cell
+  /// @param deltaPlusMax  stencil maximum minus cell value, for each variable
+  /// @param deltaPlusMin  stencil minimum minus cell value, for each variable
+  /// @param deltaMin      increments at the quadrature points [iPoint*nbEqs + iVar]
+  /// @param avgDistance   average distance between the cell and its neighbors
+  /// @post in limiterValue you put the value of the limiter for
+  ///       each variable
+  virtual void limitIncrements(CFuint nbEqs, CFuint nbPoints,
+			       const CFreal* deltaPlusMax, const CFreal* deltaPlusMin,
+			       const CFreal* deltaMin, CFreal avgDistance,
+			       CFreal* limiterValue) const
+  {
+    throw Common::NotImplementedException (FromHere(),"Limiter::limitIncrements()");
+  }
+  
+  /// @return true if limitIncrements() is implemented
+  virtual bool hasIncrementsKernel() const {return false;}
+  
+  /// @return true if the local extrema are computed on the full stencil
+  bool getUseFullStencil() const {return m_useFullStencil;}
+  
+  /// @return true if the full stencil is the one of the nodal extrapolation
+  bool getUseNodalExtrapolationStencil() const {return m_useNodalExtrapolationStencil;}
 
   /// Configure the object
   virtual void configure ( Config::ConfigArgs& args )
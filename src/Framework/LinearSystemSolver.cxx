@@ -154,6 +154,20 @@ Framework::LSSIdxMapping& LinearSystemSolver::getLocalToLocallyUpdatableMapping(
   return m_lssData->getLocalToLocallyUpdatableMapping();
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint LinearSystemSolver::getNbIterations() const
+{
+  return m_lssData->getNbIterations();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void LinearSystemSolver::setReusePreconditioner(const bool reuse)
+{
+  m_lssData->setReusePreconditioner(reuse);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
   } // namespace Framework
@@ -81,6 +81,12 @@ public: // methods
   /// Accessor that does not allow mutation for clients.
   LSSIdxMapping& getLocalToLocallyUpdatableMapping();
   
+  /// Get the number of iterations of the last solve (0 if not provided by the solver)
+  CFuint getNbIterations() const;
+  
+  /// Ask to keep (or not) the current preconditioner at the next solves
+  void setReusePreconditioner(const bool reuse);
+  
   /// Mask array that specifies which equations are solved by the current LSS
   Common::SafePtr<std::valarray<bool> > getMaskArray() {   return &m_maskArray;  }
   
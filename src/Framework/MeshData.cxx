@@ -4,7 +4,10 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include <set>
+
 #include "Common/GeneralStorage.hh"
+#include "Common/MemoryAccounting.hh"
 
 #include "Framework/State.hh"
 #include "Framework/GeometricEntityRegister.hh"
@@ -31,6 +34,11 @@ void MeshData::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< std::string >("DomainModel","Type of domain model to describe the computational domain.");
   options.addConfigOption< NamespaceGroup::StorageType >("Namespaces","List the Namespaces which will be present in this MeshData");
   options.addConfigOption< bool >("sameNodeStateConnectivity","Option to assume the Node and State connectivity to be the same.");
+  options.addConfigOption< std::vector<std::string> >("MemoryPolicySockets","Names of the sockets (e.g. states, gradients) whose arrays follow HugePages, NumaMode and ParallelFirstTouch.");
+  options.addConfigOption< bool >("HugePages","Back the MemoryPolicySockets with transparent huge pages.");
+  options.addConfigOption< bool >("ParallelFirstTouch","First-touch the MemoryPolicySockets from all the OpenMP threads.");
+  options.addConfigOption< std::string >("NumaMode","NUMA placement of the MemoryPolicySockets (Default, Interleave, Bind).");
+  options.addConfigOption< std::vector<CFuint> >("NumaNodes","NUMA nodes used by the Interleave and Bind placements (default all).");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -60,7 +68,9 @@ MeshData::MeshData(const std::string& name) :
   m_totalTRSInfo(),
   m_totalTRSMap(),
   socket_states("states"),
-  socket_nodes("nodes")
+  socket_nodes("nodes"),
+  m_memoryPolicySockets(),
+  m_numaNodes()
 {
   CFAUTOTRACE;
   addConfigOptionsTo(this);
@@ -76,6 +86,19 @@ MeshData::MeshData(const std::string& name) :
 
   m_domainmodel_str = "Null";
   setParameter("DomainModel",&m_domainmodel_str);
+  
+  setParameter("MemoryPolicySockets",&m_memoryPolicySockets);
+  
+  m_hugePages = true;
+  setParameter("HugePages",&m_hugePages);
+  
+  m_parallelFirstTouch = false;
+  setParameter("ParallelFirstTouch",&m_parallelFirstTouch);
+  
+  m_numaModeStr = "Default";
+  setParameter("NumaMode",&m_numaModeStr);
+  
+  setParameter("NumaNodes",&m_numaNodes);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -120,6 +143,19 @@ void MeshData::configure ( Config::ConfigArgs& args )
   GeometricEntityRegister::getInstance().setFactoryRegistry(getFactoryRegistry());
   
   delete dm;
+  
+  // placement policy for the selected sockets, applied by the DataStorage
+  // when their arrays get created
+  MemoryPolicy policy;
+  policy.useHugePages = m_hugePages;
+  policy.parallelFirstTouch = m_parallelFirstTouch;
+  policy.numaMode = MemoryPolicy::convertNumaMode(m_numaModeStr);
+  policy.numaNodes = m_numaNodes;
+  for (CFuint i = 0; i < m_memoryPolicySockets.size(); ++i) {
+    CFLog(VERBOSE, "MeshData::configure() => memory policy set for socket "
+	  << m_memoryPolicySockets[i] << "\n");
+    m_dataStorage->setMemoryPolicy(m_memoryPolicySockets[i], policy);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -430,6 +466,23 @@ void MeshData::removeConnectivity(const std::string& name)
 void MeshData::deleteConnectivity(const std::string& name)
 {
   m_connectivityStorage.deleteEntry(name);
+  MemoryAccounting::getInstance().setSize(getPrimaryNamespace() + "_Connectivity_" + name, 0.);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MeshData::accountMemory()
+{
+  const string prefix = getPrimaryNamespace() + "_Connectivity_";
+  MemoryAccounting::getInstance().setGroup(prefix, getPrimaryNamespace());
+  
+  // tables shared under several names (e.g. cellNodes and cellStates) are counted once
+  std::set<ConnTable*> counted;
+  for (GeneralStorage<ConnTable>::iterator it = m_connectivityStorage.begin();
+       it != m_connectivityStorage.end(); ++it) {
+    const CFdouble size = (counted.insert(it->second).second) ? it->second->getMemorySize() : 0.;
+    MemoryAccounting::getInstance().setSize(prefix + it->first, size);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -146,6 +146,10 @@ public: // methods
   /// @param name the name to identify the connectivity
   void deleteConnectivity(const std::string& name);
 
+  /// Reports the memory held by the ConnectivityTable's to the MemoryAccounting,
+  /// under the labels "<primary namespace>_Connectivity_<name>"
+  void accountMemory();
+
   /// Remove only the given ConnectivityTable from Connectivity Storage
   /// @param name the name to identify the connectivity
   void removeConnectivity(const std::string& name);
@@ -378,6 +382,21 @@ private: // member data
   /// string for configuring the domain model
   std::string m_domainmodel_str;
   
+  /// names of the sockets whose arrays follow the memory policy below
+  std::vector<std::string> m_memoryPolicySockets;
+  
+  /// flag telling to back the selected sockets with huge pages
+  bool m_hugePages;
+  
+  /// flag telling to first-touch the selected sockets from all threads
+  bool m_parallelFirstTouch;
+  
+  /// NUMA placement of the selected sockets (Default, Interleave, Bind)
+  std::string m_numaModeStr;
+  
+  /// NUMA nodes for the Interleave and Bind placements
+  std::vector<CFuint> m_numaNodes;
+  
 }; // end of class MeshData
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,93 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Framework/MultigridCycle.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MultigridCycle::MultigridCycle() :
+  m_nbLevels(1),
+  m_nbCoarseVisits(1),
+  m_nbPreSmoothing(1),
+  m_nbPostSmoothing(1),
+  m_nbCoarsestSmoothing(1),
+  m_nbFMGCycles(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MultigridCycle::~MultigridCycle()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MultigridCycle::setCycle(CFuint nbLevels,
+                              CFuint nbCoarseVisits,
+                              CFuint nbPreSmoothing,
+                              CFuint nbPostSmoothing,
+                              CFuint nbCoarsestSmoothing,
+                              CFuint nbFMGCycles)
+{
+  cf_assert(nbLevels > 0);
+  m_nbLevels = nbLevels;
+  m_nbCoarseVisits = nbCoarseVisits;
+  m_nbPreSmoothing = nbPreSmoothing;
+  m_nbPostSmoothing = nbPostSmoothing;
+  m_nbCoarsestSmoothing = nbCoarsestSmoothing;
+  m_nbFMGCycles = nbFMGCycles;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint MultigridCycle::getTopLevel(CFuint nbIter) const
+{
+  if (m_nbFMGCycles == 0 || nbIter == 0) return 0;
+
+  const CFuint nbLevelsDone = (nbIter - 1)/m_nbFMGCycles;
+  return (nbLevelsDone < m_nbLevels - 1) ? m_nbLevels - 1 - nbLevelsDone : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MultigridCycle::runCycle(CFuint level, bool isLast)
+{
+  cf_assert(level < m_nbLevels);
+
+  if (level == m_nbLevels - 1)
+  {
+    smooth(level, m_nbCoarsestSmoothing, isLast);
+    return;
+  }
+
+  smooth(level, m_nbPreSmoothing, false);
+
+  // the coarser level is visited nbCoarseVisits times for the same
+  // restricted problem before correcting this level
+  restrictToCoarse(level);
+  for (CFuint iVisit = 0; iVisit < m_nbCoarseVisits; ++iVisit)
+  {
+    runCycle(level + 1, isLast && m_nbPostSmoothing == 0 && iVisit == m_nbCoarseVisits - 1);
+  }
+  prolongToFine(level);
+
+  smooth(level, m_nbPostSmoothing, isLast);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
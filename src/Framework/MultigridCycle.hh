@@ -0,0 +1,111 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Framework_MultigridCycle_hh
+#define COOLFluiD_Framework_MultigridCycle_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/Framework.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class drives the V and W cycles of a multigrid method, optionally
+/// preceded by a full multigrid start on the coarse levels.
+/// Level 0 is the finest one. The derived class smooths the levels and
+/// transfers the problem between two consecutive levels.
+class Framework_API MultigridCycle {
+public:
+
+  /// Constructor
+  MultigridCycle();
+
+  /// Destructor
+  virtual ~MultigridCycle();
+
+  /// Sets the shape of the cycles
+  /// @param nbLevels             number of levels, including the finest one
+  /// @param nbCoarseVisits       number of visits of the coarser level from each
+  ///                             level (1 for V, 2 for W cycles)
+  /// @param nbPreSmoothing       number of smoothing steps before visiting the coarser level
+  /// @param nbPostSmoothing      number of smoothing steps after visiting the coarser level
+  /// @param nbCoarsestSmoothing  number of smoothing steps on the coarsest level
+  /// @param nbFMGCycles          number of cycles starting from each coarse level
+  ///                             at the beginning of the computation, 0 to disable
+  void setCycle(CFuint nbLevels,
+                CFuint nbCoarseVisits,
+                CFuint nbPreSmoothing,
+                CFuint nbPostSmoothing,
+                CFuint nbCoarsestSmoothing,
+                CFuint nbFMGCycles);
+
+  /// @return the number of levels
+  CFuint getNbCycleLevels() const {return m_nbLevels;}
+
+  /// @return the level from which the cycle of the given iteration starts:
+  /// with full multigrid, the first iterations start from the coarsest level,
+  /// moving up by one level every nbFMGCycles iterations
+  /// @param nbIter  number of the iteration, starting from 1
+  CFuint getTopLevel(CFuint nbIter) const;
+
+  /// Runs one cycle starting from the given level
+  /// @param level   level from which the cycle starts
+  /// @param isLast  true if the cycle ends the iteration
+  void runCycle(CFuint level, bool isLast);
+
+protected:
+
+  /// Smooths the given level
+  /// @param level    level to smooth
+  /// @param nbSteps  number of smoothing steps
+  /// @param isLast   true if the last step ends the iteration
+  virtual void smooth(CFuint level, CFuint nbSteps, bool isLast) = 0;
+
+  /// Transfers the problem of the given level to the next coarser one,
+  /// before the coarser level is visited
+  virtual void restrictToCoarse(CFuint level) = 0;
+
+  /// Corrects the solution of the given level with the one of the next
+  /// coarser level, after the coarser level has been visited
+  virtual void prolongToFine(CFuint level) = 0;
+
+private:
+
+  /// number of levels, including the finest one
+  CFuint m_nbLevels;
+
+  /// number of visits of the coarser level from each level
+  CFuint m_nbCoarseVisits;
+
+  /// number of smoothing steps before visiting the coarser level
+  CFuint m_nbPreSmoothing;
+
+  /// number of smoothing steps after visiting the coarser level
+  CFuint m_nbPostSmoothing;
+
+  /// number of smoothing steps on the coarsest level
+  CFuint m_nbCoarsestSmoothing;
+
+  /// number of cycles starting from each coarse level at the beginning
+  CFuint m_nbFMGCycles;
+
+}; // end of class MultigridCycle
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Framework_MultigridCycle_hh
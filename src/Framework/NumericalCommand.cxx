@@ -6,6 +6,7 @@
 
 #include "Config/BadMatchException.hh"
 #include "Common/CFLog.hh"
+#include "Common/AllocationTracker.hh"
 #include "Framework/NumericalCommand.hh"
 #include "Framework/BaseDataSocketSource.hh"
 #include "Framework/BaseDataSocketSink.hh"
@@ -41,7 +42,8 @@ NumericalCommand::NumericalCommand(const std::string& name)
     ConfigObject(name),
     m_iTrs(0),
     m_trsList(),
-    m_group(CFNULL)
+    m_group(CFNULL),
+    m_scratch()
 {
   addConfigOptionsTo(this);
   m_trsNames = std::vector<std::string>();
@@ -69,6 +71,7 @@ void NumericalCommand::execute()
   for (CFuint iTrs = 0; iTrs < nbTrs; ++iTrs) {
     CFLogDebugMed("Command: " << getName() << " applying on TRS: " << (m_trsList[iTrs])->getName() << "\n");
     setCurrentTrsID(iTrs);
+    Common::AllocationScope scope(*this, *m_trsList[iTrs]);
     executeOnTrs();
   }
 }
@@ -197,6 +200,7 @@ void NumericalCommand::setup()
 
 void NumericalCommand::unsetup()
 {
+  m_scratch.clear();
   SetupObject::unsetup();
 }
 
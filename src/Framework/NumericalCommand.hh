@@ -16,6 +16,7 @@
 
 #include "Environment/ConcreteProvider.hh"
 #include "Framework/TopologicalRegionSet.hh"
+#include "Framework/ScratchArena.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -138,6 +139,12 @@ protected: // functions
   /// Get the TRS name
   const std::string getTrsName(const CFuint iTrs);
 
+  /// Get the scratch arena of the calling thread, for the temporaries of
+  /// the computation on one entity. The arenas are not reset by the
+  /// framework: the command releases its temporaries with a
+  /// ScratchArena::Frame around the computation.
+  ScratchArena& getScratch() { return m_scratch.getLocal(); }
+
 private: // data
 
   /// ID of the current TRS to work on
@@ -157,6 +164,9 @@ private: // data
 
   /// rate at which the processing has to be done
   CFuint m_processRate;
+
+  /// scratch arena of each thread
+  ScratchArenaSet m_scratch;
   
 }; // class NumericalCommand
 
@@ -27,7 +27,8 @@ namespace COOLFluiD {
 
 NumericalStrategy::NumericalStrategy(const std::string& name)
   : Common::OwnedObject(),
-    ConfigObject(name)
+    ConfigObject(name),
+    m_scratch()
 {
 }
 
@@ -157,6 +158,7 @@ void NumericalStrategy::setup()
 
 void NumericalStrategy::unsetup()
 {
+  m_scratch.clear();
   SetupObject::unsetup();
 }
 
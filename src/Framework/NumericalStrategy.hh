@@ -16,6 +16,7 @@
 #include "Config/ConfigObject.hh"
 #include "Environment/ConcreteProvider.hh"
 #include "Framework/Framework.hh"
+#include "Framework/ScratchArena.hh"
 
 
 //////////////////////////////////////////////////////////////////////////////
@@ -83,6 +84,18 @@ public:
 
   /// Gets the polymorphic type name
   virtual std::string getPolymorphicTypeName() = 0;
+
+protected: // functions
+
+  /// Get the scratch arena of the calling thread, for the temporaries of
+  /// the computation on one entity: the strategy releases them with a
+  /// ScratchArena::Frame around the computation.
+  ScratchArena& getScratch() { return m_scratch.getLocal(); }
+
+private: // data
+
+  /// scratch arena of each thread
+  ScratchArenaSet m_scratch;
   
 }; // class NumericalStrategy
 
@@ -0,0 +1,172 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifdef CF_HAVE_OMP
+#  include <omp.h>
+#endif
+
+#include <algorithm>
+
+#include "Framework/ScratchArena.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+//////////////////////////////////////////////////////////////////////////////
+
+ScratchArena::ScratchArena() :
+  m_blocks(),
+  m_memory(),
+  m_sizes(),
+  m_current(0),
+  m_offset(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ScratchArena::~ScratchArena()
+{
+  clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ScratchArena::clear()
+{
+  for (CFuint i = 0; i < m_memory.size(); ++i) {
+    delete [] m_memory[i];
+  }
+  m_blocks.clear();
+  m_memory.clear();
+  m_sizes.clear();
+  m_current = 0;
+  m_offset = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint ScratchArena::getCapacity() const
+{
+  CFuint capacity = 0;
+  for (CFuint i = 0; i < m_sizes.size(); ++i) {
+    capacity += m_sizes[i];
+  }
+  return capacity;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal* ScratchArena::allocateInNextBlock(CFuint size)
+{
+  // the first free block big enough, if any, otherwise a new block,
+  // at least twice as big as the last one
+  CFuint next = (m_current < m_blocks.size()) ? m_current + 1 : m_blocks.size();
+  while (next < m_blocks.size() && m_sizes[next] < size) {
+    ++next;
+  }
+
+  if (next == m_blocks.size()) {
+    const CFuint minSize = 16*ALIGNMENT;
+    const CFuint lastSize = (m_sizes.size() > 0) ? m_sizes.back() : 0;
+    const CFuint blockSize = std::max(std::max(size, 2*lastSize), minSize);
+
+    CFreal* memory = new CFreal[blockSize + ALIGNMENT - 1];
+    const size_t misalignment = reinterpret_cast<size_t>(memory) % (ALIGNMENT*sizeof(CFreal));
+    const CFuint shift = (misalignment == 0) ? 0 : (ALIGNMENT*sizeof(CFreal) - misalignment)/sizeof(CFreal);
+
+    m_memory.push_back(memory);
+    m_blocks.push_back(memory + shift);
+    m_sizes.push_back(blockSize);
+  }
+
+  m_current = next;
+  m_offset = size;
+  return m_blocks[m_current];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ScratchArena::mergeBlocks()
+{
+  cf_assert(m_current == 0 && m_offset == 0);
+
+  const CFuint capacity = getCapacity();
+  clear();
+  allocateInNextBlock(capacity);
+  m_offset = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ScratchArenaSet::ScratchArenaSet() :
+  m_arenas()
+{
+#ifdef CF_HAVE_OMP
+  const CFuint nbThreads = std::max(omp_get_max_threads(), omp_get_num_procs());
+#else
+  const CFuint nbThreads = 1;
+#endif
+
+  // the arenas are empty until they are used
+  m_arenas.resize(nbThreads);
+  for (CFuint i = 0; i < nbThreads; ++i) {
+    m_arenas[i] = new ScratchArena();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ScratchArenaSet::~ScratchArenaSet()
+{
+  for (CFuint i = 0; i < m_arenas.size(); ++i) {
+    deletePtr(m_arenas[i]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ScratchArenaSet::reset()
+{
+  for (CFuint i = 0; i < m_arenas.size(); ++i) {
+    m_arenas[i]->reset();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ScratchArenaSet::clear()
+{
+  for (CFuint i = 0; i < m_arenas.size(); ++i) {
+    m_arenas[i]->clear();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint ScratchArenaSet::getThreadID()
+{
+#ifdef CF_HAVE_OMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
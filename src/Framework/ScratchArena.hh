@@ -0,0 +1,216 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Framework_ScratchArena_hh
+#define COOLFluiD_Framework_ScratchArena_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Common/NonCopyable.hh"
+#include "MathTools/RealVector.hh"
+#include "MathTools/RealMatrix.hh"
+#include "Framework/Framework.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class is a bump allocator of CFreal's for the temporaries of the
+/// computation on one entity (face, cell, state).
+/// Memory is handed out in chunks aligned on 64 bytes and it is given back
+/// all at once, either by releasing to a Marker taken before the
+/// allocations (see ScratchArena::Frame) or by reset().
+/// When the arena has to grow, a new block is added; on the next reset the
+/// blocks are merged into one, so that after the first iteration no heap
+/// allocation takes place.
+/// An arena must be used by one thread at a time: see ScratchArenaSet.
+class Framework_API ScratchArena : public Common::NonCopyable<ScratchArena> {
+public:
+
+  /// Position in the arena, to which it can be released
+  struct Marker {
+    CFuint block;
+    CFuint offset;
+  };
+
+  /// This class takes a Marker of the arena in its constructor and
+  /// releases the arena to it in its destructor: all the temporaries
+  /// obtained from the arena in between are freed.
+  class Frame : public Common::NonCopyable<Frame> {
+  public:
+
+    /// Constructor
+    explicit Frame(ScratchArena& arena) :
+      m_arena(arena), m_marker(arena.getMarker())
+    {
+    }
+
+    /// Destructor
+    ~Frame() {m_arena.release(m_marker);}
+
+  private:
+
+    /// arena to release
+    ScratchArena& m_arena;
+
+    /// position of the arena at construction
+    Marker m_marker;
+
+  }; // end class Frame
+
+  /// Constructor
+  ScratchArena();
+
+  /// Destructor
+  ~ScratchArena();
+
+  /// @return a pointer to n uninitialized CFreal's, valid until the arena
+  ///         is released to a Marker taken before this call
+  CFreal* allocate(CFuint n)
+  {
+    const CFuint size = (n + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    if (m_current < m_blocks.size() && m_offset + size <= m_sizes[m_current]) {
+      CFreal* ptr = m_blocks[m_current] + m_offset;
+      m_offset += size;
+      return ptr;
+    }
+    return allocateInNextBlock(size);
+  }
+
+  /// Makes the given vector a view of n CFreal's of the arena
+  /// @pre the vector does not own memory (default constructed or already a view)
+  void getVector(CFuint n, RealVector& v)
+  {
+    cf_assert(!v.isMemoryOwner() || v.size() == 0);
+    v.wrap(n, allocate(n));
+  }
+
+  /// Makes the given matrix a view of nbRows*nbCols CFreal's of the arena
+  /// @pre the matrix does not own memory (default constructed or already a view)
+  void getMatrix(CFuint nbRows, CFuint nbCols, RealMatrix& m)
+  {
+    cf_assert(!m.isMemoryOwner() || m.size() == 0);
+    m.wrap(nbRows, nbCols, allocate(nbRows*nbCols));
+  }
+
+  /// @return the current position in the arena
+  Marker getMarker() const
+  {
+    Marker marker;
+    marker.block  = m_current;
+    marker.offset = m_offset;
+    return marker;
+  }
+
+  /// Frees all the memory obtained after the given Marker was taken
+  void release(const Marker& marker)
+  {
+    m_current = marker.block;
+    m_offset  = marker.offset;
+    if (m_current == 0 && m_offset == 0 && m_blocks.size() > 1) {
+      mergeBlocks();
+    }
+  }
+
+  /// Frees all the memory obtained from the arena
+  void reset()
+  {
+    Marker begin;
+    begin.block  = 0;
+    begin.offset = 0;
+    release(begin);
+  }
+
+  /// Gives back the blocks of the arena to the heap
+  void clear();
+
+  /// @return the number of CFreal's reserved by the arena
+  CFuint getCapacity() const;
+
+private: // functions
+
+  /// Moves to the next block able to hold size CFreal's, adding one if needed
+  CFreal* allocateInNextBlock(CFuint size);
+
+  /// Replaces the blocks by a single one with their total size
+  void mergeBlocks();
+
+private: // data
+
+  /// alignment of the chunks, in number of CFreal's
+  static const CFuint ALIGNMENT = 64/sizeof(CFreal);
+
+  /// aligned start of each block
+  std::vector<CFreal*> m_blocks;
+
+  /// memory of each block, as returned by new
+  std::vector<CFreal*> m_memory;
+
+  /// size of each block
+  std::vector<CFuint> m_sizes;
+
+  /// block currently used
+  CFuint m_current;
+
+  /// first free entry in the current block
+  CFuint m_offset;
+
+}; // end class ScratchArena
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class holds one ScratchArena per thread, so that the commands and
+/// strategies can get their temporaries inside threaded loops without
+/// contention.
+class Framework_API ScratchArenaSet : public Common::NonCopyable<ScratchArenaSet> {
+public:
+
+  /// Constructor
+  ScratchArenaSet();
+
+  /// Destructor
+  ~ScratchArenaSet();
+
+  /// @return the arena of the calling thread
+  ScratchArena& getLocal()
+  {
+    const CFuint threadID = getThreadID();
+    cf_assert(threadID < m_arenas.size());
+    return *m_arenas[threadID];
+  }
+
+  /// Frees all the memory obtained from the arenas of all the threads
+  /// @pre not called inside a threaded region
+  void reset();
+
+  /// Gives back the memory of the arenas of all the threads to the heap
+  void clear();
+
+  /// @return the index of the calling thread, 0 outside threaded regions
+  static CFuint getThreadID();
+
+private: // data
+
+  /// arena of each thread
+  std::vector<ScratchArena*> m_arenas;
+
+}; // end class ScratchArenaSet
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Framework_ScratchArena_hh
@@ -7,6 +7,7 @@
 #include "Common/NotImplementedException.hh"
 #include "Common/BadValueException.hh"
 #include "Common/EventHandler.hh"
+#include "Common/AllocationTracker.hh"
 
 #include "Environment/CFEnv.hh"
 
@@ -153,6 +154,7 @@ void SpaceMethod::prepareComputation()
 
   pushNamespace();
 
+  Common::AllocationScope scope(*this, "::prepareComputation");
   prepareComputationImpl();
 
   popNamespace();
@@ -169,6 +171,7 @@ void SpaceMethod::computeSpaceResidual(CFreal factor)
 
   pushNamespace();
 
+  Common::AllocationScope scope(*this, "::computeSpaceResidual");
   computeSpaceResidualImpl(factor);
 
   popNamespace();
@@ -185,6 +188,7 @@ void SpaceMethod::computeTimeResidual(CFreal factor)
 
   pushNamespace();
 
+  Common::AllocationScope scope(*this, "::computeTimeResidual");
   computeTimeResidualImpl(factor);
 
   popNamespace();
@@ -201,6 +205,7 @@ void SpaceMethod::applyBC()
 
   pushNamespace();
 
+  Common::AllocationScope scope(*this, "::applyBC");
   applyBCImpl();
 
   popNamespace();
@@ -217,6 +222,7 @@ void SpaceMethod::postProcessSolution()
 
   pushNamespace();
 
+  Common::AllocationScope scope(*this, "::postProcessSolution");
   postProcessSolutionImpl();
 
   popNamespace();
@@ -233,6 +239,7 @@ void SpaceMethod::preProcessSolution()
 
   pushNamespace();
   
+  Common::AllocationScope scope(*this, "::preProcessSolution");
   preProcessSolutionImpl();
   
   popNamespace();
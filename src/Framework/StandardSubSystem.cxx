@@ -14,6 +14,8 @@
 #include "Common/NullPointerException.hh"
 #include "Common/EventHandler.hh"
 #include "Common/MemFunArg.hh"
+#include "Common/BigAllocator.hh"
+#include "Common/MemoryAccounting.hh"
 
 #include "Environment/FileHandlerOutput.hh"
 #include "Environment/DirPaths.hh"
@@ -94,6 +96,7 @@ void StandardSubSystem::defineConfigOptions(Config::OptionList& options)
    options.addConfigOption< CFuint >("InitialIter","Initial Iteration Number.");
    options.addConfigOption< CFreal >("InitialTime","Initial Physical Time of the SubSystem.");
    options.addConfigOption< int, Config::DynamicOption<> >("StopSimulation","Flag to force an immediate stop of the simulation.");
+   options.addConfigOption< int, Config::DynamicOption<> >("MemoryReport","Flag to print the memory accounting report at the end of the setup (if set in the case file) or at the next iteration (if set interactively).");
    options.addConfigOption< string >("StopConditionSubSystemStatus","Subsystem status corresponding to the stop condition to apply."); 
 }
 
@@ -162,6 +165,9 @@ StandardSubSystem::StandardSubSystem(const std::string& name)
 
   m_forcedStop = 0;
   setParameter("StopSimulation",&m_forcedStop);
+  
+  m_memoryReport = 0;
+  setParameter("MemoryReport",&m_memoryReport);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -585,6 +591,17 @@ void StandardSubSystem::setup()
   m_recvFlags.resize(nbRanks, 0);
 #endif
   
+#ifdef CF_HAVE_ALLOC_HUGEPAGE
+  // page size and residency of all the socket arrays at the end of the setup
+  CFLog(VERBOSE, Common::MemoryAllocatorHugePage::getStatistics());
+#endif
+  
+  // the report is a collective operation, only done on request
+  if (m_memoryReport) {
+    reportMemory();
+    m_memoryReport = 0;
+  }
+  
   CFLog(NOTICE,"-------------------------------------------------------------\n");
 }
     
@@ -620,6 +637,21 @@ void StandardSubSystem::setCouplerMethod()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void StandardSubSystem::reportMemory()
+{
+  // the connectivity tables are resized after being stored, so they are
+  // measured now, while the socket arrays are tracked by their allocators
+  vector <Common::SafePtr<MeshData> > meshDataVector = 
+    MeshDataStack::getInstance().getAllEntries();
+  for_each (meshDataVector.begin(), meshDataVector.end(), 
+	    safeptr_mem_fun(&MeshData::accountMemory));
+  
+  CFLog(INFO, Common::MemoryAccounting::getInstance().getReport
+	(SubSystemStatusStack::getCurrentName()));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void StandardSubSystem::run()
 {
   CFAUTOTRACE;
@@ -698,6 +730,11 @@ void StandardSubSystem::run()
     runSerial<void, InteractiveParamReader, &InteractiveParamReader::readFile>
       (&*getInteractiveParamReader(), ssGroupName, false);
     
+    if (m_memoryReport) {
+      reportMemory();
+      m_memoryReport = 0;
+    }
+    
     CFLog(VERBOSE, "StandardSubSystem::run() => m_dataPreProcessing.apply()\n");
     // pre-process the data
     m_dataPreProcessing.apply(mem_fun<void,DataProcessingMethod>
@@ -138,6 +138,10 @@ protected: // functions
   
   /// setup all physical models in the different namespaces
   void setupPhysicalModels();
+  
+  /// print the memory held per socket, connectivity and matrix on this rank
+  /// and over all the ranks (collective)
+  void reportMemory();
  
   /// tell if to keep on iterating
   bool iterate(Common::SafePtr<Framework::SubSystemStatus> currSSS);
@@ -209,6 +213,9 @@ protected: // functions
 
   ///flag to force stopping the run()
   int m_forcedStop;
+  
+  /// flag to request a memory report at the end of the setup or at the next iteration
+  int m_memoryReport;
 
 }; // class StandardSubSystem
 
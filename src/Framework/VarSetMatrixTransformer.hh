@@ -89,6 +89,10 @@ public:
   /// Transform a state into another one
   RealVector* transformFromRef(RealVector* const state);
 
+  /// @return true if the transformation is an identity one
+  /// @pre setup() must have been called
+  bool isIdentityTransformation() const {return _isIdentityTransformation;}
+
   /// Gets the Class name
   static std::string getClassName()
   {
@@ -0,0 +1,190 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_MathTools_BlockKernelsT_hh
+#define COOLFluiD_MathTools_BlockKernelsT_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "MathTools/RealMatrix.hh"
+#include "MathTools/RealVector.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MathTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Kernels on the square blocks of size nbEqs x nbEqs (jacobians,
+/// eigenvector matrices, transformation matrices, blocks of the linear
+/// systems) and on the vectors of size nbEqs, which are done for every face,
+/// cell or block row.
+/// With SIZE > 0 the loop bounds are known at compile time, so that the loops
+/// are unrolled. SIZE = 0 gives the kernels for any size, taken from the
+/// arguments. The kernels are static and inlined: the callers select the
+/// instantiation matching the number of equations once, at setup, and run
+/// their whole per-face or per-row computation with it (see RoeFlux and
+/// BlockLSSMatrix), so that no indirect call is made per block.
+/// The RealMatrix/RealVector kernels need results sized by the caller, the
+/// raw kernels work on blocks stored row by row. The results must not alias
+/// the other arguments.
+template < unsigned int SIZE >
+struct BlockKernelsT
+{
+  /// Computes c = a*b
+  static void mult(const RealMatrix& a, const RealMatrix& b, RealMatrix& c)
+  {
+    cf_assert(b.nbRows() == a.nbRows() && b.nbCols() == a.nbRows());
+    cf_assert(c.nbRows() == a.nbRows() && c.nbCols() == a.nbRows());
+    multBlocks(data(a), data(b), c.ptr(), size(a));
+  }
+
+  /// Computes y = a*x
+  static void mult(const RealMatrix& a, const RealVector& x, RealVector& y)
+  {
+    cf_assert(x.size() == a.nbRows() && y.size() == a.nbRows());
+    const CFuint n = size(a);
+    const CFreal *const aa = data(a);
+    for (CFuint i = 0; i < n; ++i) {
+      CFreal sum = 0.;
+      for (CFuint k = 0; k < n; ++k) {
+        sum += aa[i*n+k]*x[k];
+      }
+      y[i] = sum;
+    }
+  }
+
+  /// Computes c = alpha*a + beta*b
+  static void combine(const CFreal alpha, const RealMatrix& a,
+                      const CFreal beta, const RealMatrix& b, RealMatrix& c)
+  {
+    const CFuint n = size(a);
+    cf_assert(b.nbRows() == n && b.nbCols() == n);
+    cf_assert(c.nbRows() == n && c.nbCols() == n);
+    const CFreal *const aa = data(a);
+    const CFreal *const bb = data(b);
+    CFreal *const cc = c.ptr();
+    for (CFuint i = 0; i < n*n; ++i) {
+      cc[i] = alpha*aa[i] + beta*bb[i];
+    }
+  }
+
+  /// Computes y = b*x on raw blocks of size n
+  static void mult(const CFreal *const b, const CFreal *const x,
+                   CFreal *const y, const CFuint n)
+  {
+    const CFuint nn = size(n);
+    for (CFuint i = 0; i < nn; ++i) {
+      const CFreal *const bi = b + i*nn;
+      CFreal sum = 0.;
+      for (CFuint j = 0; j < nn; ++j) {
+        sum += bi[j]*x[j];
+      }
+      y[i] = sum;
+    }
+  }
+
+  /// Computes y += b*x on raw blocks of size n
+  static void multAdd(const CFreal *const b, const CFreal *const x,
+                      CFreal *const y, const CFuint n)
+  {
+    const CFuint nn = size(n);
+    for (CFuint i = 0; i < nn; ++i) {
+      const CFreal *const bi = b + i*nn;
+      CFreal sum = 0.;
+      for (CFuint j = 0; j < nn; ++j) {
+        sum += bi[j]*x[j];
+      }
+      y[i] += sum;
+    }
+  }
+
+  /// Computes y -= b*x on raw blocks of size n
+  static void multSub(const CFreal *const b, const CFreal *const x,
+                      CFreal *const y, const CFuint n)
+  {
+    const CFuint nn = size(n);
+    for (CFuint i = 0; i < nn; ++i) {
+      const CFreal *const bi = b + i*nn;
+      CFreal sum = 0.;
+      for (CFuint j = 0; j < nn; ++j) {
+        sum += bi[j]*x[j];
+      }
+      y[i] -= sum;
+    }
+  }
+
+  /// Computes c = a*b on raw blocks of size n
+  static void multBlocks(const CFreal *const a, const CFreal *const b,
+                         CFreal *const c, const CFuint n)
+  {
+    const CFuint nn = size(n);
+    for (CFuint i = 0; i < nn*nn; ++i) {
+      c[i] = 0.;
+    }
+    multAddBlocks(a, b, c, n, 1.);
+  }
+
+  /// Computes c -= a*b on raw blocks of size n
+  static void multSubBlocks(const CFreal *const a, const CFreal *const b,
+                            CFreal *const c, const CFuint n)
+  {
+    multAddBlocks(a, b, c, n, -1.);
+  }
+
+private:
+
+  /// Computes c += sign*a*b on raw blocks of size n, running the inner
+  /// loop over contiguous rows
+  static void multAddBlocks(const CFreal *const a, const CFreal *const b,
+                            CFreal *const c, const CFuint n, const CFreal sign)
+  {
+    const CFuint nn = size(n);
+    for (CFuint i = 0; i < nn; ++i) {
+      CFreal *const ci = c + i*nn;
+      for (CFuint k = 0; k < nn; ++k) {
+        const CFreal aik = sign*a[i*nn + k];
+        const CFreal *const bk = b + k*nn;
+        for (CFuint j = 0; j < nn; ++j) {
+          ci[j] += aik*bk[j];
+        }
+      }
+    }
+  }
+
+  /// @return the row-wise storage of the given matrix
+  static const CFreal* data(const RealMatrix& a)
+  {
+    return const_cast<RealMatrix&>(a).ptr();
+  }
+
+  /// @return the size of the given square matrix, known at compile time if SIZE > 0
+  static CFuint size(const RealMatrix& a)
+  {
+    cf_assert(a.nbRows() == a.nbCols());
+    return size(a.nbRows());
+  }
+
+  /// @return the block size, known at compile time if SIZE > 0
+  static CFuint size(const CFuint n)
+  {
+    cf_assert(SIZE == 0 || n == SIZE);
+    return (SIZE > 0) ? SIZE : n;
+  }
+
+}; // end of struct BlockKernelsT
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MathTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_MathTools_BlockKernelsT_hh
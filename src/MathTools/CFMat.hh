@@ -322,6 +322,9 @@ MAT0_EASSIGN_OP_CONST(/=)
   // Constructor from preallocated memory
   HHOST_DEV void wrap(size_t ns, size_t ms, T* data) 
   {m_owner = false; m_nrows = ns; m_ncols = ms; m_data = data;}
+  
+  /// Tell if the array allocate its own memory
+  bool isMemoryOwner() const {return m_owner;}
  
   /// return the array size 
   HHOST_DEV size_t size() const {return m_nrows*m_ncols;}